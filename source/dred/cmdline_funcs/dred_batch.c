@@ -0,0 +1,434 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// Command: dred -f batch [Script File] [Options] [Input File Names...]
+//    -j ThreadCount   : Specifies the number of worker threads. Defaults to the number of logical processors
+//    -files ListFile  : Reads additional input file names from a file, one per line
+//    -tab TabSize     : Specifies the size of tabs in spaces. This is used by unindent. Defaults to 4
+//    -dry-run         : Reports which files would be changed without writing them
+//
+// Applies a script of editing commands to each input file without any GUI. The script contains one command per line using
+// the same syntax as the command bar. Blank lines and lines starting with '#' are ignored. The supported commands are:
+//
+//    find "text"                      : Selects the next occurance of text, looping back to the start.
+//    replace "text" "replacement"     : Replaces the next occurance of text.
+//    replace-all "text" "replacement" : Replaces every occurance of text.
+//    select-all                       : Selects the entire file.
+//    goto LineNumber                  : Moves the cursor to the start of the given line and deselects everything.
+//    unindent                         : Unindents the selected lines.
+//    insert-date                      : Inserts the date at the cursor. The date is taken once when the script is read.
+//    insert "text"                    : Inserts text at the cursor.
+//
+// These behave the same as their command bar counterparts. Each file starts with the cursor at the start of the file and
+// nothing selected. Each worker thread has it's own text engine which is reused for every file it processes. Files that are
+// not changed by the script are not written.
+//
+// Implementation: dred_batch
+
+typedef enum
+{
+    dred_batch_command_type_find,
+    dred_batch_command_type_replace,
+    dred_batch_command_type_replace_all,
+    dred_batch_command_type_select_all,
+    dred_batch_command_type_goto,
+    dred_batch_command_type_unindent,
+    dred_batch_command_type_insert_date,
+    dred_batch_command_type_insert
+} dred_batch_command_type;
+
+typedef struct
+{
+    dred_batch_command_type type;
+    char* arg0;
+    char* arg1;
+} dred_batch_command;
+
+typedef struct
+{
+    dred_batch_command* pCommands;      // <-- stb_stretchy_buffer
+    const char** ppFilePaths;           // <-- stb_stretchy_buffer
+    unsigned int tabSizeInSpaces;
+    dtk_bool32 isDryRun;
+
+    dtk_mutex lock;
+    size_t nextFileIndex;
+    size_t changedFileCount;
+    size_t failedFileCount;
+} dred_batch_job;
+
+static dtk_bool32 dred_batch__parse_script(dred_batch_job* pBatch, const char* script)
+{
+    assert(pBatch != NULL);
+    assert(script != NULL);
+
+    unsigned int lineNumber = 0;
+    const char* pLineBeg = script;
+    while (*pLineBeg != '\0') {
+        lineNumber += 1;
+
+        const char* pLineEnd = pLineBeg;
+        while (*pLineEnd != '\0' && *pLineEnd != '\n') {
+            pLineEnd += 1;
+        }
+
+        char line[4096];
+        if ((size_t)(pLineEnd - pLineBeg) >= sizeof(line)) {
+            fprintf(stderr, "Line %u: Line too long. A single line cannot exceed %u characters.\n", lineNumber, (unsigned int)sizeof(line)-1);
+            return DTK_FALSE;
+        }
+        strncpy_s(line, sizeof(line), pLineBeg, (size_t)(pLineEnd - pLineBeg));
+        pLineBeg = (*pLineEnd == '\n') ? pLineEnd + 1 : pLineEnd;
+
+        char name[256];
+        const char* args = dtk_next_token(line, name, sizeof(name));
+        if (args == NULL || name[0] == '#') {
+            continue;   // Blank line or comment.
+        }
+
+        dred_batch_command command;
+        memset(&command, 0, sizeof(command));
+
+        unsigned int argCount = 0;
+        if (strcmp(name, "find") == 0) {
+            command.type = dred_batch_command_type_find;
+            argCount = 1;
+        } else if (strcmp(name, "replace") == 0) {
+            command.type = dred_batch_command_type_replace;
+            argCount = 2;
+        } else if (strcmp(name, "replace-all") == 0) {
+            command.type = dred_batch_command_type_replace_all;
+            argCount = 2;
+        } else if (strcmp(name, "select-all") == 0) {
+            command.type = dred_batch_command_type_select_all;
+        } else if (strcmp(name, "goto") == 0) {
+            command.type = dred_batch_command_type_goto;
+            argCount = 1;
+        } else if (strcmp(name, "unindent") == 0) {
+            command.type = dred_batch_command_type_unindent;
+        } else if (strcmp(name, "insert-date") == 0) {
+            command.type = dred_batch_command_type_insert_date;
+
+            // The date is formatted here rather than by the worker threads because dtk_datetime_short() is not thread-safe on
+            // all platforms. This also means every file gets the same date.
+            char dateStr[256];
+            dtk_datetime_short(dtk_now(), dateStr, sizeof(dateStr));
+            command.arg0 = dtk_make_string(dateStr);
+        } else if (strcmp(name, "insert") == 0) {
+            command.type = dred_batch_command_type_insert;
+            argCount = 1;
+        } else {
+            fprintf(stderr, "Line %u: Unknown command \"%s\".\n", lineNumber, name);
+            return DTK_FALSE;
+        }
+
+        char arg[4096];
+        if (argCount > 0) {
+            args = dtk_next_token(args, arg, sizeof(arg));
+            if (args == NULL) {
+                fprintf(stderr, "Line %u: Missing argument for \"%s\".\n", lineNumber, name);
+                return DTK_FALSE;
+            }
+            command.arg0 = dtk_make_string(arg);
+        }
+        if (argCount > 1) {
+            args = dtk_next_token(args, arg, sizeof(arg));
+            if (args == NULL) {
+                fprintf(stderr, "Line %u: Missing argument for \"%s\".\n", lineNumber, name);
+                dtk_free_string(command.arg0);
+                return DTK_FALSE;
+            }
+            command.arg1 = dtk_make_string(arg);
+        }
+
+        stb_sb_push(pBatch->pCommands, command);
+    }
+
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_batch__run_script(dred_batch_job* pBatch, drte_view* pView)
+{
+    assert(pBatch != NULL);
+    assert(pView != NULL);
+
+    dtk_bool32 wasTextChanged = DTK_FALSE;
+    for (int iCommand = 0; iCommand < stb_sb_count(pBatch->pCommands); ++iCommand) {
+        dred_batch_command* pCommand = &pBatch->pCommands[iCommand];
+        switch (pCommand->type)
+        {
+            case dred_batch_command_type_find:
+            {
+                drte_view_deselect_all(pView);
+                dred_textview__find_and_select_next_in_view(pView, pCommand->arg0);
+            } break;
+
+            case dred_batch_command_type_replace:
+            {
+                wasTextChanged = dred_textview__find_and_replace_next_in_view(pView, pCommand->arg0, pCommand->arg1) || wasTextChanged;
+            } break;
+
+            case dred_batch_command_type_replace_all:
+            {
+                wasTextChanged = dred_textview__find_and_replace_all_in_view(pView, pCommand->arg0, pCommand->arg1) || wasTextChanged;
+            } break;
+
+            case dred_batch_command_type_select_all:
+            {
+                drte_view_select_all(pView);
+                drte_view_move_cursor_to_end_of_text(pView, drte_view_get_last_cursor(pView));
+            } break;
+
+            case dred_batch_command_type_goto:
+            {
+                size_t lineNumber = (size_t)atoi(pCommand->arg0);
+                size_t lineCount = drte_view_get_line_count(pView);
+                size_t iLine = (lineNumber > 0) ? lineNumber-1 : 0;
+                if (iLine >= lineCount) {
+                    iLine = (lineCount > 0) ? lineCount-1 : 0;
+                }
+
+                drte_view_deselect_all(pView);
+                drte_view_move_cursor_to_start_of_line_by_index(pView, drte_view_get_last_cursor(pView), iLine);
+            } break;
+
+            case dred_batch_command_type_unindent:
+            {
+                wasTextChanged = dred_textview__unindent_selected_blocks_in_view(pView) || wasTextChanged;
+            } break;
+
+            case dred_batch_command_type_insert_date:
+            {
+                wasTextChanged = drte_view_insert_text_at_cursors(pView, pCommand->arg0) || wasTextChanged;
+            } break;
+
+            case dred_batch_command_type_insert:
+            {
+                wasTextChanged = drte_view_insert_text_at_cursors(pView, pCommand->arg0) || wasTextChanged;
+            } break;
+
+            default: break;
+        }
+    }
+
+    return wasTextChanged;
+}
+
+static dtk_bool32 dred_batch__save(drte_engine* pEngine, const char* filePath)
+{
+    assert(pEngine != NULL);
+    assert(filePath != NULL);
+
+    // This follows the same process as dred_editor_save() - a copy of the original file is kept until the new contents have been
+    // written so that an error part way through doesn't lose anything.
+    dtk_bool32 haveTempFile = DTK_FALSE;
+    char tempFilePath[DRED_MAX_PATH];
+    if (dtk_path_append_extension(tempFilePath, sizeof(tempFilePath), filePath, "dredtmp")) {
+        if (dtk_copy_file(filePath, tempFilePath, DTK_TRUE) == DTK_SUCCESS) {
+            haveTempFile = DTK_TRUE;
+        }
+    }
+
+    dtk_bool32 wasSaved = DTK_FALSE;
+    dred_file file = dred_file_open(filePath, DRED_FILE_OPEN_MODE_WRITE);
+    if (file != NULL) {
+        wasSaved = dred_text_editor_write_engine_text(pEngine, file);
+        dred_file_close(file);
+    }
+
+    if (haveTempFile && wasSaved) {
+        dtk_delete_file(tempFilePath);
+    }
+
+    return wasSaved;
+}
+
+static dtk_thread_result DTK_THREADCALL dred_batch__worker_thread_proc(void* pData)
+{
+    dred_batch_job* pBatch = (dred_batch_job*)pData;
+    assert(pBatch != NULL);
+
+    // The engine is never attached to any GUI. There are no fonts so measuring is skipped, which doesn't matter because nothing
+    // in the script depends on the position of anything on screen.
+    drte_engine engine;
+    if (!drte_engine_init(&engine, NULL)) {
+        return 0;
+    }
+
+    drte_view* pView = drte_view_create(&engine);
+    if (pView == NULL) {
+        drte_engine_uninit(&engine);
+        return 0;
+    }
+
+    drte_view_set_tab_size(pView, pBatch->tabSizeInSpaces);
+    drte_view_insert_cursor_at_character_and_line(pView, 0, 0);
+
+    for (;;) {
+        dtk_mutex_lock(&pBatch->lock);
+        size_t iFile = pBatch->nextFileIndex;
+        if (iFile < (size_t)stb_sb_count(pBatch->ppFilePaths)) {
+            pBatch->nextFileIndex += 1;
+        }
+        dtk_mutex_unlock(&pBatch->lock);
+
+        if (iFile >= (size_t)stb_sb_count(pBatch->ppFilePaths)) {
+            break;
+        }
+
+        const char* filePath = pBatch->ppFilePaths[iFile];
+
+        dtk_bool32 wasChanged = DTK_FALSE;
+        dtk_bool32 wasSuccessful = DTK_FALSE;
+
+        char* pFileData;
+        if (dtk_open_and_read_text_file(filePath, NULL, &pFileData) == DTK_SUCCESS) {
+            drte_engine_set_text(&engine, pFileData);
+            dtk_free(pFileData);
+
+            drte_view_deselect_all(pView);
+            drte_view_move_cursor_to_start_of_text(pView, drte_view_get_last_cursor(pView));
+
+            wasChanged = dred_batch__run_script(pBatch, pView);
+            wasSuccessful = !wasChanged || pBatch->isDryRun || dred_batch__save(&engine, filePath);
+        }
+
+        dtk_mutex_lock(&pBatch->lock);
+        {
+            if (!wasSuccessful) {
+                pBatch->failedFileCount += 1;
+                fprintf(stderr, "Failed: %s\n", filePath);
+            } else if (wasChanged) {
+                pBatch->changedFileCount += 1;
+                printf("Changed: %s\n", filePath);
+            }
+        }
+        dtk_mutex_unlock(&pBatch->lock);
+    }
+
+    drte_view_delete(pView);
+    drte_engine_uninit(&engine);
+    return 0;
+}
+
+// dred -f batch
+int dred_batch(int argc, char** argv)
+{
+    if (argc <= 1) {
+        return -1;  // No script specified.
+    }
+
+    int result = 0;
+    char* pScript = NULL;
+    char* pFileList = NULL;
+    dtk_thread* pThreads = NULL;
+    dtk_uint32 runningThreadCount = 0;
+    dtk_uint32 threadCount = dtk_get_logical_processor_count();
+
+    dred_batch_job batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.tabSizeInSpaces = 4;
+
+    for (int iarg = 2; iarg < argc; ++iarg) {
+        if (strcmp(argv[iarg], "-dry-run") == 0) {
+            batch.isDryRun = DTK_TRUE;
+        } else if (strcmp(argv[iarg], "-j") == 0 && iarg+1 < argc) {
+            threadCount = (dtk_uint32)atoi(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-tab") == 0 && iarg+1 < argc) {
+            batch.tabSizeInSpaces = (unsigned int)atoi(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-files") == 0 && iarg+1 < argc) {
+            if (pFileList != NULL || dtk_open_and_read_text_file(argv[++iarg], NULL, &pFileList) != DTK_SUCCESS) {
+                result = -2;    // Could not read the file list.
+                goto done;
+            }
+
+            // The list is split in place.
+            char* pLine = pFileList;
+            while (*pLine != '\0') {
+                char* pLineEnd = pLine;
+                while (*pLineEnd != '\0' && *pLineEnd != '\n') {
+                    pLineEnd += 1;
+                }
+
+                char* pNextLine = (*pLineEnd == '\n') ? pLineEnd + 1 : pLineEnd;
+                if (pLineEnd > pLine && pLineEnd[-1] == '\r') {
+                    pLineEnd -= 1;
+                }
+                *pLineEnd = '\0';
+
+                if (pLine[0] != '\0') {
+                    stb_sb_push(batch.ppFilePaths, pLine);
+                }
+
+                pLine = pNextLine;
+            }
+        } else {
+            stb_sb_push(batch.ppFilePaths, argv[iarg]);
+        }
+    }
+
+    if (batch.tabSizeInSpaces == 0) {
+        batch.tabSizeInSpaces = 4;
+    }
+
+    if (dtk_open_and_read_text_file(argv[1], NULL, &pScript) != DTK_SUCCESS) {
+        result = -2;    // Could not read the script.
+        goto done;
+    }
+
+    if (!dred_batch__parse_script(&batch, pScript)) {
+        result = -3;    // Invalid script.
+        goto done;
+    }
+
+    if (stb_sb_count(batch.ppFilePaths) == 0) {
+        goto done;      // Nothing to do.
+    }
+
+    if (dtk_mutex_init(&batch.lock) != DTK_SUCCESS) {
+        result = -4;
+        goto done;
+    }
+
+    threadCount = dtk_clamp(threadCount, 1, (dtk_uint32)stb_sb_count(batch.ppFilePaths));
+
+    pThreads = (dtk_thread*)malloc(threadCount * sizeof(*pThreads));
+    if (pThreads == NULL) {
+        dtk_mutex_uninit(&batch.lock);
+        result = -4;
+        goto done;
+    }
+
+    for (dtk_uint32 iThread = 0; iThread < threadCount; ++iThread) {
+        if (dtk_thread_create(&pThreads[runningThreadCount], dred_batch__worker_thread_proc, &batch) == DTK_SUCCESS) {
+            runningThreadCount += 1;
+        }
+    }
+
+    // If no threads could be created just do everything on this one.
+    if (runningThreadCount == 0) {
+        dred_batch__worker_thread_proc(&batch);
+    }
+
+    for (dtk_uint32 iThread = 0; iThread < runningThreadCount; ++iThread) {
+        dtk_thread_wait(&pThreads[iThread]);
+    }
+
+    free(pThreads);
+    dtk_mutex_uninit(&batch.lock);
+
+    printf("%u of %u files changed.\n", (unsigned int)batch.changedFileCount, (unsigned int)stb_sb_count(batch.ppFilePaths));
+    if (batch.failedFileCount > 0) {
+        result = -5;    // One or more files failed.
+    }
+
+done:
+    for (int iCommand = 0; iCommand < stb_sb_count(batch.pCommands); ++iCommand) {
+        dtk_free_string(batch.pCommands[iCommand].arg0);
+        dtk_free_string(batch.pCommands[iCommand].arg1);
+    }
+    stb_sb_free(batch.pCommands);
+    stb_sb_free(batch.ppFilePaths);
+    dtk_free(pFileList);
+    dtk_free(pScript);
+    return result;
+}
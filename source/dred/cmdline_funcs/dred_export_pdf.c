@@ -0,0 +1,69 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// Command: dred -f export-pdf [Input File Name] [Output File Name] [Options]
+//    -font FontFamily : Specifies the font family. Should be monospaced. Defaults to "monospace"
+//    -size FontSize   : Specifies the font size in points. Defaults to 9
+//    -tab TabSize     : Specifies the size of tabs in spaces. Defaults to 4
+//    -title Title     : Specifies the title shown at the bottom of each page. Defaults to the name of the input file
+//    -line-numbers    : Shows line numbers
+//
+// If no output file is specified, ".pdf" is appended to the input file name. This does not require a display.
+//
+// Implementation: dred_export_pdf_cmdline_func
+
+// dred -f export-pdf
+int dred_export_pdf_cmdline_func(int argc, char** argv)
+{
+    if (argc <= 1) {
+        return -1;  // No file specified.
+    }
+
+    const char* inputFilePath = argv[1];
+    const char* outputFilePath = NULL;
+
+    dred_pdf_export_config config = dred_pdf_export_config_init();
+    config.title = dtk_path_file_name(inputFilePath);
+
+    int iarg = 2;
+    if (argc > 2 && argv[2][0] != '-') {
+        outputFilePath = argv[2];
+        iarg = 3;
+    }
+
+    for (; iarg < argc; ++iarg) {
+        if (strcmp(argv[iarg], "-line-numbers") == 0) {
+            config.showLineNumbers = DTK_TRUE;
+            continue;
+        }
+
+        if (iarg+1 == argc) {
+            return -2;  // Missing option value.
+        }
+
+        if (strcmp(argv[iarg], "-font") == 0) {
+            config.fontFamily = argv[++iarg];
+        } else if (strcmp(argv[iarg], "-size") == 0) {
+            config.fontSize = atof(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-tab") == 0) {
+            config.tabSizeInSpaces = (unsigned int)atoi(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-title") == 0) {
+            config.title = argv[++iarg];
+        } else {
+            return -2;  // Unknown option.
+        }
+    }
+
+    char outputFilePathBuffer[DRED_MAX_PATH];
+    if (outputFilePath == NULL) {
+        if (dtk_path_append_extension(outputFilePathBuffer, sizeof(outputFilePathBuffer), inputFilePath, "pdf") == 0) {
+            return -3;
+        }
+        outputFilePath = outputFilePathBuffer;
+    }
+
+    if (dred_export_file_to_pdf(inputFilePath, outputFilePath, &config, NULL) != DRED_SUCCESS) {
+        return -4;  // Failed to export.
+    }
+
+    return 0;
+}
@@ -10,11 +10,13 @@ typedef struct
 
 static dred_cmdline_func_mapping g_BuiltInCmdLineFuncs[] = {
     {"file2chex",    dred_file2chex},
-    {"file2cstring", dred_file2cstring}
+    {"file2cstring", dred_file2cstring},
+    {"export-pdf",   dred_export_pdf_cmdline_func},
+    {"batch",        dred_batch}
 };
 
 
-int dred_main_f_exec(int argc, char** argv)
+int dred_main_f_exec(int argc, char** argv, dred_package_library* pPackageLibrary)
 {
     // The first argument should be the name of the function. If it's a built-in function we just
     // handle it directly. Otherwise we need to check extensions.
@@ -30,13 +32,20 @@ int dred_main_f_exec(int argc, char** argv)
     }
 
 
-    // If we get here it means the function is not built in and we need to check extensions.
-    //
-    // TODO: Implement extensions.
+    // If we get here it means the function is not built in and we need to check packages. Only the package that declares the
+    // function in its manifest is loaded.
+    dred_package* pPackage = dred_package_library_load_package_for_cmdline_func(pPackageLibrary, funcName);
+    if (pPackage != NULL && (pPackage->featureFlags & DRED_PACKAGE_FEATURE_CMDLINE_FUNCTION) != 0 && pPackage->cbs.cmdlinefunc.onTryExecCmdLineFunc != NULL) {
+        int result;
+        if (pPackage->cbs.cmdlinefunc.onTryExecCmdLineFunc(pPackage, argc, argv, &result)) {
+            return result;
+        }
+    }
+
     return -4;
 }
 
-int dred_main_f(int argc, char** argv)
+int dred_main_f(int argc, char** argv, dred_package_library* pPackageLibrary)
 {
     // This function will be called when the -f command line option is specified. This option is used
     // for executing a command-line function.
@@ -58,5 +67,5 @@ int dred_main_f(int argc, char** argv)
         return -3;  // Couldn't find the "-f" argument.
     }
 
-    return dred_main_f_exec(argc - f_index, argv + f_index);
+    return dred_main_f_exec(argc - f_index, argv + f_index, pPackageLibrary);
 }
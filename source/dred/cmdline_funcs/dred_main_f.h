@@ -1,5 +1,6 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
-// Executes a command line function.
-int dred_main_f_exec(int argc, char** argv);
+// Executes a command line function. Functions that are not built in are looked up in the package library, which will load the
+// package that declares the function if it's not already loaded. <pPackageLibrary> can be null.
+int dred_main_f_exec(int argc, char** argv, dred_package_library* pPackageLibrary);
 
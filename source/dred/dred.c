@@ -11,9 +11,12 @@
 // dred source files.
 #include "dtk/dtk.c"
 #include "dred_autogenerated.c"
+#include "dred_hash_index.c"
 #include "dred_string_pool.c"
+#include "dred_fuzzy.c"
 #include "dred_ipc.c"
 #include "dred_dl.c"
+#include "dred_profiler.c"
 #include "gui/dred_gui.c"
 #include "gui/dred_color_button.c"
 #include "gui/dred_checkbox.c"
@@ -25,12 +28,19 @@
 #include "dred_cmdbox_cmdlist.c"
 #include "dred_cmdbox.c"
 #include "dred_fs.c"
+#include "dred_logger.c"
 #include "dred_alias_map.c"
 #include "dred_config.c"
+#include "dred_config_cache.c"
 #include "dred_shortcuts.c"
 #include "dred_editor.c"
 #include "dred_settings_editor.c"
 #include "dred_text_editor.c"
+#include "dred_large_file_viewer.c"
+#include "dred_hex_editor.c"
+#include "dred_find_in_files.c"
+#include "dred_file_index.c"
+#include "dred_session.c"
 #include "dred_font.c"
 #include "dred_font_library.c"
 #include "dred_image.c"
@@ -38,6 +48,7 @@
 #include "dred_menus.c"
 #include "dred_about_dialog.c"
 #include "dred_settings_dialog.c"
+#include "dred_perf_hud.c"
 #include "dred_printing.c"
 #include "dred_context.c"
 #include "dred_platform_layer.c"
@@ -49,4 +60,6 @@
 #include "dred_package_library.c"
 #include "cmdline_funcs/dred_file2chex.c"
 #include "cmdline_funcs/dred_file2cstring.c"
+#include "cmdline_funcs/dred_export_pdf.c"
+#include "cmdline_funcs/dred_batch.c"
 #include "cmdline_funcs/dred_main_f.c"
\ No newline at end of file
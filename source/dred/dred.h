@@ -21,7 +21,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <limits.h>
 #include <assert.h>
+#include <signal.h>
 
 // Platform headers.
 #ifdef _WIN32
@@ -30,14 +32,28 @@
 #include <sys/file.h>
 #include <gdk/gdk.h>
 #include <gtk/gtk.h>
+#include <cairo-pdf.h>
 #include <gdk/gdkkeysyms.h>
 #include <glib-object.h>
 #include <fontconfig/fontconfig.h>
 #include <semaphore.h>
 #include <pthread.h>
 #include <dlfcn.h>
+#include <regex.h>
 #endif
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#endif
+
+
+// Performance counter hooks for dtk and the text engine. These are no-ops unless they're defined before the library is
+// included. See dred_profiler.h.
+#define DTK_PERF_BEGIN()                    dred_perf_begin()
+#define DTK_PERF_END(counter, begTime)      dred_perf_end(DRED_PERF_COUNTER_##counter, begTime)
+#define DRTE_PERF_BEGIN()                   dred_perf_begin()
+#define DRTE_PERF_END(counter, begTime)     dred_perf_end(DRED_PERF_COUNTER_##counter, begTime)
 
 // External libraries.
 #include "../external/dr_text_engine.h"
@@ -88,9 +104,12 @@ extern "C" {
 #include "dred_build_config.h"
 #include "dred_types.h"
 #include "dred_events.h"
+#include "dred_hash_index.h"
 #include "dred_string_pool.h"
+#include "dred_fuzzy.h"
 #include "dred_ipc.h"
 #include "dred_dl.h"
+#include "dred_profiler.h"
 #include "gui/dred_gui.h"
 #include "gui/dred_color_button.h"
 #include "gui/dred_checkbox.h"
@@ -102,12 +121,19 @@ extern "C" {
 #include "dred_cmdbox.h"
 #include "gui/dred_cmdbar_popup.h"
 #include "dred_fs.h"
+#include "dred_logger.h"
 #include "dred_alias_map.h"
 #include "dred_config.h"
+#include "dred_config_cache.h"
 #include "dred_shortcuts.h"
 #include "dred_editor.h"
 #include "dred_settings_editor.h"
 #include "dred_text_editor.h"
+#include "dred_large_file_viewer.h"
+#include "dred_hex_editor.h"
+#include "dred_find_in_files.h"
+#include "dred_file_index.h"
+#include "dred_session.h"
 #include "dred_font.h"
 #include "dred_font_library.h"
 #include "dred_image.h"
@@ -115,6 +141,7 @@ extern "C" {
 #include "dred_menus.h"
 #include "dred_about_dialog.h"
 #include "dred_settings_dialog.h"
+#include "dred_perf_hud.h"
 #include "dred_printing.h"
 #include "dred_context.h"
 #include "dred_platform_layer.h"
@@ -7,7 +7,7 @@ dtk_bool32 dred_alias_map_init(dred_alias_map* pMap)
     }
 
     memset(pMap, 0, sizeof(*pMap));
-    return DTK_TRUE;
+    return dred_hash_index_init(&pMap->index);
 }
 
 void dred_alias_map_uninit(dred_alias_map* pMap)
@@ -23,16 +23,27 @@ void dred_alias_map_uninit(dred_alias_map* pMap)
 
     free(pMap->keys);
     free(pMap->values);
+    dred_hash_index_uninit(&pMap->index);
 }
 
 void dred_alias_map_add(dred_alias_map* pMap, const char* key, const char* value)
 {
-    if (pMap == NULL) {
+    if (pMap == NULL || key == NULL) {
+        return;
+    }
+
+    // If the alias already exists just replace the value.
+    size_t existingIndex;
+    if (dred_alias_map_find(pMap, key, &existingIndex)) {
+        char* newValue = dtk_make_string(value);
+        if (newValue == NULL) {
+            return;
+        }
+
+        dtk_free_string(pMap->values[existingIndex]);
+        pMap->values[existingIndex] = newValue;
         return;
     }
-    
-    // Remove the existing alias first.
-    dred_alias_map_remove(pMap, key);
 
 
     if (pMap->count == pMap->bufferSize) {
@@ -55,6 +66,10 @@ void dred_alias_map_add(dred_alias_map* pMap, const char* key, const char* value
 
     assert(pMap->count < pMap->bufferSize);
 
+    if (!dred_hash_index_insert(&pMap->index, dtk_hash_string(key, 0), (dtk_uint32)pMap->count)) {
+        return;
+    }
+
     pMap->keys[pMap->count] = dtk_make_string(key);
     pMap->values[pMap->count] = dtk_make_string(value);
     pMap->count += 1;
@@ -87,6 +102,12 @@ void dred_alias_map_remove_by_index(dred_alias_map* pMap, size_t index)
     }
 
     pMap->count -= 1;
+
+    // Every item after the removed one has moved so the index needs to be rebuilt.
+    dred_hash_index_clear(&pMap->index);
+    for (size_t i = 0; i < pMap->count; ++i) {
+        dred_hash_index_insert(&pMap->index, dtk_hash_string(pMap->keys[i], 0), (dtk_uint32)i);
+    }
 }
 
 
@@ -116,10 +137,11 @@ dtk_bool32 dred_alias_map_find(dred_alias_map* pMap, const char* key, size_t* pI
         return DTK_FALSE;
     }
 
-    // Linear for now.
-    for (size_t i = 0; i < pMap->count; ++i) {
-        if (strcmp(pMap->keys[i], key) == 0) {
-            if (pIndexOut) *pIndexOut = i;
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pMap->index, dtk_hash_string(key, 0), &iterator, &index); found; found = dred_hash_index_find_next(&pMap->index, &iterator, &index)) {
+        if (strcmp(pMap->keys[index], key) == 0) {
+            if (pIndexOut) *pIndexOut = index;
             return DTK_TRUE;
         }
     }
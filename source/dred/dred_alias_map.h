@@ -1,18 +1,24 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+// Items are stored in the order in which they were added which is the order they're saved in. Lookups by key go through a
+// hash index.
+
 typedef struct
 {
     size_t count;
     size_t bufferSize;
     char** keys;
     char** values;
+    dred_hash_index index;  // Maps the hash of a key to its index in keys/values.
 } dred_alias_map;
 
 dtk_bool32 dred_alias_map_init(dred_alias_map* pMap);
 void dred_alias_map_uninit(dred_alias_map* pMap);
 
+// Adds an alias. If the key already exists its value is replaced and it keeps its position.
 void dred_alias_map_add(dred_alias_map* pMap, const char* key, const char* value);
 
+// Removing an item runs in linear time because the items after it are shifted down to keep the order.
 void dred_alias_map_remove(dred_alias_map* pMap, const char* key);
 void dred_alias_map_remove_by_index(dred_alias_map* pMap, size_t index);
 
@@ -4,7 +4,7 @@
 
 
 // Commands
-#define DRED_COMMAND_COUNT 58
+#define DRED_COMMAND_COUNT 64
 
 const char g_CommandNamePool[] = 
     "!\0"
@@ -38,7 +38,11 @@ const char g_CommandNamePool[] =
     "help\0"
     "about\0"
     "settings\0"
+    "toggle-perf-hud\0"
+    "perf-dump\0"
+    "perf-counters\0"
     "print\0"
+    "export-pdf\0"
     "reload\0"
     "undo\0"
     "redo\0"
@@ -51,6 +55,8 @@ const char g_CommandNamePool[] =
     "find\0"
     "replace\0"
     "replace-all\0"
+    "find-in-files\0"
+    "index-files\0"
     "show-line-numbers\0"
     "hide-line-numbers\0"
     "toggle-line-numbers\0"
@@ -99,32 +105,38 @@ const char* g_CommandNames[] = {
     g_CommandNamePool + 285,
     g_CommandNamePool + 291,
     g_CommandNamePool + 300,
-    g_CommandNamePool + 306,
-    g_CommandNamePool + 313,
-    g_CommandNamePool + 318,
-    g_CommandNamePool + 323,
-    g_CommandNamePool + 327,
-    g_CommandNamePool + 332,
-    g_CommandNamePool + 338,
-    g_CommandNamePool + 345,
-    g_CommandNamePool + 356,
-    g_CommandNamePool + 361,
-    g_CommandNamePool + 366,
+    g_CommandNamePool + 316,
+    g_CommandNamePool + 326,
+    g_CommandNamePool + 340,
+    g_CommandNamePool + 346,
+    g_CommandNamePool + 357,
+    g_CommandNamePool + 364,
+    g_CommandNamePool + 369,
     g_CommandNamePool + 374,
-    g_CommandNamePool + 386,
-    g_CommandNamePool + 404,
-    g_CommandNamePool + 422,
-    g_CommandNamePool + 442,
-    g_CommandNamePool + 459,
-    g_CommandNamePool + 464,
-    g_CommandNamePool + 473,
-    g_CommandNamePool + 485,
-    g_CommandNamePool + 500,
+    g_CommandNamePool + 378,
+    g_CommandNamePool + 383,
+    g_CommandNamePool + 389,
+    g_CommandNamePool + 396,
+    g_CommandNamePool + 407,
+    g_CommandNamePool + 412,
+    g_CommandNamePool + 417,
+    g_CommandNamePool + 425,
+    g_CommandNamePool + 437,
+    g_CommandNamePool + 451,
+    g_CommandNamePool + 463,
+    g_CommandNamePool + 481,
+    g_CommandNamePool + 499,
     g_CommandNamePool + 519,
-    g_CommandNamePool + 533,
+    g_CommandNamePool + 536,
+    g_CommandNamePool + 541,
     g_CommandNamePool + 550,
-    g_CommandNamePool + 572,
-    g_CommandNamePool + 597,
+    g_CommandNamePool + 562,
+    g_CommandNamePool + 577,
+    g_CommandNamePool + 596,
+    g_CommandNamePool + 610,
+    g_CommandNamePool + 627,
+    g_CommandNamePool + 649,
+    g_CommandNamePool + 674,
 };
 
 dred_command g_Commands[] = {
@@ -159,7 +171,11 @@ dred_command g_Commands[] = {
     {dred_command__help, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__about, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__settings, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__toggle_perf_hud, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__perf_dump, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__perf_counters, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__print, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__export_pdf, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__reload, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__undo, DRED_CMDBAR_NO_CLEAR},
     {dred_command__redo, DRED_CMDBAR_NO_CLEAR},
@@ -172,6 +188,8 @@ dred_command g_Commands[] = {
     {dred_command__find, DRED_CMDBAR_NO_CLEAR},
     {dred_command__replace, DRED_CMDBAR_NO_CLEAR},
     {dred_command__replace_all, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__find_in_files, DRED_CMDBAR_RELEASE_KEYBOARD},
+    {dred_command__index_files, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__show_line_numbers, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__hide_line_numbers, DRED_CMDBAR_RELEASE_KEYBOARD},
     {dred_command__toggle_line_numbers, DRED_CMDBAR_RELEASE_KEYBOARD},
@@ -188,6 +206,22 @@ dred_command g_Commands[] = {
     {dred_command__cmdbar_replace_all_prefilled, DRED_CMDBAR_RELEASE_KEYBOARD},
 };
 
+#define DRED_COMMAND_HASH_TABLE_SIZE 64
+
+const dtk_uint32 g_CommandHashSeeds[DRED_COMMAND_HASH_TABLE_SIZE] = {
+    1, 0, 1, 0, 0, 1, 2, 6, 0, 1, 2, 4, 0, 2, 2, 0,
+    4, 2, 0, 0, 0, 0, 0, 1, 2, 0, 0, 3, 1, 0, 1, 1,
+    8, 1, 0, 14, 0, 0, 0, 2, 5, 0, 7, 0, 1, 1, 7, 4,
+    0, 0, 11, 6, 8, 16, 0, 7, 5, 43, 0, 0, 8, 12, 52, 0
+};
+
+const dtk_uint16 g_CommandHashIndices[DRED_COMMAND_HASH_TABLE_SIZE] = {
+    0x0029, 0x003A, 0x0023, 0x002F, 0x0000, 0x003B, 0x001B, 0x0018, 0x0038, 0x0039, 0x003D, 0x003E, 0x000E, 0x0014, 0x0013, 0x001F,
+    0x0007, 0x0031, 0x0022, 0x0017, 0x002E, 0x0004, 0x0020, 0x0028, 0x002D, 0x0010, 0x001E, 0x002C, 0x0005, 0x0026, 0x0037, 0x0003,
+    0x0033, 0x000D, 0x0035, 0x0025, 0x001A, 0x0008, 0x0034, 0x0006, 0x0024, 0x002A, 0x0015, 0x003C, 0x0001, 0x0019, 0x0009, 0x0016,
+    0x0027, 0x002B, 0x003F, 0x0011, 0x0021, 0x000C, 0x0030, 0x001C, 0x0036, 0x000B, 0x000A, 0x0032, 0x0012, 0x000F, 0x001D, 0x0002
+};
+
 
 // Stock Images
 #define DRED_STOCK_IMAGE_COUNT_SVG    2
@@ -399,6 +433,9 @@ void dred_config_init_variables__autogenerated(dred_config* pConfig)
     pConfig->showMenuBar = true;
     pConfig->autoHideCmdBar = false;
     pConfig->enableAutoReload = true;
+    pConfig->restoreSession = true;
+    pConfig->enableFileIndex = true;
+    pConfig->logLevel = 3;
     pConfig->useDefaultWindowPos = true;
     pConfig->windowPosX = 0;
     pConfig->windowPosY = 0;
@@ -458,6 +495,7 @@ void dred_config_init_variables__autogenerated(dred_config* pConfig)
     pConfig->textEditorEnableAutoIndent = true;
     pConfig->textEditorEnableWordWrap = true;
     pConfig->textEditorEnableDragAndDrop = false;
+    pConfig->textEditorCursorBlinkTimeout = 15000;
     pConfig->cppCommentTextColor = dred_rgba(64, 192, 92, 255);
     pConfig->cppStringTextColor = dred_rgba(192, 92, 64, 255);
     pConfig->cppKeywordTextColor = dred_rgba(64, 160, 255, 255);
@@ -495,6 +533,15 @@ void dred_config_write_to_file__autogenerated(dred_config* pConfig, dred_file fi
     snprintf(tempbuf, sizeof(tempbuf), "enable-auto-reload %s\n", pConfig->enableAutoReload ? "true" : "false");
     dred_file_write_string(file, tempbuf);
 
+    snprintf(tempbuf, sizeof(tempbuf), "restore-session %s\n", pConfig->restoreSession ? "true" : "false");
+    dred_file_write_string(file, tempbuf);
+
+    snprintf(tempbuf, sizeof(tempbuf), "enable-file-index %s\n", pConfig->enableFileIndex ? "true" : "false");
+    dred_file_write_string(file, tempbuf);
+
+    snprintf(tempbuf, sizeof(tempbuf), "log-level %d\n", pConfig->logLevel);
+    dred_file_write_string(file, tempbuf);
+
     snprintf(tempbuf, sizeof(tempbuf), "use-default-window-pos %s\n", pConfig->useDefaultWindowPos ? "true" : "false");
     dred_file_write_string(file, tempbuf);
 
@@ -677,6 +724,9 @@ void dred_config_write_to_file__autogenerated(dred_config* pConfig, dred_file fi
     snprintf(tempbuf, sizeof(tempbuf), "texteditor-enable-drag-and-drop %s\n", pConfig->textEditorEnableDragAndDrop ? "true" : "false");
     dred_file_write_string(file, tempbuf);
 
+    snprintf(tempbuf, sizeof(tempbuf), "texteditor-cursor-blink-timeout %d\n", pConfig->textEditorCursorBlinkTimeout);
+    dred_file_write_string(file, tempbuf);
+
     snprintf(tempbuf, sizeof(tempbuf), "cpp-comment-text-color %d %d %d %d\n", pConfig->cppCommentTextColor.r, pConfig->cppCommentTextColor.g, pConfig->cppCommentTextColor.b, pConfig->cppCommentTextColor.a);
     dred_file_write_string(file, tempbuf);
 
@@ -689,664 +739,963 @@ void dred_config_write_to_file__autogenerated(dred_config* pConfig, dred_file fi
 }
 
 
+#define DRED_CONFIG_VAR_COUNT 70
+
+const char* const g_ConfigVarNames[DRED_CONFIG_VAR_COUNT] = {
+    "show-tab-bar",
+    "show-menu-bar",
+    "auto-hide-cmd-bar",
+    "enable-auto-reload",
+    "restore-session",
+    "enable-file-index",
+    "log-level",
+    "use-default-window-pos",
+    "window-pos-x",
+    "window-pos-y",
+    "window-width",
+    "window-height",
+    "window-maximized",
+    "ui-scale",
+    "ui-font",
+    "cmdbar-bg-color",
+    "cmdbar-bg-color-active",
+    "cmdbar-tb-font",
+    "cmdbar-text-color",
+    "cmdbar-text-color-active",
+    "cmdbar-padding-horz",
+    "cmdbar-padding-vert",
+    "cmdbar-popup-bg-color",
+    "cmdbar-popup-font",
+    "cmdbar-popup-border-width",
+    "cmdbar-popup-padding",
+    "tabgroup-bg-color",
+    "tab-bg-color-inactive",
+    "tab-bg-color-active",
+    "tab-bg-color-hovered",
+    "tab-font",
+    "tab-text-color",
+    "tab-text-color-active",
+    "tab-text-color-hovered",
+    "tab-padding",
+    "tab-show-close-button",
+    "tab-close-button-color",
+    "tab-close-button-color-tab-hovered",
+    "tab-close-button-color-tab-active",
+    "tab-close-button-color-hovered",
+    "tab-close-button-color-pressed",
+    "texteditor-font",
+    "texteditor-text-color",
+    "texteditor-bg-color",
+    "texteditor-cursor-color",
+    "texteditor-cursor-width",
+    "texteditor-selection-bg-color",
+    "texteditor-active-line-color",
+    "texteditor-show-line-numbers",
+    "texteditor-line-numbers-color",
+    "texteditor-line-numbers-bg-color",
+    "texteditor-line-numbers-padding",
+    "texteditor-sb-track-color",
+    "texteditor-sb-thumb-color",
+    "texteditor-sb-thumb-color-hovered",
+    "texteditor-sb-thumb-color-pressed",
+    "texteditor-sb-size",
+    "texteditor-show-scrollbar-horz",
+    "texteditor-show-scrollbar-vert",
+    "texteditor-enable-excess-scrolling",
+    "texteditor-enable-tabs-to-spaces",
+    "texteditor-tab-size-in-spaces",
+    "texteditor-scale",
+    "texteditor-enable-auto-indent",
+    "texteditor-enable-word-wrap",
+    "texteditor-enable-drag-and-drop",
+    "texteditor-cursor-blink-timeout",
+    "cpp-comment-text-color",
+    "cpp-string-text-color",
+    "cpp-keyword-text-color",
+};
 
-void dred_config_set__autogenerated(dred_config* pConfig, const char* key, const char* value)
+#define DRED_CONFIG_VAR_HASH_TABLE_SIZE 128
+
+const dtk_uint32 g_ConfigVarHashSeeds[DRED_CONFIG_VAR_HASH_TABLE_SIZE] = {
+    0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 2, 0, 0, 2, 1,
+    0, 0, 1, 0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2,
+    0, 2, 2, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 6,
+    0, 0, 0, 3, 1, 1, 4, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 1, 4, 1, 0, 2, 0, 2, 4, 1, 0, 0,
+    0, 0, 0, 4, 2, 0, 0, 1, 0, 0, 0, 0, 0, 7, 2, 0,
+    0, 1, 1, 0, 0, 0, 0, 2, 0, 4, 0, 1, 2, 1, 0, 0
+};
+
+const dtk_uint16 g_ConfigVarHashIndices[DRED_CONFIG_VAR_HASH_TABLE_SIZE] = {
+    0xFFFF, 0x0018, 0x0002, 0x0015, 0x0037, 0xFFFF, 0x001F, 0xFFFF, 0x003D, 0xFFFF, 0xFFFF, 0x0000, 0x002D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0001, 0xFFFF, 0xFFFF, 0x0022, 0x0036, 0xFFFF, 0x003A, 0xFFFF, 0xFFFF, 0x001B, 0xFFFF, 0x001A, 0xFFFF, 0x000B, 0x0014, 0xFFFF,
+    0x0021, 0x0029, 0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0041, 0xFFFF, 0x0040, 0x0004, 0xFFFF, 0xFFFF, 0x0038, 0x0032,
+    0x0030, 0xFFFF, 0xFFFF, 0xFFFF, 0x0025, 0x0034, 0x000F, 0x000E, 0xFFFF, 0x0024, 0x001D, 0xFFFF, 0xFFFF, 0x003E, 0xFFFF, 0x002E,
+    0x0003, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0033, 0xFFFF, 0xFFFF, 0x000C, 0xFFFF, 0x0019, 0x0028, 0x0009, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x0006, 0x002C, 0xFFFF, 0x0042, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0005, 0x001E, 0x0008, 0x0027, 0x0031, 0x0017,
+    0x0011, 0x002F, 0x0013, 0xFFFF, 0x003C, 0xFFFF, 0x0043, 0x0039, 0xFFFF, 0xFFFF, 0xFFFF, 0x000A, 0x0010, 0x0007, 0x001C, 0xFFFF,
+    0x0012, 0x0045, 0x0016, 0x003F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0020, 0x0026, 0xFFFF, 0x002B, 0x0035, 0x002A, 0x003B, 0x0023, 0x0044
+};
+
+dtk_uint32 dred_config_find_variable_index__autogenerated(const char* key)
 {
-    if (strcmp(key, "show-tab-bar") == 0) {
-        pConfig->showTabBar = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__show_tab_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "show-menu-bar") == 0) {
-        pConfig->showMenuBar = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__show_menu_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "auto-hide-cmd-bar") == 0) {
-        pConfig->autoHideCmdBar = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__auto_hide_cmd_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "enable-auto-reload") == 0) {
-        pConfig->enableAutoReload = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__enable_auto_reload(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "use-default-window-pos") == 0) {
-        pConfig->useDefaultWindowPos = dred_parse_bool(value);
-        return;
-    }
-    if (strcmp(key, "window-pos-x") == 0) {
-        pConfig->windowPosX = atoi(value);
-        return;
-    }
-    if (strcmp(key, "window-pos-y") == 0) {
-        pConfig->windowPosY = atoi(value);
-        return;
-    }
-    if (strcmp(key, "window-width") == 0) {
-        pConfig->windowWidth = atoi(value);
-        return;
-    }
-    if (strcmp(key, "window-height") == 0) {
-        pConfig->windowHeight = atoi(value);
-        return;
-    }
-    if (strcmp(key, "window-maximized") == 0) {
-        pConfig->windowMaximized = dred_parse_bool(value);
-        return;
-    }
-    if (strcmp(key, "ui-scale") == 0) {
-        pConfig->uiScale = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__ui_scale(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "ui-font") == 0) {
-        pConfig->pUIFont = dred_parse_and_load_font(pConfig->pDred, value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__ui_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-bg-color") == 0) {
-        pConfig->cmdbarBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-bg-color-active") == 0) {
-        pConfig->cmdbarBGColorActive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-tb-font") == 0) {
-        pConfig->pCmdbarTBFont = dred_parse_and_load_font(pConfig->pDred, value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_tb_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-text-color") == 0) {
-        pConfig->cmdbarTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-text-color-active") == 0) {
-        pConfig->cmdbarTextColorActive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-padding-horz") == 0) {
-        pConfig->cmdbarPaddingX = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_horz(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-padding-vert") == 0) {
-        pConfig->cmdbarPaddingY = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_vert(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-bg-color") == 0) {
-        pConfig->cmdbarPopupBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_bg_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-font") == 0) {
-        pConfig->cmdbarPopupFont = dred_parse_and_load_font(pConfig->pDred, value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-border-width") == 0) {
-        pConfig->cmdbarPopupBorderWidth = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_border_width(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-padding") == 0) {
-        pConfig->cmdbarPopupPadding = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_padding(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tabgroup-bg-color") == 0) {
-        pConfig->tabgroupBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-inactive") == 0) {
-        pConfig->tabBGColorInvactive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-active") == 0) {
-        pConfig->tabBGColorActive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-hovered") == 0) {
-        pConfig->tabBGColorHovered = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-font") == 0) {
-        pConfig->tabFont = dred_parse_and_load_font(pConfig->pDred, value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color") == 0) {
-        pConfig->tabTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color-active") == 0) {
-        pConfig->tabTextColorActive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color-hovered") == 0) {
-        pConfig->tabTextColorHovered = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-padding") == 0) {
-        pConfig->tabPadding = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-show-close-button") == 0) {
-        pConfig->tabShowCloseButton = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color") == 0) {
-        pConfig->tabCloseButtonColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-tab-hovered") == 0) {
-        pConfig->tabCloseButtonColorTabHovered = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-tab-active") == 0) {
-        pConfig->tabCloseButtonColorTabActive = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-hovered") == 0) {
-        pConfig->tabCloseButtonColorHovered = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-pressed") == 0) {
-        pConfig->tabCloseButtonColorPressed = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-font") == 0) {
-        pConfig->pTextEditorFont = dred_parse_and_load_font(pConfig->pDred, value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-text-color") == 0) {
-        pConfig->textEditorTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-bg-color") == 0) {
-        pConfig->textEditorBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-cursor-color") == 0) {
-        pConfig->textEditorCursorColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-cursor-width") == 0) {
-        pConfig->textEditorCursorWidth = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-selection-bg-color") == 0) {
-        pConfig->textEditorSelectionBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-active-line-color") == 0) {
-        pConfig->textEditorActiveLineColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-line-numbers") == 0) {
-        pConfig->textEditorShowLineNumbers = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-color") == 0) {
-        pConfig->textEditorLineNumbersColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-bg-color") == 0) {
-        pConfig->textEditorLineNumbersBGColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-padding") == 0) {
-        pConfig->textEditorLineNumbersPadding = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-track-color") == 0) {
-        pConfig->textEditorSBTrackColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color") == 0) {
-        pConfig->textEditorSBThumbColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color-hovered") == 0) {
-        pConfig->textEditorSBThumbColorHovered = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color-pressed") == 0) {
-        pConfig->textEditorSBThumbColorPressed = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-size") == 0) {
-        pConfig->textEditorSBSize = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-scrollbar-horz") == 0) {
-        pConfig->textEditorShowScrollbarHorz = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-scrollbar-vert") == 0) {
-        pConfig->textEditorShowScrollbarVert = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-excess-scrolling") == 0) {
-        pConfig->textEditorEnableExcessScrolling = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-tabs-to-spaces") == 0) {
-        pConfig->textEditorTabsToSpacesEnabled = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-tab-size-in-spaces") == 0) {
-        pConfig->textEditorTabSizeInSpaces = atoi(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-scale") == 0) {
-        pConfig->textEditorScale = (float)atof(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-auto-indent") == 0) {
-        pConfig->textEditorEnableAutoIndent = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-word-wrap") == 0) {
-        pConfig->textEditorEnableWordWrap = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_word_wrap(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-drag-and-drop") == 0) {
-        pConfig->textEditorEnableDragAndDrop = dred_parse_bool(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_drag_and_drop(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cpp-comment-text-color") == 0) {
-        pConfig->cppCommentTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cpp-string-text-color") == 0) {
-        pConfig->cppStringTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
-        return;
+    return dred_perfect_hash_find(key, g_ConfigVarHashSeeds, g_ConfigVarHashIndices, DRED_CONFIG_VAR_HASH_TABLE_SIZE, g_ConfigVarNames, DRED_CONFIG_VAR_COUNT);
+}
+
+
+void dred_config_set_by_index__autogenerated(dred_config* pConfig, dtk_uint32 index, const char* value)
+{
+    switch (index)
+    {
+        case 0:
+        {
+            pConfig->showTabBar = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__show_tab_bar(pConfig->pDred);
+        } break;
+
+        case 1:
+        {
+            pConfig->showMenuBar = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__show_menu_bar(pConfig->pDred);
+        } break;
+
+        case 2:
+        {
+            pConfig->autoHideCmdBar = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__auto_hide_cmd_bar(pConfig->pDred);
+        } break;
+
+        case 3:
+        {
+            pConfig->enableAutoReload = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__enable_auto_reload(pConfig->pDred);
+        } break;
+
+        case 4:
+        {
+            pConfig->restoreSession = dred_parse_bool(value);
+        } break;
+
+        case 5:
+        {
+            pConfig->enableFileIndex = dred_parse_bool(value);
+        } break;
+
+        case 6:
+        {
+            pConfig->logLevel = atoi(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__log_level(pConfig->pDred);
+        } break;
+
+        case 7:
+        {
+            pConfig->useDefaultWindowPos = dred_parse_bool(value);
+        } break;
+
+        case 8:
+        {
+            pConfig->windowPosX = atoi(value);
+        } break;
+
+        case 9:
+        {
+            pConfig->windowPosY = atoi(value);
+        } break;
+
+        case 10:
+        {
+            pConfig->windowWidth = atoi(value);
+        } break;
+
+        case 11:
+        {
+            pConfig->windowHeight = atoi(value);
+        } break;
+
+        case 12:
+        {
+            pConfig->windowMaximized = dred_parse_bool(value);
+        } break;
+
+        case 13:
+        {
+            pConfig->uiScale = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__ui_scale(pConfig->pDred);
+        } break;
+
+        case 14:
+        {
+            pConfig->pUIFont = dred_parse_and_load_font(pConfig->pDred, value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__ui_font(pConfig->pDred);
+        } break;
+
+        case 15:
+        {
+            pConfig->cmdbarBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color(pConfig->pDred);
+        } break;
+
+        case 16:
+        {
+            pConfig->cmdbarBGColorActive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color_active(pConfig->pDred);
+        } break;
+
+        case 17:
+        {
+            pConfig->pCmdbarTBFont = dred_parse_and_load_font(pConfig->pDred, value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_tb_font(pConfig->pDred);
+        } break;
+
+        case 18:
+        {
+            pConfig->cmdbarTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color(pConfig->pDred);
+        } break;
+
+        case 19:
+        {
+            pConfig->cmdbarTextColorActive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color_active(pConfig->pDred);
+        } break;
+
+        case 20:
+        {
+            pConfig->cmdbarPaddingX = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_horz(pConfig->pDred);
+        } break;
+
+        case 21:
+        {
+            pConfig->cmdbarPaddingY = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_vert(pConfig->pDred);
+        } break;
+
+        case 22:
+        {
+            pConfig->cmdbarPopupBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_bg_color_active(pConfig->pDred);
+        } break;
+
+        case 23:
+        {
+            pConfig->cmdbarPopupFont = dred_parse_and_load_font(pConfig->pDred, value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_font(pConfig->pDred);
+        } break;
+
+        case 24:
+        {
+            pConfig->cmdbarPopupBorderWidth = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_border_width(pConfig->pDred);
+        } break;
+
+        case 25:
+        {
+            pConfig->cmdbarPopupPadding = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_padding(pConfig->pDred);
+        } break;
+
+        case 26:
+        {
+            pConfig->tabgroupBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 27:
+        {
+            pConfig->tabBGColorInvactive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 28:
+        {
+            pConfig->tabBGColorActive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 29:
+        {
+            pConfig->tabBGColorHovered = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 30:
+        {
+            pConfig->tabFont = dred_parse_and_load_font(pConfig->pDred, value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 31:
+        {
+            pConfig->tabTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 32:
+        {
+            pConfig->tabTextColorActive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 33:
+        {
+            pConfig->tabTextColorHovered = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 34:
+        {
+            pConfig->tabPadding = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 35:
+        {
+            pConfig->tabShowCloseButton = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 36:
+        {
+            pConfig->tabCloseButtonColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 37:
+        {
+            pConfig->tabCloseButtonColorTabHovered = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 38:
+        {
+            pConfig->tabCloseButtonColorTabActive = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 39:
+        {
+            pConfig->tabCloseButtonColorHovered = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 40:
+        {
+            pConfig->tabCloseButtonColorPressed = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 41:
+        {
+            pConfig->pTextEditorFont = dred_parse_and_load_font(pConfig->pDred, value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 42:
+        {
+            pConfig->textEditorTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 43:
+        {
+            pConfig->textEditorBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 44:
+        {
+            pConfig->textEditorCursorColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 45:
+        {
+            pConfig->textEditorCursorWidth = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 46:
+        {
+            pConfig->textEditorSelectionBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 47:
+        {
+            pConfig->textEditorActiveLineColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 48:
+        {
+            pConfig->textEditorShowLineNumbers = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 49:
+        {
+            pConfig->textEditorLineNumbersColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 50:
+        {
+            pConfig->textEditorLineNumbersBGColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 51:
+        {
+            pConfig->textEditorLineNumbersPadding = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 52:
+        {
+            pConfig->textEditorSBTrackColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 53:
+        {
+            pConfig->textEditorSBThumbColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 54:
+        {
+            pConfig->textEditorSBThumbColorHovered = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 55:
+        {
+            pConfig->textEditorSBThumbColorPressed = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 56:
+        {
+            pConfig->textEditorSBSize = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 57:
+        {
+            pConfig->textEditorShowScrollbarHorz = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 58:
+        {
+            pConfig->textEditorShowScrollbarVert = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 59:
+        {
+            pConfig->textEditorEnableExcessScrolling = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 60:
+        {
+            pConfig->textEditorTabsToSpacesEnabled = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 61:
+        {
+            pConfig->textEditorTabSizeInSpaces = atoi(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 62:
+        {
+            pConfig->textEditorScale = (float)atof(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 63:
+        {
+            pConfig->textEditorEnableAutoIndent = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 64:
+        {
+            pConfig->textEditorEnableWordWrap = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_word_wrap(pConfig->pDred);
+        } break;
+
+        case 65:
+        {
+            pConfig->textEditorEnableDragAndDrop = dred_parse_bool(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_drag_and_drop(pConfig->pDred);
+        } break;
+
+        case 66:
+        {
+            pConfig->textEditorCursorBlinkTimeout = atoi(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 67:
+        {
+            pConfig->cppCommentTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        case 68:
+        {
+            pConfig->cppStringTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        case 69:
+        {
+            pConfig->cppKeywordTextColor = dred_parse_color(value);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        default: break;
     }
-    if (strcmp(key, "cpp-keyword-text-color") == 0) {
-        pConfig->cppKeywordTextColor = dred_parse_color(value);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+}
+
+
+
+void dred_config_set__autogenerated(dred_config* pConfig, const char* key, const char* value)
+{
+    dtk_uint32 index = dred_config_find_variable_index__autogenerated(key);
+    if (index == (dtk_uint32)-1) {
+        dred_warningf(pConfig->pDred, "Unknown config variable: %s\n", key);
         return;
     }
 
-    dred_warningf(pConfig->pDred, "Unknown config variable: %s\n", key);
+    dred_config_set_by_index__autogenerated(pConfig, index, value);
 }
 
 
 
 void dred_config_set_default__autogenerated(dred_config* pConfig, const char* key)
 {
-    if (strcmp(key, "show-tab-bar") == 0) {
-        pConfig->showTabBar = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__show_tab_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "show-menu-bar") == 0) {
-        pConfig->showMenuBar = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__show_menu_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "auto-hide-cmd-bar") == 0) {
-        pConfig->autoHideCmdBar = false;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__auto_hide_cmd_bar(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "enable-auto-reload") == 0) {
-        pConfig->enableAutoReload = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__enable_auto_reload(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "use-default-window-pos") == 0) {
-        pConfig->useDefaultWindowPos = true;
-        return;
-    }
-    if (strcmp(key, "window-pos-x") == 0) {
-        pConfig->windowPosX = 0;
-        return;
-    }
-    if (strcmp(key, "window-pos-y") == 0) {
-        pConfig->windowPosY = 0;
-        return;
-    }
-    if (strcmp(key, "window-width") == 0) {
-        pConfig->windowWidth = 1280;
-        return;
-    }
-    if (strcmp(key, "window-height") == 0) {
-        pConfig->windowHeight = 720;
-        return;
-    }
-    if (strcmp(key, "window-maximized") == 0) {
-        pConfig->windowMaximized = false;
-        return;
-    }
-    if (strcmp(key, "ui-scale") == 0) {
-        pConfig->uiScale = 1;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__ui_scale(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "ui-font") == 0) {
-        pConfig->pUIFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
-        if (pConfig->pDred->isInitialized) dred_config_on_set__ui_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-bg-color") == 0) {
-        pConfig->cmdbarBGColor = dred_rgba(64, 64, 64, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-bg-color-active") == 0) {
-        pConfig->cmdbarBGColorActive = dred_rgba(128, 51, 0, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-tb-font") == 0) {
-        pConfig->pCmdbarTBFont = dred_parse_and_load_font(pConfig->pDred, "system-font-mono");
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_tb_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-text-color") == 0) {
-        pConfig->cmdbarTextColor = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-text-color-active") == 0) {
-        pConfig->cmdbarTextColorActive = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-padding-horz") == 0) {
-        pConfig->cmdbarPaddingX = 2;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_horz(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-padding-vert") == 0) {
-        pConfig->cmdbarPaddingY = 2;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_vert(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-bg-color") == 0) {
-        pConfig->cmdbarPopupBGColor = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_bg_color_active(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-font") == 0) {
-        pConfig->cmdbarPopupFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_font(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-border-width") == 0) {
-        pConfig->cmdbarPopupBorderWidth = 2;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_border_width(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cmdbar-popup-padding") == 0) {
-        pConfig->cmdbarPopupPadding = 2;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_padding(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tabgroup-bg-color") == 0) {
-        pConfig->tabgroupBGColor = dred_rgba(48, 48, 48, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-inactive") == 0) {
-        pConfig->tabBGColorInvactive = dred_rgba(58, 58, 58, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-active") == 0) {
-        pConfig->tabBGColorActive = dred_rgba(16, 92, 160, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-bg-color-hovered") == 0) {
-        pConfig->tabBGColorHovered = dred_rgba(32, 128, 192, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-font") == 0) {
-        pConfig->tabFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color") == 0) {
-        pConfig->tabTextColor = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color-active") == 0) {
-        pConfig->tabTextColorActive = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-text-color-hovered") == 0) {
-        pConfig->tabTextColorHovered = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-padding") == 0) {
-        pConfig->tabPadding = 4;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-show-close-button") == 0) {
-        pConfig->tabShowCloseButton = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color") == 0) {
-        pConfig->tabCloseButtonColor = dred_rgba(58, 58, 58, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-tab-hovered") == 0) {
-        pConfig->tabCloseButtonColorTabHovered = dred_rgba(200, 200, 200, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-tab-active") == 0) {
-        pConfig->tabCloseButtonColorTabActive = dred_rgba(200, 200, 200, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-hovered") == 0) {
-        pConfig->tabCloseButtonColorHovered = dred_rgba(255, 96, 96, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "tab-close-button-color-pressed") == 0) {
-        pConfig->tabCloseButtonColorPressed = dred_rgba(192, 32, 32, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-font") == 0) {
-        pConfig->pTextEditorFont = dred_parse_and_load_font(pConfig->pDred, "system-font-mono");
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-text-color") == 0) {
-        pConfig->textEditorTextColor = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-bg-color") == 0) {
-        pConfig->textEditorBGColor = dred_rgba(48, 48, 48, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-cursor-color") == 0) {
-        pConfig->textEditorCursorColor = dred_rgba(224, 224, 224, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-cursor-width") == 0) {
-        pConfig->textEditorCursorWidth = 1;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-selection-bg-color") == 0) {
-        pConfig->textEditorSelectionBGColor = dred_rgba(64, 128, 192, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-active-line-color") == 0) {
-        pConfig->textEditorActiveLineColor = dred_rgba(40, 40, 40, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-line-numbers") == 0) {
-        pConfig->textEditorShowLineNumbers = false;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-color") == 0) {
-        pConfig->textEditorLineNumbersColor = dred_rgba(80, 160, 192, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-bg-color") == 0) {
-        pConfig->textEditorLineNumbersBGColor = dred_rgba(48, 48, 48, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-line-numbers-padding") == 0) {
-        pConfig->textEditorLineNumbersPadding = 16;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-track-color") == 0) {
-        pConfig->textEditorSBTrackColor = dred_rgba(64, 64, 64, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color") == 0) {
-        pConfig->textEditorSBThumbColor = dred_rgba(92, 92, 92, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color-hovered") == 0) {
-        pConfig->textEditorSBThumbColorHovered = dred_rgba(144, 144, 144, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-thumb-color-pressed") == 0) {
-        pConfig->textEditorSBThumbColorPressed = dred_rgba(180, 180, 180, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-sb-size") == 0) {
-        pConfig->textEditorSBSize = 16;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-scrollbar-horz") == 0) {
-        pConfig->textEditorShowScrollbarHorz = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-show-scrollbar-vert") == 0) {
-        pConfig->textEditorShowScrollbarVert = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-excess-scrolling") == 0) {
-        pConfig->textEditorEnableExcessScrolling = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-tabs-to-spaces") == 0) {
-        pConfig->textEditorTabsToSpacesEnabled = false;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-tab-size-in-spaces") == 0) {
-        pConfig->textEditorTabSizeInSpaces = 4;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-scale") == 0) {
-        pConfig->textEditorScale = 1;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-auto-indent") == 0) {
-        pConfig->textEditorEnableAutoIndent = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-word-wrap") == 0) {
-        pConfig->textEditorEnableWordWrap = true;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_word_wrap(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "texteditor-enable-drag-and-drop") == 0) {
-        pConfig->textEditorEnableDragAndDrop = false;
-        if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_drag_and_drop(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cpp-comment-text-color") == 0) {
-        pConfig->cppCommentTextColor = dred_rgba(64, 192, 92, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cpp-string-text-color") == 0) {
-        pConfig->cppStringTextColor = dred_rgba(192, 92, 64, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
-        return;
-    }
-    if (strcmp(key, "cpp-keyword-text-color") == 0) {
-        pConfig->cppKeywordTextColor = dred_rgba(64, 160, 255, 255);
-        if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
-        return;
+    switch (dred_config_find_variable_index__autogenerated(key))
+    {
+        case 0:
+        {
+            pConfig->showTabBar = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__show_tab_bar(pConfig->pDred);
+        } break;
+
+        case 1:
+        {
+            pConfig->showMenuBar = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__show_menu_bar(pConfig->pDred);
+        } break;
+
+        case 2:
+        {
+            pConfig->autoHideCmdBar = false;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__auto_hide_cmd_bar(pConfig->pDred);
+        } break;
+
+        case 3:
+        {
+            pConfig->enableAutoReload = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__enable_auto_reload(pConfig->pDred);
+        } break;
+
+        case 4:
+        {
+            pConfig->restoreSession = true;
+        } break;
+
+        case 5:
+        {
+            pConfig->enableFileIndex = true;
+        } break;
+
+        case 6:
+        {
+            pConfig->logLevel = 3;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__log_level(pConfig->pDred);
+        } break;
+
+        case 7:
+        {
+            pConfig->useDefaultWindowPos = true;
+        } break;
+
+        case 8:
+        {
+            pConfig->windowPosX = 0;
+        } break;
+
+        case 9:
+        {
+            pConfig->windowPosY = 0;
+        } break;
+
+        case 10:
+        {
+            pConfig->windowWidth = 1280;
+        } break;
+
+        case 11:
+        {
+            pConfig->windowHeight = 720;
+        } break;
+
+        case 12:
+        {
+            pConfig->windowMaximized = false;
+        } break;
+
+        case 13:
+        {
+            pConfig->uiScale = 1;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__ui_scale(pConfig->pDred);
+        } break;
+
+        case 14:
+        {
+            pConfig->pUIFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
+            if (pConfig->pDred->isInitialized) dred_config_on_set__ui_font(pConfig->pDred);
+        } break;
+
+        case 15:
+        {
+            pConfig->cmdbarBGColor = dred_rgba(64, 64, 64, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color(pConfig->pDred);
+        } break;
+
+        case 16:
+        {
+            pConfig->cmdbarBGColorActive = dred_rgba(128, 51, 0, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_bg_color_active(pConfig->pDred);
+        } break;
+
+        case 17:
+        {
+            pConfig->pCmdbarTBFont = dred_parse_and_load_font(pConfig->pDred, "system-font-mono");
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_tb_font(pConfig->pDred);
+        } break;
+
+        case 18:
+        {
+            pConfig->cmdbarTextColor = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color(pConfig->pDred);
+        } break;
+
+        case 19:
+        {
+            pConfig->cmdbarTextColorActive = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_text_color_active(pConfig->pDred);
+        } break;
+
+        case 20:
+        {
+            pConfig->cmdbarPaddingX = 2;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_horz(pConfig->pDred);
+        } break;
+
+        case 21:
+        {
+            pConfig->cmdbarPaddingY = 2;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_padding_vert(pConfig->pDred);
+        } break;
+
+        case 22:
+        {
+            pConfig->cmdbarPopupBGColor = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_bg_color_active(pConfig->pDred);
+        } break;
+
+        case 23:
+        {
+            pConfig->cmdbarPopupFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_font(pConfig->pDred);
+        } break;
+
+        case 24:
+        {
+            pConfig->cmdbarPopupBorderWidth = 2;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_border_width(pConfig->pDred);
+        } break;
+
+        case 25:
+        {
+            pConfig->cmdbarPopupPadding = 2;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cmdbar_popup_padding(pConfig->pDred);
+        } break;
+
+        case 26:
+        {
+            pConfig->tabgroupBGColor = dred_rgba(48, 48, 48, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 27:
+        {
+            pConfig->tabBGColorInvactive = dred_rgba(58, 58, 58, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 28:
+        {
+            pConfig->tabBGColorActive = dred_rgba(16, 92, 160, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 29:
+        {
+            pConfig->tabBGColorHovered = dred_rgba(32, 128, 192, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 30:
+        {
+            pConfig->tabFont = dred_parse_and_load_font(pConfig->pDred, "system-font-ui");
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 31:
+        {
+            pConfig->tabTextColor = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 32:
+        {
+            pConfig->tabTextColorActive = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 33:
+        {
+            pConfig->tabTextColorHovered = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 34:
+        {
+            pConfig->tabPadding = 4;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 35:
+        {
+            pConfig->tabShowCloseButton = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 36:
+        {
+            pConfig->tabCloseButtonColor = dred_rgba(58, 58, 58, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 37:
+        {
+            pConfig->tabCloseButtonColorTabHovered = dred_rgba(200, 200, 200, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 38:
+        {
+            pConfig->tabCloseButtonColorTabActive = dred_rgba(200, 200, 200, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 39:
+        {
+            pConfig->tabCloseButtonColorHovered = dred_rgba(255, 96, 96, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 40:
+        {
+            pConfig->tabCloseButtonColorPressed = dred_rgba(192, 32, 32, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__tabgroup_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 41:
+        {
+            pConfig->pTextEditorFont = dred_parse_and_load_font(pConfig->pDred, "system-font-mono");
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 42:
+        {
+            pConfig->textEditorTextColor = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 43:
+        {
+            pConfig->textEditorBGColor = dred_rgba(48, 48, 48, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 44:
+        {
+            pConfig->textEditorCursorColor = dred_rgba(224, 224, 224, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 45:
+        {
+            pConfig->textEditorCursorWidth = 1;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 46:
+        {
+            pConfig->textEditorSelectionBGColor = dred_rgba(64, 128, 192, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 47:
+        {
+            pConfig->textEditorActiveLineColor = dred_rgba(40, 40, 40, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 48:
+        {
+            pConfig->textEditorShowLineNumbers = false;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 49:
+        {
+            pConfig->textEditorLineNumbersColor = dred_rgba(80, 160, 192, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 50:
+        {
+            pConfig->textEditorLineNumbersBGColor = dred_rgba(48, 48, 48, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 51:
+        {
+            pConfig->textEditorLineNumbersPadding = 16;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 52:
+        {
+            pConfig->textEditorSBTrackColor = dred_rgba(64, 64, 64, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 53:
+        {
+            pConfig->textEditorSBThumbColor = dred_rgba(92, 92, 92, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 54:
+        {
+            pConfig->textEditorSBThumbColorHovered = dred_rgba(144, 144, 144, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 55:
+        {
+            pConfig->textEditorSBThumbColorPressed = dred_rgba(180, 180, 180, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 56:
+        {
+            pConfig->textEditorSBSize = 16;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 57:
+        {
+            pConfig->textEditorShowScrollbarHorz = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 58:
+        {
+            pConfig->textEditorShowScrollbarVert = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 59:
+        {
+            pConfig->textEditorEnableExcessScrolling = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 60:
+        {
+            pConfig->textEditorTabsToSpacesEnabled = false;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 61:
+        {
+            pConfig->textEditorTabSizeInSpaces = 4;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 62:
+        {
+            pConfig->textEditorScale = 1;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 63:
+        {
+            pConfig->textEditorEnableAutoIndent = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 64:
+        {
+            pConfig->textEditorEnableWordWrap = true;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_word_wrap(pConfig->pDred);
+        } break;
+
+        case 65:
+        {
+            pConfig->textEditorEnableDragAndDrop = false;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_drag_and_drop(pConfig->pDred);
+        } break;
+
+        case 66:
+        {
+            pConfig->textEditorCursorBlinkTimeout = 15000;
+            if (pConfig->pDred->isInitialized) dred_config_on_set__texteditor_generic_refresh(pConfig->pDred);
+        } break;
+
+        case 67:
+        {
+            pConfig->cppCommentTextColor = dred_rgba(64, 192, 92, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        case 68:
+        {
+            pConfig->cppStringTextColor = dred_rgba(192, 92, 64, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        case 69:
+        {
+            pConfig->cppKeywordTextColor = dred_rgba(64, 160, 255, 255);
+            if (pConfig->pDred->isInitialized) dred_config_on_set__cpp_syntax_color(pConfig->pDred);
+        } break;
+
+        default: break;
     }
 }
 
@@ -2313,15 +2662,15 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
     pTable->pItems[DRED_MENU_ITEM_ID_SEPARATOR].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_HELP_ABOUT].id = DRED_MENU_ITEM_ID_GENERIC_HELP_ABOUT;
-    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_HELP_ABOUT].commandStrOffset = 409;
+    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_HELP_ABOUT].commandStrOffset = 660;
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_HELP_ABOUT].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_DARK].id = DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_DARK;
-    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_DARK].commandStrOffset = 415;
+    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_DARK].commandStrOffset = 672;
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_DARK].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_LIGHT].id = DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_LIGHT;
-    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_LIGHT].commandStrOffset = 442;
+    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_LIGHT].commandStrOffset = 704;
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES_LIGHT].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES].id = DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES;
@@ -2329,16 +2678,16 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_THEMES].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_SETTINGS].id = DRED_MENU_ITEM_ID_GENERIC_SETTINGS_SETTINGS;
-    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_SETTINGS].commandStrOffset = 470;
+    pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_SETTINGS].commandStrOffset = 736;
     pTable->pItems[DRED_MENU_ITEM_ID_GENERIC_SETTINGS_SETTINGS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_NEW].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_NEW;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_NEW].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_NEW].shortcutStrOffset = 1;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_NEW].shortcutStrOffset = 8;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN].shortcutStrOffset = 14;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN].shortcutStrOffset = 32;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN_RECENT].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN_RECENT;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN_RECENT].commandStrOffset = 0;
@@ -2349,19 +2698,19 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_OPEN_FAVOURITE].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_CLEARRECENTFILES].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_CLEARRECENTFILES;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_CLEARRECENTFILES].commandStrOffset = 479;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_CLEARRECENTFILES].commandStrOffset = 752;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_CLEARRECENTFILES].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_EXIT].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_EXIT;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_EXIT].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_EXIT].shortcutStrOffset = 404;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE_EXIT].shortcutStrOffset = 648;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS].commandStrOffset = 498;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS].commandStrOffset = 776;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR;
-    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR].commandStrOffset = 513;
+    pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR].commandStrOffset = 796;
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE].id = DRED_MENU_ITEM_ID_NOTHINGOPEN_FILE;
@@ -2382,11 +2731,11 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_NEW].id = DRED_MENU_ITEM_ID_TEXT_FILE_NEW;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_NEW].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_NEW].shortcutStrOffset = 1;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_NEW].shortcutStrOffset = 8;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN].id = DRED_MENU_ITEM_ID_TEXT_FILE_OPEN;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN].shortcutStrOffset = 14;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN].shortcutStrOffset = 32;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN_RECENT].id = DRED_MENU_ITEM_ID_TEXT_FILE_OPEN_RECENT;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN_RECENT].commandStrOffset = 0;
@@ -2397,104 +2746,104 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_OPEN_FAVOURITE].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_ADDFAVOURITE].id = DRED_MENU_ITEM_ID_TEXT_FILE_ADDFAVOURITE;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_ADDFAVOURITE].commandStrOffset = 537;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_ADDFAVOURITE].commandStrOffset = 824;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_ADDFAVOURITE].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_REMOVEFAVOURITE].id = DRED_MENU_ITEM_ID_TEXT_FILE_REMOVEFAVOURITE;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_REMOVEFAVOURITE].commandStrOffset = 551;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_REMOVEFAVOURITE].commandStrOffset = 844;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_REMOVEFAVOURITE].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLEARRECENTFILES].id = DRED_MENU_ITEM_ID_TEXT_FILE_CLEARRECENTFILES;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLEARRECENTFILES].commandStrOffset = 479;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLEARRECENTFILES].commandStrOffset = 752;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLEARRECENTFILES].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVE].id = DRED_MENU_ITEM_ID_TEXT_FILE_SAVE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVE].shortcutStrOffset = 29;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVE].shortcutStrOffset = 60;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEAS].id = DRED_MENU_ITEM_ID_TEXT_FILE_SAVEAS;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEAS].commandStrOffset = 568;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEAS].commandStrOffset = 868;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEAS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEALL].id = DRED_MENU_ITEM_ID_TEXT_FILE_SAVEALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEALL].shortcutStrOffset = 44;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_SAVEALL].shortcutStrOffset = 88;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSE].id = DRED_MENU_ITEM_ID_TEXT_FILE_CLOSE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSE].shortcutStrOffset = 67;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSE].shortcutStrOffset = 124;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSEALL].id = DRED_MENU_ITEM_ID_TEXT_FILE_CLOSEALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSEALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSEALL].shortcutStrOffset = 84;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_CLOSEALL].shortcutStrOffset = 152;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_PRINT].id = DRED_MENU_ITEM_ID_TEXT_FILE_PRINT;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_PRINT].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_PRINT].shortcutStrOffset = 109;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_PRINT].shortcutStrOffset = 188;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_EXIT].id = DRED_MENU_ITEM_ID_TEXT_FILE_EXIT;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_EXIT].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_EXIT].shortcutStrOffset = 404;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE_EXIT].shortcutStrOffset = 648;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_UNDO].id = DRED_MENU_ITEM_ID_TEXT_EDIT_UNDO;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_UNDO].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_UNDO].shortcutStrOffset = 145;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_UNDO].shortcutStrOffset = 244;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_REDO].id = DRED_MENU_ITEM_ID_TEXT_EDIT_REDO;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_REDO].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_REDO].shortcutStrOffset = 160;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_REDO].shortcutStrOffset = 272;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_CUT].id = DRED_MENU_ITEM_ID_TEXT_EDIT_CUT;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_CUT].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_CUT].shortcutStrOffset = 175;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_CUT].shortcutStrOffset = 300;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_COPY].id = DRED_MENU_ITEM_ID_TEXT_EDIT_COPY;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_COPY].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_COPY].shortcutStrOffset = 188;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_COPY].shortcutStrOffset = 324;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_PASTE].id = DRED_MENU_ITEM_ID_TEXT_EDIT_PASTE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_PASTE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_PASTE].shortcutStrOffset = 203;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_PASTE].shortcutStrOffset = 352;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_DELETE].id = DRED_MENU_ITEM_ID_TEXT_EDIT_DELETE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_DELETE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_DELETE].shortcutStrOffset = 220;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_DELETE].shortcutStrOffset = 380;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_SELECTALL].id = DRED_MENU_ITEM_ID_TEXT_EDIT_SELECTALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_SELECTALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_SELECTALL].shortcutStrOffset = 239;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_EDIT_SELECTALL].shortcutStrOffset = 408;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS].id = DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS].commandStrOffset = 498;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS].commandStrOffset = 776;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR].id = DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR].commandStrOffset = 513;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR].commandStrOffset = 796;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS].id = DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS].commandStrOffset = 576;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS].commandStrOffset = 880;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_RESETZOOM].id = DRED_MENU_ITEM_ID_TEXT_VIEW_RESETZOOM;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_RESETZOOM].commandStrOffset = 596;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_RESETZOOM].commandStrOffset = 904;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_RESETZOOM].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP].id = DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP].commandStrOffset = 603;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP].commandStrOffset = 916;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_FIND].id = DRED_MENU_ITEM_ID_TEXT_FIND_FIND;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_FIND].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_FIND].shortcutStrOffset = 289;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_FIND].shortcutStrOffset = 480;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_REPLACE].id = DRED_MENU_ITEM_ID_TEXT_FIND_REPLACE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_REPLACE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_REPLACE].shortcutStrOffset = 321;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_REPLACE].shortcutStrOffset = 524;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_GOTO].id = DRED_MENU_ITEM_ID_TEXT_FIND_GOTO;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_GOTO].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_GOTO].shortcutStrOffset = 363;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FIND_GOTO].shortcutStrOffset = 580;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE].id = DRED_MENU_ITEM_ID_TEXT_FILE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_FILE].commandStrOffset = 0;
@@ -2522,100 +2871,120 @@ void dred_menu_item_table__bind_stock_items__autogenerated(dred_context* pDred,
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_UNDO].id = DRED_MENU_ITEM_ID_TEXT_POPUP_UNDO;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_UNDO].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_UNDO].shortcutStrOffset = 145;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_UNDO].shortcutStrOffset = 244;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_REDO].id = DRED_MENU_ITEM_ID_TEXT_POPUP_REDO;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_REDO].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_REDO].shortcutStrOffset = 160;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_REDO].shortcutStrOffset = 272;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_CUT].id = DRED_MENU_ITEM_ID_TEXT_POPUP_CUT;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_CUT].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_CUT].shortcutStrOffset = 175;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_CUT].shortcutStrOffset = 300;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_COPY].id = DRED_MENU_ITEM_ID_TEXT_POPUP_COPY;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_COPY].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_COPY].shortcutStrOffset = 188;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_COPY].shortcutStrOffset = 324;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_PASTE].id = DRED_MENU_ITEM_ID_TEXT_POPUP_PASTE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_PASTE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_PASTE].shortcutStrOffset = 203;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_PASTE].shortcutStrOffset = 352;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_DELETE].id = DRED_MENU_ITEM_ID_TEXT_POPUP_DELETE;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_DELETE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_DELETE].shortcutStrOffset = 220;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_DELETE].shortcutStrOffset = 380;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_SELECTALL].id = DRED_MENU_ITEM_ID_TEXT_POPUP_SELECTALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_SELECTALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_SELECTALL].shortcutStrOffset = 239;
+    pTable->pItems[DRED_MENU_ITEM_ID_TEXT_POPUP_SELECTALL].shortcutStrOffset = 408;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVE].id = DRED_MENU_ITEM_ID_TABPOPUP_SAVE;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVE].shortcutStrOffset = 29;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVE].shortcutStrOffset = 60;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEAS].id = DRED_MENU_ITEM_ID_TABPOPUP_SAVEAS;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEAS].commandStrOffset = 568;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEAS].commandStrOffset = 868;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEAS].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEALL].id = DRED_MENU_ITEM_ID_TABPOPUP_SAVEALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEALL].shortcutStrOffset = 44;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_SAVEALL].shortcutStrOffset = 88;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSE].id = DRED_MENU_ITEM_ID_TABPOPUP_CLOSE;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSE].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSE].shortcutStrOffset = 67;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSE].shortcutStrOffset = 124;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSEALL].id = DRED_MENU_ITEM_ID_TABPOPUP_CLOSEALL;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSEALL].commandStrOffset = 0;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSEALL].shortcutStrOffset = 84;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_CLOSEALL].shortcutStrOffset = 152;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_ADDFAVOURITE].id = DRED_MENU_ITEM_ID_TABPOPUP_ADDFAVOURITE;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_ADDFAVOURITE].commandStrOffset = 537;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_ADDFAVOURITE].commandStrOffset = 824;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_ADDFAVOURITE].shortcutStrOffset = 0;
 
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_REMOVEFAVOURITE].id = DRED_MENU_ITEM_ID_TABPOPUP_REMOVEFAVOURITE;
-    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_REMOVEFAVOURITE].commandStrOffset = 551;
+    pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_REMOVEFAVOURITE].commandStrOffset = 844;
     pTable->pItems[DRED_MENU_ITEM_ID_TABPOPUP_REMOVEFAVOURITE].shortcutStrOffset = 0;
 
 }
 
 const unsigned char g_InitialStringPoolData[] = {
-    0x00,0x66,0x69,0x6C,0x65,0x2E,0x6E,0x65,0x77,0x00,0x6E,0x65,0x77,0x00,0x66,0x69,
-    0x6C,0x65,0x2E,0x6F,0x70,0x65,0x6E,0x00,0x6F,0x70,0x65,0x6E,0x00,0x66,0x69,0x6C,
-    0x65,0x2E,0x73,0x61,0x76,0x65,0x00,0x73,0x61,0x76,0x65,0x00,0x66,0x69,0x6C,0x65,
-    0x2E,0x73,0x61,0x76,0x65,0x2D,0x61,0x6C,0x6C,0x00,0x73,0x61,0x76,0x65,0x2D,0x61,
-    0x6C,0x6C,0x00,0x66,0x69,0x6C,0x65,0x2E,0x63,0x6C,0x6F,0x73,0x65,0x00,0x63,0x6C,
-    0x6F,0x73,0x65,0x00,0x66,0x69,0x6C,0x65,0x2E,0x63,0x6C,0x6F,0x73,0x65,0x2D,0x61,
-    0x6C,0x6C,0x00,0x63,0x6C,0x6F,0x73,0x65,0x2D,0x61,0x6C,0x6C,0x00,0x66,0x69,0x6C,
-    0x65,0x2E,0x70,0x72,0x69,0x6E,0x74,0x00,0x70,0x72,0x69,0x6E,0x74,0x00,0x66,0x69,
-    0x6C,0x65,0x2E,0x72,0x65,0x6C,0x6F,0x61,0x64,0x00,0x72,0x65,0x6C,0x6F,0x61,0x64,
-    0x00,0x65,0x64,0x69,0x74,0x2E,0x75,0x6E,0x64,0x6F,0x00,0x75,0x6E,0x64,0x6F,0x00,
-    0x65,0x64,0x69,0x74,0x2E,0x72,0x65,0x64,0x6F,0x00,0x72,0x65,0x64,0x6F,0x00,0x65,
-    0x64,0x69,0x74,0x2E,0x63,0x75,0x74,0x00,0x63,0x75,0x74,0x00,0x65,0x64,0x69,0x74,
-    0x2E,0x63,0x6F,0x70,0x79,0x00,0x63,0x6F,0x70,0x79,0x00,0x65,0x64,0x69,0x74,0x2E,
-    0x70,0x61,0x73,0x74,0x65,0x00,0x70,0x61,0x73,0x74,0x65,0x00,0x65,0x64,0x69,0x74,
-    0x2E,0x64,0x65,0x6C,0x65,0x74,0x65,0x00,0x64,0x65,0x6C,0x65,0x74,0x65,0x00,0x65,
-    0x64,0x69,0x74,0x2E,0x73,0x65,0x6C,0x65,0x63,0x74,0x2D,0x61,0x6C,0x6C,0x00,0x73,
-    0x65,0x6C,0x65,0x63,0x74,0x2D,0x61,0x6C,0x6C,0x00,0x65,0x64,0x69,0x74,0x2E,0x75,
-    0x6E,0x69,0x6E,0x64,0x65,0x6E,0x74,0x00,0x75,0x6E,0x69,0x6E,0x64,0x65,0x6E,0x74,
-    0x00,0x66,0x69,0x6E,0x64,0x2E,0x66,0x69,0x6E,0x64,0x00,0x63,0x6D,0x64,0x62,0x61,
-    0x72,0x2D,0x66,0x69,0x6E,0x64,0x2D,0x70,0x72,0x65,0x66,0x69,0x6C,0x6C,0x65,0x64,
-    0x00,0x66,0x69,0x6E,0x64,0x2E,0x72,0x65,0x70,0x6C,0x61,0x63,0x65,0x00,0x63,0x6D,
-    0x64,0x62,0x61,0x72,0x2D,0x72,0x65,0x70,0x6C,0x61,0x63,0x65,0x2D,0x61,0x6C,0x6C,
-    0x2D,0x70,0x72,0x65,0x66,0x69,0x6C,0x6C,0x65,0x64,0x00,0x66,0x69,0x6E,0x64,0x2E,
-    0x67,0x6F,0x74,0x6F,0x00,0x63,0x6D,0x64,0x62,0x61,0x72,0x20,0x67,0x6F,0x74,0x6F,
-    0x20,0x00,0x6E,0x65,0x78,0x74,0x2D,0x74,0x61,0x62,0x00,0x70,0x72,0x65,0x76,0x2D,
-    0x74,0x61,0x62,0x00,0x65,0x78,0x69,0x74,0x00,0x61,0x62,0x6F,0x75,0x74,0x00,0x6C,
-    0x6F,0x61,0x64,0x2D,0x63,0x6F,0x6E,0x66,0x69,0x67,0x20,0x64,0x61,0x72,0x6B,0x2E,
-    0x64,0x72,0x65,0x64,0x74,0x68,0x65,0x6D,0x65,0x00,0x6C,0x6F,0x61,0x64,0x2D,0x63,
-    0x6F,0x6E,0x66,0x69,0x67,0x20,0x6C,0x69,0x67,0x68,0x74,0x2E,0x64,0x72,0x65,0x64,
-    0x74,0x68,0x65,0x6D,0x65,0x00,0x73,0x65,0x74,0x74,0x69,0x6E,0x67,0x73,0x00,0x63,
-    0x6C,0x65,0x61,0x72,0x2D,0x72,0x65,0x63,0x65,0x6E,0x74,0x2D,0x66,0x69,0x6C,0x65,
-    0x73,0x00,0x74,0x6F,0x67,0x67,0x6C,0x65,0x2D,0x74,0x61,0x62,0x2D,0x62,0x61,0x72,
-    0x00,0x74,0x6F,0x67,0x67,0x6C,0x65,0x2D,0x61,0x75,0x74,0x6F,0x2D,0x68,0x69,0x64,
-    0x65,0x2D,0x63,0x6D,0x64,0x62,0x61,0x72,0x00,0x61,0x64,0x64,0x2D,0x66,0x61,0x76,
-    0x6F,0x75,0x72,0x69,0x74,0x65,0x00,0x72,0x65,0x6D,0x6F,0x76,0x65,0x2D,0x66,0x61,
-    0x76,0x6F,0x75,0x72,0x69,0x74,0x65,0x00,0x73,0x61,0x76,0x65,0x2D,0x61,0x73,0x00,
+    0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,0x2E,0x6E,0x65,0x77,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x6E,0x65,0x77,0x00,0x09,0x00,0x00,0x00,
+    0x66,0x69,0x6C,0x65,0x2E,0x6F,0x70,0x65,0x6E,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x6F,0x70,0x65,0x6E,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,
+    0x2E,0x73,0x61,0x76,0x65,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x73,0x61,0x76,0x65,
+    0x00,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,0x2E,0x73,0x61,0x76,
+    0x65,0x2D,0x61,0x6C,0x6C,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x73,0x61,0x76,0x65,
+    0x2D,0x61,0x6C,0x6C,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,
+    0x2E,0x63,0x6C,0x6F,0x73,0x65,0x00,0x00,0x05,0x00,0x00,0x00,0x63,0x6C,0x6F,0x73,
+    0x65,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,0x2E,0x63,0x6C,0x6F,
+    0x73,0x65,0x2D,0x61,0x6C,0x6C,0x00,0x00,0x09,0x00,0x00,0x00,0x63,0x6C,0x6F,0x73,
+    0x65,0x2D,0x61,0x6C,0x6C,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,
+    0x2E,0x70,0x72,0x69,0x6E,0x74,0x00,0x00,0x05,0x00,0x00,0x00,0x70,0x72,0x69,0x6E,
+    0x74,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x66,0x69,0x6C,0x65,0x2E,0x72,0x65,0x6C,
+    0x6F,0x61,0x64,0x00,0x06,0x00,0x00,0x00,0x72,0x65,0x6C,0x6F,0x61,0x64,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x65,0x64,0x69,0x74,0x2E,0x75,0x6E,0x64,0x6F,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x75,0x6E,0x64,0x6F,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x65,0x64,0x69,0x74,0x2E,0x72,0x65,0x64,0x6F,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x72,0x65,0x64,0x6F,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x65,0x64,0x69,0x74,
+    0x2E,0x63,0x75,0x74,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x63,0x75,0x74,0x00,
+    0x09,0x00,0x00,0x00,0x65,0x64,0x69,0x74,0x2E,0x63,0x6F,0x70,0x79,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x63,0x6F,0x70,0x79,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
+    0x65,0x64,0x69,0x74,0x2E,0x70,0x61,0x73,0x74,0x65,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x70,0x61,0x73,0x74,0x65,0x00,0x00,0x00,0x0B,0x00,0x00,0x00,0x65,0x64,0x69,0x74,
+    0x2E,0x64,0x65,0x6C,0x65,0x74,0x65,0x00,0x06,0x00,0x00,0x00,0x64,0x65,0x6C,0x65,
+    0x74,0x65,0x00,0x00,0x0F,0x00,0x00,0x00,0x65,0x64,0x69,0x74,0x2E,0x73,0x65,0x6C,
+    0x65,0x63,0x74,0x2D,0x61,0x6C,0x6C,0x00,0x0A,0x00,0x00,0x00,0x73,0x65,0x6C,0x65,
+    0x63,0x74,0x2D,0x61,0x6C,0x6C,0x00,0x00,0x0D,0x00,0x00,0x00,0x65,0x64,0x69,0x74,
+    0x2E,0x75,0x6E,0x69,0x6E,0x64,0x65,0x6E,0x74,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0x75,0x6E,0x69,0x6E,0x64,0x65,0x6E,0x74,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x66,0x69,0x6E,0x64,0x2E,0x66,0x69,0x6E,0x64,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x63,0x6D,0x64,0x62,0x61,0x72,0x2D,0x66,0x69,0x6E,0x64,0x2D,0x70,0x72,0x65,0x66,
+    0x69,0x6C,0x6C,0x65,0x64,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x66,0x69,0x6E,0x64,
+    0x2E,0x72,0x65,0x70,0x6C,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,
+    0x63,0x6D,0x64,0x62,0x61,0x72,0x2D,0x72,0x65,0x70,0x6C,0x61,0x63,0x65,0x2D,0x61,
+    0x6C,0x6C,0x2D,0x70,0x72,0x65,0x66,0x69,0x6C,0x6C,0x65,0x64,0x00,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x66,0x69,0x6E,0x64,0x2E,0x67,0x6F,0x74,0x6F,0x00,0x00,0x00,
+    0x0C,0x00,0x00,0x00,0x63,0x6D,0x64,0x62,0x61,0x72,0x20,0x67,0x6F,0x74,0x6F,0x20,
+    0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x6E,0x65,0x78,0x74,0x2D,0x74,0x61,0x62,
+    0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x70,0x72,0x65,0x76,0x2D,0x74,0x61,0x62,
+    0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x65,0x78,0x69,0x74,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x61,0x62,0x6F,0x75,0x74,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
+    0x6C,0x6F,0x61,0x64,0x2D,0x63,0x6F,0x6E,0x66,0x69,0x67,0x20,0x64,0x61,0x72,0x6B,
+    0x2E,0x64,0x72,0x65,0x64,0x74,0x68,0x65,0x6D,0x65,0x00,0x00,0x1B,0x00,0x00,0x00,
+    0x6C,0x6F,0x61,0x64,0x2D,0x63,0x6F,0x6E,0x66,0x69,0x67,0x20,0x6C,0x69,0x67,0x68,
+    0x74,0x2E,0x64,0x72,0x65,0x64,0x74,0x68,0x65,0x6D,0x65,0x00,0x08,0x00,0x00,0x00,
+    0x73,0x65,0x74,0x74,0x69,0x6E,0x67,0x73,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x63,0x6C,0x65,0x61,0x72,0x2D,0x72,0x65,0x63,0x65,0x6E,0x74,0x2D,0x66,0x69,0x6C,
+    0x65,0x73,0x00,0x00,0x0E,0x00,0x00,0x00,0x74,0x6F,0x67,0x67,0x6C,0x65,0x2D,0x74,
+    0x61,0x62,0x2D,0x62,0x61,0x72,0x00,0x00,0x17,0x00,0x00,0x00,0x74,0x6F,0x67,0x67,
+    0x6C,0x65,0x2D,0x61,0x75,0x74,0x6F,0x2D,0x68,0x69,0x64,0x65,0x2D,0x63,0x6D,0x64,
+    0x62,0x61,0x72,0x00,0x0D,0x00,0x00,0x00,0x61,0x64,0x64,0x2D,0x66,0x61,0x76,0x6F,
+    0x75,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x72,0x65,0x6D,0x6F,
+    0x76,0x65,0x2D,0x66,0x61,0x76,0x6F,0x75,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x73,0x61,0x76,0x65,0x2D,0x61,0x73,0x00,0x13,0x00,0x00,0x00,
     0x74,0x6F,0x67,0x67,0x6C,0x65,0x2D,0x6C,0x69,0x6E,0x65,0x2D,0x6E,0x75,0x6D,0x62,
-    0x65,0x72,0x73,0x00,0x7A,0x6F,0x6F,0x6D,0x20,0x31,0x00,0x74,0x6F,0x67,0x67,0x6C,
-    0x65,0x2D,0x77,0x6F,0x72,0x64,0x2D,0x77,0x72,0x61,0x70,0x00
+    0x65,0x72,0x73,0x00,0x06,0x00,0x00,0x00,0x7A,0x6F,0x6F,0x6D,0x20,0x31,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x74,0x6F,0x67,0x67,0x6C,0x65,0x2D,0x77,0x6F,0x72,0x64,0x2D,
+    0x77,0x72,0x61,0x70,0x00,0x00,0x00,0x00
 };
@@ -13,6 +13,9 @@ dtk_bool32 showTabBar; \
 dtk_bool32 showMenuBar; \
 dtk_bool32 autoHideCmdBar; \
 dtk_bool32 enableAutoReload; \
+dtk_bool32 restoreSession; \
+dtk_bool32 enableFileIndex; \
+int logLevel; \
 dtk_bool32 useDefaultWindowPos; \
 int windowPosX; \
 int windowPosY; \
@@ -72,6 +75,7 @@ float textEditorScale; \
 dtk_bool32 textEditorEnableAutoIndent; \
 dtk_bool32 textEditorEnableWordWrap; \
 dtk_bool32 textEditorEnableDragAndDrop; \
+int textEditorCursorBlinkTimeout; \
 dtk_color cppCommentTextColor; \
 dtk_color cppStringTextColor; \
 dtk_color cppKeywordTextColor;
@@ -1,5 +1,107 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+// The commands whose argument is completed with a file path.
+static const char* g_CmdListFileCommandNames[] = {
+    "open"
+};
+
+const char* dred_cmdbox_cmdlist__find_file_command_name(const char* commandName)
+{
+    for (size_t i = 0; i < dtk_count_of(g_CmdListFileCommandNames); ++i) {
+        if (strcmp(commandName, g_CmdListFileCommandNames[i]) == 0) {
+            return g_CmdListFileCommandNames[i];
+        }
+    }
+
+    return NULL;
+}
+
+typedef struct
+{
+    dred_cmdbox_cmdlist* pCmdList;
+    const char* rootDirectory;
+} dred_cmdbox_cmdlist__file_index_callback_data;
+
+static dtk_bool32 dred_cmdbox_cmdlist__is_favourite_or_recent_file(dred_context* pDred, const char* absolutePath)
+{
+    for (size_t i = 0; i < pDred->config.favouriteFileCount; ++i) {
+        if (dtk_path_equal(pDred->config.favouriteFiles[i], absolutePath)) {
+            return DTK_TRUE;
+        }
+    }
+
+    for (size_t i = 0; i < pDred->config.recentFileCount; ++i) {
+        if (dtk_path_equal(pDred->config.recentFiles[i], absolutePath)) {
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+static dtk_bool32 dred_cmdbox_cmdlist__on_file_index_result(const char* relativePath, void* pUserData)
+{
+    dred_cmdbox_cmdlist__file_index_callback_data* pData = (dred_cmdbox_cmdlist__file_index_callback_data*)pUserData;
+    dtk_assert(pData != NULL);
+
+    char absolutePath[DRED_MAX_PATH];
+    if (dtk_path_append(absolutePath, sizeof(absolutePath), pData->rootDirectory, relativePath) == 0) {
+        return DTK_TRUE;
+    }
+
+    if (!dred_cmdbox_cmdlist__is_favourite_or_recent_file(pData->pCmdList->pDred, absolutePath)) {
+        dred_fuzzy_matcher_add_candidate(&pData->pCmdList->fileMatcher, absolutePath, NULL);
+    }
+
+    return DTK_TRUE;
+}
+
+// A hash of the favourite and recent files, which come first in the file list. Used to know when the list needs rebuilding.
+static dtk_uint32 dred_cmdbox_cmdlist__hash_favourite_and_recent_files(dred_context* pDred)
+{
+    dtk_uint32 hash = (dtk_uint32)(pDred->config.favouriteFileCount*31 + pDred->config.recentFileCount);
+    for (size_t i = 0; i < pDred->config.favouriteFileCount; ++i) {
+        hash = dtk_hash_string(pDred->config.favouriteFiles[i], hash);
+    }
+
+    for (size_t i = 0; i < pDred->config.recentFileCount; ++i) {
+        hash = dtk_hash_string(pDred->config.recentFiles[i], hash);
+    }
+
+    return hash;
+}
+
+dred_result dred_cmdbox_cmdlist__rebuild_file_candidates(dred_cmdbox_cmdlist* pCmdList)
+{
+    dtk_assert(pCmdList != NULL);
+
+    dred_context* pDred = pCmdList->pDred;
+    dred_fuzzy_matcher_clear(&pCmdList->fileMatcher);
+
+    // Favourites come first so they win ties against recent files.
+    for (size_t i = 0; i < pDred->config.favouriteFileCount; ++i) {
+        dred_fuzzy_matcher_add_candidate(&pCmdList->fileMatcher, pDred->config.favouriteFiles[i], NULL);
+    }
+
+    for (size_t i = 0; i < pDred->config.recentFileCount; ++i) {
+        dred_fuzzy_matcher_add_candidate(&pCmdList->fileMatcher, pDred->config.recentFiles[i], NULL);
+    }
+
+    // Every file in the index is a candidate so that the fuzzy matcher does all of the narrowing down. This is only done once
+    // for each generation of the index, after which typing only narrows down the previous matches.
+    if (dred_file_index_is_ready(&pDred->fileIndex)) {
+        dred_cmdbox_cmdlist__file_index_callback_data data;
+        data.pCmdList = pCmdList;
+        data.rootDirectory = dred_file_index_get_root_directory(&pDred->fileIndex);
+        dred_file_index_find(&pDred->fileIndex, "", DRED_CMDBOX_CMDLIST_MAX_INDEXED_FILES, dred_cmdbox_cmdlist__on_file_index_result, &data);
+    }
+
+    pCmdList->fileIndexGeneration = dred_file_index_get_generation(&pDred->fileIndex);
+    pCmdList->favouriteAndRecentFilesHash = dred_cmdbox_cmdlist__hash_favourite_and_recent_files(pDred);
+
+    return DRED_SUCCESS;
+}
+
 dtk_rect dred_cmdbox_cmdlist__calculate_content_rect(dred_cmdbox_cmdlist* pCmdList)
 {
     dtk_rect rect = dtk_control_get_local_rect(DTK_CONTROL(pCmdList));
@@ -31,7 +133,7 @@ dtk_bool32 dred_cmdbox_cmdlist__find_line_index_under_point(dred_cmdbox_cmdlist*
     dtk_uint32 lineIndexUnscrolled = y / fontMetrics.lineHeight;
     dtk_uint32 lineIndex = lineIndexUnscrolled + dtk_scrollbar_get_scroll_position(&pCmdList->scrollbar);
 
-    if (lineIndex >= pCmdList->commandIndexCount) {
+    if (lineIndex >= pCmdList->itemCount) {
         return DTK_FALSE;
     }
 
@@ -54,7 +156,7 @@ void dred_cmdbox_cmdlist__update_scrollbar(dred_cmdbox_cmdlist* pCmdList)
     dtk_font_get_metrics(dtk_get_ui_font(&pCmdList->pDred->tk), uiScale, &fontMetrics);
 
     dtk_uint32 pageSize = contentHeight / fontMetrics.lineHeight;
-    dtk_scrollbar_set_range_and_page_size(&pCmdList->scrollbar, 0, (dtk_int32)pCmdList->commandIndexCount, (dtk_int32)pageSize);
+    dtk_scrollbar_set_range_and_page_size(&pCmdList->scrollbar, 0, (dtk_int32)pCmdList->itemCount, (dtk_int32)pageSize);
 }
 
 void dred_cmdbox_cmdlist__refresh_layout(dred_cmdbox_cmdlist* pCmdList)
@@ -118,12 +220,22 @@ dtk_bool32 dred_cmbox_cmdlist_event_handler(dtk_event* pEvent)
             dtk_font_metrics fontMetrics;
             dtk_font_get_metrics(dtk_get_ui_font(&pCmdList->pDred->tk), uiScale, &fontMetrics);
 
+            // Only the visible items are drawn. The file list can be long.
+            dtk_uint32 firstVisibleItem = (dtk_uint32)dtk_scrollbar_get_scroll_position(&pCmdList->scrollbar);
+            dtk_uint32 lastVisibleItem = firstVisibleItem + (dtk_uint32)((innerRect.bottom - innerRect.top) / fontMetrics.lineHeight) + 1;
+            if (lastVisibleItem > pCmdList->itemCount) {
+                lastVisibleItem = pCmdList->itemCount;
+            }
+            if (pCmdList->showOnlyFirstCommand && lastVisibleItem > firstVisibleItem + 1) {
+                lastVisibleItem = firstVisibleItem + 1;
+            }
+
             dtk_int32 penPosX = 0;
-            dtk_int32 penPosY = -dtk_scrollbar_get_scroll_position(&pCmdList->scrollbar) * fontMetrics.lineHeight;
-            for (size_t i = 0; i < pCmdList->commandIndexCount; ++i) {
+            dtk_int32 penPosY = 0;
+            for (dtk_uint32 i = firstVisibleItem; i < lastVisibleItem; ++i) {
                 dtk_font* pFont = dtk_get_ui_font(&pDred->tk);
 
-                const char* text = g_CommandNames[pCmdList->pCommandIndices[i]];
+                const char* text = dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, i);
                 size_t textLength = strlen(text);
 
                 dtk_int32 stringSizeX;
@@ -141,10 +253,6 @@ dtk_bool32 dred_cmbox_cmdlist_event_handler(dtk_event* pEvent)
                 dtk_surface_draw_rect(pEvent->paint.pSurface, dtk_rect_init((dtk_int32)stringSizeX, penPosY, innerRect.right, penPosY + fontMetrics.lineHeight), bgColor);
 
                 penPosY += fontMetrics.lineHeight;
-
-                if (pCmdList->showOnlyFirstCommand) {
-                    break;
-                }
             }
 
             // The part of the background between the bottom of the text and the bottom of the main control.
@@ -172,7 +280,17 @@ dtk_bool32 dred_cmbox_cmdlist_event_handler(dtk_event* pEvent)
         {
             dtk_uint32 itemIndex;
             if (dred_cmdbox_cmdlist__find_line_index_under_point(pCmdList, pEvent->mouseButton.x, pEvent->mouseButton.y, &itemIndex)) {
-                char* newText = dtk_make_stringf("%s ", g_CommandNames[pCmdList->pCommandIndices[itemIndex]]);
+                char* newText;
+                if (pCmdList->isCompletingFile) {
+                    newText = dtk_make_stringf("%s \"%s\"", pCmdList->pFileCommandName, dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, itemIndex));
+                } else {
+                    newText = dtk_make_stringf("%s ", dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, itemIndex));
+                }
+
+                if (newText == NULL) {
+                    break;
+                }
+
                 dred_set_command_bar_text(pCmdList->pDred, newText);
                 dred_cmdbox_cmdlist_update_list(pCmdList, newText);
                 dtk_free_string(newText);
@@ -209,12 +327,33 @@ dred_result dred_cmdbox_cmdlist_init(dred_context* pDred, dtk_control* pParent,
 
     dtk_scrollbar_set_on_scroll(&pCmdList->scrollbar, dred_cmdbox_cmdlist__on_scroll);
 
+
+    // Every command is listed when nothing has been typed, so they're added in alphabetical order.
+    result = dred_fuzzy_matcher_init(&pCmdList->commandMatcher, 0);
+    if (result != DRED_SUCCESS) {
+        return result;
+    }
+
+    dtk_uint32 commandIndices[DRED_COMMAND_COUNT];
+    dtk_uint32 commandCount = dred_find_commands_starting_with(commandIndices, dtk_count_of(commandIndices), "");
+    for (dtk_uint32 i = 0; i < commandCount; ++i) {
+        dred_fuzzy_matcher_add_candidate(&pCmdList->commandMatcher, g_CommandNames[commandIndices[i]], NULL);
+    }
+
+    result = dred_fuzzy_matcher_init(&pCmdList->fileMatcher, DRED_CMDBOX_CMDLIST_MAX_FILE_RESULTS);
+    if (result != DRED_SUCCESS) {
+        return result;
+    }
+
+    pCmdList->pActiveMatcher = &pCmdList->commandMatcher;
+
     return DTK_SUCCESS;
 }
 
 dred_result dred_cmdbox_cmdlist_uninit(dred_cmdbox_cmdlist* pCmdList)
 {
-    dtk_free(pCmdList->pCommandIndices);
+    dred_fuzzy_matcher_uninit(&pCmdList->commandMatcher);
+    dred_fuzzy_matcher_uninit(&pCmdList->fileMatcher);
     return dtk_control_uninit(DTK_CONTROL(pCmdList));
 }
 
@@ -226,59 +365,93 @@ dred_result dred_cmdbox_cmdlist_update_list(dred_cmdbox_cmdlist* pCmdList, const
         runningText = "";
     }
 
-    size_t oldSelectedCommandIndex = (size_t)-1;
-    if (pCmdList->commandIndexCount > pCmdList->selectedItemIndex) {
-        oldSelectedCommandIndex = pCmdList->pCommandIndices[pCmdList->selectedItemIndex];
+    // The selected item is restored after updating the list if it's still there.
+    dtk_bool32 wasCompletingFile = pCmdList->isCompletingFile;
+    char* oldSelectedItemText = NULL;
+    if (pCmdList->itemCount > pCmdList->selectedItemIndex) {
+        oldSelectedItemText = dtk_make_string(dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, pCmdList->selectedItemIndex));
     }
 
 
     char commandName[256];
     const char* params = dtk_next_token(runningText, commandName, sizeof(commandName));
 
-    // If the user has typed the whole command we only want to show the first one.
+    // If the user has typed the whole command we only want to show the first one, unless it's a command that takes a file in
+    // which case we show the files matching the argument.
     pCmdList->showOnlyFirstCommand = DTK_FALSE;
+    pCmdList->isCompletingFile = DTK_FALSE;
+    pCmdList->pFileCommandName = NULL;
     if (params != NULL && dtk_is_whitespace(params[0])) {
-        pCmdList->showOnlyFirstCommand = DTK_TRUE;
+        pCmdList->pFileCommandName = dred_cmdbox_cmdlist__find_file_command_name(commandName);
+        if (pCmdList->pFileCommandName != NULL) {
+            pCmdList->isCompletingFile = DTK_TRUE;
+        } else {
+            pCmdList->showOnlyFirstCommand = DTK_TRUE;
+        }
     }
 
-    dtk_uint32 commandCount = (dtk_uint32)dred_find_commands_starting_with(NULL, 0, commandName);
-    if (commandCount > pCmdList->commandIndexCapacity) {
-        dtk_uint32* pNewCommandIndices = (dtk_uint32*)dtk_realloc(pCmdList->pCommandIndices, commandCount * sizeof(*pNewCommandIndices));
-        if (pNewCommandIndices == NULL) {
-            return DTK_OUT_OF_MEMORY;
+    dred_result result;
+    if (pCmdList->isCompletingFile) {
+        // The argument may or may not be quoted. Quotes are not part of the pattern.
+        char pattern[DRED_FUZZY_MAX_PATTERN_LENGTH+1];
+        params = dtk_first_non_whitespace(params);
+        if (params[0] == '\"') {
+            params += 1;
+        }
+
+        size_t patternLength = strcspn(params, "\"");
+        if (patternLength > DRED_FUZZY_MAX_PATTERN_LENGTH) {
+            patternLength = DRED_FUZZY_MAX_PATTERN_LENGTH;
+        }
+        memcpy(pattern, params, patternLength);
+        pattern[patternLength] = '\0';
+
+        // The favourite and recent files can only change while the list isn't showing files.
+        if (pCmdList->fileIndexGeneration != dred_file_index_get_generation(&pCmdList->pDred->fileIndex) ||
+           (!wasCompletingFile && pCmdList->favouriteAndRecentFilesHash != dred_cmdbox_cmdlist__hash_favourite_and_recent_files(pCmdList->pDred)) ||
+           !pCmdList->hasFileCandidates) {
+            dred_cmdbox_cmdlist__rebuild_file_candidates(pCmdList);
+            pCmdList->hasFileCandidates = DTK_TRUE;
         }
 
-        pCmdList->pCommandIndices = pNewCommandIndices;
-        pCmdList->commandIndexCapacity = commandCount;
+        pCmdList->pActiveMatcher = &pCmdList->fileMatcher;
+        result = dred_fuzzy_matcher_set_pattern(pCmdList->pActiveMatcher, pattern);
+    } else {
+        pCmdList->pActiveMatcher = &pCmdList->commandMatcher;
+        result = dred_fuzzy_matcher_set_pattern(pCmdList->pActiveMatcher, commandName);
     }
 
-    pCmdList->commandIndexCount = commandCount;
-    dred_find_commands_starting_with(pCmdList->pCommandIndices, pCmdList->commandIndexCapacity, commandName);
+    pCmdList->itemCount = dred_fuzzy_matcher_get_result_count(pCmdList->pActiveMatcher);
 
     pCmdList->selectedItemIndex = 0;
-    if (oldSelectedCommandIndex != (size_t)-1 && pCmdList->commandIndexCount > 0) {
-        for (dtk_uint32 i = 0; i < pCmdList->commandIndexCount; ++i) {
-            if (pCmdList->pCommandIndices[i] == oldSelectedCommandIndex) {
+    if (oldSelectedItemText != NULL && wasCompletingFile == pCmdList->isCompletingFile) {
+        for (dtk_uint32 i = 0; i < pCmdList->itemCount; ++i) {
+            if (strcmp(dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, i), oldSelectedItemText) == 0) {
                 pCmdList->selectedItemIndex = i;
                 break;
             }
         }
     }
 
+    dtk_free_string(oldSelectedItemText);
+
 
     // A change in commands will change the structure of the scrollbar.
     dred_cmdbox_cmdlist__update_scrollbar(pCmdList);
     dred_cmdbox_cmdlist__scroll_to_highlighted_item(pCmdList);
 
     dtk_control_scheduled_redraw(DTK_CONTROL(pCmdList), dtk_control_get_local_rect(DTK_CONTROL(pCmdList)));
-    return DTK_SUCCESS;
+    return result;
 }
 
 dred_result dred_cmdbox_cmdlist_highlight_next_item(dred_cmdbox_cmdlist* pCmdList)
 {
     if (pCmdList == NULL) return DRED_INVALID_ARGS;
 
-    pCmdList->selectedItemIndex = (pCmdList->selectedItemIndex + 1) % pCmdList->commandIndexCount;
+    if (pCmdList->itemCount > 0) {
+        pCmdList->selectedItemIndex = (pCmdList->selectedItemIndex + 1) % pCmdList->itemCount;
+    }
+
     dred_cmdbox_cmdlist__scroll_to_highlighted_item(pCmdList);
 
     dtk_control_scheduled_redraw(DTK_CONTROL(pCmdList), dtk_control_get_local_rect(DTK_CONTROL(pCmdList)));
@@ -293,8 +466,8 @@ dred_result dred_cmdbox_cmdlist_highlight_prev_item(dred_cmdbox_cmdlist* pCmdLis
     if (pCmdList->selectedItemIndex > 0) {
         pCmdList->selectedItemIndex -= 1;
     } else {
-        if (pCmdList->commandIndexCount > 0) {
-            pCmdList->selectedItemIndex = pCmdList->commandIndexCount-1;
+        if (pCmdList->itemCount > 0) {
+            pCmdList->selectedItemIndex = pCmdList->itemCount-1;
         } else {
             pCmdList->selectedItemIndex = 0;
         }
@@ -308,11 +481,28 @@ dred_result dred_cmdbox_cmdlist_highlight_prev_item(dred_cmdbox_cmdlist* pCmdLis
 
 const char* dred_cmdbox_cmdlist_get_highlighted_command_name(dred_cmdbox_cmdlist* pCmdList)
 {
-    if (pCmdList == NULL) return NULL;
+    if (pCmdList == NULL || pCmdList->isCompletingFile) return NULL;
 
-    if (pCmdList->selectedItemIndex < pCmdList->commandIndexCount) {
-        return g_CommandNames[pCmdList->pCommandIndices[pCmdList->selectedItemIndex]];
+    if (pCmdList->selectedItemIndex < pCmdList->itemCount) {
+        return dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, pCmdList->selectedItemIndex);
     }
 
     return NULL;
-}
\ No newline at end of file
+}
+
+const char* dred_cmdbox_cmdlist_get_highlighted_file_path(dred_cmdbox_cmdlist* pCmdList)
+{
+    if (pCmdList == NULL || !pCmdList->isCompletingFile) return NULL;
+
+    if (pCmdList->selectedItemIndex < pCmdList->itemCount) {
+        return dred_fuzzy_matcher_get_result_text(pCmdList->pActiveMatcher, pCmdList->selectedItemIndex);
+    }
+
+    return NULL;
+}
+
+dtk_bool32 dred_cmdbox_cmdlist_is_completing_file(dred_cmdbox_cmdlist* pCmdList)
+{
+    if (pCmdList == NULL) return DTK_FALSE;
+    return pCmdList->isCompletingFile;
+}
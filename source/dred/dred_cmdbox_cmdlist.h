@@ -1,5 +1,11 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+// The maximum number of files to show in the list while completing the argument of a command that takes a file.
+#define DRED_CMDBOX_CMDLIST_MAX_FILE_RESULTS    1000
+
+// The maximum number of files from the file index to fuzzy match against. Files past this, in path order, are not listed.
+#define DRED_CMDBOX_CMDLIST_MAX_INDEXED_FILES   500000
+
 typedef struct
 {
     dtk_control control;
@@ -8,10 +14,20 @@ typedef struct
     char* runningText;          // Used to determine which commands should be listed.
     dtk_uint32 selectedItemIndex;
 
-    dtk_uint32* pCommandIndices;
-    dtk_uint32 commandIndexCount;
-    dtk_uint32 commandIndexCapacity;
+    // The list is populated by fuzzy matching against either the command names, or when the argument of a command that takes
+    // a file (such as "open") is being typed, a list of files. The file list is the favourite and recent files followed by
+    // every file in the file index. It's only rebuilt when the file index changes generation, or when the favourite or recent
+    // files have changed.
+    dred_fuzzy_matcher commandMatcher;
+    dred_fuzzy_matcher fileMatcher;
+    dred_fuzzy_matcher* pActiveMatcher;
+    dtk_uint32 itemCount;
+    const char* pFileCommandName;   // The name of the command whose file argument is being completed.
+    dtk_uint32 fileIndexGeneration;             // The generation of the file index the file list was built from.
+    dtk_uint32 favouriteAndRecentFilesHash;     // A hash of the favourite and recent files the file list was built from.
+    dtk_bool32 hasFileCandidates : 1;
     dtk_bool32 showOnlyFirstCommand : 1;
+    dtk_bool32 isCompletingFile : 1;
 } dred_cmdbox_cmdlist;
 
 dred_result dred_cmdbox_cmdlist_init(dred_context* pDred, dtk_control* pParent, dred_cmdbox_cmdlist* pCmdList);
@@ -19,4 +35,12 @@ dred_result dred_cmdbox_cmdlist_uninit(dred_cmdbox_cmdlist* pCmdList);
 dred_result dred_cmdbox_cmdlist_update_list(dred_cmdbox_cmdlist* pCmdList, const char* runningText);
 dred_result dred_cmdbox_cmdlist_highlight_next_item(dred_cmdbox_cmdlist* pCmdList);
 dred_result dred_cmdbox_cmdlist_highlight_prev_item(dred_cmdbox_cmdlist* pCmdList);
-const char* dred_cmdbox_cmdlist_get_highlighted_command_name(dred_cmdbox_cmdlist* pCmdList);
\ No newline at end of file
+
+// Retrieves the name of the highlighted command. Returns null if the list is showing files.
+const char* dred_cmdbox_cmdlist_get_highlighted_command_name(dred_cmdbox_cmdlist* pCmdList);
+
+// Retrieves the path of the highlighted file. Returns null if the list is showing commands.
+const char* dred_cmdbox_cmdlist_get_highlighted_file_path(dred_cmdbox_cmdlist* pCmdList);
+
+// Determines whether or not the list is showing files for the argument of a command.
+dtk_bool32 dred_cmdbox_cmdlist_is_completing_file(dred_cmdbox_cmdlist* pCmdList);
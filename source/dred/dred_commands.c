@@ -82,7 +82,7 @@ dtk_bool32 dred_command__cmdline_func(dred_context* pDred, const char* value)
         argc = dtk_winmain_to_argv(value, &argv);
     }
 
-    int result = dred_main_f_exec(argc, argv);
+    int result = dred_main_f_exec(argc, argv, pDred->pPackageLibrary);
 
     dtk_free_argv(argv);
     return (result == 0) ? DTK_TRUE : DTK_FALSE;
@@ -362,6 +362,62 @@ dtk_bool32 dred_command__settings(dred_context* pDred, const char* value)
     return DTK_TRUE;
 }
 
+dtk_bool32 dred_command__toggle_perf_hud(dred_context* pDred, const char* value)
+{
+    (void)value;
+    dred_toggle_perf_hud(pDred);
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_command__perf_dump(dred_context* pDred, const char* value)
+{
+    char outputFilePath[DRED_MAX_PATH];
+    if (dtk_next_token(value, outputFilePath, sizeof(outputFilePath)) == NULL) {
+        char logFolderPath[DRED_MAX_PATH];
+        if (dred_get_log_folder_path(pDred, logFolderPath, sizeof(logFolderPath)) == 0) {
+            dred_cmdbar_set_message(&pDred->cmdBar, "Specify an output file.");
+            return DTK_FALSE;
+        }
+
+        if (dtk_path_append(outputFilePath, sizeof(outputFilePath), logFolderPath, "dred_perf.txt") == 0) {
+            return DTK_FALSE;
+        }
+    }
+
+    if (!dred_perf_dump(pDred, outputFilePath)) {
+        dred_cmdbar_set_message(&pDred->cmdBar, "Failed to write performance counters.");
+        return DTK_FALSE;
+    }
+
+    char msg[DRED_MAX_PATH + 64];
+    snprintf(msg, sizeof(msg), "Performance counters written to %s", outputFilePath);
+    dred_cmdbar_set_message(&pDred->cmdBar, msg);
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_command__perf_counters(dred_context* pDred, const char* value)
+{
+    char state[32];
+    if (dtk_next_token(value, state, sizeof(state)) == NULL) {
+        dred_cmdbar_set_message(&pDred->cmdBar, dred_perf_is_enabled() ? "Performance counters are being recorded." : "Performance counters are not being recorded.");
+        return DTK_TRUE;
+    }
+
+    if (_stricmp(state, "on") == 0) {
+        dred_enable_perf_counters(pDred);
+        dred_cmdbar_set_message(&pDred->cmdBar, "Performance counters are being recorded.");
+    } else if (_stricmp(state, "off") == 0) {
+        dred_disable_perf_counters(pDred);
+        dred_cmdbar_set_message(&pDred->cmdBar, "Performance counters are not being recorded.");
+    } else {
+        dred_cmdbar_set_message(&pDred->cmdBar, "Usage: perf-counters on|off");
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
 dtk_bool32 dred_command__print(dred_context* pDred, const char* value)
 {
     (void)value;
@@ -370,6 +426,51 @@ dtk_bool32 dred_command__print(dred_context* pDred, const char* value)
     return dred_show_print_dialog(pDred, NULL, &printInfo) == DTK_DIALOG_RESULT_OK;
 }
 
+dtk_bool32 dred_command__export_pdf(dred_context* pDred, const char* value)
+{
+    dred_editor* pFocusedEditor = dred_get_focused_editor(pDred);
+    if (pFocusedEditor == NULL || !dred_control_is_of_type(DRED_CONTROL(pFocusedEditor), DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+        return DTK_FALSE;
+    }
+
+    const char* filePath = dred_editor_get_file_path(pFocusedEditor);
+
+    char outputFilePath[DRED_MAX_PATH];
+    if (dtk_next_token(value, outputFilePath, sizeof(outputFilePath)) == NULL) {
+        if (filePath == NULL || filePath[0] == '\0') {
+            dred_cmdbar_set_message(&pDred->cmdBar, "Specify an output file.");
+            return DTK_FALSE;
+        }
+
+        if (dtk_path_append_extension(outputFilePath, sizeof(outputFilePath), filePath, "pdf") == 0) {
+            return DTK_FALSE;
+        }
+    }
+
+    dred_font* pFont = pDred->config.pTextEditorFont;
+
+    dred_pdf_export_config config = dred_pdf_export_config_init();
+    config.title = (filePath != NULL && filePath[0] != '\0') ? dtk_path_file_name(filePath) : NULL;
+    config.tabSizeInSpaces = (unsigned int)pDred->config.textEditorTabSizeInSpaces;
+    config.showLineNumbers = pDred->config.textEditorShowLineNumbers;
+    if (pFont != NULL) {
+        config.fontFamily = pFont->desc.family;
+        config.fontSize = pFont->desc.size;
+    }
+
+    dtk_uint32 pageCount;
+    if (dred_export_text_engine_to_pdf(&DRED_TEXT_EDITOR(pFocusedEditor)->engine, outputFilePath, &config, &pageCount) != DRED_SUCCESS) {
+        dred_cmdbar_set_message(&pDred->cmdBar, "Failed to export PDF.");
+        return DTK_FALSE;
+    }
+
+    char msg[DRED_MAX_PATH + 64];
+    snprintf(msg, sizeof(msg), "Exported %u page%s to %s", pageCount, (pageCount == 1) ? "" : "s", outputFilePath);
+    dred_cmdbar_set_message(&pDred->cmdBar, msg);
+
+    return DTK_TRUE;
+}
+
 dtk_bool32 dred_command__reload(dred_context* pDred, const char* value)
 {
     (void)value;
@@ -472,6 +573,11 @@ dtk_bool32 dred_command__undo(dred_context* pDred, const char* value)
         return DTK_TRUE;
     }
 
+    if (dred_control_is_of_type(pFocusedControl, DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        dred_hex_editor_undo(DRED_HEX_EDITOR(pFocusedControl));
+        return DTK_TRUE;
+    }
+
     return DTK_FALSE;
 }
 
@@ -489,6 +595,11 @@ dtk_bool32 dred_command__redo(dred_context* pDred, const char* value)
         return DTK_TRUE;
     }
 
+    if (dred_control_is_of_type(pFocusedControl, DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        dred_hex_editor_redo(DRED_HEX_EDITOR(pFocusedControl));
+        return DTK_TRUE;
+    }
+
     return DTK_FALSE;
 }
 
@@ -612,6 +723,38 @@ dtk_bool32 dred_command__goto(dred_context* pDred, const char* value)
         }
     }
 
+    if (dred_control_is_of_type(DRED_CONTROL(pFocusedEditor), DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+        char param[256];
+        if (dtk_next_token(value, param, sizeof(param)) != NULL) {
+            if (param[strlen(param) - 1] == '%') {
+                param[strlen(param) - 1] = '\0';
+                dred_large_file_viewer_goto_ratio(DRED_LARGE_FILE_VIEWER(pFocusedEditor), (unsigned int)abs(atoi(param)));
+            } else {
+                if (!dred_large_file_viewer_goto_line(DRED_LARGE_FILE_VIEWER(pFocusedEditor), (dtk_uint64)strtoull(param, NULL, 10))) {
+                    dred_cmdbar_set_message(&pDred->cmdBar, "Line index is still being built. Try again shortly.");
+                    return DTK_FALSE;
+                }
+            }
+
+            return DTK_TRUE;
+        }
+    }
+
+    if (dred_control_is_of_type(DRED_CONTROL(pFocusedEditor), DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        char param[256];
+        if (dtk_next_token(value, param, sizeof(param)) != NULL) {
+            // The hex editor goes to byte offsets rather than lines. These can be given in hex with a "0x" prefix.
+            if (param[strlen(param) - 1] == '%') {
+                param[strlen(param) - 1] = '\0';
+                dred_hex_editor_goto_ratio(DRED_HEX_EDITOR(pFocusedEditor), (unsigned int)abs(atoi(param)));
+            } else {
+                dred_hex_editor_goto_offset(DRED_HEX_EDITOR(pFocusedEditor), (dtk_uint64)strtoull(param, NULL, 0));
+            }
+
+            return DTK_TRUE;
+        }
+    }
+
     return DTK_FALSE;
 }
 
@@ -635,6 +778,30 @@ dtk_bool32 dred_command__find(dred_context* pDred, const char* value)
         }
     }
 
+    if (dred_control_is_of_type(DRED_CONTROL(pFocusedEditor), DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+        char query[1024];
+        if (dtk_next_token(value, query, sizeof(query)) != NULL) {
+            if (!dred_large_file_viewer_find_next(DRED_LARGE_FILE_VIEWER(pFocusedEditor), query)) {
+                dred_cmdbar_set_message(&pDred->cmdBar, "No results found.");
+                return DTK_FALSE;
+            }
+
+            return DTK_TRUE;
+        }
+    }
+
+    if (dred_control_is_of_type(DRED_CONTROL(pFocusedEditor), DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        char query[1024];
+        if (dtk_next_token(value, query, sizeof(query)) != NULL) {
+            if (!dred_hex_editor_find_next(DRED_HEX_EDITOR(pFocusedEditor), query)) {
+                dred_cmdbar_set_message(&pDred->cmdBar, "No results found.");
+                return DTK_FALSE;
+            }
+
+            return DTK_TRUE;
+        }
+    }
+
     return DTK_FALSE;
 }
 
@@ -692,6 +859,71 @@ dtk_bool32 dred_command__replace_all(dred_context* pDred, const char* value)
     return DTK_FALSE;
 }
 
+dtk_bool32 dred_command__find_in_files(dred_context* pDred, const char* value)
+{
+    char query[1024];
+    value = dtk_next_token(value, query, sizeof(query));
+    if (value == NULL) {
+        dred_cmdbar_set_message(&pDred->cmdBar, "Nothing to search for.");
+        return DTK_FALSE;
+    }
+
+    // Version control directories are always ignored.
+    const char* ppIgnorePatterns[DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS] = {".git", ".svn", ".hg"};
+    dtk_uint32 ignorePatternCount = 3;
+    char ignorePatterns[DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS][256];
+
+    char directory[DRED_MAX_PATH];
+    directory[0] = '\0';
+
+    dtk_uint32 flags = 0;
+
+    char token[DRED_MAX_PATH];
+    while ((value = dtk_next_token(value, token, sizeof(token))) != NULL) {
+        if (strcmp(token, "-regex") == 0) {
+            flags |= DRED_FIND_IN_FILES_FLAG_REGEX;
+        } else if (strcmp(token, "-ignore") == 0) {
+            value = dtk_next_token(value, token, sizeof(token));
+            if (value == NULL) {
+                break;
+            }
+
+            if (ignorePatternCount < dtk_count_of(ignorePatterns)) {
+                strcpy_s(ignorePatterns[ignorePatternCount], sizeof(ignorePatterns[ignorePatternCount]), token);
+                ppIgnorePatterns[ignorePatternCount] = ignorePatterns[ignorePatternCount];
+                ignorePatternCount += 1;
+            }
+        } else {
+            strcpy_s(directory, sizeof(directory), token);
+        }
+    }
+
+    return dred_find_in_files_begin(&pDred->findInFiles, pDred, query, directory, flags, ppIgnorePatterns, ignorePatternCount);
+}
+
+dtk_bool32 dred_command__index_files(dred_context* pDred, const char* value)
+{
+    char directory[DRED_MAX_PATH];
+    if (dtk_next_token(value, directory, sizeof(directory)) == NULL) {
+        directory[0] = '\0';
+    }
+
+    const char* currentRoot = dred_file_index_get_root_directory(&pDred->fileIndex);
+    if (currentRoot != NULL) {
+        char absoluteDirectory[DRED_MAX_PATH];
+        if (directory[0] == '\0' || (dred_to_absolute_path(directory, absoluteDirectory, sizeof(absoluteDirectory)) && dtk_path_equal(absoluteDirectory, currentRoot))) {
+            return dred_file_index_rebuild(&pDred->fileIndex);
+        }
+    }
+
+    if (!dred_file_index_init(&pDred->fileIndex, pDred, directory)) {
+        dred_cmdbar_set_message(&pDred->cmdBar, "Failed to index files.");
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
 dtk_bool32 dred_command__show_line_numbers(dred_context* pDred, const char* value)
 {
     (void)value;
@@ -964,13 +1196,7 @@ dtk_uint32 dred_find_command_index(const char* cmdFunc)
         return 0;
     }
 
-    for (dtk_uint32 i = 0; i < DRED_COMMAND_COUNT; ++i) {
-        if (strcmp(cmdFunc, g_CommandNames[i]) == 0) {
-            return i;
-        }
-    }
-
-    return (dtk_uint32)-1;
+    return dred_perfect_hash_find(cmdFunc, g_CommandHashSeeds, g_CommandHashIndices, DRED_COMMAND_HASH_TABLE_SIZE, g_CommandNames, DRED_COMMAND_COUNT);
 }
 
 int dred_find_commands_starting_with_qsort_comp(const void* a, const void* b)
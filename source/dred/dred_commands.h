@@ -36,7 +36,11 @@
 // help                         dred_command__help                          DRED_CMDBAR_RELEASE_KEYBOARD
 // about                        dred_command__about                         DRED_CMDBAR_RELEASE_KEYBOARD
 // settings                     dred_command__settings                      DRED_CMDBAR_RELEASE_KEYBOARD
+// toggle-perf-hud              dred_command__toggle_perf_hud               DRED_CMDBAR_RELEASE_KEYBOARD
+// perf-dump                    dred_command__perf_dump                     DRED_CMDBAR_RELEASE_KEYBOARD
+// perf-counters                dred_command__perf_counters                 DRED_CMDBAR_RELEASE_KEYBOARD
 // print                        dred_command__print                         DRED_CMDBAR_RELEASE_KEYBOARD
+// export-pdf                   dred_command__export_pdf                    DRED_CMDBAR_RELEASE_KEYBOARD
 // reload                       dred_command__reload                        DRED_CMDBAR_RELEASE_KEYBOARD
 // undo                         dred_command__undo                          DRED_CMDBAR_NO_CLEAR
 // redo                         dred_command__redo                          DRED_CMDBAR_NO_CLEAR
@@ -49,6 +53,8 @@
 // find                         dred_command__find                          DRED_CMDBAR_NO_CLEAR
 // replace                      dred_command__replace                       DRED_CMDBAR_NO_CLEAR
 // replace-all                  dred_command__replace_all                   DRED_CMDBAR_RELEASE_KEYBOARD
+// find-in-files                dred_command__find_in_files                 DRED_CMDBAR_RELEASE_KEYBOARD
+// index-files                  dred_command__index_files                   DRED_CMDBAR_RELEASE_KEYBOARD
 // show-line-numbers            dred_command__show_line_numbers             DRED_CMDBAR_RELEASE_KEYBOARD
 // hide-line-numbers            dred_command__hide_line_numbers             DRED_CMDBAR_RELEASE_KEYBOARD
 // toggle-line-numbers          dred_command__toggle_line_numbers           DRED_CMDBAR_RELEASE_KEYBOARD
@@ -200,9 +206,39 @@ dtk_bool32 dred_command__about(dred_context* pDred, const char* value);
 // settings
 dtk_bool32 dred_command__settings(dred_context* pDred, const char* value);
 
+// toggle-perf-hud
+//
+// Shows or hides the performance HUD. The performance counters are recorded while the HUD is showing, or while they have
+// been turned on with perf-counters.
+dtk_bool32 dred_command__toggle_perf_hud(dred_context* pDred, const char* value);
+
+// perf-dump
+//
+// Usage: perf-dump [output file]
+//
+// Writes the performance counters, including their histograms, and the memory usage of each editor to a text file. If no
+// output file is given it's written to dred_perf.txt in the log folder.
+dtk_bool32 dred_command__perf_dump(dred_context* pDred, const char* value);
+
+// perf-counters
+//
+// Usage: perf-counters on|off
+//
+// Turns recording of the performance counters on or off without showing the HUD, so they can be written with perf-dump.
+// Without an argument it reports whether or not they are being recorded.
+dtk_bool32 dred_command__perf_counters(dred_context* pDred, const char* value);
+
 // print
 dtk_bool32 dred_command__print(dred_context* pDred, const char* value);
 
+// export-pdf
+//
+// Usage: export-pdf [output file]
+//
+// Exports the focused text file to PDF without showing the print dialog. If no output file is given, ".pdf" is appended to
+// the path of the file being exported.
+dtk_bool32 dred_command__export_pdf(dred_context* pDred, const char* value);
+
 // reload
 //
 // Reloads the currently focused file.
@@ -258,6 +294,20 @@ dtk_bool32 dred_command__replace(dred_context* pDred, const char* value);
 // replace-all
 dtk_bool32 dred_command__replace_all(dred_context* pDred, const char* value);
 
+// find-in-files
+//
+// Usage: find-in-files "query" [directory] [-regex] [-ignore pattern]...
+dtk_bool32 dred_command__find_in_files(dred_context* pDred, const char* value);
+
+// index-files
+//
+// Usage: index-files [directory]
+//
+// Indexes the files under the given directory so they can be opened by name with the "open" command. If no directory is
+// given, the current index is rebuilt, or the working directory is indexed if there is no index yet. The home directory and
+// the root of the file system are only indexed when they're given explicitly.
+dtk_bool32 dred_command__index_files(dred_context* pDred, const char* value);
+
 // show-line-numbers
 dtk_bool32 dred_command__show_line_numbers(dred_context* pDred, const char* value);
 
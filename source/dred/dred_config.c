@@ -48,8 +48,11 @@ typedef struct
     dred_config_on_error_proc onError;
     void* pUserData;
     dred_file file;
+    dred_config_cache_builder* pCacheBuilder;   // Null when the file is not being compiled.
 } dred_config_load_file__data;
 
+static dtk_bool32 dred_config_load_file__parse(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData, dred_config_cache_builder* pCacheBuilder);
+
 size_t dred_config_load_file__on_read(void* pUserData, void* pDataOut, size_t bytesToRead)
 {
     dred_config_load_file__data* pData = (dred_config_load_file__data*)pUserData;
@@ -69,6 +72,19 @@ void dred_config_load_file__on_pair(void* pUserData, const char* key, const char
     dred_config_load_file__data* pData = (dred_config_load_file__data*)pUserData;
     assert(pData != NULL);
 
+    // Most keys are variables so they're checked first. This is a single hash lookup.
+    dtk_uint32 varIndex = dred_config_find_variable_index__autogenerated(key);
+
+    // Includes are expanded in place when compiling so they're not recorded.
+    if (pData->pCacheBuilder != NULL && strcmp(key, "include") != 0) {
+        dred_config_cache_builder_add_pair(pData->pCacheBuilder, key, value, varIndex);
+    }
+
+    if (varIndex != (dtk_uint32)-1) {
+        dred_config_set_by_index__autogenerated(pData->pConfig, varIndex, value);
+        return;
+    }
+
     if (strcmp(key, "include") == 0) {
         char fileAbsolutePath[DRED_MAX_PATH];
         if (!dred_to_absolute_path(pData->filePath, fileAbsolutePath, sizeof(fileAbsolutePath))) {
@@ -88,7 +104,11 @@ void dred_config_load_file__on_pair(void* pUserData, const char* key, const char
             return;
         }
 
-        dred_load_config(pData->pConfig->pDred, includeAbsolutePath);
+        if (pData->pCacheBuilder != NULL) {
+            dred_config_load_file__parse(pData->pConfig, includeAbsolutePath, pData->onError, pData->pUserData, pData->pCacheBuilder);
+        } else {
+            dred_load_config(pData->pConfig->pDred, includeAbsolutePath);
+        }
         return;
     }
 
@@ -145,7 +165,7 @@ void dred_config_load_file__on_pair(void* pUserData, const char* key, const char
     }
 
 
-    dred_config_set__autogenerated(pData->pConfig, key, value);
+    dred_warningf(pData->pConfig->pDred, "Unknown config variable: %s\n", key);
 }
 
 void dred_config_load_file__on_error(void* pUserData, const char* message, unsigned int line)
@@ -153,15 +173,22 @@ void dred_config_load_file__on_error(void* pUserData, const char* message, unsig
     dred_config_load_file__data* pData = (dred_config_load_file__data*)pUserData;
     assert(pData != NULL);
 
+    if (pData->pCacheBuilder != NULL) {
+        pData->pCacheBuilder->hasError = DTK_TRUE;  // Don't cache files with errors so they're reported on every load.
+    }
+
     if (pData->onError) {
         pData->onError(pData->pConfig, pData->filePath, message, line, pData->pUserData);
     }
 }
 
-dtk_bool32 dred_config_load_file(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData)
+static dtk_bool32 dred_config_load_file__parse(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData, dred_config_cache_builder* pCacheBuilder)
 {
-    if (pConfig == NULL) {
-        return DTK_FALSE;
+    assert(pConfig != NULL);
+
+    // The file is recorded as a dependency even when it doesn't exist so that creating it later invalidates the cache.
+    if (pCacheBuilder != NULL) {
+        dred_config_cache_builder_add_dependency(pCacheBuilder, filePath);
     }
 
     dred_file file = dred_file_open(filePath, DRED_FILE_OPEN_MODE_READ);
@@ -181,6 +208,7 @@ dtk_bool32 dred_config_load_file(dred_config* pConfig, const char* filePath, dre
     data.onError = onError;
     data.pUserData = pUserData;
     data.file = file;
+    data.pCacheBuilder = pCacheBuilder;
     dtk_parse_key_value_pairs(dred_config_load_file__on_read, dred_config_load_file__on_pair, dred_config_load_file__on_error, &data);
 
     //if (pConfig->pDred->pMainWindow != NULL) {
@@ -191,6 +219,84 @@ dtk_bool32 dred_config_load_file(dred_config* pConfig, const char* filePath, dre
     return DTK_TRUE;
 }
 
+static void dred_config_load_file__replay(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData, dred_config_cache* pCache)
+{
+    assert(pConfig != NULL);
+    assert(pCache != NULL);
+
+    dred_config_load_file__data data;
+    data.pConfig = pConfig;
+    data.filePath = filePath;
+    data.onError = onError;
+    data.pUserData = pUserData;
+    data.file = NULL;
+    data.pCacheBuilder = NULL;
+
+    dtk_uint32 pairCount = dred_config_cache_get_pair_count(pCache);
+    for (dtk_uint32 iPair = 0; iPair < pairCount; ++iPair) {
+        const char* key;
+        const char* value;
+        if (dred_config_cache_get_pair(pCache, iPair, &key, &value)) {
+            dred_config_load_file__on_pair(&data, key, value);
+        }
+    }
+}
+
+static dtk_bool32 dred_config_load_file__cached(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData)
+{
+    assert(pConfig != NULL);
+    assert(filePath != NULL);
+
+    if (pConfig->pDred->isConfigCacheDisabled) {
+        return dred_config_load_file__parse(pConfig, filePath, onError, pUserData, NULL);
+    }
+
+    // Files that don't exist are not cached. Checking this first also means the common case of a missing .dred file in the
+    // working directory stays cheap.
+    char absolutePath[DRED_MAX_PATH];
+    char cacheFilePath[DRED_MAX_PATH];
+    if (!dtk_file_exists(filePath) ||
+        !dred_to_absolute_path(filePath, absolutePath, sizeof(absolutePath)) ||
+        !dred_config_cache_get_file_path(pConfig->pDred, absolutePath, cacheFilePath, sizeof(cacheFilePath))) {
+        return dred_config_load_file__parse(pConfig, filePath, onError, pUserData, NULL);
+    }
+
+    dred_config_cache cache;
+    if (dred_config_cache_open(&cache, cacheFilePath, absolutePath)) {
+        dred_config_load_file__replay(pConfig, absolutePath, onError, pUserData, &cache);
+        dred_config_cache_close(&cache);
+        return DTK_TRUE;
+    }
+
+    // The cache is either missing or out of date so the file needs to be parsed. It's compiled at the same time.
+    dred_config_cache_builder builder;
+    if (!dred_config_cache_builder_init(&builder)) {
+        return dred_config_load_file__parse(pConfig, filePath, onError, pUserData, NULL);
+    }
+
+    dtk_bool32 result = dred_config_load_file__parse(pConfig, absolutePath, onError, pUserData, &builder);
+    if (result) {
+        dred_config_cache_builder_save(&builder, cacheFilePath);
+    }
+
+    dred_config_cache_builder_uninit(&builder);
+    return result;
+}
+
+dtk_bool32 dred_config_load_file(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData)
+{
+    if (pConfig == NULL || filePath == NULL) {
+        return DTK_FALSE;
+    }
+
+    // A config file can set many variables which would otherwise restyle everything once for each one.
+    dred_config_begin_transaction(pConfig);
+    dtk_bool32 result = dred_config_load_file__cached(pConfig, filePath, onError, pUserData);
+    dred_config_end_transaction(pConfig);
+
+    return result;
+}
+
 void dred_config_set(dred_config* pConfig, const char* name, const char* value)
 {
     if (pConfig == NULL) {
@@ -339,60 +445,195 @@ void dred_config_push_recent_cmd(dred_config* pConfig, const char* cmd)
 
 
 
-// Set handlers.
+// Refreshing.
 
-void dred_config_on_set__ui_scale(dred_context* pDred)
+static void dred_config__refresh_text_editors(dred_context* pDred, dtk_uint32 flags)
 {
-    dred_refresh_layout(pDred);
-}
+    assert(pDred != NULL);
 
-void dred_config_on_set__ui_font(dred_context* pDred)
-{
-    // Everything that uses the UI font needs to be updated.
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
-    dred_settings_dialog_refresh_styling(pDred->pSettingsDialog);
+    // Every open editor is visited once regardless of how many kinds of refreshes are needed.
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
+            if (pPage != NULL && pPage->type == DTK_CONTROL_TYPE_DRED) {
+                dred_control* pDredControl = DRED_CONTROL(pPage);
+                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+                    dred_text_editor* pTextEditor = DRED_TEXT_EDITOR(pDredControl);
+
+                    if ((flags & DRED_CONFIG_REFRESH_WORD_WRAP) != 0) {
+                        if (pDred->config.textEditorEnableWordWrap) {
+                            dred_text_editor_enable_word_wrap(pTextEditor);
+                        } else {
+                            dred_text_editor_disable_word_wrap(pTextEditor);
+                        }
+                    }
+
+                    if ((flags & DRED_CONFIG_REFRESH_DRAG_AND_DROP) != 0) {
+                        if (pDred->config.textEditorEnableDragAndDrop) {
+                            dred_text_editor_enable_drag_and_drop(pTextEditor);
+                        } else {
+                            dred_text_editor_disable_drag_and_drop(pTextEditor);
+                        }
+                    }
 
-    // The UI font may have resulted in the main window's layout becoming invalid.
-    dred_update_main_window_layout(pDred);
+                    if ((flags & (DRED_CONFIG_REFRESH_TEXT_EDITORS | DRED_CONFIG_REFRESH_SYNTAX_COLORS)) != 0) {
+                        dred_text_editor_refresh_styling(pTextEditor);
+                    }
+                }
+                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+                    if ((flags & DRED_CONFIG_REFRESH_TEXT_EDITORS) != 0) {
+                        dred_large_file_viewer_refresh_styling(DRED_LARGE_FILE_VIEWER(pDredControl));
+                    }
+                }
+                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_HEX_EDITOR)) {
+                    if ((flags & DRED_CONFIG_REFRESH_TEXT_EDITORS) != 0) {
+                        dred_hex_editor_refresh_styling(DRED_HEX_EDITOR(pDredControl));
+                    }
+                }
+            }
+        }
+    }
 }
 
-void dred_config_on_set__show_tab_bar(dred_context* pDred)
+static void dred_config__refresh(dred_context* pDred, dtk_uint32 flags)
 {
-    if (pDred->config.showTabBar) {
+    assert(pDred != NULL);
+
+    if ((flags & DRED_CONFIG_REFRESH_TAB_BAR_VISIBILITY) != 0) {
         for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-            dtk_tabgroup_show_tabbar(pTabGroup);
+            if (pDred->config.showTabBar) {
+                dtk_tabgroup_show_tabbar(pTabGroup);
+            } else {
+                dtk_tabgroup_hide_tabbar(pTabGroup);
+            }
         }
-    } else {
+
+        dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS, pDred->config.showTabBar);
+        dtk_menu_set_item_checked_by_id(&pDred->menus.nothingopenView, DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS, pDred->config.showTabBar);
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_MENU_BAR_VISIBILITY) != 0) {
+        if (pDred->config.showMenuBar) {
+            dred_show_main_menu(pDred);
+        } else {
+            dred_hide_main_menu(pDred);
+        }
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_CMDBAR_VISIBILITY) != 0) {
+        if (pDred->config.autoHideCmdBar) {
+            if (!dred_cmdbar_has_keyboard_focus(&pDred->cmdBar)) {
+                dred_hide_command_bar(pDred);
+            }
+        } else {
+            dred_show_command_bar(pDred);
+        }
+
+        dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR, pDred->config.autoHideCmdBar);
+        dtk_menu_set_item_checked_by_id(&pDred->menus.nothingopenView, DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR, pDred->config.autoHideCmdBar);
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_CMDBAR) != 0) {
+        dred_cmdbar_refresh_styling(&pDred->cmdBar);
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_CMDBAR_POPUP) != 0) {
+        dred_cmdbar_popup_refresh_styling(&pDred->cmdbarPopup);
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_TABGROUPS) != 0) {
         for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-            dtk_tabgroup_hide_tabbar(pTabGroup);
+            dred_refresh_styling_tabgroup(pDred, pTabGroup);
         }
     }
 
-    dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_TABBARS, pDred->config.showTabBar);
-    dtk_menu_set_item_checked_by_id(&pDred->menus.nothingopenView, DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_TABBARS, pDred->config.showTabBar);
+    if ((flags & (DRED_CONFIG_REFRESH_TEXT_EDITORS | DRED_CONFIG_REFRESH_SYNTAX_COLORS | DRED_CONFIG_REFRESH_WORD_WRAP | DRED_CONFIG_REFRESH_DRAG_AND_DROP)) != 0) {
+        dred_config__refresh_text_editors(pDred, flags);
+
+        if ((flags & DRED_CONFIG_REFRESH_TEXT_EDITORS) != 0) {
+            dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS, pDred->config.textEditorShowLineNumbers);
+        }
+        if ((flags & DRED_CONFIG_REFRESH_WORD_WRAP) != 0) {
+            dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP, pDred->config.textEditorEnableWordWrap);
+        }
+    }
+
+    // Layout is done last since everything above can change the size of things. dred_refresh_layout() also restyles the
+    // settings dialog.
+    if ((flags & DRED_CONFIG_REFRESH_LAYOUT) != 0) {
+        dred_refresh_layout(pDred);
+    } else if ((flags & DRED_CONFIG_REFRESH_SETTINGS_DIALOG) != 0) {
+        dred_settings_dialog_refresh_styling(pDred->pSettingsDialog);
+    }
+
+    if ((flags & DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT) != 0) {
+        dred_update_main_window_layout(pDred);
+    }
 }
 
-void dred_config_on_set__show_menu_bar(dred_context* pDred)
+static void dred_config__on_set(dred_context* pDred, dtk_uint32 flags)
 {
-    if (pDred->config.showMenuBar) {
-        dred_show_main_menu(pDred);
+    assert(pDred != NULL);
+
+    if (pDred->config.transactionDepth > 0) {
+        pDred->config.pendingRefreshFlags |= flags;
     } else {
-        dred_hide_main_menu(pDred);
+        dred_config__refresh(pDred, flags);
     }
 }
 
-void dred_config_on_set__auto_hide_cmd_bar(dred_context* pDred)
+void dred_config_begin_transaction(dred_config* pConfig)
 {
-    if (pDred->config.autoHideCmdBar) {
-        if (!dred_cmdbar_has_keyboard_focus(&pDred->cmdBar)) {
-            dred_hide_command_bar(pDred);
-        }
-    } else {
-        dred_show_command_bar(pDred);
+    if (pConfig == NULL) {
+        return;
     }
 
-    dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_CMDBAR, pDred->config.autoHideCmdBar);
-    dtk_menu_set_item_checked_by_id(&pDred->menus.nothingopenView, DRED_MENU_ITEM_ID_NOTHINGOPEN_VIEW_CMDBAR, pDred->config.autoHideCmdBar);
+    pConfig->transactionDepth += 1;
+}
+
+void dred_config_end_transaction(dred_config* pConfig)
+{
+    if (pConfig == NULL || pConfig->transactionDepth == 0) {
+        return;
+    }
+
+    pConfig->transactionDepth -= 1;
+    if (pConfig->transactionDepth == 0 && pConfig->pendingRefreshFlags != 0) {
+        // The flags are cleared before refreshing in case the refresh itself changes a variable.
+        dtk_uint32 flags = pConfig->pendingRefreshFlags;
+        pConfig->pendingRefreshFlags = 0;
+        dred_config__refresh(pConfig->pDred, flags);
+    }
+}
+
+
+// Set handlers.
+
+void dred_config_on_set__ui_scale(dred_context* pDred)
+{
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_LAYOUT);
+}
+
+void dred_config_on_set__ui_font(dred_context* pDred)
+{
+    // Everything that uses the UI font needs to be updated, and it may have resulted in the main window's layout becoming
+    // invalid.
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR | DRED_CONFIG_REFRESH_SETTINGS_DIALOG | DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT);
+}
+
+void dred_config_on_set__show_tab_bar(dred_context* pDred)
+{
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_TAB_BAR_VISIBILITY);
+}
+
+void dred_config_on_set__show_menu_bar(dred_context* pDred)
+{
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_MENU_BAR_VISIBILITY);
+}
+
+void dred_config_on_set__auto_hide_cmd_bar(dred_context* pDred)
+{
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR_VISIBILITY);
 }
 
 void dred_config_on_set__enable_auto_reload(dred_context* pDred)
@@ -400,144 +641,92 @@ void dred_config_on_set__enable_auto_reload(dred_context* pDred)
     (void)pDred;
 }
 
+void dred_config_on_set__log_level(dred_context* pDred)
+{
+    dred_logger_set_level(&pDred->logger, (dtk_uint32)pDred->config.logLevel);
+}
+
 
 void dred_config_on_set__cmdbar_bg_color(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR);
 }
 
 void dred_config_on_set__cmdbar_bg_color_active(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR);
 }
 
 void dred_config_on_set__cmdbar_tb_font(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
-    dred_update_main_window_layout(pDred);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR | DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT);
 }
 
 void dred_config_on_set__cmdbar_text_color(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR);
 }
 
 void dred_config_on_set__cmdbar_text_color_active(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR);
 }
 
 void dred_config_on_set__cmdbar_padding_horz(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
-    dred_update_main_window_layout(pDred);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR | DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT);
 }
 
 void dred_config_on_set__cmdbar_padding_vert(dred_context* pDred)
 {
-    dred_cmdbar_refresh_styling(&pDred->cmdBar);
-    dred_update_main_window_layout(pDred);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR | DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT);
 }
 
 void dred_config_on_set__cmdbar_popup_bg_color_active(dred_context* pDred)
 {
-    dred_cmdbar_popup_refresh_styling(&pDred->cmdbarPopup);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR_POPUP);
 }
 
 void dred_config_on_set__cmdbar_popup_font(dred_context* pDred)
 {
-    dred_cmdbar_popup_refresh_styling(&pDred->cmdbarPopup);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR_POPUP);
 }
 
 void dred_config_on_set__cmdbar_popup_border_width(dred_context* pDred)
 {
-    dred_cmdbar_popup_refresh_styling(&pDred->cmdbarPopup);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR_POPUP);
 }
 
 void dred_config_on_set__cmdbar_popup_padding(dred_context* pDred)
 {
-    dred_cmdbar_popup_refresh_styling(&pDred->cmdbarPopup);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_CMDBAR_POPUP);
 }
 
 
 void dred_config_on_set__tabgroup_generic_refresh(dred_context* pDred)
 {
-    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-        dred_refresh_styling_tabgroup(pDred, pTabGroup);
-    }
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_TABGROUPS);
 }
 
 
 void dred_config_on_set__texteditor_generic_refresh(dred_context* pDred)
 {
-    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
-            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
-            if (pPage != NULL && pPage->type == DTK_CONTROL_TYPE_DRED) {
-                dred_control* pDredControl = DRED_CONTROL(pPage);
-                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
-                    dred_text_editor_refresh_styling(DRED_TEXT_EDITOR(pDredControl));
-                }
-            }
-        }
-    }
-
-    dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_LINENUMBERS, pDred->config.textEditorShowLineNumbers);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_TEXT_EDITORS);
 }
 
 void dred_config_on_set__texteditor_word_wrap(dred_context* pDred)
 {
-    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
-            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
-            if (pPage != NULL && pPage->type == DTK_CONTROL_TYPE_DRED) {
-                dred_control* pDredControl = DRED_CONTROL(pPage);
-                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
-                    if (pDred->config.textEditorEnableWordWrap) {
-                        dred_text_editor_enable_word_wrap(DRED_TEXT_EDITOR(pDredControl));
-                    } else {
-                        dred_text_editor_disable_word_wrap(DRED_TEXT_EDITOR(pDredControl));
-                    }
-                }
-            }
-        }
-    }
-
-    dtk_menu_set_item_checked_by_id(&pDred->menus.textView, DRED_MENU_ITEM_ID_TEXT_VIEW_WORDWRAP, pDred->config.textEditorEnableWordWrap);
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_WORD_WRAP);
 }
 
 void dred_config_on_set__texteditor_drag_and_drop(dred_context* pDred)
 {
-    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
-            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
-            if (pPage != NULL && pPage->type == DTK_CONTROL_TYPE_DRED) {
-                dred_control* pDredControl = DRED_CONTROL(pPage);
-                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
-                    if (pDred->config.textEditorEnableDragAndDrop) {
-                        dred_text_editor_enable_drag_and_drop(DRED_TEXT_EDITOR(pDredControl));
-                    } else {
-                        dred_text_editor_disable_drag_and_drop(DRED_TEXT_EDITOR(pDredControl));
-                    }
-                }
-            }
-        }
-    }
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_DRAG_AND_DROP);
 }
 
 
 void dred_config_on_set__cpp_syntax_color(dred_context* pDred)
 {
-    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
-        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
-            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
-            if (pPage != NULL && pPage->type == DTK_CONTROL_TYPE_DRED) {
-                dred_control* pDredControl = DRED_CONTROL(pPage);
-                if (dred_control_is_of_type(pDredControl, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
-                    dred_text_editor_refresh_styling(DRED_TEXT_EDITOR(pDredControl));
-                }
-            }
-        }
-    }
+    dred_config__on_set(pDred, DRED_CONFIG_REFRESH_SYNTAX_COLORS);
 }
 
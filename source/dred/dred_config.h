@@ -17,6 +17,15 @@
 // enable-auto-reload enableAutoReload dtk_bool32 dred_config_on_set__enable_auto_reload true
 //   Whether or not dirty files will automatically be reloaded. When disabled, reloading requires manual reloading via the "reload" command.
 //
+// restore-session restoreSession dtk_bool32 none true
+//   Whether or not the tabs that were open when dred was last closed are restored at startup. Restored tabs are not loaded until they are first activated. The session is not saved when dred was started with files on the command line.
+//
+// enable-file-index enableFileIndex dtk_bool32 none true
+//   Whether or not to index the files under the working directory at startup so they can be opened by name with the "open" command. The index is kept up to date in the background. The working directory is not indexed if it is the home directory or the root of the file system. See also the "index-files" command.
+//
+// log-level logLevel int dred_config_on_set__log_level 3
+//   The level of messages that are written to the log. 1 = errors, 2 = warnings, 3 = information, 4 = debug. Debug messages are only available in debug builds.
+//
 //
 // use-default-window-pos useDefaultWindowPos dtk_bool32 none true
 //   Internal use only. Used to determine whether or not the operation system should decide where to place the main window.
@@ -199,6 +208,9 @@
 // texteditor-enable-drag-and-drop textEditorEnableDragAndDrop dtk_bool32 dred_config_on_set__texteditor_drag_and_drop false
 //   Whether or not drag-and-drop should be enabled for text editors.
 //
+// texteditor-cursor-blink-timeout textEditorCursorBlinkTimeout int dred_config_on_set__texteditor_generic_refresh 15000
+//   The number of milliseconds of inactivity after which the cursor stops blinking and stays solid. Set to 0 to blink forever.
+//
 //
 // cpp-comment-text-color cppCommentTextColor color dred_config_on_set__cpp_syntax_color 64 192 92
 //   The color to use for C/C++ comments.
@@ -236,20 +248,55 @@ typedef struct
     // Aliases
     dred_alias_map aliasMap;
 
+    // The number of transactions that are currently open, and the refreshes that have been deferred until the outermost one
+    // is ended. See dred_config_begin_transaction().
+    dtk_uint32 transactionDepth;
+    dtk_uint32 pendingRefreshFlags;
+
 
     // The auto-generated variable declarations. You can find these in dred_autogenerated.h
     DRED_CONFIG_VARIABLE_DECLARATIONS
 
 } dred_config;
 
+// The categories of refreshes that are performed when a variable is changed. Setting a variable marks one or more of these
+// as dirty, and they're applied either immediately or at the end of the current transaction.
+#define DRED_CONFIG_REFRESH_LAYOUT              (1 << 0)    // dred_refresh_layout()
+#define DRED_CONFIG_REFRESH_MAIN_WINDOW_LAYOUT  (1 << 1)
+#define DRED_CONFIG_REFRESH_TAB_BAR_VISIBILITY  (1 << 2)
+#define DRED_CONFIG_REFRESH_MENU_BAR_VISIBILITY (1 << 3)
+#define DRED_CONFIG_REFRESH_CMDBAR_VISIBILITY   (1 << 4)
+#define DRED_CONFIG_REFRESH_CMDBAR              (1 << 5)
+#define DRED_CONFIG_REFRESH_CMDBAR_POPUP        (1 << 6)
+#define DRED_CONFIG_REFRESH_SETTINGS_DIALOG     (1 << 7)
+#define DRED_CONFIG_REFRESH_TABGROUPS           (1 << 8)
+#define DRED_CONFIG_REFRESH_TEXT_EDITORS        (1 << 9)    // Text editors and large file viewers.
+#define DRED_CONFIG_REFRESH_SYNTAX_COLORS       (1 << 10)   // Text editors only. Implied by DRED_CONFIG_REFRESH_TEXT_EDITORS.
+#define DRED_CONFIG_REFRESH_WORD_WRAP           (1 << 11)
+#define DRED_CONFIG_REFRESH_DRAG_AND_DROP       (1 << 12)
+
 typedef void (* dred_config_on_error_proc)(dred_config* pConfig, const char* configPath, const char* message, unsigned int line, void* pUserData);
 
 dtk_bool32 dred_config_init(dred_config* pConfig, dred_context* pDred);
 void dred_config_uninit(dred_config* pConfig);
 
 // The pUserData argument of onError will be set to pConfig.
+//
+// The compiled form of the file is used in place of the text when it's up to date. See dred_config_cache.h.
+//
+// The whole file, including its includes, is loaded inside a transaction.
 dtk_bool32 dred_config_load_file(dred_config* pConfig, const char* filePath, dred_config_on_error_proc onError, void* pUserData);
 
+// Begins a transaction. While a transaction is open, the refreshes triggered by changing variables are collected rather than
+// applied, and then applied once when the outermost transaction is ended. This is used to avoid restyling every open editor
+// once for every variable when loading a theme.
+//
+// Transactions can be nested. Every call to this must be paired with a call to dred_config_end_transaction().
+void dred_config_begin_transaction(dred_config* pConfig);
+
+// Ends a transaction. When this ends the outermost transaction, every refresh that was deferred is applied in one pass.
+void dred_config_end_transaction(dred_config* pConfig);
+
 // Sets a variable from a name/value string pair.
 void dred_config_set(dred_config* pConfig, const char* name, const char* value);
 
@@ -293,6 +340,9 @@ void dred_config_on_set__auto_hide_cmd_bar(dred_context* pDred);
 // enable-auto-reload
 void dred_config_on_set__enable_auto_reload(dred_context* pDred);
 
+// log-level
+void dred_config_on_set__log_level(dred_context* pDred);
+
 
 void dred_config_on_set__cmdbar_bg_color(dred_context* pDred);
 void dred_config_on_set__cmdbar_bg_color_active(dred_context* pDred);
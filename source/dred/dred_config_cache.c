@@ -0,0 +1,397 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+#define DRED_CONFIG_CACHE_CHUNK_SIZE    4096
+
+static dtk_bool32 dred_config_cache__hash_file(const char* filePath, dtk_uint64* pModifiedTimeOut, dtk_uint32* pContentHashOut)
+{
+    dtk_assert(pModifiedTimeOut != NULL);
+    dtk_assert(pContentHashOut != NULL);
+
+    *pModifiedTimeOut = 0;
+    *pContentHashOut = 0;
+
+    if (!dtk_file_exists(filePath)) {
+        return DTK_TRUE;    // Missing files are recorded with a time and hash of 0.
+    }
+
+    char* pFileData;
+    if (dtk_open_and_read_text_file(filePath, NULL, &pFileData) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    *pModifiedTimeOut = dtk_get_file_modified_time(filePath);
+    *pContentHashOut = dtk_hash_string(pFileData, 0);
+
+    dtk_free(pFileData);
+    return DTK_TRUE;
+}
+
+
+static dtk_bool32 dred_config_cache_builder__add_string(dred_config_cache_builder* pBuilder, const char* str, dtk_uint32* pOffsetOut)
+{
+    dtk_assert(pBuilder != NULL);
+    dtk_assert(pOffsetOut != NULL);
+
+    size_t len = strlen(str);
+    if ((size_t)pBuilder->stringsSize + len+1 > 0xFFFFFFFF) {
+        return DTK_FALSE;
+    }
+
+    if (pBuilder->stringsSize + len+1 > pBuilder->stringsCapacity) {
+        dtk_uint32 newCapacity = (dtk_uint32)dtk_round_up(pBuilder->stringsSize + len+1, DRED_CONFIG_CACHE_CHUNK_SIZE);
+        char* pNewStrings = (char*)dtk_realloc(pBuilder->pStrings, newCapacity);
+        if (pNewStrings == NULL) {
+            return DTK_FALSE;
+        }
+
+        pBuilder->pStrings = pNewStrings;
+        pBuilder->stringsCapacity = newCapacity;
+    }
+
+    *pOffsetOut = pBuilder->stringsSize;
+    memcpy(pBuilder->pStrings + pBuilder->stringsSize, str, len+1);
+    pBuilder->stringsSize += (dtk_uint32)(len+1);
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_config_cache_builder_init(dred_config_cache_builder* pBuilder)
+{
+    if (pBuilder == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_zero_object(pBuilder);
+    return DTK_TRUE;
+}
+
+void dred_config_cache_builder_uninit(dred_config_cache_builder* pBuilder)
+{
+    if (pBuilder == NULL) {
+        return;
+    }
+
+    dtk_free(pBuilder->pStrings);
+    dtk_free(pBuilder->pDependencies);
+    dtk_free(pBuilder->pPairs);
+    dtk_free(pBuilder->pPairVarIndices);
+    dtk_zero_object(pBuilder);
+}
+
+dtk_bool32 dred_config_cache_builder_add_dependency(dred_config_cache_builder* pBuilder, const char* absolutePath)
+{
+    if (pBuilder == NULL || absolutePath == NULL) {
+        return DTK_FALSE;
+    }
+
+    // A file can be included more than once, but it only needs to be checked once.
+    for (dtk_uint32 iDependency = 0; iDependency < pBuilder->dependencyCount; ++iDependency) {
+        if (strcmp(pBuilder->pStrings + pBuilder->pDependencies[iDependency].pathOffset, absolutePath) == 0) {
+            return DTK_TRUE;
+        }
+    }
+
+    if (pBuilder->dependencyCount == pBuilder->dependencyCapacity) {
+        dtk_uint32 newCapacity = (pBuilder->dependencyCapacity == 0) ? 4 : pBuilder->dependencyCapacity*2;
+        dred_config_cache_dependency* pNewDependencies = (dred_config_cache_dependency*)dtk_realloc(pBuilder->pDependencies, newCapacity * sizeof(*pNewDependencies));
+        if (pNewDependencies == NULL) {
+            pBuilder->hasError = DTK_TRUE;
+            return DTK_FALSE;
+        }
+
+        pBuilder->pDependencies = pNewDependencies;
+        pBuilder->dependencyCapacity = newCapacity;
+    }
+
+    dred_config_cache_dependency dependency;
+    if (!dred_config_cache__hash_file(absolutePath, &dependency.modifiedTime, &dependency.contentHash) ||
+        !dred_config_cache_builder__add_string(pBuilder, absolutePath, &dependency.pathOffset)) {
+        pBuilder->hasError = DTK_TRUE;
+        return DTK_FALSE;
+    }
+
+    pBuilder->pDependencies[pBuilder->dependencyCount] = dependency;
+    pBuilder->dependencyCount += 1;
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_config_cache_builder_add_pair(dred_config_cache_builder* pBuilder, const char* key, const char* value, dtk_uint32 varIndex)
+{
+    if (pBuilder == NULL || key == NULL || value == NULL) {
+        return DTK_FALSE;
+    }
+
+    // An earlier assignment of the same variable within the current run is overwritten by this one so it can be removed. The
+    // new assignment is appended rather than replacing the old one in place so that the order of the final assignments of
+    // each variable is the same as it would be without coalescing.
+    if (varIndex != (dtk_uint32)-1) {
+        for (dtk_uint32 iPair = pBuilder->runStart; iPair < pBuilder->pairCount; ++iPair) {
+            if (pBuilder->pPairVarIndices[iPair] == varIndex) {
+                memmove(pBuilder->pPairs + iPair, pBuilder->pPairs + iPair+1, (pBuilder->pairCount - iPair-1) * sizeof(*pBuilder->pPairs));
+                memmove(pBuilder->pPairVarIndices + iPair, pBuilder->pPairVarIndices + iPair+1, (pBuilder->pairCount - iPair-1) * sizeof(*pBuilder->pPairVarIndices));
+                pBuilder->pairCount -= 1;
+                break;  // There can only ever be one earlier assignment in the run.
+            }
+        }
+    }
+
+    if (pBuilder->pairCount == pBuilder->pairCapacity) {
+        dtk_uint32 newCapacity = (pBuilder->pairCapacity == 0) ? 64 : pBuilder->pairCapacity*2;
+        dred_config_cache_pair* pNewPairs = (dred_config_cache_pair*)dtk_realloc(pBuilder->pPairs, newCapacity * sizeof(*pNewPairs));
+        if (pNewPairs == NULL) {
+            pBuilder->hasError = DTK_TRUE;
+            return DTK_FALSE;
+        }
+        pBuilder->pPairs = pNewPairs;
+
+        dtk_uint32* pNewVarIndices = (dtk_uint32*)dtk_realloc(pBuilder->pPairVarIndices, newCapacity * sizeof(*pNewVarIndices));
+        if (pNewVarIndices == NULL) {
+            pBuilder->hasError = DTK_TRUE;
+            return DTK_FALSE;
+        }
+        pBuilder->pPairVarIndices = pNewVarIndices;
+
+        pBuilder->pairCapacity = newCapacity;
+    }
+
+    dred_config_cache_pair pair;
+    if (!dred_config_cache_builder__add_string(pBuilder, key, &pair.keyOffset) ||
+        !dred_config_cache_builder__add_string(pBuilder, value, &pair.valueOffset)) {
+        pBuilder->hasError = DTK_TRUE;
+        return DTK_FALSE;
+    }
+
+    pBuilder->pPairs[pBuilder->pairCount] = pair;
+    pBuilder->pPairVarIndices[pBuilder->pairCount] = varIndex;
+    pBuilder->pairCount += 1;
+
+    if (varIndex == (dtk_uint32)-1) {
+        pBuilder->runStart = pBuilder->pairCount;
+    }
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_config_cache_builder_save(dred_config_cache_builder* pBuilder, const char* cacheFilePath)
+{
+    if (pBuilder == NULL || cacheFilePath == NULL || pBuilder->hasError) {
+        return DTK_FALSE;
+    }
+
+    dred_config_cache_header header;
+    header.magic = DRED_CONFIG_CACHE_MAGIC;
+    header.version = DRED_CONFIG_CACHE_VERSION;
+    header.dependencyCount = pBuilder->dependencyCount;
+    header.pairCount = pBuilder->pairCount;
+    header.stringsSize = pBuilder->stringsSize;
+    header.reserved = 0;
+
+    size_t dependenciesSize = pBuilder->dependencyCount * sizeof(dred_config_cache_dependency);
+    size_t pairsSize = pBuilder->pairCount * sizeof(dred_config_cache_pair);
+    size_t fileSize = sizeof(header) + dependenciesSize + pairsSize + pBuilder->stringsSize;
+
+    dtk_uint8* pFileData = (dtk_uint8*)dtk_malloc(fileSize);
+    if (pFileData == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint8* pRunningData = pFileData;
+    memcpy(pRunningData, &header, sizeof(header));                          pRunningData += sizeof(header);
+    memcpy(pRunningData, pBuilder->pDependencies, dependenciesSize);        pRunningData += dependenciesSize;
+    memcpy(pRunningData, pBuilder->pPairs, pairsSize);                      pRunningData += pairsSize;
+    memcpy(pRunningData, pBuilder->pStrings, pBuilder->stringsSize);
+
+    char tempFilePath[DRED_MAX_PATH];
+    if (snprintf(tempFilePath, sizeof(tempFilePath), "%s.tmp", cacheFilePath) >= (int)sizeof(tempFilePath)) {
+        dtk_free(pFileData);
+        return DTK_FALSE;
+    }
+
+    dtk_result result = dtk_mkdir_for_file(cacheFilePath);
+    if (result == DTK_SUCCESS || result == DTK_ALREADY_EXISTS) {
+        result = dtk_open_and_write_file(tempFilePath, pFileData, fileSize);
+    }
+    dtk_free(pFileData);
+
+    if (result != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    if (dtk_move_file(tempFilePath, cacheFilePath) != DTK_SUCCESS) {
+        dtk_delete_file(tempFilePath);
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
+
+static dtk_bool32 dred_config_cache__is_dependency_valid(const dred_config_cache_dependency* pDependency, const char* filePath)
+{
+    dtk_assert(pDependency != NULL);
+    dtk_assert(filePath != NULL);
+
+    if (!dtk_file_exists(filePath)) {
+        return pDependency->modifiedTime == 0;
+    }
+
+    // Checking the modified time is cheap so that's done first. If it has changed the content is hashed to catch the case
+    // where the file was rewritten with the same content.
+    if (pDependency->modifiedTime != 0 && dtk_get_file_modified_time(filePath) == pDependency->modifiedTime) {
+        return DTK_TRUE;
+    }
+
+    dtk_uint64 modifiedTime;
+    dtk_uint32 contentHash;
+    if (!dred_config_cache__hash_file(filePath, &modifiedTime, &contentHash)) {
+        return DTK_FALSE;
+    }
+
+    return pDependency->modifiedTime != 0 && contentHash == pDependency->contentHash;
+}
+
+dtk_bool32 dred_config_cache_open(dred_config_cache* pCache, const char* cacheFilePath, const char* sourceAbsolutePath)
+{
+    if (pCache == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_zero_object(pCache);
+
+    if (cacheFilePath == NULL || sourceAbsolutePath == NULL) {
+        return DTK_FALSE;
+    }
+
+    if (dtk_mapped_file_open(cacheFilePath, DTK_FALSE, &pCache->file) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    if (pCache->file.fileSize < sizeof(dred_config_cache_header) || pCache->file.fileSize > 0xFFFFFFFF) {
+        goto on_error;
+    }
+
+    if (dtk_mapped_file_map(&pCache->file, 0, (size_t)pCache->file.fileSize, &pCache->view) != DTK_SUCCESS) {
+        goto on_error;
+    }
+
+    if (pCache->view.dataSize != pCache->file.fileSize) {
+        dtk_mapped_file_unmap(&pCache->file, &pCache->view);
+        goto on_error;
+    }
+
+    // Everything in the file is validated up front so that nothing needs to be checked while replaying.
+    const dred_config_cache_header* pHeader = (const dred_config_cache_header*)pCache->view.pData;
+    if (pHeader->magic != DRED_CONFIG_CACHE_MAGIC || pHeader->version != DRED_CONFIG_CACHE_VERSION) {
+        goto on_error_unmap;
+    }
+
+    dtk_uint64 expectedSize = sizeof(*pHeader) +
+        (dtk_uint64)pHeader->dependencyCount * sizeof(dred_config_cache_dependency) +
+        (dtk_uint64)pHeader->pairCount * sizeof(dred_config_cache_pair) +
+        pHeader->stringsSize;
+    if (expectedSize != pCache->view.dataSize || pHeader->dependencyCount == 0 || pHeader->stringsSize == 0) {
+        goto on_error_unmap;
+    }
+
+    const dred_config_cache_dependency* pDependencies = (const dred_config_cache_dependency*)(pHeader + 1);
+    const dred_config_cache_pair* pPairs = (const dred_config_cache_pair*)(pDependencies + pHeader->dependencyCount);
+    const char* pStrings = (const char*)(pPairs + pHeader->pairCount);
+
+    // With the last byte being a null terminator and every offset being in range, every string is guaranteed to be null
+    // terminated within the string data.
+    if (pStrings[pHeader->stringsSize-1] != '\0') {
+        goto on_error_unmap;
+    }
+
+    for (dtk_uint32 iPair = 0; iPair < pHeader->pairCount; ++iPair) {
+        if (pPairs[iPair].keyOffset >= pHeader->stringsSize || pPairs[iPair].valueOffset >= pHeader->stringsSize) {
+            goto on_error_unmap;
+        }
+    }
+
+    for (dtk_uint32 iDependency = 0; iDependency < pHeader->dependencyCount; ++iDependency) {
+        if (pDependencies[iDependency].pathOffset >= pHeader->stringsSize) {
+            goto on_error_unmap;
+        }
+    }
+
+    // The first dependency is always the source file itself.
+    if (strcmp(pStrings + pDependencies[0].pathOffset, sourceAbsolutePath) != 0) {
+        goto on_error_unmap;
+    }
+
+    for (dtk_uint32 iDependency = 0; iDependency < pHeader->dependencyCount; ++iDependency) {
+        if (!dred_config_cache__is_dependency_valid(&pDependencies[iDependency], pStrings + pDependencies[iDependency].pathOffset)) {
+            goto on_error_unmap;
+        }
+    }
+
+    pCache->pHeader = pHeader;
+    pCache->pPairs = pPairs;
+    pCache->pStrings = pStrings;
+    return DTK_TRUE;
+
+on_error_unmap:
+    dtk_mapped_file_unmap(&pCache->file, &pCache->view);
+on_error:
+    dtk_mapped_file_close(&pCache->file);
+    dtk_zero_object(pCache);
+    return DTK_FALSE;
+}
+
+void dred_config_cache_close(dred_config_cache* pCache)
+{
+    if (pCache == NULL || pCache->pHeader == NULL) {
+        return;
+    }
+
+    dtk_mapped_file_unmap(&pCache->file, &pCache->view);
+    dtk_mapped_file_close(&pCache->file);
+    dtk_zero_object(pCache);
+}
+
+dtk_uint32 dred_config_cache_get_pair_count(dred_config_cache* pCache)
+{
+    if (pCache == NULL || pCache->pHeader == NULL) {
+        return 0;
+    }
+
+    return pCache->pHeader->pairCount;
+}
+
+dtk_bool32 dred_config_cache_get_pair(dred_config_cache* pCache, dtk_uint32 index, const char** pKeyOut, const char** pValueOut)
+{
+    if (pCache == NULL || pCache->pHeader == NULL || index >= pCache->pHeader->pairCount) {
+        return DTK_FALSE;
+    }
+
+    if (pKeyOut) *pKeyOut = pCache->pStrings + pCache->pPairs[index].keyOffset;
+    if (pValueOut) *pValueOut = pCache->pStrings + pCache->pPairs[index].valueOffset;
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_config_cache_get_file_path(dred_context* pDred, const char* sourceAbsolutePath, char* pathOut, size_t pathOutSize)
+{
+    if (pathOut == NULL || pathOutSize == 0) {
+        return DTK_FALSE;
+    }
+
+    pathOut[0] = '\0';
+
+    if (pDred == NULL || sourceAbsolutePath == NULL) {
+        return DTK_FALSE;
+    }
+
+    char configFolderPath[DRED_MAX_PATH];
+    if (dred_get_config_folder_path(pDred, configFolderPath, sizeof(configFolderPath)) == 0) {
+        return DTK_FALSE;
+    }
+
+    // The file name is derived from the path of the source file. The full path is stored in the cache and checked when it's
+    // opened so a collision only results in a cache miss.
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "cache/%08x.dredconfigcache", (unsigned int)dtk_hash_string(sourceAbsolutePath, 0));
+
+    return dtk_path_append(pathOut, pathOutSize, configFolderPath, fileName) != 0;
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The config cache stores a compiled form of a config file so that it doesn't need to be parsed on every launch.
+//
+// The compiled form is the flattened stream of key/value pairs that came out of the parser, with includes expanded in place.
+// Runs of variable assignments are coalesced so that only the last assignment of each variable within a run is kept, which
+// means a key like texteditor-font that's set a few times across a config file and its includes only results in a single
+// font load. Anything that isn't a variable (exec, bind, alias, etc.) is kept as-is and acts as a barrier for coalescing.
+//
+// A snapshot of the resolved dred_config structure itself is not stored because it's full of pointers to fonts and images,
+// and setting many of the variables has side effects which need to happen at load time anyway. Replaying the compiled
+// stream is what avoids the parsing and redundant work.
+//
+// Each compiled file records every file it was built from (the file itself and all of its includes, including those that
+// did not exist at the time) along with their modification times and a hash of their contents. The cache is valid when
+// every dependency is either unmodified, or modified but with identical content. The latter is common with .dredprivate
+// which is rewritten every time dred exits.
+//
+// File Format
+// ===========
+// All integers are stored in the native byte order. The cache is per-machine so this is not a problem, and a byte order
+// mismatch will just fail the magic number check.
+//
+//     dred_config_cache_header
+//     dred_config_cache_dependency[dependencyCount]
+//     dred_config_cache_pair[pairCount]
+//     char strings[stringsSize]      <-- Null terminated strings referenced by offset.
+
+#define DRED_CONFIG_CACHE_MAGIC     0x47464344  // "DCFG"
+#define DRED_CONFIG_CACHE_VERSION   1
+
+typedef struct
+{
+    dtk_uint32 magic;
+    dtk_uint32 version;
+    dtk_uint32 dependencyCount;
+    dtk_uint32 pairCount;
+    dtk_uint32 stringsSize;
+    dtk_uint32 reserved;
+} dred_config_cache_header;
+
+typedef struct
+{
+    dtk_uint64 modifiedTime;    // 0 if the file did not exist.
+    dtk_uint32 contentHash;     // 0 if the file did not exist.
+    dtk_uint32 pathOffset;      // Offset into the string data.
+} dred_config_cache_dependency;
+
+typedef struct
+{
+    dtk_uint32 keyOffset;
+    dtk_uint32 valueOffset;
+} dred_config_cache_pair;
+
+
+// The builder is used for recording the compiled form of a config file while it's being parsed.
+typedef struct
+{
+    char* pStrings;
+    dtk_uint32 stringsSize;
+    dtk_uint32 stringsCapacity;
+    dred_config_cache_dependency* pDependencies;
+    dtk_uint32 dependencyCount;
+    dtk_uint32 dependencyCapacity;
+    dred_config_cache_pair* pPairs;
+    dtk_uint32* pPairVarIndices;    // The config variable index of each pair, or (dtk_uint32)-1. Used for coalescing.
+    dtk_uint32 pairCount;
+    dtk_uint32 pairCapacity;
+    dtk_uint32 runStart;            // The index of the first pair in the current run of variable assignments.
+    dtk_bool32 hasError;            // Set when something couldn't be recorded or a parse error occurred. The cache is not saved.
+} dred_config_cache_builder;
+
+// dred_config_cache_builder_init()
+dtk_bool32 dred_config_cache_builder_init(dred_config_cache_builder* pBuilder);
+
+// dred_config_cache_builder_uninit()
+void dred_config_cache_builder_uninit(dred_config_cache_builder* pBuilder);
+
+// Records a file that the compiled config depends on. The file does not need to exist.
+dtk_bool32 dred_config_cache_builder_add_dependency(dred_config_cache_builder* pBuilder, const char* absolutePath);
+
+// Records a key/value pair. varIndex should be the index of the config variable, or (dtk_uint32)-1 if the key is not a
+// variable, in which case it acts as a barrier for coalescing.
+dtk_bool32 dred_config_cache_builder_add_pair(dred_config_cache_builder* pBuilder, const char* key, const char* value, dtk_uint32 varIndex);
+
+// Writes the compiled config to the given file. The file is written to a temporary file first and then moved into place so
+// that a partially written cache is never observed by another instance.
+dtk_bool32 dred_config_cache_builder_save(dred_config_cache_builder* pBuilder, const char* cacheFilePath);
+
+
+// A compiled config file that has been opened for reading.
+typedef struct
+{
+    dtk_mapped_file file;
+    dtk_mapped_view view;
+    const dred_config_cache_header* pHeader;
+    const dred_config_cache_pair* pPairs;
+    const char* pStrings;
+} dred_config_cache;
+
+// Opens a compiled config file and validates it against the source files it was built from. This fails if the cache does
+// not exist, is corrupt, was built from a different file or if any of its dependencies have changed.
+//
+// sourceAbsolutePath is the path of the config file the cache is being opened for. This is checked against the first
+// dependency to protect against hash collisions in the cache file name.
+dtk_bool32 dred_config_cache_open(dred_config_cache* pCache, const char* cacheFilePath, const char* sourceAbsolutePath);
+
+// Closes a compiled config file.
+void dred_config_cache_close(dred_config_cache* pCache);
+
+// Retrieves the number of pairs in the compiled config.
+dtk_uint32 dred_config_cache_get_pair_count(dred_config_cache* pCache);
+
+// Retrieves a pair from the compiled config. The returned strings are valid until the cache is closed.
+dtk_bool32 dred_config_cache_get_pair(dred_config_cache* pCache, dtk_uint32 index, const char** pKeyOut, const char** pValueOut);
+
+// Retrieves the path of the compiled cache file for the given config file.
+dtk_bool32 dred_config_cache_get_file_path(dred_context* pDred, const char* sourceAbsolutePath, char* pathOut, size_t pathOutSize);
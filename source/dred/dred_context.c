@@ -73,6 +73,7 @@ void dred__update_main_window_layout(dtk_window* pWindow, dtk_int32 windowWidth,
 
     dred__update_cmdbar_layout(pDred, &pDred->cmdBar, windowWidth, windowHeight);
     dred__update_background_layout(pDred, &pDred->backgroundControl, windowWidth, windowHeight);
+    dred_perf_hud_refresh_layout(pDred->pPerfHUD);
 }
 
 
@@ -298,11 +299,11 @@ void dred__on_main_window_size(dtk_window* pWindow, dtk_int32 width, dtk_int32 h
 }
 
 
-dred_file dred__open_log_file(dred_context* pDred)
+dtk_bool32 dred__init_logger(dred_context* pDred)
 {
     char logFilePath[DRED_MAX_PATH];
     if (dred_get_log_path(pDred, logFilePath, sizeof(logFilePath)) == 0) {
-        return NULL;
+        logFilePath[0] = '\0';
     }
 
     // Make sure the folder exists.
@@ -311,7 +312,8 @@ dred_file dred__open_log_file(dred_context* pDred)
         dtk_mkdir_recursive(logFolderPath);
     }
 
-    return dred_file_open(logFilePath, DRED_FILE_OPEN_MODE_WRITE);
+    // The level is set properly when the config is loaded.
+    return dred_logger_init(&pDred->logger, logFilePath, DRED_LOG_LEVEL_INFO, !pDred->isTerminalOutputDisabled);
 }
 
 void dred_config__on_error(dred_config* pConfig, const char* configPath, const char* message, unsigned int line, void* pUserData)
@@ -350,59 +352,61 @@ dtk_thread_result DTK_THREADCALL dred_ipc_message_proc(void* pData)
     dred_context* pDred = (dred_context*)pData;
     assert(pDred != NULL);
 
-#if 0
-    while (pDred->pipeIPC != NULL) {
-        if (dtk_pipe_connect(pDred->pipeIPC) != dtk_result_success) {
-            return 0;
-        }
+    char pipeName[256];
+    if (!dred_ipc_get_pipe_name(pipeName, sizeof(pipeName))) {
+        pDred->isIPCThreadDone = DTK_TRUE;
+        return 0;
     }
-#endif
 
+    // The receive buffer is reused for every message.
+    void* pMsgBuffer = NULL;
+    size_t msgBufferCap = 0;
+
+    // The pipe is kept open and reused for every client. It's only re-opened if something goes wrong, since at that point
+    // we can no longer trust that we're at the start of a message. It's opened for writing as well as reading because on
+    // *nix platforms that is what keeps the FIFO valid between clients.
+    dtk_pipe server = NULL;
     while (!pDred->isClosing) {
-        char pipeName[256];
-        if (!dred_ipc_get_pipe_name(pipeName, sizeof(pipeName))) {
-            break;
-        }
+        if (server == NULL) {
+            if (dtk_pipe_open_named_server(pipeName, DTK_IPC_READ | DTK_IPC_WRITE, &server) != DTK_SUCCESS) {
+                break;
+            }
 
-        dtk_pipe server;
-        if (dtk_pipe_open_named_server(pipeName, DTK_IPC_READ, &server) != DTK_SUCCESS) {
-            return 0;
+            // We may have connected a temporary client during the shutdown procedure in order to return from the call above.
+            if (pDred->isClosing) {
+                break;
+            }
         }
 
-        // We may have connected a temporary client during the shutdown procedure in order to return from the call above. Here is where we close.
-        if (pDred->isClosing) {
+        dred_ipc_message_header header;
+        if (!dred_ipc_read_message(server, &header, &pMsgBuffer, &msgBufferCap)) {
             dtk_pipe_close(server);
-            return 0;
+            server = NULL;
+            continue;
         }
 
-
-        void* pMsgData;
-        dred_ipc_message_header header;
-        while (dred_ipc_read_message(server, &header, &pMsgData)) {
-            dtk_bool32 foundTerminator = DTK_FALSE;
-            switch (header.message)
-            {
-                case DRED_IPC_MESSAGE_TERMINATOR:
-                {
-                    foundTerminator = DTK_TRUE;
-                } break;
-
-                default:
-                {
-                    dtk_post_custom_event(&pDred->tk, DTK_CONTROL(&pDred->mainWindow), header.message, pMsgData, header.size);
-                } break;
+        if (header.message == DRED_IPC_MESSAGE_TERMINATOR) {
+            // The client is done. During shutdown a terminator is posted in order to return from the read above.
+            if (pDred->isClosing) {
+                break;
             }
 
-            free(pMsgData);
-
-            if (foundTerminator) {
-                break;
+            if (dtk_pipe_wait_for_next_client(server) != DTK_SUCCESS) {
+                dtk_pipe_close(server);
+                server = NULL;
             }
+        } else {
+            dtk_post_custom_event(&pDred->tk, DTK_CONTROL(&pDred->mainWindow), header.message, (header.size > 0) ? pMsgBuffer : NULL, header.size);
         }
+    }
 
+    if (server != NULL) {
         dtk_pipe_close(server);
     }
 
+    free(pMsgBuffer);
+
+    pDred->isIPCThreadDone = DTK_TRUE;
     return 0;
 }
 
@@ -423,6 +427,47 @@ static dtk_bool32 dred_background_control_event_handler(dtk_event* pEvent)
     return dtk_control_default_event_handler(pEvent);
 }
 
+static void dred__deferred_init(dred_context* pDred)
+{
+    assert(pDred != NULL);
+
+    if (pDred->isDeferredInitDone) {
+        return;
+    }
+
+    pDred->isDeferredInitDone = DTK_TRUE;
+
+    // These are the stages that were deferred until after the first paint. Each one depends only on stages that were
+    // completed in dred_init(). Anything that needs one of these earlier is responsible for waiting on it itself, which is
+    // what dred_image_library_get_image_by_id() does for the stock images.
+    dred_profiler_begin(&pDred->profiler, "deferred-init");
+    {
+        // Stock SVG images. Decoded on a worker thread.
+        dred_profiler_begin(&pDred->profiler, "stock-images");
+        dred_image_library_load_stock_images_async(&pDred->imageLibrary);
+        dred_profiler_end(&pDred->profiler);
+
+        // Recent and favourite files menus. Depends on the menus and config. Opening a file rebuilds the recent files menu
+        // in its entirety so it doesn't matter if that happens first.
+        dred_profiler_begin(&pDred->profiler, "recent-menus");
+        dred_refresh_recent_files_menu(pDred);
+        dred_refresh_favourite_files_menu(pDred);
+        dred_profiler_end(&pDred->profiler);
+
+        // File index. Loaded from disk if it's there, otherwise built on a worker thread. This may have already been started
+        // by the "index-files" command in the config.
+        if (pDred->config.enableFileIndex && dred_file_index_get_root_directory(&pDred->fileIndex) == NULL) {
+            dred_profiler_begin(&pDred->profiler, "file-index");
+            dred_file_index_init(&pDred->fileIndex, pDred, NULL);
+            dred_profiler_end(&pDred->profiler);
+        }
+    }
+    dred_profiler_end(&pDred->profiler);
+
+    // This is the last part of startup so the profile can be written now.
+    dred_profiler_flush(&pDred->profiler, pDred);
+}
+
 static dtk_bool32 dred_dtk_global_event_proc(dtk_event* pEvent)
 {
     dred_context* pDred = (dred_context*)pEvent->pTK->pUserData;
@@ -482,8 +527,31 @@ static dtk_bool32 dred_dtk_global_event_proc(dtk_event* pEvent)
             {
                 case DRED_EVENT_IPC_ACTIVATE:
                 case DRED_EVENT_IPC_OPEN:
+                case DRED_EVENT_IPC_OPEN_FILES:
+                {
+                    dred_on_ipc_message(pDred, pEvent->custom.id, pEvent->custom.pData, pEvent->custom.dataSize);
+                } break;
+
+                case DRED_EVENT_FIND_IN_FILES_RESULT:
+                case DRED_EVENT_FIND_IN_FILES_DONE:
+                {
+                    dred_find_in_files_on_event(&pDred->findInFiles, pEvent->custom.id, pEvent->custom.pData, pEvent->custom.dataSize);
+                } break;
+
+                case DRED_EVENT_FILE_INDEX_BUILT:
+                case DRED_EVENT_FILE_INDEX_CHANGED:
+                {
+                    dred_file_index_on_event(&pDred->fileIndex, pEvent->custom.id, pEvent->custom.pData, pEvent->custom.dataSize);
+                } break;
+
+                case DRED_EVENT_SESSION_PREFETCH:
                 {
-                    dred_on_ipc_message(pDred, pEvent->custom.id, pEvent->custom.pData);
+                    dred_session_on_prefetch(pDred);
+                } break;
+
+                case DRED_EVENT_DEFERRED_INIT:
+                {
+                    dred__deferred_init(pDred);
                 } break;
                 default: break;
             }
@@ -540,12 +608,234 @@ static dtk_bool32 dred_main_window_event_handler(dtk_event* pEvent)
             }
         } break;
 
+        case DTK_EVENT_PAINT:
+        {
+            // Anything that isn't needed to show the main window is deferred until after the first paint. The deferred stages
+            // are run from a separate event so that the first frame is presented before they start.
+            if (!pDred->isFirstPaintDone && pDred->isInitialized) {
+                pDred->isFirstPaintDone = DTK_TRUE;
+
+                dred_profiler_begin(&pDred->profiler, "first-paint");
+                dtk_bool32 result = dtk_window_default_event_handler(pEvent);
+                dred_profiler_end(&pDred->profiler);
+
+                if (dred_profiler_is_enabled(&pDred->profiler)) {
+                    dred_logf(pDred, "[PROFILE] Time to first paint: %.3f ms", (dtk_now_nanoseconds() - pDred->profiler.baseTime) / 1000000.0);
+                }
+
+                dtk_post_custom_event(&pDred->tk, DTK_CONTROL(&pDred->mainWindow), DRED_EVENT_DEFERRED_INIT, NULL, 0);
+                return result;
+            }
+
+            // The default handler paints every child control so this is the time it takes to paint a whole frame.
+            dtk_uint64 perfBegTime = dred_perf_begin();
+            dtk_bool32 result = dtk_window_default_event_handler(pEvent);
+            dred_perf_end(DRED_PERF_COUNTER_FRAME, perfBegTime);
+
+            return result;
+        }
+
         default: break;
     }
 
     return dtk_window_default_event_handler(pEvent);
 }
 
+void dred__query_system_font_ui(dred_font_desc* pFontDesc)
+{
+    assert(pFontDesc != NULL);
+
+    dred_font_desc fontDesc;
+    fontDesc.flags = 0;
+
+#ifdef _WIN32
+    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Segoe UI");
+    fontDesc.size = 12;
+    fontDesc.weight = dtk_font_weight_normal;
+    fontDesc.slant = dtk_font_slant_none;
+#else
+    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "sans");
+    fontDesc.size = 13;
+    fontDesc.weight = dtk_font_weight_normal;
+    fontDesc.slant = dtk_font_slant_none;
+
+    #if 1
+    GSettings* settings = g_settings_new("org.gnome.desktop.interface");
+    if (settings != NULL) {
+        char* fontName = g_settings_get_string(settings, "font-name");
+        if (fontName != NULL) {
+            PangoFontDescription* pPangoDesc = pango_font_description_from_string(fontName);
+            if (pPangoDesc != NULL) {
+                strcpy_s(fontDesc.family, sizeof(fontDesc.family), pango_font_description_get_family(pPangoDesc));
+
+                gint size = pango_font_description_get_size(pPangoDesc);
+                if (size > 0) {
+                    if (pango_font_description_get_size_is_absolute(pPangoDesc)) {
+                        fontDesc.size = size;
+                    } else {
+                        fontDesc.size = (unsigned int)(size/PANGO_SCALE * (96.0/72.0));
+                    }
+                }
+
+                fontDesc.slant = dred_font_slant_from_pango(pango_font_description_get_style(pPangoDesc));
+                fontDesc.weight = dred_font_weight_from_pango(pango_font_description_get_weight(pPangoDesc));
+
+                pango_font_description_free(pPangoDesc);
+            }
+        }
+
+        g_object_unref(settings);
+    }
+    #endif
+#endif
+
+    *pFontDesc = fontDesc;
+}
+
+void dred__query_system_font_mono(dred_font_desc* pFontDesc)
+{
+    assert(pFontDesc != NULL);
+
+    dred_font_desc fontDesc;
+    fontDesc.flags = 0;
+
+#ifdef _WIN32
+    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Consolas");
+    fontDesc.size = 13;
+    fontDesc.weight = dtk_font_weight_normal;
+    fontDesc.slant = dtk_font_slant_none;
+
+    // Fall back to Courier New by default for XP.
+    OSVERSIONINFOEXA version;
+    ZeroMemory(&version, sizeof(version));
+    version.dwOSVersionInfoSize = sizeof(version);
+    version.dwMajorVersion = 5;
+    if (VerifyVersionInfoA(&version, VER_MAJORVERSION, VerSetConditionMask(0, VER_MAJORVERSION, VER_LESS_EQUAL))) {
+        strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Courier New");
+    }
+#endif
+
+#ifdef DRED_GTK
+    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "monospace");
+    fontDesc.size = 13;
+    fontDesc.weight = dtk_font_weight_normal;
+    fontDesc.slant = dtk_font_slant_none;
+
+    #if 0
+    FcPattern* basepat = FcNameParse((const FcChar8*)"monospace");
+    if (basepat != NULL) {
+        FcConfigSubstitute(NULL, basepat, FcMatchPattern);
+        FcDefaultSubstitute(basepat);
+
+        FcResult result = FcResultNoMatch;
+        FcPattern* fontpat = FcFontMatch(NULL, basepat, &result);
+        if (fontpat != NULL && result == FcResultMatch) {
+            FcPatternPrint(fontpat);
+
+            FcChar8* family;
+            FcPatternGetString(fontpat, FC_FAMILY, 0, &family);
+            strcpy_s(fontDesc.family, sizeof(fontDesc.family), (const char*)family);
+        }
+
+        FcPatternDestroy(fontpat);
+        FcPatternDestroy(basepat);
+    }
+    #endif
+
+    #if 1
+    GSettings* settings = g_settings_new("org.gnome.desktop.interface");
+    if (settings != NULL) {
+        char* fontName = g_settings_get_string(settings, "monospace-font-name");
+        if (fontName != NULL) {
+            PangoFontDescription* pPangoDesc = pango_font_description_from_string(fontName);
+            if (pPangoDesc != NULL) {
+                strcpy_s(fontDesc.family, sizeof(fontDesc.family), pango_font_description_get_family(pPangoDesc));
+
+                gint size = pango_font_description_get_size(pPangoDesc);
+                if (size > 0) {
+                    if (pango_font_description_get_size_is_absolute(pPangoDesc)) {
+                        fontDesc.size = size;
+                    } else {
+                        fontDesc.size = (unsigned int)(size/PANGO_SCALE * (96.0/72.0));
+                    }
+                }
+
+                fontDesc.slant = dred_font_slant_from_pango(pango_font_description_get_style(pPangoDesc));
+                fontDesc.weight = dred_font_weight_from_pango(pango_font_description_get_weight(pPangoDesc));
+
+                pango_font_description_free(pPangoDesc);
+            }
+        }
+
+        g_object_unref(settings);
+    }
+    #endif
+#endif
+
+    *pFontDesc = fontDesc;
+}
+
+dtk_thread_result DTK_THREADCALL dred__system_font_thread_proc(void* pData)
+{
+    dred_context* pDred = (dred_context*)pData;
+    assert(pDred != NULL);
+
+    // This is run on a worker thread during startup. Querying the system fonts does not touch the toolkit which means it's safe
+    // to do here. Creating the fonts is done on the main thread.
+    dred__query_system_font_ui(&pDred->systemFontDescUI);
+    dred__query_system_font_mono(&pDred->systemFontDescMono);
+
+    return 0;
+}
+
+void dred__begin_system_font_query(dred_context* pDred)
+{
+    assert(pDred != NULL);
+
+    if (dtk_thread_create(&pDred->threadSystemFonts, dred__system_font_thread_proc, pDred) == DTK_SUCCESS) {
+        pDred->isSystemFontThreadRunning = DTK_TRUE;
+    }
+}
+
+dtk_bool32 dred__wait_for_system_font_query(dred_context* pDred)
+{
+    assert(pDred != NULL);
+
+    if (pDred->isSystemFontThreadRunning) {
+        dtk_thread_wait(&pDred->threadSystemFonts);
+        pDred->isSystemFontThreadRunning = DTK_FALSE;
+        pDred->hasStartupSystemFonts = DTK_TRUE;
+    }
+
+    // The results of the startup query are only used during initialization. After that we query them again so that changes to
+    // the system settings are picked up when the config is reloaded.
+    return pDred->hasStartupSystemFonts && !pDred->isInitialized;
+}
+
+dred_font* dred__load_system_font_ui(dred_context* pDred)
+{
+    dred_font_desc fontDesc;
+    if (dred__wait_for_system_font_query(pDred)) {
+        fontDesc = pDred->systemFontDescUI;
+    } else {
+        dred__query_system_font_ui(&fontDesc);
+    }
+
+    return dred_font_library_create_font(&pDred->fontLibrary, fontDesc.family, fontDesc.size, fontDesc.weight, fontDesc.slant, fontDesc.flags);
+}
+
+dred_font* dred__load_system_font_mono(dred_context* pDred)
+{
+    dred_font_desc fontDesc;
+    if (dred__wait_for_system_font_query(pDred)) {
+        fontDesc = pDred->systemFontDescMono;
+    } else {
+        dred__query_system_font_mono(&fontDesc);
+    }
+
+    return dred_font_library_create_font(&pDred->fontLibrary, fontDesc.family, fontDesc.size, fontDesc.weight, fontDesc.slant, fontDesc.flags);
+}
+
 void dred_dtk_log_callback(dtk_context* pTK, const char* message)
 {
     dred_context* pDred = (dred_context*)pTK->pUserData;
@@ -563,13 +853,29 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
     if (pDred == NULL) return DTK_FALSE;
     dtk_zero_object(pDred);
 
+    // The startup profiler needs to be enabled before anything else so it can time everything. The trace file is only taken
+    // from the explicit --profile-startup-trace option, never from a value following --profile-startup.
+    const char* profilerTraceFilePath = dtk_argv_get_value(argc, argv, "profile-startup-trace");
+    if (profilerTraceFilePath != NULL && profilerTraceFilePath[0] != '\0') {
+        dred_profiler_init(&pDred->profiler, profilerTraceFilePath);
+    } else if (dtk_argv_exists(argc, argv, "profile-startup")) {
+        dred_profiler_init(&pDred->profiler, NULL);
+    }
+
+    dred_profiler_begin(&pDred->profiler, "dred_init");
+
     // Initialize the toolkit first.
+    dred_profiler_begin(&pDred->profiler, "dtk_init");
     if (dtk_init(&pDred->tk, dred_dtk_global_event_proc, pDred) != DTK_SUCCESS) {
         return DTK_FALSE;
     }
+    dred_profiler_end(&pDred->profiler);
 
     dtk_set_log_callback(&pDred->tk, dred_dtk_log_callback);
 
+    // The system fonts are not needed until the config is loaded so they're queried on a worker thread in the meantime.
+    dred__begin_system_font_query(pDred);
+
     // The string pool is initialized with data from the pre-build tool. It contains strings for stock shortcuts, menus, etc.
     dred_string_pool_init(&pDred->stringPool, (const char*)g_InitialStringPoolData, sizeof(g_InitialStringPoolData));
 
@@ -580,6 +886,12 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
     pDred->argv = argv;
     pDred->pPackageLibrary = pPackageLibrary;
 
+    // Compiled config files are normally used when they're up to date, but it's useful to be able to bypass them when
+    // diagnosing config issues.
+    if (dtk_argv_exists(argc, argv, "no-config-cache")) {
+        pDred->isConfigCacheDisabled = DTK_TRUE;
+    }
+
 #ifdef DRED_PORTABLE
     pDred->isPortable = DTK_TRUE;
 #endif
@@ -607,43 +919,57 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
 
 
     // Make sure the user's config directory exists.
+    dred_profiler_begin(&pDred->profiler, "config-folder");
     char configFolderPath[DRED_MAX_PATH];
     dred_get_config_folder_path(pDred, configFolderPath, sizeof(configFolderPath));
     dtk_mkdir_recursive(configFolderPath);
+    dred_profiler_end(&pDred->profiler);
 
 
     // Open the log file first to ensure we're able to log as soon as possible.
-    pDred->logFile = dred__open_log_file(pDred);
+    dred_profiler_begin(&pDred->profiler, "log-file");
+    dred__init_logger(pDred);
+    dred_profiler_end(&pDred->profiler);
 
 
     // The GUI.
+    dred_profiler_begin(&pDred->profiler, "gui");
     if (!dred_gui_init_dtk(pDred->pGUI, pDred)) {
         goto on_error;
     }
+    dred_profiler_end(&pDred->profiler);
 
 
     // The font library. This needs to be initialized before loading any fonts and configs.
+    dred_profiler_begin(&pDred->profiler, "font-library");
     if (!dred_font_library_init(&pDred->fontLibrary, pDred)) {
         goto on_error;
     }
+    dred_profiler_end(&pDred->profiler);
 
     // The image library. This needs to be initialized before loading any images and configs.
+    dred_profiler_begin(&pDred->profiler, "image-library");
     if (!dred_image_library_init(&pDred->imageLibrary, pDred)) {
         goto on_error;
     }
+    dred_profiler_end(&pDred->profiler);
 
 
     // Shortcut table.
+    dred_profiler_begin(&pDred->profiler, "shortcut-table");
     if (!dred_shortcut_table_init(pDred, &pDred->shortcutTable, DRED_STOCK_SHORTCUT_COUNT)) {
         goto on_error;
     }
 
     dred_init_stock_shortcuts__autogenerated(pDred);
+    dred_profiler_end(&pDred->profiler);
 
     // Before loading configs we want to make sure any stock themes and settings are present.
+    dred_profiler_begin(&pDred->profiler, "stock-config-files");
     dred_create_config_file_if_not_exists(pDred, ".dred", "");
     dred_create_config_file_if_not_exists(pDred, "dark.dredtheme", g_StockTheme_Dark);
     dred_create_config_file_if_not_exists(pDred, "light.dredtheme", g_StockTheme_Light);
+    dred_profiler_end(&pDred->profiler);
 
 
     // Config
@@ -654,6 +980,7 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
     //   3) The .dred file from the main user directory is loaded.
     //   4) If the application is running in portable mode the "portable.dred" file is loaded, if present.
     //   5) The .dred file sitting in the working directory is loaded.
+    dred_profiler_begin(&pDred->profiler, "config");
     dred_config_init(&pDred->config, pDred);                // 1
 
     char configPath[DRED_MAX_PATH];
@@ -661,21 +988,34 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
         char configPathPrivate[DRED_MAX_PATH];
         strcpy_s(configPathPrivate, sizeof(configPathPrivate), configPath);
         strcat_s(configPathPrivate, sizeof(configPathPrivate), "private");
+        dred_profiler_begin(&pDred->profiler, "load-config:.dredprivate");
         dred_load_config(pDred, configPathPrivate);         // 2
+        dred_profiler_end(&pDred->profiler);
+        dred_profiler_begin(&pDred->profiler, "load-config:.dred");
         dred_load_config(pDred, configPath);                // 3
+        dred_profiler_end(&pDred->profiler);
         if (hasPortableConfig) {
+            dred_profiler_begin(&pDred->profiler, "load-config:portable.dred");
             dred_load_config(pDred, portableConfigPath);    // 4
+            dred_profiler_end(&pDred->profiler);
         }
     } else {
         dred_warning(pDred, "Failed to load .dred config file from user directory. The most likely cause of this is that the path is too long.");
     }
 
+    dred_profiler_begin(&pDred->profiler, "load-config:working-directory");
     dred_load_config(pDred, ".dred");                       // 5
+    dred_profiler_end(&pDred->profiler);
+    dred_profiler_end(&pDred->profiler);
+
+    // Config set handlers aren't called during initialization so the log level needs to be applied explicitly.
+    dred_logger_set_level(&pDred->logger, (dtk_uint32)pDred->config.logLevel);
 
 
 
     // Stock menus should be initialized after the shortcut table and configs because it will need access to the initial shortcut bindings
     // and recent files.
+    dred_profiler_begin(&pDred->profiler, "menus");
     dred_init_stock_menus__autogenerated(pDred);
 
     // The menu item table is what's used to bind menu items to commands and shortcuts. This table will be used for looking up the command
@@ -684,12 +1024,15 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
         goto on_error;
     }
 
-    dred_refresh_recent_files_menu(pDred);
-    dred_refresh_favourite_files_menu(pDred);
+    dred_profiler_end(&pDred->profiler);
+
+    // NOTE: The recent and favourite files menus are not populated here. That is deferred until after the first paint. See
+    // dred__deferred_init().
 
 
 
     // The main window.
+    dred_profiler_begin(&pDred->profiler, "main-window");
     dtk_result result = dtk_window_init(&pDred->tk, dred_main_window_event_handler, NULL, dtk_window_type_toplevel, "dred", 1280, 1024, &pDred->mainWindow);
     if (result != DTK_SUCCESS) {
         dred_error(pDred, "Failed to create main window.");
@@ -702,6 +1045,7 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
     }
 
     dtk_control_hide(&pDred->backgroundControl);
+    dred_profiler_end(&pDred->profiler);
 
 
     // The main tab group container.
@@ -715,6 +1059,7 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
         goto on_error;
     }*/
 
+    dred_profiler_begin(&pDred->profiler, "tabgroup");
     result = dtk_tabgroup_init(&pDred->tk, dred_main_tabgroup_event_handler, DTK_CONTROL(&pDred->mainWindow), dtk_tabgroup_tabbar_edge_top, dtk_tabbar_flow_left_to_right, dtk_tabbar_text_direction_horizontal, &pDred->mainTabGroup);
     if (result != DTK_SUCCESS) {
         dred_error(pDred, "Failed to create main tab group.\n");
@@ -723,9 +1068,11 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
 
     dtk_tabgroup_enable_close_on_middle_click(&pDred->mainTabGroup);
     dtk_tabgroup_show_tab_close_buttons(&pDred->mainTabGroup);  // We want the tab bar for the open files to have close buttons on them by default.
+    dred_profiler_end(&pDred->profiler);
 
 
     // The command bar. Ensure this is given a valid initial size.
+    dred_profiler_begin(&pDred->profiler, "cmdbar");
     if (!dred_cmdbar_init(&pDred->cmdBar, pDred, DTK_CONTROL(&pDred->mainWindow))) {
         dred_error(pDred, "Failed to create command bar.\n");
         goto on_error;
@@ -740,12 +1087,14 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
         dred_error(pDred, "Failed to create command bar popup.\n");
         goto on_error;
     }
+    dred_profiler_end(&pDred->profiler);
 
 
 
     // Show the window last to ensure child GUI elements have been initialized and in a valid state. This should be done before
     // opening the files passed on the command line, however, because the window needs to be shown in order for it to receive
     // keyboard focus.
+    dred_profiler_begin(&pDred->profiler, "show-window");
     windowPosX   = pDred->config.windowPosX;
     windowPosY   = pDred->config.windowPosY;
     windowWidth  = pDred->config.windowWidth;
@@ -767,6 +1116,7 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
         dtk_window_set_absolute_position(&pDred->mainWindow, windowPosX, windowPosY);
         dtk_window_move_into_view(&pDred->mainWindow);  // <-- This just makes sure the window is in view in case the config has an erroneous position setting.
     }
+    dred_profiler_end(&pDred->profiler);
 
     
     // We only want to use the default window position on first run.
@@ -774,10 +1124,23 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
 
 
     // Load initial files from the command line.
+    dred_profiler_begin(&pDred->profiler, "open-startup-files");
     dtk_argv_parse(argc, argv, dred_parse_cmdline__startup_files, pDred);
+    dred_profiler_end(&pDred->profiler);
+
+    // If there were no files passed on the command line, restore the previous session. Restored tabs are not loaded until
+    // they're activated so this is fast regardless of how many tabs there are. An instance that was started with files on
+    // the command line does not own the session, and does not save it on close because that would replace the previous
+    // session with just those files.
+    pDred->isSessionOwner = !dred_are_any_files_open(pDred);
+    if (pDred->isSessionOwner && pDred->config.restoreSession) {
+        dred_profiler_begin(&pDred->profiler, "restore-session");
+        dred_session_restore(pDred);
+        dred_profiler_end(&pDred->profiler);
+    }
 
-    // If there were no files passed on the command line, start with an empty text file. We can know this by simply finding the
-    // focused editor. If it's null, nothing is open.
+    // If there's still nothing open, start with an empty text file. We can know this by simply finding the focused editor. If
+    // it's null, nothing is open.
     if (dred_are_any_files_open(pDred) == DTK_FALSE) {
         dred_open_new_text_file(pDred);
     }
@@ -788,11 +1151,17 @@ dtk_bool32 dred_init(dred_context* pDred, int argc, char** argv, dred_package_li
 
 
     // Create the IPC server pipe last to ensure the context is in a valid when messages are received.
+    dred_profiler_begin(&pDred->profiler, "ipc-thread");
     if (!dtk_argv_exists(argc, argv, "noipc")) {
-        if (dtk_thread_create(&pDred->threadIPC, dred_ipc_message_proc, pDred)) {
+        if (dtk_thread_create(&pDred->threadIPC, dred_ipc_message_proc, pDred) == DTK_SUCCESS) {
+            pDred->isIPCThreadRunning = DTK_TRUE;
         }
     }
+    dred_profiler_end(&pDred->profiler);
+
 
+    dred_profiler_end(&pDred->profiler);    // dred_init
+    dred_profiler_mark(&pDred->profiler, "init-complete");
 
     pDred->isInitialized = DTK_TRUE;
     return DTK_TRUE;
@@ -810,24 +1179,64 @@ void dred_uninit(dred_context* pDred)
 
     pDred->isClosing = DTK_TRUE;
 
+    // If the window was never painted the startup profile will not have been written yet.
+    dred_profiler_flush(&pDred->profiler, pDred);
+
+    // The system font thread will have been waited on when the config was loaded, but if initialization failed before then
+    // it may still be running.
+    dred__wait_for_system_font_query(pDred);
+
+    // Any running search needs to be stopped before closing the tabs because it may be writing to one of them.
+    dred_find_in_files_cancel(&pDred->findInFiles);
+
+    // The file index has background threads which post events to the main window.
+    dred_file_index_uninit(&pDred->fileIndex);
+
 
     // Make sure any lingering tabs are forcefully closed. This should be done at a higher level so that the user
     // can be prompted to save any unsaved work or whatnot, but I'm keeping this here for sanity.
     dred_close_all_tabs(pDred);
 
 
-    // The IPC thread may be waiting for a client connection. To break from the loop we'll need to create a temporary
-    // client in order to break from it.
-    char pipeName[256];
-    if (dred_ipc_get_pipe_name(pipeName, sizeof(pipeName))) {
-        dtk_pipe tempClientPipe;
-        dtk_pipe_open_named_client(pipeName, DTK_IPC_WRITE, &tempClientPipe);
-        dtk_thread_wait(&pDred->threadIPC);
-        dtk_pipe_close(tempClientPipe);
+    // The IPC thread may be waiting for a client connection or for the next message. To break from the loop we'll need to
+    // create a temporary client and post a terminator. If the client can't connect it means the thread either hasn't
+    // opened the pipe yet or has already returned. In the former case it may still go on to wait for a client so we need
+    // to keep trying until it's done. The thread checks isClosing straight after opening the pipe so this doesn't take
+    // long, but the number of attempts is limited in case the pipe can never be opened. In that case the thread is left
+    // to be cleaned up when the process exits rather than waiting on it forever.
+    if (pDred->isIPCThreadRunning) {
+        char pipeName[256];
+        if (dred_ipc_get_pipe_name(pipeName, sizeof(pipeName))) {
+            dtk_pipe tempClientPipe = NULL;
+            for (dtk_uint32 iAttempt = 0; !pDred->isIPCThreadDone && iAttempt < DRED_IPC_SHUTDOWN_CONNECT_ATTEMPTS; ++iAttempt) {
+                if (dtk_pipe_open_named_client(pipeName, DTK_IPC_WRITE, &tempClientPipe) == DTK_SUCCESS) {
+                    dred_ipc_post_message(tempClientPipe, DRED_IPC_MESSAGE_TERMINATOR, NULL, 0);
+                    break;
+                }
+
+                tempClientPipe = NULL;
+                dtk_sleep(DRED_IPC_SHUTDOWN_CONNECT_INTERVAL);
+            }
+
+            if (tempClientPipe != NULL || pDred->isIPCThreadDone) {
+                dtk_thread_wait(&pDred->threadIPC);
+            } else {
+                dred_warningf(pDred, "Failed to stop the IPC thread.");
+            }
+
+            if (tempClientPipe != NULL) {
+                dtk_pipe_close(tempClientPipe);
+            }
+        } else {
+            dtk_thread_wait(&pDred->threadIPC);     // The thread can't get the pipe name either so it has already returned.
+        }
+
+        pDred->isIPCThreadRunning = DTK_FALSE;
     }
 
     dred_about_dialog_uninit(pDred->pAboutDialog);
     dred_settings_dialog_uninit(pDred->pSettingsDialog);
+    dred_perf_hud_uninit(pDred->pPerfHUD);
 
     dred_cmdbar_uninit(&pDred->cmdBar);
     dtk_tabgroup_uninit(&pDred->mainTabGroup);
@@ -844,9 +1253,7 @@ void dred_uninit(dred_context* pDred)
         dred_gui_uninit(pDred->pGUI);
     }
 
-    if (pDred->logFile) {
-        dred_file_close(pDred->logFile);
-    }
+    dred_logger_uninit(&pDred->logger);
 
     dtk_uninit(&pDred->tk);
 }
@@ -869,6 +1276,30 @@ int dred_run(dred_context* pDred)
     return exitCode;
 }
 
+// Asks the user what to do with any unsaved changes before closing every tab. Returns DTK_FALSE if the user hits the cancel
+// button. When the user chose to save but saving failed, *pIsSaveFailed is set and the tabs should be left open.
+static dtk_bool32 dred__confirm_close_all_tabs(dred_context* pDred, dtk_bool32* pIsSaveFailed)
+{
+    assert(pDred != NULL);
+    assert(pIsSaveFailed != NULL);
+
+    *pIsSaveFailed = DTK_FALSE;
+
+    // If there's any modified files we need to show a dialog box.
+    if (dred_are_any_open_files_modified(pDred)) {
+        unsigned int result = dred_show_yesnocancel_dialog(pDred, "You have unsaved changes. Save changes?", "Save changes?");
+        if (result == DTK_DIALOG_RESULT_YES) {
+            if (!dred_save_all_open_files_with_saveas(pDred)) {
+                *pIsSaveFailed = DTK_TRUE;
+            }
+        } else if (result == DTK_DIALOG_RESULT_CANCEL) {
+            return DTK_FALSE;
+        }
+    }
+
+    return DTK_TRUE;
+}
+
 void dred_close(dred_context* pDred)
 {
     if (pDred == NULL) {
@@ -876,10 +1307,20 @@ void dred_close(dred_context* pDred)
     }
 
     // This will return DTK_FALSE if the user hits the cancel button.
-    if (!dred_close_all_tabs_with_confirmation(pDred)) {
+    dtk_bool32 isSaveFailed;
+    if (!dred__confirm_close_all_tabs(pDred, &isSaveFailed)) {
         return;
     }
 
+    // The session needs to be saved while the tabs are still open, but only once the close has been confirmed.
+    if (pDred->config.restoreSession && pDred->isSessionOwner) {
+        dred_session_save(pDred);
+    }
+
+    if (!isSaveFailed) {
+        dred_close_all_tabs(pDred);
+    }
+
     // Make sure the settings file has been saved.
     dred_save_dredprivate(pDred);
 
@@ -889,89 +1330,84 @@ void dred_close(dred_context* pDred)
 
 
 
-void dred_log(dred_context* pDred, const char* message)
+void dred_log_level(dred_context* pDred, dtk_uint32 level, const char* message)
 {
     if (pDred == NULL || message == NULL) {
         return;
     }
 
-    // Log file.
-    if (pDred->logFile != NULL) {
-        char dateTime[64];
-        dtk_datetime_short(dtk_now(), dateTime, sizeof(dateTime));
-
-        dred_file_write_string(pDred->logFile, "[");
-        dred_file_write_string(pDred->logFile, dateTime);
-        dred_file_write_string(pDred->logFile, "]");
-        dred_file_write_line  (pDred->logFile, message);
-        dred_file_flush(pDred->logFile);
+    // Messages posted before the logger has been initialized, or after it's been uninitialized, can only go to the terminal.
+    if (pDred->logger.pRings == NULL) {
+        if (level <= DRED_LOG_LEVEL_MAX && level <= DRED_LOG_LEVEL_INFO && !pDred->isTerminalOutputDisabled) {
+            printf("%s%s\n", dred_logger_get_level_prefix(level), message);
+        }
+        return;
     }
 
-
-    // Terminal.
-    if (!pDred->isTerminalOutputDisabled) {
-        printf("%s\n", message);
-    }
+    dred_logger_post(&pDred->logger, level, message);
 }
 
-void dred_logf(dred_context* pDred, const char* format, ...)
+void dred__logv(dred_context* pDred, dtk_uint32 level, const char* format, va_list args)
 {
     if (pDred == NULL || format == NULL) {
         return;
     }
 
+    // Don't bother formatting messages that are just going to be discarded.
+    if (pDred->logger.pRings != NULL && !dred_logger_is_level_enabled(&pDred->logger, level)) {
+        return;
+    }
+
+    char msg[DRED_LOGGER_MAX_MESSAGE_LENGTH];
+    vsnprintf(msg, sizeof(msg), format, args);
+
+    dred_log_level(pDred, level, msg);
+}
+
+void dred_logf_level(dred_context* pDred, dtk_uint32 level, const char* format, ...)
+{
     va_list args;
     va_start(args, format);
-    {
-        char msg[4096];
-        vsnprintf(msg, sizeof(msg), format, args);
+    dred__logv(pDred, level, format, args);
+    va_end(args);
+}
 
-        dred_log(pDred, msg);
-    }
+void dred_log(dred_context* pDred, const char* message)
+{
+    dred_log_level(pDred, DRED_LOG_LEVEL_INFO, message);
+}
+
+void dred_logf(dred_context* pDred, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    dred__logv(pDred, DRED_LOG_LEVEL_INFO, format, args);
     va_end(args);
 }
 
 void dred_warning(dred_context* pDred, const char* message)
 {
-    dred_logf(pDred, "[WARNING] %s", message);
+    dred_log_level(pDred, DRED_LOG_LEVEL_WARNING, message);
 }
 
 void dred_warningf(dred_context* pDred, const char* format, ...)
 {
-    if (pDred == NULL || format == NULL) {
-        return;
-    }
-
     va_list args;
     va_start(args, format);
-    {
-        char msg[4096];
-        vsnprintf(msg, sizeof(msg), format, args);
-
-        dred_warning(pDred, msg);
-    }
+    dred__logv(pDred, DRED_LOG_LEVEL_WARNING, format, args);
     va_end(args);
 }
 
 void dred_error(dred_context* pDred, const char* message)
 {
-    dred_logf(pDred, "[ERROR] %s", message);
+    dred_log_level(pDred, DRED_LOG_LEVEL_ERROR, message);
 }
 
 void dred_errorf(dred_context* pDred, const char* format, ...)
 {
-    if (pDred == NULL || format == NULL) {
-        return;
-    }
-
     va_list args;
     va_start(args, format);
-    {
-        char msg[4096];
-        vsnprintf(msg, sizeof(msg), format, args);
-
-        dred_error(pDred, msg);
-    }
+    dred__logv(pDred, DRED_LOG_LEVEL_ERROR, format, args);
     va_end(args);
 }
 
@@ -1236,7 +1672,10 @@ const char* dred_get_editor_type_by_path(dred_context* pDred, const char* filePa
     }
 
     // We need to look at packages and determine which one, if any, is able to open the file. If we can't find any, we fall back
-    // to the text or hex editor.
+    // to the text or hex editor. Packages are loaded lazily so any that have declared the file's extension need to be loaded
+    // first.
+    dred_package_library_load_packages_for_file(pDred->pPackageLibrary, filePath);
+
     DRED_FOREACH_PACKAGE(pDred, pPackage) {
         if (pPackage->cbs.editor.getEditorTypeByPath) {
             const char* type = pPackage->cbs.editor.getEditorTypeByPath(pPackage, pDred, filePath);
@@ -1246,6 +1685,21 @@ const char* dred_get_editor_type_by_path(dred_context* pDred, const char* filePa
         }
     }
 
+    // Files of an unknown type that are too big to be loaded into memory are opened in the large file viewer, unless they're
+    // binary in which case the hex editor is used since it can handle files of any size. Files of a known type are checked
+    // for size in dred_create_editor_by_type() instead so that the file doesn't need to be opened here.
+    if (dred_large_file_viewer_should_open(filePath)) {
+        if (dred_hex_editor_should_open(filePath)) {
+            return DRED_CONTROL_TYPE_HEX_EDITOR;
+        }
+
+        return DRED_CONTROL_TYPE_LARGE_FILE_VIEWER;
+    }
+
+    if (dred_hex_editor_should_open(filePath)) {
+        return DRED_CONTROL_TYPE_HEX_EDITOR;
+    }
+
     return NULL;
 }
 
@@ -1359,6 +1813,70 @@ dtk_bool32 dred_open_file_by_type(dred_context* pDred, const char* filePath, con
     return DTK_TRUE;
 }
 
+dtk_bool32 dred_append_editor_tab(dred_context* pDred, dtk_tabgroup* pTabGroup, dred_editor* pEditor, dtk_uint32* pTabIndexOut)
+{
+    if (pDred == NULL || pTabGroup == NULL || pEditor == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_editor_set_on_modified(pEditor, dred__on_editor_modified);
+    dred_editor_set_on_unmodified(pEditor, dred__on_editor_unmodified);
+
+    dtk_uint32 tabIndex;
+    dtk_result result = dtk_tabgroup_append_tab(pTabGroup, NULL, DTK_CONTROL(pEditor), &tabIndex);
+    if (result != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    // The tab is not active so the editor needs to be hidden. It'll be shown when the tab is activated.
+    dtk_control_hide(DTK_CONTROL(pEditor));
+    dred__refresh_editor_tab_text(pEditor, pTabGroup, tabIndex);
+
+    if (pTabIndexOut) {
+        *pTabIndexOut = tabIndex;
+    }
+
+    return DTK_TRUE;
+}
+
+dred_editor* dred_load_placeholder_tab(dred_context* pDred, dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex)
+{
+    if (pDred == NULL || pTabGroup == NULL) {
+        return NULL;
+    }
+
+    dtk_control* pTabPage = dtk_tabgroup_get_tab_page(pTabGroup, tabIndex);
+    if (pTabPage == NULL || pTabPage->type != DTK_CONTROL_TYPE_DRED || !dred_control_is_of_type(DRED_CONTROL(pTabPage), DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR)) {
+        return NULL;
+    }
+
+    dred_placeholder_editor* pPlaceholder = DRED_PLACEHOLDER_EDITOR(pTabPage);
+
+    dred_editor* pEditor = dred_create_editor_by_type(pDred, pTabGroup, pPlaceholder->editorType, dred_editor_get_file_path(DRED_EDITOR(pPlaceholder)));
+    if (pEditor == NULL) {
+        return NULL;
+    }
+
+    dred_editor_set_on_modified(pEditor, dred__on_editor_modified);
+    dred_editor_set_on_unmodified(pEditor, dred__on_editor_unmodified);
+
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+        dred_text_editor_set_view_state(DRED_TEXT_EDITOR(pEditor), pPlaceholder->cursorCharacter, pPlaceholder->scrollX, pPlaceholder->scrollY);
+    }
+
+    // The new editor takes the place of the placeholder, including it's visibility.
+    if (!dtk_control_is_visible(pTabPage)) {
+        dtk_control_hide(DTK_CONTROL(pEditor));
+    }
+
+    dtk_tabgroup_set_tab_page(pTabGroup, tabIndex, DTK_CONTROL(pEditor));
+    dred_placeholder_editor_delete(pPlaceholder);
+
+    dred__refresh_editor_tab_text(pEditor, pTabGroup, tabIndex);
+
+    return pEditor;
+}
+
 void dred_close_focused_file(dred_context* pDred)
 {
     dtk_tabgroup* pTabGroup = dred_get_focused_tabgroup(pDred);
@@ -1473,19 +1991,15 @@ dtk_bool32 dred_close_all_tabs_with_confirmation(dred_context* pDred)
         return DTK_FALSE;
     }
 
-    // If there's any modified files we need to show a dialog box.
-    if (dred_are_any_open_files_modified(pDred)) {
-        unsigned int result = dred_show_yesnocancel_dialog(pDred, "You have unsaved changes. Save changes?", "Save changes?");
-        if (result == DTK_DIALOG_RESULT_YES) {
-            if (!dred_save_all_open_files_with_saveas(pDred)) {
-                return DTK_TRUE;
-            }
-        } else if (result == DTK_DIALOG_RESULT_CANCEL) {
-            return DTK_FALSE;
-        }
+    dtk_bool32 isSaveFailed;
+    if (!dred__confirm_close_all_tabs(pDred, &isSaveFailed)) {
+        return DTK_FALSE;
+    }
+
+    if (!isSaveFailed) {
+        dred_close_all_tabs(pDred);
     }
 
-    dred_close_all_tabs(pDred);
     return DTK_TRUE;
 }
 
@@ -1688,6 +2202,12 @@ dred_editor* dred_create_editor_by_type(dred_context* pDred, dtk_tabgroup* pTabG
     dtk_control* pParentControl = dtk_tabgroup_get_tab_page_container(pTabGroup);
     dtk_assert(pParentControl != NULL);
 
+    // A file that would be loaded into a text editor is opened in the large file viewer instead if it's too big to be loaded
+    // into memory. The size is only checked here, just before the whole file would otherwise be read.
+    if (filePathAbsolute != NULL && dred_is_control_type_of_type(editorType, DRED_CONTROL_TYPE_TEXT_EDITOR) && dred_large_file_viewer_should_open(filePathAbsolute)) {
+        editorType = DRED_CONTROL_TYPE_LARGE_FILE_VIEWER;
+    }
+
     // Check for special built-in editors first.
     dred_editor* pEditor = NULL;
     if (pEditor == NULL && dred_is_control_type_of_type(editorType, DRED_CONTROL_TYPE_TEXT_EDITOR)) {
@@ -1696,6 +2216,12 @@ dred_editor* dred_create_editor_by_type(dred_context* pDred, dtk_tabgroup* pTabG
     if (pEditor == NULL && dred_is_control_type_of_type(editorType, DRED_CONTROL_TYPE_SETTINGS_EDITOR)) {
         pEditor = DRED_EDITOR(dred_settings_editor_create(pDred, pParentControl, filePathAbsolute));
     }
+    if (pEditor == NULL && dred_is_control_type_of_type(editorType, DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+        pEditor = DRED_EDITOR(dred_large_file_viewer_create(pDred, pParentControl, (float)sizeX, (float)sizeY, filePathAbsolute));
+    }
+    if (pEditor == NULL && dred_is_control_type_of_type(editorType, DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        pEditor = DRED_EDITOR(dred_hex_editor_create(pDred, pParentControl, (float)sizeX, (float)sizeY, filePathAbsolute));
+    }
 
     // Try loading from external packages if it's an unknown extension.
     if (pEditor == NULL) {
@@ -1727,6 +2253,18 @@ void dred_delete_editor_by_type(dred_editor* pEditor)
         dred_settings_editor_delete(DRED_SETTINGS_EDITOR(pEditor));
         return;
     }
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+        dred_large_file_viewer_delete(DRED_LARGE_FILE_VIEWER(pEditor));
+        return;
+    }
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        dred_hex_editor_delete(DRED_HEX_EDITOR(pEditor));
+        return;
+    }
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR)) {
+        dred_placeholder_editor_delete(DRED_PLACEHOLDER_EDITOR(pEditor));
+        return;
+    }
 
     // If we get here it means it's not a known core editor, so check packages.
     dred_context* pDred = dred_control_get_context(DRED_CONTROL(pEditor));
@@ -2532,6 +3070,52 @@ void dred_toggle_auto_hide_command_bar(dred_context* pDred)
     }
 }
 
+void dred_toggle_perf_hud(dred_context* pDred)
+{
+    if (pDred == NULL) {
+        return;
+    }
+
+    if (pDred->pPerfHUD == NULL) {
+        dtk_result result = dred_perf_hud_init(pDred, &pDred->perfHUD);
+        if (result != DTK_SUCCESS) {
+            return;
+        }
+
+        pDred->pPerfHUD = &pDred->perfHUD;
+    }
+
+    if (dred_perf_hud_is_showing(pDred->pPerfHUD)) {
+        dred_perf_hud_hide(pDred->pPerfHUD);
+    } else {
+        dred_perf_hud_show(pDred->pPerfHUD);
+    }
+}
+
+void dred_enable_perf_counters(dred_context* pDred)
+{
+    if (pDred == NULL) {
+        return;
+    }
+
+    pDred->isRecordingPerfCounters = DTK_TRUE;
+    dred_perf_set_enabled(DTK_TRUE);
+}
+
+void dred_disable_perf_counters(dred_context* pDred)
+{
+    if (pDred == NULL) {
+        return;
+    }
+
+    pDred->isRecordingPerfCounters = DTK_FALSE;
+
+    // The HUD needs the counters for as long as it's showing.
+    if (!dred_perf_hud_is_showing(pDred->pPerfHUD)) {
+        dred_perf_set_enabled(DTK_FALSE);
+    }
+}
+
 
 void dred_set_text_editor_scale(dred_context* pDred, float scale)
 {
@@ -2574,136 +3158,6 @@ void dred_set_config_variable(dred_context* pDred, const char* name, const char*
 }
 
 
-dred_font* dred__load_system_font_ui(dred_context* pDred)
-{
-    dred_font_desc fontDesc;
-    fontDesc.flags = 0;
-
-#ifdef _WIN32
-    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Segoe UI");
-    fontDesc.size = 12;
-    fontDesc.weight = dtk_font_weight_normal;
-    fontDesc.slant = dtk_font_slant_none;
-#else
-    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "sans");
-    fontDesc.size = 13;
-    fontDesc.weight = dtk_font_weight_normal;
-    fontDesc.slant = dtk_font_slant_none;
-
-    #if 1
-    GSettings* settings = g_settings_new("org.gnome.desktop.interface");
-    if (settings != NULL) {
-        char* fontName = g_settings_get_string(settings, "font-name");
-        if (fontName != NULL) {
-            PangoFontDescription* pPangoDesc = pango_font_description_from_string(fontName);
-            if (pPangoDesc != NULL) {
-                strcpy_s(fontDesc.family, sizeof(fontDesc.family), pango_font_description_get_family(pPangoDesc));
-
-                gint size = pango_font_description_get_size(pPangoDesc);
-                if (size > 0) {
-                    if (pango_font_description_get_size_is_absolute(pPangoDesc)) {
-                        fontDesc.size = size;
-                    } else {
-                        fontDesc.size = (unsigned int)(size/PANGO_SCALE * (96.0/72.0));
-                    }
-                }
-
-                fontDesc.slant = dred_font_slant_from_pango(pango_font_description_get_style(pPangoDesc));
-                fontDesc.weight = dred_font_weight_from_pango(pango_font_description_get_weight(pPangoDesc));
-
-                pango_font_description_free(pPangoDesc);
-            }
-        }
-
-        g_object_unref(settings);
-    }
-    #endif
-#endif
-
-    return dred_font_library_create_font(&pDred->fontLibrary, fontDesc.family, fontDesc.size, fontDesc.weight, fontDesc.slant, fontDesc.flags);
-}
-
-dred_font* dred__load_system_font_mono(dred_context* pDred)
-{
-    dred_font_desc fontDesc;
-    fontDesc.flags = 0;
-
-#ifdef _WIN32
-    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Consolas");
-    fontDesc.size = 13;
-    fontDesc.weight = dtk_font_weight_normal;
-    fontDesc.slant = dtk_font_slant_none;
-
-    // Fall back to Courier New by default for XP.
-    OSVERSIONINFOEXA version;
-    ZeroMemory(&version, sizeof(version));
-    version.dwOSVersionInfoSize = sizeof(version);
-    version.dwMajorVersion = 5;
-    if (VerifyVersionInfoA(&version, VER_MAJORVERSION, VerSetConditionMask(0, VER_MAJORVERSION, VER_LESS_EQUAL))) {
-        strcpy_s(fontDesc.family, sizeof(fontDesc.family), "Courier New");
-    }
-#endif
-
-#ifdef DRED_GTK
-    strcpy_s(fontDesc.family, sizeof(fontDesc.family), "monospace");
-    fontDesc.size = 13;
-    fontDesc.weight = dtk_font_weight_normal;
-    fontDesc.slant = dtk_font_slant_none;
-
-    #if 0
-    FcPattern* basepat = FcNameParse((const FcChar8*)"monospace");
-    if (basepat != NULL) {
-        FcConfigSubstitute(NULL, basepat, FcMatchPattern);
-        FcDefaultSubstitute(basepat);
-
-        FcResult result = FcResultNoMatch;
-        FcPattern* fontpat = FcFontMatch(NULL, basepat, &result);
-        if (fontpat != NULL && result == FcResultMatch) {
-            FcPatternPrint(fontpat);
-
-            FcChar8* family;
-            FcPatternGetString(fontpat, FC_FAMILY, 0, &family);
-            strcpy_s(fontDesc.family, sizeof(fontDesc.family), (const char*)family);
-        }
-
-        FcPatternDestroy(fontpat);
-        FcPatternDestroy(basepat);
-    }
-    #endif
-
-    #if 1
-    GSettings* settings = g_settings_new("org.gnome.desktop.interface");
-    if (settings != NULL) {
-        char* fontName = g_settings_get_string(settings, "monospace-font-name");
-        if (fontName != NULL) {
-            PangoFontDescription* pPangoDesc = pango_font_description_from_string(fontName);
-            if (pPangoDesc != NULL) {
-                strcpy_s(fontDesc.family, sizeof(fontDesc.family), pango_font_description_get_family(pPangoDesc));
-
-                gint size = pango_font_description_get_size(pPangoDesc);
-                if (size > 0) {
-                    if (pango_font_description_get_size_is_absolute(pPangoDesc)) {
-                        fontDesc.size = size;
-                    } else {
-                        fontDesc.size = (unsigned int)(size/PANGO_SCALE * (96.0/72.0));
-                    }
-                }
-
-                fontDesc.slant = dred_font_slant_from_pango(pango_font_description_get_style(pPangoDesc));
-                fontDesc.weight = dred_font_weight_from_pango(pango_font_description_get_weight(pPangoDesc));
-
-                pango_font_description_free(pPangoDesc);
-            }
-        }
-
-        g_object_unref(settings);
-    }
-    #endif
-#endif
-
-    return dred_font_library_create_font(&pDred->fontLibrary, fontDesc.family, fontDesc.size, fontDesc.weight, fontDesc.slant, fontDesc.flags);
-}
-
 dred_font* dred_parse_and_load_font(dred_context* pDred, const char* value)
 {
     // Check for pre-defined fonts first.
@@ -2806,6 +3260,10 @@ void dred_on_tab_activated(dred_context* pDred, dtk_tabgroup* pTabGroup, dtk_uin
         return;
     }
 
+    // Tabs restored from the previous session aren't loaded until they're activated for the first time. This needs to be
+    // done before the tab page is shown.
+    dred_load_placeholder_tab(pDred, pTabGroup, newActivateTabIndex);
+
     if (pTabGroup == dred_get_focused_tabgroup(pDred)) {
         dtk_control* pControl = dtk_tabgroup_get_tab_page(pTabGroup, newActivateTabIndex);
         if (pControl == NULL) {
@@ -2856,28 +3314,31 @@ void dred_on_tab_deactivated(dred_context* pDred, dtk_tabgroup* pTabGroup, dtk_u
 
 void dred_on_accelerator(dred_context* pDred, dtk_accelerator accelerator)
 {
-    // The accelerator should be tied to a shortcut. We need to find that shortcut and execute it's command.
-    for (size_t iShortcut = 0; iShortcut < pDred->shortcutTable.count; ++iShortcut) {
-        dred_shortcut shortcut = pDred->shortcutTable.pShortcuts[iShortcut];
-        if (pDred->queuedAccelerator.key == 0) {
-            if (dtk_accelerator_equal(shortcut.accelerators[0], accelerator)) {
-                if (shortcut.accelerators[1].key == 0) {
-                    const char* cmd = dred_shortcut_table_get_command_string_by_index(&pDred->shortcutTable, iShortcut);
-                    if (cmd == NULL) {
-                        return;
-                    }
-
-                    dred_exec(pDred, cmd, NULL);
-                } else {
-                    // There is a shortcut that uses this accelerator as it's first one. Thus, it needs to be queued.
-                    pDred->queuedAccelerator = accelerator;
+    // The accelerator should be tied to a shortcut. We need to find that shortcut and execute it's command. Shortcuts are looked
+    // up by their first accelerator through a hash index so this does not depend on the number of shortcuts.
+    size_t iShortcut;
+    if (pDred->queuedAccelerator.key == 0) {
+        if (dred_shortcut_table_find_by_first_accelerator(&pDred->shortcutTable, accelerator, 0, &iShortcut)) {
+            dred_shortcut shortcut = pDred->shortcutTable.pShortcuts[iShortcut];
+            if (shortcut.accelerators[1].key == 0) {
+                const char* cmd = dred_shortcut_table_get_command_string_by_index(&pDred->shortcutTable, iShortcut);
+                if (cmd == NULL) {
+                    return;
                 }
 
-                return;
+                dred_exec(pDred, cmd, NULL);
+            } else {
+                // There is a shortcut that uses this accelerator as it's first one. Thus, it needs to be queued.
+                pDred->queuedAccelerator = accelerator;
             }
-        } else {
-            // An accelerator is queued.
-            if (dred_shortcut_equal(shortcut, dred_shortcut_create(pDred->queuedAccelerator, accelerator))) {
+
+            return;
+        }
+    } else {
+        // An accelerator is queued. Every shortcut matching the queued accelerator followed by this one is executed, in order.
+        dred_shortcut queuedShortcut = dred_shortcut_create(pDred->queuedAccelerator, accelerator);
+        for (dtk_bool32 found = dred_shortcut_table_find_by_first_accelerator(&pDred->shortcutTable, pDred->queuedAccelerator, 0, &iShortcut); found; found = dred_shortcut_table_find_by_first_accelerator(&pDred->shortcutTable, pDred->queuedAccelerator, iShortcut+1, &iShortcut)) {
+            if (dred_shortcut_equal(pDred->shortcutTable.pShortcuts[iShortcut], queuedShortcut)) {
                 const char* cmd = dred_shortcut_table_get_command_string_by_index(&pDred->shortcutTable, iShortcut);
                 if (cmd == NULL) {
                     pDred->queuedAccelerator = dtk_accelerator_none();
@@ -2893,7 +3354,7 @@ void dred_on_accelerator(dred_context* pDred, dtk_accelerator accelerator)
     pDred->queuedAccelerator = dtk_accelerator_none();
 }
 
-void dred_on_ipc_message(dred_context* pDred, unsigned int messageID, const void* pMessageData)
+void dred_on_ipc_message(dred_context* pDred, unsigned int messageID, const void* pMessageData, size_t messageSize)
 {
     switch (messageID)
     {
@@ -2907,6 +3368,24 @@ void dred_on_ipc_message(dred_context* pDred, unsigned int messageID, const void
             dred_open_file(pDred, (const char*)pMessageData);
         } break;
 
+        case DRED_IPC_MESSAGE_OPEN_FILES:
+        {
+            const char* pFilePaths = (const char*)pMessageData;
+            size_t offset = 0;
+            while (offset < messageSize) {
+                size_t filePathLength = strnlen(pFilePaths + offset, messageSize - offset);
+                if (offset + filePathLength == messageSize) {
+                    break;  // Not null terminated.
+                }
+
+                if (filePathLength > 0) {
+                    dred_open_file(pDred, pFilePaths + offset);
+                }
+
+                offset += filePathLength + 1;
+            }
+        } break;
+
         default:
         {
             dred_warningf(pDred, "Received unknown IPC message: %d\n", messageID);
@@ -10,11 +10,21 @@ struct dred_context
     // as an argument to dred_init().
     dred_package_library* pPackageLibrary;
 
-    // The log file.
-    dred_file logFile;
+    // The logger. Messages are written to the log file asynchronously.
+    dred_logger logger;
+
+    // The startup profiler. This is only enabled by the --profile-startup and --profile-startup-trace options.
+    dred_profiler profiler;
 
     // The IPC thread.
     dtk_thread threadIPC;
+    volatile dtk_bool32 isIPCThreadDone;    // Set by the IPC thread just before it returns.
+
+    // The system fonts are queried on a worker thread during startup because it can be slow (GSettings on Linux). The
+    // thread is waited on when the fonts are first needed, which is when the default config is loaded.
+    dtk_thread threadSystemFonts;
+    dred_font_desc systemFontDescUI;
+    dred_font_desc systemFontDescMono;
 
     // The main toolkit context. This needs to be initialized before doing pretty much anything.
     dtk_context tk;
@@ -71,6 +81,10 @@ struct dred_context
     dred_settings_dialog settingsDialog;
     dred_settings_dialog* pSettingsDialog;  // Lazily initialized. Set to NULL by default, and then set to &aboutDialog after it's been initialized.
 
+    // The performance HUD.
+    dred_perf_hud perfHUD;
+    dred_perf_hud* pPerfHUD;                // Lazily initialized. Set to NULL by default, and then set to &perfHUD after it's been initialized.
+
 
     // The background control that's displayed when there is nothing open.
     dtk_control backgroundControl;
@@ -88,6 +102,12 @@ struct dred_context
     // The command bar auto-complete popup window.
     dred_cmdbar_popup cmdbarPopup;
 
+    // The state of the find-in-files search. Only a single search can be running at a time.
+    dred_find_in_files findInFiles;
+
+    // The index of every file under the working directory. Used for opening files by name from the command bar.
+    dred_file_index fileIndex;
+
 
     
     dtk_bool32 isInitialized               : 1; // Whether or not the context is initialized.
@@ -95,6 +115,14 @@ struct dred_context
     dtk_bool32 isTerminalOutputDisabled    : 1; // Whether or not the application is running in silent mode.
     dtk_bool32 isPortable                  : 1; // Whether or not we're running in portable mode.
     dtk_bool32 isShowingMainMenu           : 1; // Whether or not the main menu is being shown.
+    dtk_bool32 isSystemFontThreadRunning   : 1; // Whether or not the system font worker thread needs to be waited on.
+    dtk_bool32 hasStartupSystemFonts       : 1; // Whether or not systemFontDescUI and systemFontDescMono are valid.
+    dtk_bool32 isFirstPaintDone            : 1; // Whether or not the main window has been painted for the first time.
+    dtk_bool32 isDeferredInitDone          : 1; // Whether or not the stages that were deferred until after the first paint have been run.
+    dtk_bool32 isConfigCacheDisabled       : 1; // Whether or not config files are always parsed from text. Set with --no-config-cache.
+    dtk_bool32 isIPCThreadRunning          : 1; // Whether or not the IPC thread needs to be terminated and waited on.
+    dtk_bool32 isSessionOwner              : 1; // Whether or not the session is saved on close. Not set when files were opened from the command line.
+    dtk_bool32 isRecordingPerfCounters     : 1; // Whether or not the performance counters were turned on with the perf-counters command.
 };
 
 // dred_init
@@ -129,6 +157,22 @@ void dred_error(dred_context* pDred, const char* message);
 // Posts a formatted error log message.
 void dred_errorf(dred_context* pDred, const char* format, ...);
 
+// Posts a log message with the given level (DRED_LOG_LEVEL_*).
+void dred_log_level(dred_context* pDred, dtk_uint32 level, const char* message);
+
+// Posts a formatted log message with the given level. The message is not formatted if the level is filtered out.
+void dred_logf_level(dred_context* pDred, dtk_uint32 level, const char* format, ...);
+
+// Posts a debug log message. These are compiled out entirely unless DRED_LOG_LEVEL_MAX includes debug messages, which it
+// does by default in debug builds.
+#if DRED_LOG_LEVEL_MAX >= DRED_LOG_LEVEL_DEBUG
+#define dred_debug(pDred, message)  dred_log_level((pDred), DRED_LOG_LEVEL_DEBUG, (message))
+#define dred_debugf(pDred, ...)     dred_logf_level((pDred), DRED_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define dred_debug(pDred, message)  ((void)(pDred))
+#define dred_debugf(pDred, ...)     ((void)(pDred))
+#endif
+
 
 // Loads a config file.
 dtk_bool32 dred_load_config(dred_context* pDred, const char* configFilePath);
@@ -191,6 +235,16 @@ dtk_bool32 dred_open_file(dred_context* pDred, const char* filePath);
 // Opens the file at the given path as the given type.
 dtk_bool32 dred_open_file_by_type(dred_context* pDred, const char* filePath, const char* editorType);
 
+// Appends a tab for the given editor to the end of the given tab group without activating it. The editor should have been
+// created with the tab group's page container as it's parent.
+dtk_bool32 dred_append_editor_tab(dred_context* pDred, dtk_tabgroup* pTabGroup, dred_editor* pEditor, dtk_uint32* pTabIndexOut);
+
+// Loads the file of the placeholder editor at the given tab and replaces the placeholder with the real editor. This is
+// called automatically when a placeholder tab is activated.
+//
+// Returns the new editor, or NULL if the tab is not a placeholder or the editor could not be created.
+dred_editor* dred_load_placeholder_tab(dred_context* pDred, dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex);
+
 // Closes the focused file.
 void dred_close_focused_file(dred_context* pDred);
 
@@ -380,6 +434,16 @@ void dred_disable_auto_hide_command_bar(dred_context* pDred);
 void dred_toggle_auto_hide_command_bar(dred_context* pDred);
 
 
+// Shows or hides the performance HUD. The performance counters are enabled while the HUD is showing.
+void dred_toggle_perf_hud(dred_context* pDred);
+
+// Turns recording of the performance counters on without needing the HUD to be showing.
+void dred_enable_perf_counters(dred_context* pDred);
+
+// Turns recording of the performance counters off. The counters stay enabled while the HUD is showing.
+void dred_disable_perf_counters(dred_context* pDred);
+
+
 // Sets the scale of text editors.
 void dred_set_text_editor_scale(dred_context* pDred, float scale);
 
@@ -415,7 +479,7 @@ void dred_on_tab_deactivated(dred_context* pDred, dtk_tabgroup* pTabGroup, dtk_u
 void dred_on_accelerator(dred_context* pDred, dtk_accelerator accelerator);
 
 // Called from the main loop in the platform layer when an IPC message is received.
-void dred_on_ipc_message(dred_context* pDred, unsigned int messageID, const void* pMessageData);
+void dred_on_ipc_message(dred_context* pDred, unsigned int messageID, const void* pMessageData, size_t messageSize);
 
 
 // Retrieves a pointer to the dred_context from the given DTK control.
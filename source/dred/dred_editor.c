@@ -66,6 +66,22 @@ const char* dred_editor_get_file_path(dred_editor* pEditor)
     return pEditor->filePathAbsolute;
 }
 
+static dtk_bool32 dred_editor__make_absolute_path(char* pathOut, size_t pathOutSize, const char* path)
+{
+    if (dtk_path_is_relative(path)) {
+        char* pCurrentDir = dtk_get_current_directory();
+        if (pCurrentDir == NULL) {
+            return DTK_FALSE;
+        }
+
+        size_t length = dtk_path_append_and_clean(pathOut, pathOutSize, pCurrentDir, path);
+        dtk_free(pCurrentDir);
+        return length != 0;
+    } else {
+        return dtk_path_clean(pathOut, pathOutSize, path) != 0;
+    }
+}
+
 dtk_bool32 dred_editor_set_file_path(dred_editor* pEditor, const char* newFilePath)
 {
     if (pEditor == NULL || newFilePath == NULL) {
@@ -115,35 +131,51 @@ dtk_bool32 dred_editor_save(dred_editor* pEditor, const char* newFilePath)
         return DTK_FALSE;
     }
 
-    // Saving is done in 3 stages:
-    //   1) A copy of the original file is created called <original_file>.dredtmp.
-    //   2) The contents of the original file is replaced with the new contents.
-    //   3) The copy of the original file is deleted.
-    //
-    // The rationale for this system is to try and prevent data loss in the event that an error occurs while in the
-    // middle of saving.
-    dtk_bool32 haveTempFile = DTK_FALSE;
-    char tempFilePath[DRED_MAX_PATH];
-
+    // Editors that support it can write their changes straight into their own file which is much cheaper than rewriting
+    // the whole thing when the file is big.
     const char* originalFilePath = dred_editor_get_file_path(pEditor);
+    dtk_bool32 isSavingOverOriginal = DTK_FALSE;
     if (!dred_string_is_null_or_empty(originalFilePath)) {
-        if (dtk_path_append_extension(tempFilePath, sizeof(tempFilePath), originalFilePath, "dredtmp")) {
-            if (dtk_copy_file(originalFilePath, tempFilePath, DTK_TRUE) == DTK_SUCCESS) {
-                haveTempFile = DTK_TRUE;
-            }
+        char actualFilePathAbsolute[DRED_MAX_PATH];
+        if (dred_editor__make_absolute_path(actualFilePathAbsolute, sizeof(actualFilePathAbsolute), actualFilePath)) {
+            isSavingOverOriginal = strcmp(actualFilePathAbsolute, originalFilePath) == 0;
         }
     }
 
     dtk_bool32 wasSaved = DTK_FALSE;
-    dred_file file = dred_file_open(actualFilePath, DRED_FILE_OPEN_MODE_WRITE);
-    if (file != NULL) {
-        wasSaved = pEditor->onSave(pEditor, file, actualFilePath);
-        dred_file_close(file);
-    }
+    if (isSavingOverOriginal && pEditor->onSaveInPlace != NULL) {
+        wasSaved = pEditor->onSaveInPlace(pEditor);
+    } else {
+        // Saving is done in 3 stages:
+        //   1) A copy of the original file is created called <original_file>.dredtmp.
+        //   2) The contents of the original file is replaced with the new contents.
+        //   3) The copy of the original file is deleted.
+        //
+        // The rationale for this system is to try and prevent data loss in the event that an error occurs while in the
+        // middle of saving.
+        dtk_bool32 haveTempFile = DTK_FALSE;
+        char tempFilePath[DRED_MAX_PATH];
+
+        if (!dred_string_is_null_or_empty(originalFilePath)) {
+            if (dtk_path_append_extension(tempFilePath, sizeof(tempFilePath), originalFilePath, "dredtmp")) {
+                if (dtk_copy_file(originalFilePath, tempFilePath, DTK_TRUE) == DTK_SUCCESS) {
+                    haveTempFile = DTK_TRUE;
+                }
+            }
+        }
+
+        dtk_uint64 perfBegTime = dred_perf_begin();
+        dred_file file = dred_file_open(actualFilePath, DRED_FILE_OPEN_MODE_WRITE);
+        if (file != NULL) {
+            wasSaved = pEditor->onSave(pEditor, file, actualFilePath);
+            dred_file_close(file);
+        }
+        dred_perf_end(DRED_PERF_COUNTER_FILE_SAVE, perfBegTime);
 
-    // Everything should be saved so just delete the temporary one.
-    if (haveTempFile) {
-        dtk_delete_file(tempFilePath);
+        // Everything should be saved so just delete the temporary one.
+        if (haveTempFile) {
+            dtk_delete_file(tempFilePath);
+        }
     }
 
     if (!wasSaved) {
@@ -241,6 +273,25 @@ dtk_bool32 dred_editor_is_modified(dred_editor* pEditor)
     return pEditor->isModified;
 }
 
+size_t dred_editor_get_memory_usage(dred_editor* pEditor)
+{
+    if (pEditor == NULL) {
+        return 0;
+    }
+
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+        return dred_text_editor_get_memory_usage(DRED_TEXT_EDITOR(pEditor));
+    }
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_HEX_EDITOR)) {
+        return dred_hex_editor_get_memory_usage(DRED_HEX_EDITOR(pEditor));
+    }
+    if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_LARGE_FILE_VIEWER)) {
+        return dred_large_file_viewer_get_memory_usage(DRED_LARGE_FILE_VIEWER(pEditor));
+    }
+
+    return 0;
+}
+
 
 void dred_editor_update_file_last_modified_time(dred_editor* pEditor)
 {
@@ -271,6 +322,15 @@ void dred_editor_set_on_save(dred_editor* pEditor, dred_editor_on_save_proc proc
     pEditor->onSave = proc;
 }
 
+void dred_editor_set_on_save_in_place(dred_editor* pEditor, dred_editor_on_save_in_place_proc proc)
+{
+    if (pEditor == NULL) {
+        return;
+    }
+
+    pEditor->onSaveInPlace = proc;
+}
+
 void dred_editor_set_on_reload(dred_editor* pEditor, dred_editor_on_reload_proc proc)
 {
     if (pEditor == NULL) {
@@ -6,6 +6,7 @@ typedef struct dred_editor dred_editor;
 #define DRED_EDITOR(a) ((dred_editor*)(a))
 
 typedef dtk_bool32 (* dred_editor_on_save_proc)(dred_editor* pEditor, dred_file file, const char* filePath);
+typedef dtk_bool32 (* dred_editor_on_save_in_place_proc)(dred_editor* pEditor);
 typedef dtk_bool32 (* dred_editor_on_reload_proc)(dred_editor* pEditor);
 typedef void (* dred_editor_on_modified_proc)(dred_editor* pEditor);
 typedef void (* dred_editor_on_unmodified_proc)(dred_editor* pEditor);
@@ -18,6 +19,7 @@ struct dred_editor
     char filePathAbsolute[DRED_MAX_PATH];
     uint64_t fileLastModifiedTime;
     dred_editor_on_save_proc onSave;
+    dred_editor_on_save_in_place_proc onSaveInPlace;    // Optional. Used instead of onSave when saving over the editor's own file.
     dred_editor_on_reload_proc onReload;
     dred_editor_on_modified_proc onModified;
     dred_editor_on_unmodified_proc onUnmodified;
@@ -47,7 +49,8 @@ dtk_bool32 dred_editor_set_file_path(dred_editor* pEditor, const char* newFilePa
 
 // Saves the given editor to the given file.
 //
-// This will change the file association to the new file.
+// This will change the file association to the new file. When saving to the editor's own file and the editor has an
+// on_save_in_place handler, that is used instead of rewriting the whole file.
 dtk_bool32 dred_editor_save(dred_editor* pEditor, const char* newFilePath);
 
 // Reloads the given editor.
@@ -66,6 +69,9 @@ void dred_editor_unmark_as_modified(dred_editor* pEditor);
 // Determines whether or not the editor is marked as modified.
 dtk_bool32 dred_editor_is_modified(dred_editor* pEditor);
 
+// Retrieves an estimate of the amount of memory being used by the editor, in bytes. Returns 0 for editors that don't track it.
+size_t dred_editor_get_memory_usage(dred_editor* pEditor);
+
 
 // Updates the last modified time of the file.
 void dred_editor_update_file_last_modified_time(dred_editor* pEditor);
@@ -76,6 +82,7 @@ dtk_bool32 dred_editor_is_read_only(dred_editor* pEditor);
 
 // Events
 void dred_editor_set_on_save(dred_editor* pEditor, dred_editor_on_save_proc proc);
+void dred_editor_set_on_save_in_place(dred_editor* pEditor, dred_editor_on_save_in_place_proc proc);
 void dred_editor_set_on_reload(dred_editor* pEditor, dred_editor_on_reload_proc proc);
 void dred_editor_set_on_modified(dred_editor* pEditor, dred_editor_on_modified_proc proc);
 void dred_editor_set_on_unmodified(dred_editor* pEditor, dred_editor_on_unmodified_proc proc);
\ No newline at end of file
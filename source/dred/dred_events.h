@@ -5,4 +5,15 @@
 
 #define DRED_EVENT_IPC_TERMINATOR   (DTK_EVENT_CUSTOM + 0)
 #define DRED_EVENT_IPC_ACTIVATE     (DTK_EVENT_CUSTOM + 1)
-#define DRED_EVENT_IPC_OPEN         (DTK_EVENT_CUSTOM + 2)
\ No newline at end of file
+#define DRED_EVENT_IPC_OPEN         (DTK_EVENT_CUSTOM + 2)
+#define DRED_EVENT_IPC_OPEN_FILES   (DTK_EVENT_CUSTOM + 5)
+
+#define DRED_EVENT_FIND_IN_FILES_RESULT     (DTK_EVENT_CUSTOM + 3)
+#define DRED_EVENT_FIND_IN_FILES_DONE       (DTK_EVENT_CUSTOM + 4)
+
+#define DRED_EVENT_SESSION_PREFETCH         (DTK_EVENT_CUSTOM + 6)
+
+#define DRED_EVENT_DEFERRED_INIT            (DTK_EVENT_CUSTOM + 7)
+
+#define DRED_EVENT_FILE_INDEX_BUILT         (DTK_EVENT_CUSTOM + 8)
+#define DRED_EVENT_FILE_INDEX_CHANGED       (DTK_EVENT_CUSTOM + 9)
@@ -0,0 +1,1513 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// Directories with these names are never indexed.
+static const char* g_FileIndexExcludePatterns[] = {
+    ".git", ".svn", ".hg"
+};
+
+// Every build and every index loaded from disk gets a new generation which is never reused, even across re-initializations of
+// the index. Only accessed from the main thread.
+static dtk_uint32 g_FileIndexGeneration = 0;
+
+DTK_INLINE char dred_file_index__fold(char c)
+{
+    if (c >= 'A' && c <= 'Z') {
+        return c + ('a' - 'A');
+    }
+    if (c == '\\') {
+        return '/';
+    }
+
+    return c;
+}
+
+DTK_INLINE dtk_uint32 dred_file_index__make_trigram_key(const char* text)
+{
+    return ((dtk_uint32)(dtk_uint8)dred_file_index__fold(text[0]) << 16) |
+           ((dtk_uint32)(dtk_uint8)dred_file_index__fold(text[1]) <<  8) |
+           ((dtk_uint32)(dtk_uint8)dred_file_index__fold(text[2]) <<  0);
+}
+
+static const char* dred_file_index__find_file_name(const char* path)
+{
+    const char* fileName = path;
+    for (const char* p = path; *p != '\0'; ++p) {
+        if (*p == '/' || *p == '\\') {
+            fileName = p + 1;
+        }
+    }
+
+    return fileName;
+}
+
+// Case insensitive substring search. <needle> must already be folded.
+static dtk_bool32 dred_file_index__contains(const char* haystack, const char* needle, size_t needleLength)
+{
+    if (needleLength == 0) {
+        return DTK_TRUE;
+    }
+
+    for (; *haystack != '\0'; ++haystack) {
+        if (dred_file_index__fold(*haystack) == needle[0]) {
+            size_t i = 1;
+            while (i < needleLength && haystack[i] != '\0' && dred_file_index__fold(haystack[i]) == needle[i]) {
+                i += 1;
+            }
+
+            if (i == needleLength) {
+                return DTK_TRUE;
+            }
+            if (haystack[i] == '\0') {
+                return DTK_FALSE;
+            }
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+static dtk_uint64 dred_file_index__get_directory_modified_time(const char* directoryPath)
+{
+#ifdef DRED_WIN32
+    // dtk_get_file_modified_time() opens the file which doesn't work for directories.
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(directoryPath, GetFileExInfoStandard, &data)) {
+        return 0;
+    }
+
+    ULARGE_INTEGER result;
+    result.HighPart = data.ftLastWriteTime.dwHighDateTime;
+    result.LowPart = data.ftLastWriteTime.dwLowDateTime;
+    return result.QuadPart;
+#else
+    return dtk_get_file_modified_time(directoryPath);
+#endif
+}
+
+static void dred_file_index__write_varint(dtk_uint8** ppOut, dtk_uint32 value)
+{
+    dtk_uint8* pOut = *ppOut;
+    while (value >= 0x80) {
+        *pOut++ = (dtk_uint8)(value | 0x80);
+        value >>= 7;
+    }
+    *pOut++ = (dtk_uint8)value;
+
+    *ppOut = pOut;
+}
+
+// Returns false if the end of the data is reached before the end of the integer.
+DTK_INLINE dtk_bool32 dred_file_index__read_varint(const dtk_uint8** ppIn, const dtk_uint8* pEnd, dtk_uint32* pValue)
+{
+    const dtk_uint8* pIn = *ppIn;
+    dtk_uint32 value = 0;
+    for (dtk_uint32 shift = 0; shift < 35; shift += 7) {
+        if (pIn == pEnd) {
+            return DTK_FALSE;
+        }
+
+        dtk_uint8 b = *pIn++;
+        value |= (dtk_uint32)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *ppIn = pIn;
+            *pValue = value;
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+
+//// Snapshots ////
+
+// Sets up the pointers of a snapshot from data in the file format. Everything that would otherwise need to be checked
+// while querying is validated here.
+static dtk_bool32 dred_file_index__snapshot_init_pointers(dred_file_index_snapshot* pSnapshot, const void* pData, size_t dataSize, const char* rootDirectory)
+{
+    dtk_assert(pSnapshot != NULL);
+
+    if (dataSize < sizeof(dred_file_index_header)) {
+        return DTK_FALSE;
+    }
+
+    const dred_file_index_header* pHeader = (const dred_file_index_header*)pData;
+    if (pHeader->magic != DRED_FILE_INDEX_MAGIC || pHeader->version != DRED_FILE_INDEX_VERSION) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint64 expectedSize = sizeof(*pHeader) +
+        (dtk_uint64)pHeader->directoryCount * sizeof(dred_file_index_directory) +
+        (dtk_uint64)pHeader->trigramCount * sizeof(dred_file_index_trigram) +
+        (dtk_uint64)pHeader->pathCount * sizeof(dtk_uint32) +
+        pHeader->postingsSize +
+        pHeader->stringsSize;
+    if (expectedSize != dataSize || pHeader->stringsSize == 0 || (pHeader->postingsSize & 3) != 0) {
+        return DTK_FALSE;
+    }
+
+    const dred_file_index_directory* pDirectories = (const dred_file_index_directory*)(pHeader + 1);
+    const dred_file_index_trigram* pTrigrams = (const dred_file_index_trigram*)(pDirectories + pHeader->directoryCount);
+    const dtk_uint32* pPathOffsets = (const dtk_uint32*)(pTrigrams + pHeader->trigramCount);
+    const dtk_uint8* pPostings = (const dtk_uint8*)(pPathOffsets + pHeader->pathCount);
+    const char* pStrings = (const char*)(pPostings + pHeader->postingsSize);
+
+    // With the last byte being a null terminator and every offset being in range, every string is guaranteed to be null
+    // terminated within the string data.
+    if (pStrings[pHeader->stringsSize-1] != '\0') {
+        return DTK_FALSE;
+    }
+
+    // The root directory is always the first string. This protects against hash collisions in the index file name.
+    if (rootDirectory != NULL && strcmp(pStrings, rootDirectory) != 0) {
+        return DTK_FALSE;
+    }
+
+    for (dtk_uint32 iPath = 0; iPath < pHeader->pathCount; ++iPath) {
+        if (pPathOffsets[iPath] >= pHeader->stringsSize) {
+            return DTK_FALSE;
+        }
+    }
+
+    for (dtk_uint32 iDirectory = 0; iDirectory < pHeader->directoryCount; ++iDirectory) {
+        if (pDirectories[iDirectory].pathOffset >= pHeader->stringsSize) {
+            return DTK_FALSE;
+        }
+    }
+
+    // Posting lists are bounds checked while they're decoded, but the offsets need to be in range.
+    for (dtk_uint32 iTrigram = 0; iTrigram < pHeader->trigramCount; ++iTrigram) {
+        if (pTrigrams[iTrigram].postingsOffset > pHeader->postingsSize) {
+            return DTK_FALSE;
+        }
+    }
+
+    pSnapshot->pHeader = pHeader;
+    pSnapshot->pDirectories = pDirectories;
+    pSnapshot->pTrigrams = pTrigrams;
+    pSnapshot->pPathOffsets = pPathOffsets;
+    pSnapshot->pPostings = pPostings;
+    pSnapshot->pStrings = pStrings;
+    return DTK_TRUE;
+}
+
+static dred_file_index_snapshot* dred_file_index__snapshot_load(const char* indexFilePath, const char* rootDirectory)
+{
+    dred_file_index_snapshot* pSnapshot = (dred_file_index_snapshot*)dtk_calloc(1, sizeof(*pSnapshot));
+    if (pSnapshot == NULL) {
+        return NULL;
+    }
+
+    if (dtk_mapped_file_open(indexFilePath, DTK_FALSE, &pSnapshot->file) != DTK_SUCCESS) {
+        dtk_free(pSnapshot);
+        return NULL;
+    }
+
+    if (pSnapshot->file.fileSize < sizeof(dred_file_index_header) || pSnapshot->file.fileSize > 0xFFFFFFFF) {
+        goto on_error;
+    }
+
+    if (dtk_mapped_file_map(&pSnapshot->file, 0, (size_t)pSnapshot->file.fileSize, &pSnapshot->view) != DTK_SUCCESS) {
+        goto on_error;
+    }
+
+    if (pSnapshot->view.dataSize != pSnapshot->file.fileSize ||
+       !dred_file_index__snapshot_init_pointers(pSnapshot, pSnapshot->view.pData, pSnapshot->view.dataSize, rootDirectory)) {
+        dtk_mapped_file_unmap(&pSnapshot->file, &pSnapshot->view);
+        goto on_error;
+    }
+
+    pSnapshot->isMapped = DTK_TRUE;
+    pSnapshot->pData = pSnapshot->view.pData;
+    pSnapshot->dataSize = pSnapshot->view.dataSize;
+    return pSnapshot;
+
+on_error:
+    dtk_mapped_file_close(&pSnapshot->file);
+    dtk_free(pSnapshot);
+    return NULL;
+}
+
+static void dred_file_index__snapshot_delete(dred_file_index_snapshot* pSnapshot)
+{
+    if (pSnapshot == NULL) {
+        return;
+    }
+
+    if (pSnapshot->isMapped) {
+        dtk_mapped_file_unmap(&pSnapshot->file, &pSnapshot->view);
+        dtk_mapped_file_close(&pSnapshot->file);
+    } else {
+        dtk_free(pSnapshot->pData);
+    }
+
+    dtk_free(pSnapshot);
+}
+
+static const dred_file_index_trigram* dred_file_index__snapshot_find_trigram(const dred_file_index_snapshot* pSnapshot, dtk_uint32 key)
+{
+    dtk_uint32 lo = 0;
+    dtk_uint32 hi = pSnapshot->pHeader->trigramCount;
+    while (lo < hi) {
+        dtk_uint32 mid = lo + (hi - lo)/2;
+        if (pSnapshot->pTrigrams[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < pSnapshot->pHeader->trigramCount && pSnapshot->pTrigrams[lo].key == key) {
+        return &pSnapshot->pTrigrams[lo];
+    }
+
+    return NULL;
+}
+
+
+//// Building ////
+
+typedef struct
+{
+    dred_file_index* pIndex;
+    size_t rootLength;
+
+    // Everything is collected into these while walking. The walk is multi-threaded so they're protected by a lock.
+    dtk_mutex lock;
+    char* pStrings;
+    size_t stringsSize;
+    size_t stringsCapacity;
+    size_t* pFileOffsets;
+    size_t fileCount;
+    size_t fileCapacity;
+    dred_file_index_directory* pDirectories;
+    size_t directoryCount;
+    size_t directoryCapacity;
+    dtk_bool32 hasError;
+} dred_file_index__build_state;
+
+static dtk_bool32 dred_file_index__build_add_string(dred_file_index__build_state* pState, const char* str, size_t* pOffset)
+{
+    size_t length = strlen(str);
+    if (pState->stringsSize + length + 1 > pState->stringsCapacity) {
+        size_t newCapacity = dtk_max(pState->stringsSize + length + 1, pState->stringsCapacity*2);
+        char* pNewStrings = (char*)dtk_realloc(pState->pStrings, newCapacity);
+        if (pNewStrings == NULL) {
+            return DTK_FALSE;
+        }
+
+        pState->pStrings = pNewStrings;
+        pState->stringsCapacity = newCapacity;
+    }
+
+    // Relative paths always use forward slashes.
+    char* pDst = pState->pStrings + pState->stringsSize;
+    for (size_t i = 0; i <= length; ++i) {
+        pDst[i] = (str[i] == '\\') ? '/' : str[i];
+    }
+
+    *pOffset = pState->stringsSize;
+    pState->stringsSize += length + 1;
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_file_index__build_add_directory(dred_file_index__build_state* pState, const char* relativePath, dtk_uint64 modifiedTime)
+{
+    if (pState->directoryCount == pState->directoryCapacity) {
+        size_t newCapacity = (pState->directoryCapacity == 0) ? 256 : pState->directoryCapacity*2;
+        dred_file_index_directory* pNewDirectories = (dred_file_index_directory*)dtk_realloc(pState->pDirectories, newCapacity * sizeof(*pNewDirectories));
+        if (pNewDirectories == NULL) {
+            return DTK_FALSE;
+        }
+
+        pState->pDirectories = pNewDirectories;
+        pState->directoryCapacity = newCapacity;
+    }
+
+    size_t offset;
+    if (!dred_file_index__build_add_string(pState, relativePath, &offset)) {
+        return DTK_FALSE;
+    }
+
+    dred_file_index_directory* pDirectory = &pState->pDirectories[pState->directoryCount++];
+    pDirectory->modifiedTime = modifiedTime;
+    pDirectory->pathOffset = (dtk_uint32)offset;    // Fixed up when the final string data is built.
+    pDirectory->reserved = 0;
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_file_index__build_walk_proc(const dtk_walk_directory_entry* pEntry, void* pUserData)
+{
+    dred_file_index__build_state* pState = (dred_file_index__build_state*)pUserData;
+    dtk_assert(pState != NULL);
+
+    if (pState->pIndex->isBuildCancelled) {
+        return DTK_FALSE;
+    }
+
+    const char* relativePath = pEntry->path + pState->rootLength;
+    while (relativePath[0] == '/' || relativePath[0] == '\\') {
+        relativePath += 1;
+    }
+
+    // The modified time of directories is needed for detecting changes that were made while dred was not running. This is
+    // done outside of the lock since it's a system call.
+    dtk_uint64 modifiedTime = 0;
+    if (pEntry->isDirectory) {
+        if (pEntry->isSymbolicLink) {
+            return DTK_TRUE;    // Not descended into by the walker, so not watched either.
+        }
+
+        modifiedTime = dred_file_index__get_directory_modified_time(pEntry->path);
+    }
+
+    dtk_bool32 result = DTK_TRUE;
+    dtk_mutex_lock(&pState->lock);
+    {
+        if (pEntry->isDirectory) {
+            if (!dred_file_index__build_add_directory(pState, relativePath, modifiedTime)) {
+                pState->hasError = DTK_TRUE;
+                result = DTK_FALSE;
+            }
+        } else {
+            if (pState->fileCount == DRED_FILE_INDEX_MAX_FILES) {
+                result = DTK_FALSE;
+            } else {
+                if (pState->fileCount == pState->fileCapacity) {
+                    size_t newCapacity = (pState->fileCapacity == 0) ? 1024 : pState->fileCapacity*2;
+                    size_t* pNewFileOffsets = (size_t*)dtk_realloc(pState->pFileOffsets, newCapacity * sizeof(*pNewFileOffsets));
+                    if (pNewFileOffsets == NULL) {
+                        pState->hasError = DTK_TRUE;
+                        result = DTK_FALSE;
+                    } else {
+                        pState->pFileOffsets = pNewFileOffsets;
+                        pState->fileCapacity = newCapacity;
+                    }
+                }
+
+                if (result) {
+                    if (dred_file_index__build_add_string(pState, relativePath, &pState->pFileOffsets[pState->fileCount])) {
+                        pState->fileCount += 1;
+                    } else {
+                        pState->hasError = DTK_TRUE;
+                        result = DTK_FALSE;
+                    }
+                }
+            }
+        }
+    }
+    dtk_mutex_unlock(&pState->lock);
+
+    return result;
+}
+
+static int dred_file_index__compare_strings(const void* a, const void* b)
+{
+    return strcmp(*(const char**)a, *(const char**)b);
+}
+
+static int dred_file_index__compare_uint64(const void* a, const void* b)
+{
+    dtk_uint64 valueA = *(const dtk_uint64*)a;
+    dtk_uint64 valueB = *(const dtk_uint64*)b;
+    return (valueA < valueB) ? -1 : ((valueA > valueB) ? 1 : 0);
+}
+
+static int dred_file_index__compare_uint32(const void* a, const void* b)
+{
+    dtk_uint32 valueA = *(const dtk_uint32*)a;
+    dtk_uint32 valueB = *(const dtk_uint32*)b;
+    return (valueA < valueB) ? -1 : ((valueA > valueB) ? 1 : 0);
+}
+
+// Turns the collected paths into the file format. Returns null on error.
+static void* dred_file_index__build_data(dred_file_index__build_state* pState, const char* rootDirectory, size_t* pDataSize)
+{
+    dtk_assert(pState != NULL);
+    dtk_assert(pDataSize != NULL);
+
+    void* pData = NULL;
+    const char** ppSortedPaths = NULL;
+    dtk_uint64* pPairs = NULL;
+    dtk_uint32* pKeys = NULL;
+    dtk_uint8* pPostings = NULL;
+    dred_file_index_trigram* pTrigrams = NULL;
+
+    dtk_uint32 pathCount = (dtk_uint32)pState->fileCount;
+
+    // Paths are sorted so that results come out in a sensible order and are laid out in that order in the string data.
+    ppSortedPaths = (const char**)dtk_malloc(dtk_max(pathCount, 1) * sizeof(*ppSortedPaths));
+    if (ppSortedPaths == NULL) {
+        goto done;
+    }
+
+    for (dtk_uint32 iPath = 0; iPath < pathCount; ++iPath) {
+        ppSortedPaths[iPath] = pState->pStrings + pState->pFileOffsets[iPath];
+    }
+    qsort(ppSortedPaths, pathCount, sizeof(*ppSortedPaths), dred_file_index__compare_strings);
+
+
+    // Each file name is broken up into trigrams, and each unique trigram of each file becomes a (trigram, path index) pair.
+    // Sorting the pairs groups them by trigram, with the path indices of each trigram in ascending order.
+    size_t pairCount = 0;
+    size_t pairCapacity = 0;
+    size_t maxKeyCount = 0;
+    for (dtk_uint32 iPath = 0; iPath < pathCount; ++iPath) {
+        size_t fileNameLength = strlen(dred_file_index__find_file_name(ppSortedPaths[iPath]));
+        if (fileNameLength >= 3) {
+            pairCapacity += fileNameLength - 2;
+            maxKeyCount = dtk_max(maxKeyCount, fileNameLength - 2);
+        }
+    }
+
+    pPairs = (dtk_uint64*)dtk_malloc(dtk_max(pairCapacity, 1) * sizeof(*pPairs));
+    if (pPairs == NULL) {
+        goto done;
+    }
+
+    // Every trigram of the longest file name needs to fit so none are dropped.
+    pKeys = (dtk_uint32*)dtk_malloc(dtk_max(maxKeyCount, 1) * sizeof(*pKeys));
+    if (pKeys == NULL) {
+        goto done;
+    }
+
+    for (dtk_uint32 iPath = 0; iPath < pathCount; ++iPath) {
+        const char* fileName = dred_file_index__find_file_name(ppSortedPaths[iPath]);
+        size_t fileNameLength = strlen(fileName);
+        if (fileNameLength < 3) {
+            continue;
+        }
+
+        // Duplicates within a single file name are removed by sorting the keys of this file.
+        size_t keyCount = 0;
+        for (size_t i = 0; i+2 < fileNameLength; ++i) {
+            pKeys[keyCount++] = dred_file_index__make_trigram_key(fileName + i);
+        }
+        qsort(pKeys, keyCount, sizeof(*pKeys), dred_file_index__compare_uint32);
+
+        for (size_t iKey = 0; iKey < keyCount; ++iKey) {
+            if (iKey > 0 && pKeys[iKey] == pKeys[iKey-1]) {
+                continue;
+            }
+
+            pPairs[pairCount++] = ((dtk_uint64)pKeys[iKey] << 32) | iPath;
+        }
+    }
+
+    qsort(pPairs, pairCount, sizeof(*pPairs), dred_file_index__compare_uint64);
+
+
+    // Posting lists. Each path index is stored as the difference from the previous one, which keeps most of them to a byte.
+    dtk_uint32 trigramCount = 0;
+    for (size_t iPair = 0; iPair < pairCount; ++iPair) {
+        if (iPair == 0 || (pPairs[iPair] >> 32) != (pPairs[iPair-1] >> 32)) {
+            trigramCount += 1;
+        }
+    }
+
+    pTrigrams = (dred_file_index_trigram*)dtk_malloc(dtk_max(trigramCount, 1) * sizeof(*pTrigrams));
+    pPostings = (dtk_uint8*)dtk_malloc(pairCount*5 + 4);
+    if (pTrigrams == NULL || pPostings == NULL) {
+        goto done;
+    }
+
+    dtk_uint8* pRunningPostings = pPostings;
+    dtk_uint32 iTrigram = 0;
+    dtk_uint32 prevPathIndex = 0;
+    for (size_t iPair = 0; iPair < pairCount; ++iPair) {
+        dtk_uint32 key = (dtk_uint32)(pPairs[iPair] >> 32);
+        dtk_uint32 pathIndex = (dtk_uint32)(pPairs[iPair] & 0xFFFFFFFF);
+
+        if (iPair == 0 || key != pTrigrams[iTrigram-1].key) {
+            pTrigrams[iTrigram].key = key;
+            pTrigrams[iTrigram].pathCount = 0;
+            pTrigrams[iTrigram].postingsOffset = (dtk_uint32)(pRunningPostings - pPostings);
+            iTrigram += 1;
+            prevPathIndex = 0;
+        }
+
+        dred_file_index__write_varint(&pRunningPostings, pathIndex - prevPathIndex);
+        pTrigrams[iTrigram-1].pathCount += 1;
+        prevPathIndex = pathIndex;
+    }
+
+    size_t postingsSize = (size_t)(pRunningPostings - pPostings);
+    while ((postingsSize & 3) != 0) {
+        pPostings[postingsSize++] = 0;
+    }
+
+
+    // The final string data is the root followed by every path in sorted order, and then the directories.
+    size_t stringsSize = strlen(rootDirectory) + 1;
+    for (dtk_uint32 iPath = 0; iPath < pathCount; ++iPath) {
+        stringsSize += strlen(ppSortedPaths[iPath]) + 1;
+    }
+    for (size_t iDirectory = 0; iDirectory < pState->directoryCount; ++iDirectory) {
+        stringsSize += strlen(pState->pStrings + pState->pDirectories[iDirectory].pathOffset) + 1;
+    }
+
+    size_t dataSize = sizeof(dred_file_index_header) +
+        pState->directoryCount * sizeof(dred_file_index_directory) +
+        trigramCount * sizeof(dred_file_index_trigram) +
+        pathCount * sizeof(dtk_uint32) +
+        postingsSize +
+        stringsSize;
+    if (dataSize > 0xFFFFFFFF) {
+        goto done;
+    }
+
+    pData = dtk_malloc(dataSize);
+    if (pData == NULL) {
+        goto done;
+    }
+
+    dred_file_index_header* pHeader = (dred_file_index_header*)pData;
+    pHeader->magic = DRED_FILE_INDEX_MAGIC;
+    pHeader->version = DRED_FILE_INDEX_VERSION;
+    pHeader->pathCount = pathCount;
+    pHeader->directoryCount = (dtk_uint32)pState->directoryCount;
+    pHeader->trigramCount = trigramCount;
+    pHeader->postingsSize = (dtk_uint32)postingsSize;
+    pHeader->stringsSize = (dtk_uint32)stringsSize;
+    pHeader->reserved = 0;
+
+    dred_file_index_directory* pDstDirectories = (dred_file_index_directory*)(pHeader + 1);
+    dred_file_index_trigram* pDstTrigrams = (dred_file_index_trigram*)(pDstDirectories + pState->directoryCount);
+    dtk_uint32* pDstPathOffsets = (dtk_uint32*)(pDstTrigrams + trigramCount);
+    dtk_uint8* pDstPostings = (dtk_uint8*)(pDstPathOffsets + pathCount);
+    char* pDstStrings = (char*)(pDstPostings + postingsSize);
+
+    memcpy(pDstTrigrams, pTrigrams, trigramCount * sizeof(*pTrigrams));
+    memcpy(pDstPostings, pPostings, postingsSize);
+
+    size_t stringOffset = 0;
+    size_t rootLength = strlen(rootDirectory);
+    memcpy(pDstStrings, rootDirectory, rootLength + 1);
+    stringOffset += rootLength + 1;
+
+    for (dtk_uint32 iPath = 0; iPath < pathCount; ++iPath) {
+        size_t length = strlen(ppSortedPaths[iPath]);
+        memcpy(pDstStrings + stringOffset, ppSortedPaths[iPath], length + 1);
+        pDstPathOffsets[iPath] = (dtk_uint32)stringOffset;
+        stringOffset += length + 1;
+    }
+
+    for (size_t iDirectory = 0; iDirectory < pState->directoryCount; ++iDirectory) {
+        const char* path = pState->pStrings + pState->pDirectories[iDirectory].pathOffset;
+        size_t length = strlen(path);
+        memcpy(pDstStrings + stringOffset, path, length + 1);
+        pDstDirectories[iDirectory] = pState->pDirectories[iDirectory];
+        pDstDirectories[iDirectory].pathOffset = (dtk_uint32)stringOffset;
+        stringOffset += length + 1;
+    }
+
+    *pDataSize = dataSize;
+
+done:
+    dtk_free(ppSortedPaths);
+    dtk_free(pPairs);
+    dtk_free(pKeys);
+    dtk_free(pPostings);
+    dtk_free(pTrigrams);
+    return pData;
+}
+
+static dtk_bool32 dred_file_index__get_temp_file_path(const char* indexFilePath, char* tempFilePathOut, size_t tempFilePathOutSize)
+{
+    return snprintf(tempFilePathOut, tempFilePathOutSize, "%s.tmp", indexFilePath) < (int)tempFilePathOutSize;
+}
+
+// The new index is written next to the old one by the build thread, and then moved over the old one from the main thread once
+// the old snapshot has been unmapped. Windows won't replace a file that's still mapped.
+static dtk_bool32 dred_file_index__save_temp_data(const void* pData, size_t dataSize, const char* indexFilePath)
+{
+    char tempFilePath[DRED_MAX_PATH];
+    if (!dred_file_index__get_temp_file_path(indexFilePath, tempFilePath, sizeof(tempFilePath))) {
+        return DTK_FALSE;
+    }
+
+    dtk_result result = dtk_mkdir_for_file(indexFilePath);
+    if (result == DTK_SUCCESS || result == DTK_ALREADY_EXISTS) {
+        result = dtk_open_and_write_file(tempFilePath, pData, dataSize);
+    }
+
+    if (result != DTK_SUCCESS) {
+        dtk_delete_file(tempFilePath);
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
+static void dred_file_index__replace_with_temp_data(const char* indexFilePath)
+{
+    char tempFilePath[DRED_MAX_PATH];
+    if (!dred_file_index__get_temp_file_path(indexFilePath, tempFilePath, sizeof(tempFilePath))) {
+        return;
+    }
+
+    if (dtk_move_file(tempFilePath, indexFilePath) != DTK_SUCCESS) {
+        dtk_delete_file(tempFilePath);
+    }
+}
+
+static dtk_thread_result DTK_THREADCALL dred_file_index__build_thread_proc(void* pData)
+{
+    dred_file_index* pIndex = (dred_file_index*)pData;
+    dtk_assert(pIndex != NULL);
+
+    // The generation is passed back with the event so the main thread can tell whether or not it's for the current build.
+    dtk_uint32 buildGeneration = pIndex->buildGeneration;
+
+    dred_file_index__build_state state;
+    dtk_zero_object(&state);
+    state.pIndex = pIndex;
+    state.rootLength = strlen(pIndex->rootDirectory);
+    if (dtk_mutex_init(&state.lock) != DTK_SUCCESS) {
+        goto done;
+    }
+
+    // The root itself is a directory that needs watching.
+    if (!dred_file_index__build_add_directory(&state, "", dred_file_index__get_directory_modified_time(pIndex->rootDirectory))) {
+        goto done_uninit_lock;
+    }
+
+    dtk_walk_directory_config config;
+    dtk_zero_object(&config);
+    config.ppExcludePatterns = g_FileIndexExcludePatterns;
+    config.excludePatternCount = dtk_count_of(g_FileIndexExcludePatterns);
+
+    const char* ppExcludedDirectories[dtk_count_of(pIndex->excludedDirectories)];
+    for (dtk_uint32 iDirectory = 0; iDirectory < pIndex->excludedDirectoryCount; ++iDirectory) {
+        ppExcludedDirectories[iDirectory] = pIndex->excludedDirectories[iDirectory];
+    }
+    config.ppExcludeDirectories = ppExcludedDirectories;
+    config.excludeDirectoryCount = pIndex->excludedDirectoryCount;
+    config.threadCount = 4;
+    dtk_walk_directory(pIndex->rootDirectory, &config, dred_file_index__build_walk_proc, &state);
+
+    if (pIndex->isBuildCancelled || state.hasError) {
+        goto done_uninit_lock;
+    }
+
+    size_t dataSize;
+    void* pIndexData = dred_file_index__build_data(&state, pIndex->rootDirectory, &dataSize);
+    if (pIndexData == NULL) {
+        goto done_uninit_lock;
+    }
+
+    dred_file_index_snapshot* pSnapshot = (dred_file_index_snapshot*)dtk_calloc(1, sizeof(*pSnapshot));
+    if (pSnapshot == NULL || !dred_file_index__snapshot_init_pointers(pSnapshot, pIndexData, dataSize, NULL)) {
+        dtk_free(pSnapshot);
+        dtk_free(pIndexData);
+        goto done_uninit_lock;
+    }
+
+    pSnapshot->pData = pIndexData;
+    pSnapshot->dataSize = dataSize;
+
+    // Failing to save is not an error. It just means the index will be built again next time.
+    dtk_bool32 isSaved = dred_file_index__save_temp_data(pIndexData, dataSize, pIndex->indexFilePath);
+
+    dtk_mutex_lock(&pIndex->buildLock);
+    {
+        dred_file_index__snapshot_delete(pIndex->pBuiltSnapshot);
+        pIndex->pBuiltSnapshot = pSnapshot;
+        pIndex->isBuiltSnapshotSaved = isSaved;
+    }
+    dtk_mutex_unlock(&pIndex->buildLock);
+
+done_uninit_lock:
+    dtk_mutex_uninit(&state.lock);
+done:
+    dtk_free(state.pStrings);
+    dtk_free(state.pFileOffsets);
+    dtk_free(state.pDirectories);
+
+    // The main thread is always notified, even on failure, so it knows the build has finished.
+    dtk_post_custom_event(&pIndex->pDred->tk, DTK_CONTROL(&pIndex->pDred->mainWindow), DRED_EVENT_FILE_INDEX_BUILT, &buildGeneration, sizeof(buildGeneration));
+    return 0;
+}
+
+
+//// Watching ////
+
+static void dred_file_index__post_changed(dred_file_index* pIndex)
+{
+    dtk_post_custom_event(&pIndex->pDred->tk, DTK_CONTROL(&pIndex->pDred->mainWindow), DRED_EVENT_FILE_INDEX_CHANGED, NULL, 0);
+}
+
+static dtk_bool32 dred_file_index__is_excluded_directory(dred_file_index* pIndex, const char* absolutePath)
+{
+    for (dtk_uint32 iDirectory = 0; iDirectory < pIndex->excludedDirectoryCount; ++iDirectory) {
+        if (dtk_path_equal(absolutePath, pIndex->excludedDirectories[iDirectory]) || dtk_path_is_descendant(absolutePath, pIndex->excludedDirectories[iDirectory])) {
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+#if defined(__linux__)
+// Brings the inotify watches in line with the directories in the snapshot. Directories that were already being watched are
+// left alone so that a rebuild only costs a system call for each directory that was actually added or removed.
+static void dred_file_index__sync_watches(dred_file_index* pIndex, const dred_file_index_snapshot* pSnapshot)
+{
+    dtk_uint32 directoryCount = pSnapshot->pHeader->directoryCount;
+
+    const char** ppPaths = (const char**)dtk_malloc(directoryCount * sizeof(*ppPaths));
+    dred_file_index_watch* pNewWatches = (dred_file_index_watch*)dtk_malloc((directoryCount + pIndex->watchCount) * sizeof(*pNewWatches));
+    if (ppPaths == NULL || pNewWatches == NULL) {
+        dtk_free(ppPaths);
+        dtk_free(pNewWatches);
+        return;
+    }
+
+    for (dtk_uint32 iDirectory = 0; iDirectory < directoryCount; ++iDirectory) {
+        ppPaths[iDirectory] = pSnapshot->pStrings + pSnapshot->pDirectories[iDirectory].pathOffset;
+    }
+    qsort(ppPaths, directoryCount, sizeof(*ppPaths), dred_file_index__compare_strings);
+
+    // Both lists are sorted so they can be merged in one pass.
+    dtk_uint32 newWatchCount = 0;
+    dtk_uint32 iPath = 0;
+    dtk_uint32 iWatch = 0;
+    while ((iPath < directoryCount || iWatch < pIndex->watchCount) && !pIndex->isWatchStopping) {
+        int order;
+        if (iPath == directoryCount) {
+            order = 1;
+        } else if (iWatch == pIndex->watchCount) {
+            order = -1;
+        } else {
+            order = strcmp(ppPaths[iPath], pIndex->pWatches[iWatch].path);
+        }
+
+        if (order == 0) {
+            pNewWatches[newWatchCount++] = pIndex->pWatches[iWatch];
+            iPath += 1;
+            iWatch += 1;
+        } else if (order > 0) {
+            // No longer in the index.
+            inotify_rm_watch(pIndex->inotifyFD, pIndex->pWatches[iWatch].wd);
+            dtk_free_string(pIndex->pWatches[iWatch].path);
+            iWatch += 1;
+        } else {
+            // This will fail if the watch limit is reached, in which case changes in this directory will go unnoticed.
+            char directoryPath[DRED_MAX_PATH];
+            if (dtk_path_append(directoryPath, sizeof(directoryPath), pIndex->rootDirectory, ppPaths[iPath]) != 0) {
+                int wd = inotify_add_watch(pIndex->inotifyFD, directoryPath, IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR);
+                if (wd != -1) {
+                    char* path = dtk_make_string(ppPaths[iPath]);
+                    if (path != NULL) {
+                        pNewWatches[newWatchCount].wd = wd;
+                        pNewWatches[newWatchCount].path = path;
+                        newWatchCount += 1;
+                    } else {
+                        inotify_rm_watch(pIndex->inotifyFD, wd);
+                    }
+                }
+            }
+
+            iPath += 1;
+        }
+    }
+
+    // If this was stopped part way through, everything that wasn't looked at is kept as is.
+    for (; iWatch < pIndex->watchCount; ++iWatch) {
+        pNewWatches[newWatchCount++] = pIndex->pWatches[iWatch];
+    }
+
+    dtk_free(pIndex->pWatches);
+    pIndex->pWatches = pNewWatches;
+    pIndex->watchCount = newWatchCount;
+
+    dtk_free(ppPaths);
+}
+
+static void dred_file_index__unwatch_all(dred_file_index* pIndex)
+{
+    for (dtk_uint32 iWatch = 0; iWatch < pIndex->watchCount; ++iWatch) {
+        dtk_free_string(pIndex->pWatches[iWatch].path);
+    }
+
+    dtk_free(pIndex->pWatches);
+    pIndex->pWatches = NULL;
+    pIndex->watchCount = 0;
+
+    if (pIndex->inotifyFD != -1) {
+        close(pIndex->inotifyFD);   // <-- This removes every watch.
+        pIndex->inotifyFD = -1;
+    }
+}
+#endif
+
+static dtk_thread_result DTK_THREADCALL dred_file_index__watch_thread_proc(void* pData)
+{
+    dred_file_index* pIndex = (dred_file_index*)pData;
+    dtk_assert(pIndex != NULL);
+
+    // The snapshot is not replaced while this thread is running.
+    const dred_file_index_snapshot* pSnapshot = pIndex->pSnapshot;
+    dtk_assert(pSnapshot != NULL);
+
+    if (pIndex->checkDirectoriesOnWatch) {
+        for (dtk_uint32 iDirectory = 0; iDirectory < pSnapshot->pHeader->directoryCount && !pIndex->isWatchStopping; ++iDirectory) {
+            const dred_file_index_directory* pDirectory = &pSnapshot->pDirectories[iDirectory];
+
+            char directoryPath[DRED_MAX_PATH];
+            if (dtk_path_append(directoryPath, sizeof(directoryPath), pIndex->rootDirectory, pSnapshot->pStrings + pDirectory->pathOffset) == 0) {
+                continue;
+            }
+
+            if (dred_file_index__get_directory_modified_time(directoryPath) != pDirectory->modifiedTime) {
+                dred_file_index__post_changed(pIndex);
+                break;
+            }
+        }
+    }
+
+#if defined(DRED_WIN32)
+    // Change notifications are recursive, so changes inside the excluded directories need to be filtered out by hand.
+    HANDLE hDirectory = CreateFileA(pIndex->rootDirectory, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+    if (hDirectory == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    OVERLAPPED overlapped;
+    ZeroMemory(&overlapped, sizeof(overlapped));
+    overlapped.hEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+    if (overlapped.hEvent == NULL) {
+        CloseHandle(hDirectory);
+        return 0;
+    }
+
+    DWORD buffer[16384];    // DWORD for alignment.
+    dtk_bool32 isReadPending = DTK_FALSE;
+    while (!pIndex->isWatchStopping) {
+        if (!isReadPending) {
+            ResetEvent(overlapped.hEvent);
+            if (!ReadDirectoryChangesW(hDirectory, buffer, sizeof(buffer), TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME, NULL, &overlapped, NULL)) {
+                break;
+            }
+            isReadPending = DTK_TRUE;
+        }
+
+        if (WaitForSingleObject(overlapped.hEvent, 250) != WAIT_OBJECT_0) {
+            continue;
+        }
+
+        isReadPending = DTK_FALSE;
+
+        DWORD bytesTransferred;
+        if (!GetOverlappedResult(hDirectory, &overlapped, &bytesTransferred, FALSE)) {
+            break;
+        }
+
+        // Zero bytes means the buffer overflowed and the details were lost, in which case a rebuild is needed regardless.
+        dtk_bool32 hasChanged = bytesTransferred == 0;
+        for (DWORD offset = 0; offset < bytesTransferred && !hasChanged; ) {
+            const FILE_NOTIFY_INFORMATION* pInfo = (const FILE_NOTIFY_INFORMATION*)((const dtk_uint8*)buffer + offset);
+
+            // Anything that can't be converted is treated as a change to be safe.
+            char relativePath[DRED_MAX_PATH];
+            int length = WideCharToMultiByte(CP_UTF8, 0, pInfo->FileName, (int)(pInfo->FileNameLength / sizeof(WCHAR)), relativePath, sizeof(relativePath)-1, NULL, NULL);
+            if (length <= 0) {
+                hasChanged = DTK_TRUE;
+            } else {
+                relativePath[length] = '\0';
+
+                char absolutePath[DRED_MAX_PATH];
+                if (dtk_path_append(absolutePath, sizeof(absolutePath), pIndex->rootDirectory, relativePath) == 0 || !dred_file_index__is_excluded_directory(pIndex, absolutePath)) {
+                    hasChanged = DTK_TRUE;
+                }
+            }
+
+            if (pInfo->NextEntryOffset == 0) {
+                break;
+            }
+            offset += pInfo->NextEntryOffset;
+        }
+
+        if (hasChanged) {
+            dred_file_index__post_changed(pIndex);
+        }
+    }
+
+    if (isReadPending) {
+        CancelIo(hDirectory);
+        DWORD bytesTransferred;
+        GetOverlappedResult(hDirectory, &overlapped, &bytesTransferred, TRUE);
+    }
+
+    CloseHandle(overlapped.hEvent);
+    CloseHandle(hDirectory);
+#elif defined(__linux__)
+    if (pIndex->inotifyFD == -1) {
+        pIndex->inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (pIndex->inotifyFD == -1) {
+            return 0;
+        }
+    }
+
+    dred_file_index__sync_watches(pIndex, pSnapshot);
+
+    while (!pIndex->isWatchStopping) {
+        struct pollfd pfd;
+        pfd.fd = pIndex->inotifyFD;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 250) > 0 && (pfd.revents & POLLIN) != 0) {
+            // The details of the events don't matter since the whole index is rebuilt. The only exception is IN_IGNORED which
+            // is what removing a watch generates. That's the result of a rebuild rather than a change so it's skipped.
+            dtk_bool32 hasChanged = DTK_FALSE;
+            char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+            ssize_t bytesRead;
+            while ((bytesRead = read(pIndex->inotifyFD, buffer, sizeof(buffer))) > 0) {
+                for (ssize_t offset = 0; offset < bytesRead; ) {
+                    const struct inotify_event* pEvent = (const struct inotify_event*)(buffer + offset);
+                    if ((pEvent->mask & ~IN_IGNORED) != 0) {
+                        hasChanged = DTK_TRUE;
+                    }
+
+                    offset += sizeof(*pEvent) + pEvent->len;
+                }
+            }
+
+            if (hasChanged) {
+                dred_file_index__post_changed(pIndex);
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+
+static void dred_file_index__start_watching(dred_file_index* pIndex, dtk_bool32 checkDirectories)
+{
+    dtk_assert(pIndex != NULL);
+    dtk_assert(!pIndex->isWatching);
+
+    if (pIndex->pSnapshot == NULL) {
+        return;
+    }
+
+    pIndex->isWatchStopping = DTK_FALSE;
+    pIndex->checkDirectoriesOnWatch = checkDirectories;
+    if (dtk_thread_create(&pIndex->watchThread, dred_file_index__watch_thread_proc, pIndex) == DTK_SUCCESS) {
+        pIndex->isWatching = DTK_TRUE;
+    }
+}
+
+static void dred_file_index__stop_watching(dred_file_index* pIndex)
+{
+    dtk_assert(pIndex != NULL);
+
+    if (!pIndex->isWatching) {
+        return;
+    }
+
+    pIndex->isWatchStopping = DTK_TRUE;
+    dtk_thread_wait(&pIndex->watchThread);
+    pIndex->isWatching = DTK_FALSE;
+}
+
+static void dred_file_index__on_rebuild_timer(dtk_timer* pTimer, void* pUserData)
+{
+    dred_file_index* pIndex = (dred_file_index*)pUserData;
+    dtk_assert(pIndex != NULL);
+
+    dtk_timer_uninit(pTimer);
+    pIndex->hasRebuildTimer = DTK_FALSE;
+
+    dred_file_index_rebuild(pIndex);
+}
+
+
+static dtk_bool32 dred_file_index__is_too_broad_for_default(const char* directory)
+{
+    // The root of the file system. This is "/" or a drive root such as "C:".
+    if (dtk_path_is_root(directory)) {
+        return DTK_TRUE;
+    }
+
+#if defined(DRED_WIN32)
+    const char* homeDirectory = getenv("USERPROFILE");
+#else
+    const char* homeDirectory = getenv("HOME");
+    if (homeDirectory == NULL) {
+        struct passwd* pPasswd = getpwuid(getuid());
+        if (pPasswd != NULL) {
+            homeDirectory = pPasswd->pw_dir;
+        }
+    }
+#endif
+
+    return homeDirectory != NULL && dtk_path_equal(directory, homeDirectory);
+}
+
+static void dred_file_index__add_excluded_directory(dred_file_index* pIndex, const char* directory)
+{
+    if (pIndex->excludedDirectoryCount == dtk_count_of(pIndex->excludedDirectories)) {
+        return;
+    }
+
+    if (!dred_to_absolute_path(directory, pIndex->excludedDirectories[pIndex->excludedDirectoryCount], sizeof(pIndex->excludedDirectories[0]))) {
+        return;
+    }
+
+    pIndex->excludedDirectoryCount += 1;
+}
+
+
+//// Public API ////
+
+dtk_bool32 dred_file_index_init(dred_file_index* pIndex, dred_context* pDred, const char* rootDirectory)
+{
+    if (pIndex == NULL || pDred == NULL) {
+        return DTK_FALSE;
+    }
+
+    if (pIndex->isInitialized) {
+        dred_file_index_uninit(pIndex);
+    }
+
+    dtk_zero_object(pIndex);
+    pIndex->pDred = pDred;
+#if defined(__linux__)
+    pIndex->inotifyFD = -1;
+#endif
+
+    dtk_bool32 isDefaultRoot = rootDirectory == NULL || rootDirectory[0] == '\0';
+    if (isDefaultRoot) {
+        char* workingDirectory = dtk_get_current_directory();
+        if (workingDirectory == NULL) {
+            return DTK_FALSE;
+        }
+
+        strcpy_s(pIndex->rootDirectory, sizeof(pIndex->rootDirectory), workingDirectory);
+        dtk_free(workingDirectory);
+    } else {
+        if (!dred_to_absolute_path(rootDirectory, pIndex->rootDirectory, sizeof(pIndex->rootDirectory))) {
+            return DTK_FALSE;
+        }
+    }
+
+    // Trailing slashes are removed so that the same directory always maps to the same index file.
+    size_t rootLength = strlen(pIndex->rootDirectory);
+    while (rootLength > 1 && (pIndex->rootDirectory[rootLength-1] == '/' || pIndex->rootDirectory[rootLength-1] == '\\')) {
+        pIndex->rootDirectory[--rootLength] = '\0';
+    }
+
+    if (!dtk_directory_exists(pIndex->rootDirectory)) {
+        return DTK_FALSE;
+    }
+
+    // Launching from the home directory is common, but indexing it would mean walking most of the disk. It needs to be asked
+    // for explicitly.
+    if (isDefaultRoot && dred_file_index__is_too_broad_for_default(pIndex->rootDirectory)) {
+        dred_logf(pDred, "Not indexing %s by default. Use the index-files command to index it explicitly.", pIndex->rootDirectory);
+        return DTK_FALSE;
+    }
+
+    char configFolderPath[DRED_MAX_PATH];
+    if (dred_get_config_folder_path(pDred, configFolderPath, sizeof(configFolderPath)) == 0) {
+        return DTK_FALSE;
+    }
+
+    char logFolderPath[DRED_MAX_PATH];
+    if (dred_get_log_folder_path(pDred, logFolderPath, sizeof(logFolderPath)) == 0) {
+        logFolderPath[0] = '\0';
+    }
+
+    // The config and log folders are excluded with their absolute paths, in the same form the walker produces them.
+    dred_file_index__add_excluded_directory(pIndex, configFolderPath);
+    if (logFolderPath[0] != '\0' && !dtk_path_equal(logFolderPath, configFolderPath)) {
+        dred_file_index__add_excluded_directory(pIndex, logFolderPath);
+    }
+
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "cache/%08x.dredfileindex", (unsigned int)dtk_hash_string(pIndex->rootDirectory, 0));
+    if (dtk_path_append(pIndex->indexFilePath, sizeof(pIndex->indexFilePath), configFolderPath, fileName) == 0) {
+        return DTK_FALSE;
+    }
+
+    if (dtk_mutex_init(&pIndex->buildLock) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    pIndex->isInitialized = DTK_TRUE;
+
+    pIndex->pSnapshot = dred_file_index__snapshot_load(pIndex->indexFilePath, pIndex->rootDirectory);
+    if (pIndex->pSnapshot != NULL) {
+        pIndex->snapshotGeneration = ++g_FileIndexGeneration;
+        dred_file_index__start_watching(pIndex, DTK_TRUE);
+    } else {
+        dred_file_index_rebuild(pIndex);
+    }
+
+    return DTK_TRUE;
+}
+
+void dred_file_index_uninit(dred_file_index* pIndex)
+{
+    if (pIndex == NULL || !pIndex->isInitialized) {
+        return;
+    }
+
+    if (pIndex->hasRebuildTimer) {
+        dtk_timer_uninit(&pIndex->rebuildTimer);
+        pIndex->hasRebuildTimer = DTK_FALSE;
+    }
+
+    dred_file_index__stop_watching(pIndex);
+#if defined(__linux__)
+    dred_file_index__unwatch_all(pIndex);
+#endif
+
+    if (pIndex->isBuilding) {
+        pIndex->isBuildCancelled = DTK_TRUE;
+        dtk_thread_wait(&pIndex->buildThread);
+        pIndex->isBuilding = DTK_FALSE;
+    }
+
+    dred_file_index__snapshot_delete(pIndex->pBuiltSnapshot);
+    dred_file_index__snapshot_delete(pIndex->pSnapshot);
+    dtk_mutex_uninit(&pIndex->buildLock);
+
+    // A build that finished before its event was handled still has a complete index to keep.
+    if (pIndex->isBuiltSnapshotSaved) {
+        dred_file_index__replace_with_temp_data(pIndex->indexFilePath);
+        pIndex->isBuiltSnapshotSaved = DTK_FALSE;
+    }
+
+    pIndex->pBuiltSnapshot = NULL;
+    pIndex->pSnapshot = NULL;
+    pIndex->isInitialized = DTK_FALSE;
+}
+
+dtk_bool32 dred_file_index_rebuild(dred_file_index* pIndex)
+{
+    if (pIndex == NULL || !pIndex->isInitialized) {
+        return DTK_FALSE;
+    }
+
+    if (pIndex->isBuilding) {
+        pIndex->isRebuildPending = DTK_TRUE;
+        return DTK_TRUE;
+    }
+
+    pIndex->isBuildCancelled = DTK_FALSE;
+    pIndex->isRebuildPending = DTK_FALSE;
+    pIndex->buildGeneration = ++g_FileIndexGeneration;
+    if (dtk_thread_create(&pIndex->buildThread, dred_file_index__build_thread_proc, pIndex) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    pIndex->isBuilding = DTK_TRUE;
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_file_index_is_ready(dred_file_index* pIndex)
+{
+    return pIndex != NULL && pIndex->isInitialized && pIndex->pSnapshot != NULL;
+}
+
+const char* dred_file_index_get_root_directory(dred_file_index* pIndex)
+{
+    if (pIndex == NULL || !pIndex->isInitialized) {
+        return NULL;
+    }
+
+    return pIndex->rootDirectory;
+}
+
+dtk_uint32 dred_file_index_get_file_count(dred_file_index* pIndex)
+{
+    if (!dred_file_index_is_ready(pIndex)) {
+        return 0;
+    }
+
+    return pIndex->pSnapshot->pHeader->pathCount;
+}
+
+dtk_uint32 dred_file_index_get_generation(dred_file_index* pIndex)
+{
+    if (!dred_file_index_is_ready(pIndex)) {
+        return 0;
+    }
+
+    return pIndex->snapshotGeneration;
+}
+
+typedef struct
+{
+    const dred_file_index_snapshot* pSnapshot;
+    char foldedQuery[DRED_MAX_PATH];
+    size_t queryLength;
+    const char* foldedFileName;     // Points into foldedQuery.
+    size_t fileNameLength;
+    size_t directoryLength;         // The length of the part of the query before the last path separator.
+    dtk_bool32 hasDirectory;
+    dtk_uint32 maxResultCount;
+    dtk_uint32 resultCount;
+    dred_file_index_find_proc proc;
+    void* pUserData;
+} dred_file_index__query;
+
+// Checks a path against the query and passes it to the callback if it matches. Returns false if the search should stop.
+static dtk_bool32 dred_file_index__query_path(dred_file_index__query* pQuery, dtk_uint32 pathIndex)
+{
+    const char* path = pQuery->pSnapshot->pStrings + pQuery->pSnapshot->pPathOffsets[pathIndex];
+    if (!dred_file_index__contains(dred_file_index__find_file_name(path), pQuery->foldedFileName, pQuery->fileNameLength)) {
+        return DTK_TRUE;
+    }
+    if (pQuery->hasDirectory && !dred_file_index__contains(path, pQuery->foldedQuery, pQuery->queryLength)) {
+        return DTK_TRUE;
+    }
+
+    pQuery->resultCount += 1;
+    return pQuery->proc(path, pQuery->pUserData) && pQuery->resultCount < pQuery->maxResultCount;
+}
+
+static void dred_file_index__query_trigrams(dred_file_index__query* pQuery)
+{
+    const dred_file_index_snapshot* pSnapshot = pQuery->pSnapshot;
+
+    // Only the files containing the rarest trigram need to be checked. If any trigram is not in the index at all there can't
+    // be any matches.
+    const dred_file_index_trigram* pRarestTrigram = NULL;
+    for (size_t i = 0; i+2 < pQuery->fileNameLength; ++i) {
+        const dred_file_index_trigram* pTrigram = dred_file_index__snapshot_find_trigram(pSnapshot, dred_file_index__make_trigram_key(pQuery->foldedFileName + i));
+        if (pTrigram == NULL) {
+            return;
+        }
+
+        if (pRarestTrigram == NULL || pTrigram->pathCount < pRarestTrigram->pathCount) {
+            pRarestTrigram = pTrigram;
+        }
+    }
+
+    const dtk_uint8* pPosting = pSnapshot->pPostings + pRarestTrigram->postingsOffset;
+    const dtk_uint8* pPostingsEnd = pSnapshot->pPostings + pSnapshot->pHeader->postingsSize;
+
+    dtk_uint32 pathIndex = 0;
+    for (dtk_uint32 i = 0; i < pRarestTrigram->pathCount; ++i) {
+        dtk_uint32 delta;
+        if (!dred_file_index__read_varint(&pPosting, pPostingsEnd, &delta)) {
+            break;
+        }
+
+        pathIndex += delta;
+        if (pathIndex >= pSnapshot->pHeader->pathCount) {
+            break;
+        }
+
+        if (!dred_file_index__query_path(pQuery, pathIndex)) {
+            break;
+        }
+    }
+}
+
+// Finds the index of the first path that is not less than the given prefix. When <pastPrefix> is true, finds the index of the
+// first path that comes after every path starting with the prefix instead.
+static dtk_uint32 dred_file_index__find_path_bound(const dred_file_index_snapshot* pSnapshot, const char* prefix, size_t prefixLength, dtk_bool32 pastPrefix)
+{
+    dtk_uint32 lo = 0;
+    dtk_uint32 hi = pSnapshot->pHeader->pathCount;
+    while (lo < hi) {
+        dtk_uint32 mid = lo + (hi - lo)/2;
+        int cmp = strncmp(pSnapshot->pStrings + pSnapshot->pPathOffsets[mid], prefix, prefixLength);
+        if (cmp < 0 || (cmp == 0 && pastPrefix)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static int dred_file_index__compare_ranges(const void* a, const void* b)
+{
+    return dred_file_index__compare_uint32(a, b);   // Ranges are sorted by their first index.
+}
+
+// Used when the file name part of the query is too short for trigrams but there is a directory part. For the query to match,
+// the directory part must be at the end of one of the file's ancestor directories, and since paths are sorted the files under
+// each directory are contiguous. This finds those ranges from the (much shorter) list of directories and only checks the files
+// within them. Returns false if the ranges could not be found, in which case every path needs to be checked instead.
+static dtk_bool32 dred_file_index__query_directories(dred_file_index__query* pQuery)
+{
+    const dred_file_index_snapshot* pSnapshot = pQuery->pSnapshot;
+
+    dtk_uint32* pRanges = (dtk_uint32*)dtk_malloc(dtk_max(pSnapshot->pHeader->directoryCount, 1) * sizeof(dtk_uint32) * 2);
+    if (pRanges == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint32 rangeCount = 0;
+    for (dtk_uint32 iDirectory = 0; iDirectory < pSnapshot->pHeader->directoryCount; ++iDirectory) {
+        const char* directoryPath = pSnapshot->pStrings + pSnapshot->pDirectories[iDirectory].pathOffset;
+        size_t directoryPathLength = strlen(directoryPath);
+        if (directoryPathLength < pQuery->directoryLength || directoryPathLength+2 > DRED_MAX_PATH) {
+            continue;
+        }
+
+        const char* directoryPathEnd = directoryPath + directoryPathLength - pQuery->directoryLength;
+        size_t i = 0;
+        while (i < pQuery->directoryLength && dred_file_index__fold(directoryPathEnd[i]) == pQuery->foldedQuery[i]) {
+            i += 1;
+        }
+        if (i < pQuery->directoryLength) {
+            continue;
+        }
+
+        char prefix[DRED_MAX_PATH];
+        memcpy(prefix, directoryPath, directoryPathLength);
+        prefix[directoryPathLength] = '/';
+
+        dtk_uint32 first = dred_file_index__find_path_bound(pSnapshot, prefix, directoryPathLength+1, DTK_FALSE);
+        dtk_uint32 end   = dred_file_index__find_path_bound(pSnapshot, prefix, directoryPathLength+1, DTK_TRUE);
+        if (first < end) {
+            pRanges[rangeCount*2 + 0] = first;
+            pRanges[rangeCount*2 + 1] = end;
+            rangeCount += 1;
+        }
+    }
+
+    // Nested directories give overlapping ranges. Sorting them keeps the results in path order, and makes skipping the overlap
+    // simple.
+    qsort(pRanges, rangeCount, sizeof(dtk_uint32)*2, dred_file_index__compare_ranges);
+
+    dtk_uint32 nextPathIndex = 0;
+    for (dtk_uint32 iRange = 0; iRange < rangeCount; ++iRange) {
+        dtk_uint32 pathIndex = dtk_max(pRanges[iRange*2 + 0], nextPathIndex);
+        dtk_uint32 end = pRanges[iRange*2 + 1];
+        for (; pathIndex < end; ++pathIndex) {
+            if (!dred_file_index__query_path(pQuery, pathIndex)) {
+                dtk_free(pRanges);
+                return DTK_TRUE;
+            }
+        }
+
+        nextPathIndex = dtk_max(nextPathIndex, end);
+    }
+
+    dtk_free(pRanges);
+    return DTK_TRUE;
+}
+
+dtk_uint32 dred_file_index_find(dred_file_index* pIndex, const char* query, dtk_uint32 maxResultCount, dred_file_index_find_proc proc, void* pUserData)
+{
+    if (!dred_file_index_is_ready(pIndex) || query == NULL || proc == NULL || maxResultCount == 0) {
+        return 0;
+    }
+
+    dred_file_index__query* pQuery = (dred_file_index__query*)dtk_malloc(sizeof(*pQuery));
+    if (pQuery == NULL) {
+        return 0;
+    }
+
+    pQuery->pSnapshot = pIndex->pSnapshot;
+    pQuery->maxResultCount = maxResultCount;
+    pQuery->resultCount = 0;
+    pQuery->proc = proc;
+    pQuery->pUserData = pUserData;
+
+    pQuery->queryLength = 0;
+    for (; query[pQuery->queryLength] != '\0' && pQuery->queryLength+1 < sizeof(pQuery->foldedQuery); ++pQuery->queryLength) {
+        pQuery->foldedQuery[pQuery->queryLength] = dred_file_index__fold(query[pQuery->queryLength]);
+    }
+    pQuery->foldedQuery[pQuery->queryLength] = '\0';
+
+    pQuery->foldedFileName = dred_file_index__find_file_name(pQuery->foldedQuery);
+    pQuery->fileNameLength = strlen(pQuery->foldedFileName);
+    pQuery->hasDirectory = pQuery->foldedFileName != pQuery->foldedQuery;
+    pQuery->directoryLength = pQuery->hasDirectory ? (size_t)(pQuery->foldedFileName - pQuery->foldedQuery) - 1 : 0;
+
+    if (pQuery->fileNameLength >= 3) {
+        dred_file_index__query_trigrams(pQuery);
+    } else if (pQuery->directoryLength == 0 || !dred_file_index__query_directories(pQuery)) {
+        // Nothing to narrow things down with. Every path needs to be checked, but unless the query has a directory part the
+        // result limit is reached quickly in practice.
+        for (dtk_uint32 pathIndex = 0; pathIndex < pQuery->pSnapshot->pHeader->pathCount; ++pathIndex) {
+            if (!dred_file_index__query_path(pQuery, pathIndex)) {
+                break;
+            }
+        }
+    }
+
+    dtk_uint32 resultCount = pQuery->resultCount;
+    dtk_free(pQuery);
+
+    return resultCount;
+}
+
+void dred_file_index_on_event(dred_file_index* pIndex, dtk_uint32 eventID, const void* pData, size_t dataSize)
+{
+    if (pIndex == NULL || !pIndex->isInitialized) {
+        return;
+    }
+
+    switch (eventID)
+    {
+        case DRED_EVENT_FILE_INDEX_BUILT:
+        {
+            // Events from a build that was cancelled can still be in the queue after a new build has started. Those are ignored,
+            // otherwise the wait below would block until the new build finishes.
+            if (pData == NULL || dataSize != sizeof(dtk_uint32) || *(const dtk_uint32*)pData != pIndex->buildGeneration || !pIndex->isBuilding) {
+                return;
+            }
+
+            // The event is the last thing the build thread does so this doesn't wait long.
+            dtk_thread_wait(&pIndex->buildThread);
+            pIndex->isBuilding = DTK_FALSE;
+
+            dred_file_index_snapshot* pBuiltSnapshot;
+            dtk_bool32 isBuiltSnapshotSaved;
+            dtk_mutex_lock(&pIndex->buildLock);
+            {
+                pBuiltSnapshot = pIndex->pBuiltSnapshot;
+                isBuiltSnapshotSaved = pIndex->isBuiltSnapshotSaved;
+                pIndex->pBuiltSnapshot = NULL;
+                pIndex->isBuiltSnapshotSaved = DTK_FALSE;
+            }
+            dtk_mutex_unlock(&pIndex->buildLock);
+
+            if (pBuiltSnapshot != NULL) {
+                // The watch thread uses the old snapshot so it needs to be stopped before the snapshot is replaced. The new
+                // snapshot is fresh so there's no need to check for stale directories.
+                dred_file_index__stop_watching(pIndex);
+                dred_file_index__snapshot_delete(pIndex->pSnapshot);
+                pIndex->pSnapshot = pBuiltSnapshot;
+                pIndex->snapshotGeneration = pIndex->buildGeneration;
+
+                // The old snapshot may have been mapped from the index file so it can only be replaced now that it's gone.
+                if (isBuiltSnapshotSaved) {
+                    dred_file_index__replace_with_temp_data(pIndex->indexFilePath);
+                }
+
+                dred_file_index__start_watching(pIndex, DTK_FALSE);
+            }
+
+            if (pIndex->isRebuildPending) {
+                dred_file_index_rebuild(pIndex);
+            }
+        } break;
+
+        case DRED_EVENT_FILE_INDEX_CHANGED:
+        {
+            // Changes tend to come in bursts, such as when switching branches, so the rebuild is delayed until things settle.
+            if (pIndex->hasRebuildTimer) {
+                dtk_timer_set_timeout(&pIndex->rebuildTimer, DRED_FILE_INDEX_REBUILD_DELAY);
+            } else {
+                if (dtk_timer_init(&pIndex->pDred->tk, DRED_FILE_INDEX_REBUILD_DELAY, dred_file_index__on_rebuild_timer, pIndex, &pIndex->rebuildTimer) == DTK_SUCCESS) {
+                    pIndex->hasRebuildTimer = DTK_TRUE;
+                }
+            }
+        } break;
+
+        default: break;
+    }
+}
@@ -0,0 +1,179 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The file index is a list of every file under a root directory (the working directory by default) which is used for opening
+// files by name from the command bar without needing to browse for them. The working directory is not indexed by default if
+// it's the home directory or the root of the file system since that would be most of the disk.
+//
+// dred's own config and log folders are never indexed or watched. They're written to all the time, including by the index
+// itself when it's saved, and watching them would trigger endless rebuilds.
+//
+// The index is built on a background thread by walking the directory tree, and is then saved to disk so that the next
+// time dred is started it can be mapped straight back into memory without walking the tree again. Every time the index is
+// loaded from disk, the modified time of each indexed directory is checked on a background thread to catch changes that were
+// made while dred was not running. While dred is running the tree is watched for changes with the platform's file system
+// notifications (inotify on Linux and change notifications on Windows) and the index is rebuilt in the background shortly
+// after things settle down.
+//
+// The index is immutable once built. Rebuilding creates a new one which replaces the old one on the main thread.
+//
+// Queries are case insensitive substring searches against the file name. If the query contains a path separator, it's
+// matched against the whole path relative to the root instead, but the file name part of the query must still be a part of
+// the file name. To make queries fast, each file name is broken up into trigrams (every run of three characters) and a list of
+// the files containing each trigram is stored. A query only needs to look at the files in the list of its rarest trigram.
+//
+// File Format
+// ===========
+// The file format is the same as the in-memory format. All integers are stored in the native byte order. The index is
+// per-machine so this is not a problem, and a byte order mismatch will just fail the magic number check.
+//
+//     dred_file_index_header
+//     dred_file_index_directory[directoryCount]
+//     dred_file_index_trigram[trigramCount]      <-- Sorted by key.
+//     dtk_uint32 pathOffsets[pathCount]          <-- Offsets into the string data, sorted by path.
+//     dtk_uint8 postings[postingsSize]           <-- Lists of path indices. Each is delta encoded as variable length integers.
+//     char strings[stringsSize]                  <-- The root directory followed by every relative path, null terminated.
+//
+// Relative paths always use forward slashes.
+
+#define DRED_FILE_INDEX_MAGIC           0x58494644  // "DFIX"
+#define DRED_FILE_INDEX_VERSION         1
+
+// The maximum number of files to index. Walking stops when this is reached so that accidentally indexing something like the
+// root of the file system doesn't consume all available memory.
+#define DRED_FILE_INDEX_MAX_FILES       2000000
+
+// How long to wait after the last file system notification before rebuilding the index.
+#define DRED_FILE_INDEX_REBUILD_DELAY   2000
+
+typedef struct
+{
+    dtk_uint32 magic;
+    dtk_uint32 version;
+    dtk_uint32 pathCount;
+    dtk_uint32 directoryCount;
+    dtk_uint32 trigramCount;
+    dtk_uint32 postingsSize;        // Always a multiple of 4 so the string data is aligned.
+    dtk_uint32 stringsSize;
+    dtk_uint32 reserved;
+} dred_file_index_header;
+
+typedef struct
+{
+    dtk_uint64 modifiedTime;
+    dtk_uint32 pathOffset;          // The path relative to the root. The root itself is an empty string.
+    dtk_uint32 reserved;
+} dred_file_index_directory;
+
+typedef struct
+{
+    dtk_uint32 key;                 // The three case folded characters of the trigram, with the first in the highest bits.
+    dtk_uint32 pathCount;           // The number of paths in the posting list.
+    dtk_uint32 postingsOffset;      // The offset of the posting list in the postings data.
+} dred_file_index_trigram;
+
+// A built index. This is either loaded from disk with a mapped file, or is built in memory.
+typedef struct
+{
+    dtk_mapped_file file;
+    dtk_mapped_view view;
+    dtk_bool32 isMapped;
+    void* pData;                    // The whole index, in the file format.
+    size_t dataSize;
+
+    const dred_file_index_header* pHeader;
+    const dred_file_index_directory* pDirectories;
+    const dred_file_index_trigram* pTrigrams;
+    const dtk_uint32* pPathOffsets;
+    const dtk_uint8* pPostings;
+    const char* pStrings;
+} dred_file_index_snapshot;
+
+#if defined(__linux__)
+typedef struct
+{
+    int wd;
+    char* path;                     // Relative to the root.
+} dred_file_index_watch;
+#endif
+
+typedef struct
+{
+    dred_context* pDred;
+    char rootDirectory[DRED_MAX_PATH];
+    char indexFilePath[DRED_MAX_PATH];
+
+    // Directories that are excluded from the index, such as the config folder.
+    char excludedDirectories[2][DRED_MAX_PATH];
+    dtk_uint32 excludedDirectoryCount;
+
+    // The current index. Only accessed from the main thread.
+    dred_file_index_snapshot* pSnapshot;
+    dtk_uint32 snapshotGeneration;
+
+    // Building. The build thread places the new snapshot in pBuiltSnapshot and posts a DRED_EVENT_FILE_INDEX_BUILT event with
+    // the build's generation. Events with a generation other than buildGeneration are from cancelled builds.
+    dtk_thread buildThread;
+    dtk_mutex buildLock;
+    dred_file_index_snapshot* pBuiltSnapshot;   // Protected by buildLock.
+    dtk_bool32 isBuiltSnapshotSaved;            // Protected by buildLock. Whether or not the temp index file was written.
+    dtk_uint32 buildGeneration;
+    volatile dtk_bool32 isBuildCancelled;
+    dtk_bool32 isBuilding;
+    dtk_bool32 isRebuildPending;                // Set when a change is detected while building.
+
+    // Watching. The watch thread posts a DRED_EVENT_FILE_INDEX_CHANGED event when something changes, which starts the
+    // rebuild timer. Each event restarts the timer.
+    dtk_thread watchThread;
+    volatile dtk_bool32 isWatchStopping;
+    dtk_bool32 isWatching;
+    dtk_bool32 checkDirectoriesOnWatch;         // Whether or not the watch thread should check for stale directories first.
+    dtk_timer rebuildTimer;
+    dtk_bool32 hasRebuildTimer;
+#if defined(__linux__)
+    // inotify is not recursive so each directory is watched individually. The watches are kept across rebuilds, and only
+    // directories that have been added or removed since the last rebuild are changed. Only accessed by the watch thread.
+    int inotifyFD;                              // -1 if it hasn't been created yet.
+    dred_file_index_watch* pWatches;            // Sorted by path.
+    dtk_uint32 watchCount;
+#endif
+
+    dtk_bool32 isInitialized;
+} dred_file_index;
+
+// Callback for dred_file_index_find(). Return false to stop.
+typedef dtk_bool32 (* dred_file_index_find_proc)(const char* relativePath, void* pUserData);
+
+// Initializes the file index for the given root directory. If the root is null or empty, the working directory is used, unless
+// it's the home directory or the root of the file system in which case this fails.
+//
+// If an index for the root exists on disk it's loaded immediately. Otherwise it's built in the background and queries will
+// not return anything until it's ready. If the index is already initialized it's uninitialized first.
+dtk_bool32 dred_file_index_init(dred_file_index* pIndex, dred_context* pDred, const char* rootDirectory);
+
+// Uninitializes the file index. This waits for any background threads to finish.
+void dred_file_index_uninit(dred_file_index* pIndex);
+
+// Rebuilds the index in the background.
+dtk_bool32 dred_file_index_rebuild(dred_file_index* pIndex);
+
+// Determines whether or not the index is initialized and has something to query.
+dtk_bool32 dred_file_index_is_ready(dred_file_index* pIndex);
+
+// Retrieves the root directory of the index. Returns null if the index is not initialized.
+const char* dred_file_index_get_root_directory(dred_file_index* pIndex);
+
+// Retrieves the number of files in the index.
+dtk_uint32 dred_file_index_get_file_count(dred_file_index* pIndex);
+
+// Retrieves the generation of the index. This changes whenever the index is loaded or rebuilt, and is never 0 while the index
+// is ready. Used for knowing when something derived from the index needs to be refreshed.
+dtk_uint32 dred_file_index_get_generation(dred_file_index* pIndex);
+
+// Finds files whose name contains the given query, in the order of their paths. An empty query matches every file. Paths passed
+// to the callback are relative to the root directory and are only valid for the duration of the callback.
+//
+// Returns the number of files passed to the callback.
+dtk_uint32 dred_file_index_find(dred_file_index* pIndex, const char* query, dtk_uint32 maxResultCount, dred_file_index_find_proc proc, void* pUserData);
+
+// Called from the main thread when a DRED_EVENT_FILE_INDEX_* event is received.
+void dred_file_index_on_event(dred_file_index* pIndex, dtk_uint32 eventID, const void* pData, size_t dataSize);
@@ -0,0 +1,587 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The number of threads used for walking the directory tree.
+#define DRED_FIND_IN_FILES_WALKER_THREAD_COUNT  4
+
+// Results are buffered per-thread and posted to the main thread once they reach this size, or when the file is finished.
+#define DRED_FIND_IN_FILES_RESULT_FLUSH_SIZE    16384
+
+// Lines longer than this are truncated in the results.
+#define DRED_FIND_IN_FILES_MAX_RESULT_LENGTH    256
+
+// Files with a null byte within this many bytes of the start are considered binary and are skipped.
+#define DRED_FIND_IN_FILES_BINARY_CHECK_SIZE    8000
+
+typedef struct
+{
+    dtk_uint32 searchID;
+    dtk_uint32 matchCount;
+    dtk_uint32 matchedFileCount;
+    dtk_uint32 searchedFileCount;
+} dred_find_in_files_done_data;
+
+static dtk_bool32 dred_find_in_files__walker_iterate_proc(const dtk_walk_directory_entry* pEntry, void* pUserData)
+{
+    dred_find_in_files* pFIF = (dred_find_in_files*)pUserData;
+    dtk_assert(pFIF != NULL);
+
+    if (pFIF->isCancelled) {
+        return DTK_FALSE;
+    }
+
+    char* filePathCopy = dtk_make_string(pEntry->path);
+    if (filePathCopy == NULL) {
+        return DTK_FALSE;
+    }
+
+    // If the queue is full we need to wait for a worker to take something off it. The workers keep emptying the queue after
+    // the search is cancelled so this can't get stuck.
+    dtk_semaphore_wait(&pFIF->queueSpaceSemaphore);
+
+    dtk_mutex_lock(&pFIF->queueLock);
+    {
+        pFIF->ppQueue[(pFIF->queueHead + pFIF->queueCount) % DRED_FIND_IN_FILES_QUEUE_CAPACITY] = filePathCopy;
+        pFIF->queueCount += 1;
+    }
+    dtk_mutex_unlock(&pFIF->queueLock);
+
+    dtk_semaphore_release(&pFIF->queueSemaphore);
+    return DTK_TRUE;
+}
+
+static dtk_thread_result DTK_THREADCALL dred_find_in_files__walker_thread_proc(void* pData)
+{
+    dred_find_in_files* pFIF = (dred_find_in_files*)pData;
+    dtk_assert(pFIF != NULL);
+
+    const char* ppIgnorePatterns[DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS];
+    for (dtk_uint32 iPattern = 0; iPattern < pFIF->ignorePatternCount; ++iPattern) {
+        ppIgnorePatterns[iPattern] = pFIF->ignorePatterns[iPattern];
+    }
+
+    // The walker callback is thread-safe so the tree can be walked on multiple threads.
+    dtk_walk_directory_config config;
+    dtk_zero_object(&config);
+    config.ppExcludePatterns = ppIgnorePatterns;
+    config.excludePatternCount = pFIF->ignorePatternCount;
+    config.flags = DTK_WALK_DIRECTORY_EXCLUDE_DIRECTORIES;
+    config.threadCount = DRED_FIND_IN_FILES_WALKER_THREAD_COUNT;
+    dtk_walk_directory(pFIF->directory, &config, dred_find_in_files__walker_iterate_proc, pFIF);
+
+    // Every worker needs to be woken up so they can see that there's nothing left to do.
+    dtk_mutex_lock(&pFIF->queueLock);
+    {
+        pFIF->isWalkingDone = DTK_TRUE;
+    }
+    dtk_mutex_unlock(&pFIF->queueLock);
+
+    for (dtk_uint32 iWorker = 0; iWorker < pFIF->workerThreadCount; ++iWorker) {
+        dtk_semaphore_release(&pFIF->queueSemaphore);
+    }
+
+    return 0;
+}
+
+
+static void dred_find_in_files__post_results(dred_find_in_files* pFIF, dtk_string* pResults)
+{
+    dtk_assert(pFIF != NULL);
+    dtk_assert(pResults != NULL);
+
+    size_t resultsLength = dtk_string_length(*pResults);
+    if (resultsLength == 0) {
+        return;
+    }
+
+    // The event data is the search ID followed by the null terminated results string.
+    size_t dataSize = sizeof(dtk_uint32) + resultsLength + 1;
+    dtk_uint8* pEventData = (dtk_uint8*)malloc(dataSize);
+    if (pEventData != NULL) {
+        memcpy(pEventData, &pFIF->searchID, sizeof(dtk_uint32));
+        memcpy(pEventData + sizeof(dtk_uint32), *pResults, resultsLength + 1);
+        dtk_post_custom_event(&pFIF->pDred->tk, DTK_CONTROL(&pFIF->pDred->mainWindow), DRED_EVENT_FIND_IN_FILES_RESULT, pEventData, dataSize);
+        free(pEventData);
+    }
+
+    dtk_free_string(*pResults);
+    *pResults = NULL;
+}
+
+static void dred_find_in_files__append_result(dred_find_in_files* pFIF, dtk_string* pResults, const char* filePath, size_t lineNumber, const char* pLine, size_t lineLength)
+{
+    dtk_assert(pFIF != NULL);
+    dtk_assert(pResults != NULL);
+
+    if (lineLength > 0 && pLine[lineLength-1] == '\r') {
+        lineLength -= 1;
+    }
+    if (lineLength > DRED_FIND_IN_FILES_MAX_RESULT_LENGTH) {
+        lineLength = DRED_FIND_IN_FILES_MAX_RESULT_LENGTH;
+    }
+
+    if (*pResults == NULL) {
+        *pResults = dtk_make_string("");
+    }
+
+    *pResults = dtk_append_stringf(*pResults, "%s:%u: ", filePath, (unsigned int)lineNumber);
+    *pResults = dtk_append_substring(*pResults, pLine, lineLength);
+    *pResults = dtk_append_string(*pResults, "\n");
+
+    if (dtk_string_length(*pResults) >= DRED_FIND_IN_FILES_RESULT_FLUSH_SIZE) {
+        dred_find_in_files__post_results(pFIF, pResults);
+    }
+}
+
+// Searches a file and returns the number of matching lines.
+static dtk_uint32 dred_find_in_files__search_file(dred_find_in_files* pFIF, const char* filePath, dtk_string* pResults)
+{
+    dtk_assert(pFIF != NULL);
+    dtk_assert(filePath != NULL);
+
+    dtk_mapped_file file;
+    if (dtk_mapped_file_open(filePath, DTK_FALSE, &file) != DTK_SUCCESS) {
+        return 0;
+    }
+
+    if (file.fileSize == 0 || file.fileSize > SIZE_MAX) {
+        dtk_mapped_file_close(&file);
+        return 0;
+    }
+
+    dtk_mapped_view view;
+    if (dtk_mapped_file_map(&file, 0, (size_t)file.fileSize, &view) != DTK_SUCCESS) {
+        dtk_mapped_file_close(&file);
+        return 0;
+    }
+
+    const char* pData = (const char*)view.pData;
+    size_t dataSize = view.dataSize;
+    dtk_uint32 matchCount = 0;
+
+    // Binary files are skipped.
+    if (memchr(pData, '\0', dtk_min(dataSize, DRED_FIND_IN_FILES_BINARY_CHECK_SIZE)) != NULL) {
+        dtk_mapped_file_unmap(&file, &view);
+        dtk_mapped_file_close(&file);
+        return 0;
+    }
+
+#ifndef DRED_WIN32
+    if ((pFIF->flags & DRED_FIND_IN_FILES_FLAG_REGEX) != 0) {
+        // Regular expressions are matched line by line. regexec() needs a null terminated string so each line is copied
+        // out of the file. Most lines fit in the buffer on the stack, but longer ones are copied to a heap buffer which is
+        // grown as required so that the whole line is always matched.
+        char lineStack[4096];
+        char* pLineHeap = NULL;
+        size_t lineHeapCap = 0;
+        size_t lineNumber = 1;
+        size_t lineBeg = 0;
+        while (lineBeg < dataSize && !pFIF->isCancelled) {
+            const char* pLineEnd = (const char*)memchr(pData + lineBeg, '\n', dataSize - lineBeg);
+            size_t lineEnd = (pLineEnd != NULL) ? (size_t)(pLineEnd - pData) : dataSize;
+            size_t lineLength = lineEnd - lineBeg;
+
+            char* pLine = lineStack;
+            if (lineLength >= sizeof(lineStack)) {
+                if (lineLength >= lineHeapCap) {
+                    char* pNewLineHeap = (char*)realloc(pLineHeap, lineLength + 1);
+                    if (pNewLineHeap == NULL) {
+                        break;
+                    }
+
+                    pLineHeap = pNewLineHeap;
+                    lineHeapCap = lineLength + 1;
+                }
+
+                pLine = pLineHeap;
+            }
+
+            memcpy(pLine, pData + lineBeg, lineLength);
+            pLine[lineLength] = '\0';
+
+            if (regexec(&pFIF->regex, pLine, 0, NULL, 0) == 0) {
+                dred_find_in_files__append_result(pFIF, pResults, filePath, lineNumber, pLine, lineLength);
+                matchCount += 1;
+            }
+
+            lineBeg = lineEnd + 1;
+            lineNumber += 1;
+        }
+
+        free(pLineHeap);
+    } else
+#endif
+    {
+        // Literal matching. Candidates are found with memchr() which is vectorized in any decent C library. Line numbers
+        // are only counted up to each match, which is much faster than splitting the file into lines up front.
+        size_t lineNumber = 1;
+        size_t lineBeg = 0;     // The start of the line containing "countedTo".
+        size_t countedTo = 0;   // Line numbers have been counted up to here.
+        size_t pos = 0;
+        while (pos + pFIF->queryLength <= dataSize && !pFIF->isCancelled) {
+            const char* pCandidate = (const char*)memchr(pData + pos, pFIF->query[0], dataSize - pos - pFIF->queryLength + 1);
+            if (pCandidate == NULL) {
+                break;
+            }
+
+            size_t candidate = (size_t)(pCandidate - pData);
+            if (memcmp(pCandidate, pFIF->query, pFIF->queryLength) != 0) {
+                pos = candidate + 1;
+                continue;
+            }
+
+            // Count lines up to the match.
+            for (;;) {
+                const char* pNewLine = (const char*)memchr(pData + countedTo, '\n', candidate - countedTo);
+                if (pNewLine == NULL) {
+                    break;
+                }
+
+                lineNumber += 1;
+                countedTo = (size_t)(pNewLine - pData) + 1;
+                lineBeg = countedTo;
+            }
+
+            const char* pLineEnd = (const char*)memchr(pCandidate, '\n', dataSize - candidate);
+            size_t lineEnd = (pLineEnd != NULL) ? (size_t)(pLineEnd - pData) : dataSize;
+
+            dred_find_in_files__append_result(pFIF, pResults, filePath, lineNumber, pData + lineBeg, lineEnd - lineBeg);
+            matchCount += 1;
+
+            // Only a single result is output per line so we skip straight to the next one.
+            if (lineEnd == dataSize) {
+                break;
+            }
+
+            lineNumber += 1;
+            pos = lineEnd + 1;
+            lineBeg = pos;
+            countedTo = pos;
+        }
+    }
+
+    dtk_mapped_file_unmap(&file, &view);
+    dtk_mapped_file_close(&file);
+
+    return matchCount;
+}
+
+static dtk_thread_result DTK_THREADCALL dred_find_in_files__worker_thread_proc(void* pData)
+{
+    dred_find_in_files* pFIF = (dred_find_in_files*)pData;
+    dtk_assert(pFIF != NULL);
+
+    dtk_string results = NULL;
+    for (;;) {
+        dtk_semaphore_wait(&pFIF->queueSemaphore);
+
+        char* filePath = NULL;
+        dtk_bool32 isWalkingDone = DTK_FALSE;
+        dtk_mutex_lock(&pFIF->queueLock);
+        {
+            if (pFIF->queueCount > 0) {
+                filePath = pFIF->ppQueue[pFIF->queueHead];
+                pFIF->queueHead = (pFIF->queueHead + 1) % DRED_FIND_IN_FILES_QUEUE_CAPACITY;
+                pFIF->queueCount -= 1;
+            }
+            isWalkingDone = pFIF->isWalkingDone;
+        }
+        dtk_mutex_unlock(&pFIF->queueLock);
+
+        if (filePath != NULL) {
+            dtk_semaphore_release(&pFIF->queueSpaceSemaphore);
+        } else {
+            if (isWalkingDone) {
+                break;
+            }
+            continue;
+        }
+
+        if (!pFIF->isCancelled) {
+            dtk_uint32 matchCount = dred_find_in_files__search_file(pFIF, filePath, &results);
+            dred_find_in_files__post_results(pFIF, &results);
+
+            dtk_mutex_lock(&pFIF->queueLock);
+            {
+                pFIF->matchCount += matchCount;
+                pFIF->matchedFileCount += (matchCount > 0) ? 1 : 0;
+                pFIF->searchedFileCount += 1;
+            }
+            dtk_mutex_unlock(&pFIF->queueLock);
+        }
+
+        dtk_free_string(filePath);
+    }
+
+    dtk_free_string(results);
+
+    // The last worker to finish lets the main thread know that the search is complete.
+    if (dtk_atomic_decrement_32(&pFIF->activeWorkerCount) == 0) {
+        dred_find_in_files_done_data done;
+        dtk_mutex_lock(&pFIF->queueLock);
+        {
+            done.searchID          = pFIF->searchID;
+            done.matchCount        = pFIF->matchCount;
+            done.matchedFileCount  = pFIF->matchedFileCount;
+            done.searchedFileCount = pFIF->searchedFileCount;
+        }
+        dtk_mutex_unlock(&pFIF->queueLock);
+
+        dtk_post_custom_event(&pFIF->pDred->tk, DTK_CONTROL(&pFIF->pDred->mainWindow), DRED_EVENT_FIND_IN_FILES_DONE, &done, sizeof(done));
+    }
+
+    return 0;
+}
+
+
+// Waits for every thread to finish and frees the resources of the search. This is the same for a cancelled search and a
+// completed search.
+static void dred_find_in_files__end(dred_find_in_files* pFIF)
+{
+    dtk_assert(pFIF != NULL);
+
+    if (!pFIF->isRunning) {
+        return;
+    }
+
+    dtk_thread_wait(&pFIF->walkerThread);
+    for (dtk_uint32 iWorker = 0; iWorker < pFIF->workerThreadCount; ++iWorker) {
+        dtk_thread_wait(&pFIF->workerThreads[iWorker]);
+    }
+
+    for (size_t i = 0; i < pFIF->queueCount; ++i) {
+        dtk_free_string(pFIF->ppQueue[(pFIF->queueHead + i) % DRED_FIND_IN_FILES_QUEUE_CAPACITY]);
+    }
+    free(pFIF->ppQueue);
+    pFIF->ppQueue = NULL;
+    pFIF->queueHead = 0;
+    pFIF->queueCount = 0;
+
+    dtk_semaphore_uninit(&pFIF->queueSpaceSemaphore);
+    dtk_semaphore_uninit(&pFIF->queueSemaphore);
+    dtk_mutex_uninit(&pFIF->queueLock);
+
+#ifndef DRED_WIN32
+    if ((pFIF->flags & DRED_FIND_IN_FILES_FLAG_REGEX) != 0) {
+        regfree(&pFIF->regex);
+    }
+#endif
+
+    pFIF->isRunning = DTK_FALSE;
+}
+
+static dtk_bool32 dred_find_in_files__is_results_editor_open(dred_find_in_files* pFIF)
+{
+    dtk_assert(pFIF != NULL);
+
+    if (pFIF->pResultsEditor == NULL) {
+        return DTK_FALSE;
+    }
+
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pFIF->pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pFIF->pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            if (dtk_tabgroup_get_tab_page(pTabGroup, iTab) == DTK_CONTROL(pFIF->pResultsEditor)) {
+                return DTK_TRUE;
+            }
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+static void dred_find_in_files__write_to_results_editor(dred_find_in_files* pFIF, const char* text)
+{
+    dtk_assert(pFIF != NULL);
+
+    if (!dred_find_in_files__is_results_editor_open(pFIF)) {
+        pFIF->pResultsEditor = NULL;
+        return;
+    }
+
+    dred_text_editor_append_text(DRED_TEXT_EDITOR(pFIF->pResultsEditor), text);
+}
+
+dtk_bool32 dred_find_in_files_begin(dred_find_in_files* pFIF, dred_context* pDred, const char* query, const char* directory, dtk_uint32 flags, const char** ppIgnorePatterns, dtk_uint32 ignorePatternCount)
+{
+    if (pFIF == NULL || pDred == NULL || query == NULL || query[0] == '\0') {
+        return DTK_FALSE;
+    }
+
+    dred_find_in_files_cancel(pFIF);
+
+    dtk_uint32 searchID = pFIF->searchID + 1;
+    dtk_zero_object(pFIF);
+    pFIF->pDred = pDred;
+    pFIF->searchID = searchID;
+    pFIF->flags = flags;
+
+    if (strcpy_s(pFIF->query, sizeof(pFIF->query), query) != 0) {
+        return DTK_FALSE;
+    }
+    pFIF->queryLength = strlen(pFIF->query);
+
+    if (directory == NULL || directory[0] == '\0') {
+        directory = ".";
+    }
+    if (!dred_to_absolute_path(directory, pFIF->directory, sizeof(pFIF->directory))) {
+        return DTK_FALSE;
+    }
+
+    for (dtk_uint32 iPattern = 0; iPattern < ignorePatternCount && pFIF->ignorePatternCount < DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS; ++iPattern) {
+        if (strcpy_s(pFIF->ignorePatterns[pFIF->ignorePatternCount], sizeof(pFIF->ignorePatterns[0]), ppIgnorePatterns[iPattern]) == 0) {
+            pFIF->ignorePatternCount += 1;
+        }
+    }
+
+    if ((flags & DRED_FIND_IN_FILES_FLAG_REGEX) != 0) {
+#ifndef DRED_WIN32
+        if (regcomp(&pFIF->regex, pFIF->query, REG_EXTENDED | REG_NOSUB) != 0) {
+            dred_cmdbar_set_message(&pDred->cmdBar, "Invalid regular expression.");
+            return DTK_FALSE;
+        }
+#else
+        dred_cmdbar_set_message(&pDred->cmdBar, "Regular expressions are not supported on this platform.");
+        return DTK_FALSE;
+#endif
+    }
+
+
+    // The results are written to a new text editor.
+    if (!dred_open_new_text_file(pDred)) {
+        goto on_error;
+    }
+
+    pFIF->pResultsEditor = dred_get_focused_editor(pDred);
+    if (pFIF->pResultsEditor == NULL || !dred_control_is_of_type(DRED_CONTROL(pFIF->pResultsEditor), DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+        goto on_error;
+    }
+
+    char* header = dtk_make_stringf("Searching for \"%s\" in %s\n\n", pFIF->query, pFIF->directory);
+    if (header != NULL) {
+        dred_find_in_files__write_to_results_editor(pFIF, header);
+        dtk_free_string(header);
+    }
+
+
+    pFIF->ppQueue = (char**)malloc(DRED_FIND_IN_FILES_QUEUE_CAPACITY * sizeof(*pFIF->ppQueue));
+    if (pFIF->ppQueue == NULL) {
+        goto on_error;
+    }
+
+    if (dtk_mutex_init(&pFIF->queueLock) != DTK_SUCCESS) {
+        goto on_error;
+    }
+    if (dtk_semaphore_init(&pFIF->queueSemaphore, 0) != DTK_SUCCESS) {
+        dtk_mutex_uninit(&pFIF->queueLock);
+        goto on_error;
+    }
+    if (dtk_semaphore_init(&pFIF->queueSpaceSemaphore, DRED_FIND_IN_FILES_QUEUE_CAPACITY) != DTK_SUCCESS) {
+        dtk_semaphore_uninit(&pFIF->queueSemaphore);
+        dtk_mutex_uninit(&pFIF->queueLock);
+        goto on_error;
+    }
+
+    // The workers need to be created before the walker because the walker uses the worker count to know how many times it
+    // needs to wake them up when it's done.
+    dtk_uint32 workerThreadCount = dtk_clamp(dtk_get_logical_processor_count(), 1, DRED_FIND_IN_FILES_MAX_WORKER_THREADS);
+    for (dtk_uint32 iWorker = 0; iWorker < workerThreadCount; ++iWorker) {
+        if (dtk_thread_create(&pFIF->workerThreads[pFIF->workerThreadCount], dred_find_in_files__worker_thread_proc, pFIF) != DTK_SUCCESS) {
+            break;
+        }
+
+        dtk_atomic_increment_32(&pFIF->activeWorkerCount);
+        pFIF->workerThreadCount += 1;
+    }
+
+    pFIF->isRunning = DTK_TRUE;
+
+    if (pFIF->workerThreadCount == 0 || dtk_thread_create(&pFIF->walkerThread, dred_find_in_files__walker_thread_proc, pFIF) != DTK_SUCCESS) {
+        // We can't end the search until the workers have returned.
+        pFIF->isCancelled = DTK_TRUE;
+        pFIF->isWalkingDone = DTK_TRUE;
+        for (dtk_uint32 iWorker = 0; iWorker < pFIF->workerThreadCount; ++iWorker) {
+            dtk_semaphore_release(&pFIF->queueSemaphore);
+        }
+        for (dtk_uint32 iWorker = 0; iWorker < pFIF->workerThreadCount; ++iWorker) {
+            dtk_thread_wait(&pFIF->workerThreads[iWorker]);
+        }
+        pFIF->workerThreadCount = 0;
+
+        dtk_semaphore_uninit(&pFIF->queueSpaceSemaphore);
+        dtk_semaphore_uninit(&pFIF->queueSemaphore);
+        dtk_mutex_uninit(&pFIF->queueLock);
+        pFIF->isRunning = DTK_FALSE;
+        goto on_error;
+    }
+
+    return DTK_TRUE;
+
+on_error:
+    free(pFIF->ppQueue);
+    pFIF->ppQueue = NULL;
+
+#ifndef DRED_WIN32
+    if ((flags & DRED_FIND_IN_FILES_FLAG_REGEX) != 0) {
+        regfree(&pFIF->regex);
+    }
+#endif
+    return DTK_FALSE;
+}
+
+void dred_find_in_files_cancel(dred_find_in_files* pFIF)
+{
+    if (pFIF == NULL || !pFIF->isRunning) {
+        return;
+    }
+
+    pFIF->isCancelled = DTK_TRUE;
+    dred_find_in_files__end(pFIF);
+}
+
+void dred_find_in_files_on_event(dred_find_in_files* pFIF, dtk_uint32 eventID, const void* pData, size_t dataSize)
+{
+    if (pFIF == NULL || pData == NULL) {
+        return;
+    }
+
+    switch (eventID)
+    {
+        case DRED_EVENT_FIND_IN_FILES_RESULT:
+        {
+            if (dataSize <= sizeof(dtk_uint32)) {
+                return;
+            }
+
+            // Results from an old search are discarded.
+            dtk_uint32 searchID;
+            memcpy(&searchID, pData, sizeof(searchID));
+            if (searchID != pFIF->searchID || !pFIF->isRunning) {
+                return;
+            }
+
+            dred_find_in_files__write_to_results_editor(pFIF, (const char*)pData + sizeof(dtk_uint32));
+        } break;
+
+        case DRED_EVENT_FIND_IN_FILES_DONE:
+        {
+            if (dataSize < sizeof(dred_find_in_files_done_data)) {
+                return;
+            }
+
+            const dred_find_in_files_done_data* pDone = (const dred_find_in_files_done_data*)pData;
+            if (pDone->searchID != pFIF->searchID || !pFIF->isRunning) {
+                return;
+            }
+
+            dred_find_in_files__end(pFIF);
+
+            char summary[256];
+            snprintf(summary, sizeof(summary), "\n%u matches in %u of %u files.\n", pDone->matchCount, pDone->matchedFileCount, pDone->searchedFileCount);
+            dred_find_in_files__write_to_results_editor(pFIF, summary);
+
+            snprintf(summary, sizeof(summary), "%u matches in %u files.", pDone->matchCount, pDone->matchedFileCount);
+            dred_cmdbar_set_message(&pFIF->pDred->cmdBar, summary);
+        } break;
+
+        default: break;
+    }
+}
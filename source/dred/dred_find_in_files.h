@@ -0,0 +1,70 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// Project-wide searching. A search is made up of a single walker thread which enumerates the files in the directory and
+// pushes them onto a queue, and a number of worker threads which pull files off the queue and search them. Files are
+// accessed through memory mapping so they never need to be copied into memory.
+//
+// Results are posted back to the main thread as DRED_EVENT_FIND_IN_FILES_RESULT events as each file is finished and are
+// appended to a results text editor, in the format of "<path>:<line>: <text>".
+
+#define DRED_FIND_IN_FILES_MAX_WORKER_THREADS   16
+#define DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS  32
+
+// The maximum number of files waiting to be searched. The walker waits for the workers to catch up when the queue is full.
+#define DRED_FIND_IN_FILES_QUEUE_CAPACITY       4096
+
+#define DRED_FIND_IN_FILES_FLAG_REGEX           (1 << 0)    // The query is a POSIX extended regular expression.
+
+typedef struct
+{
+    dred_context* pDred;
+
+    // The ID of the search. This is incremented for each search so that results from an old search can be discarded.
+    dtk_uint32 searchID;
+
+    char query[1024];
+    size_t queryLength;
+    char directory[DRED_MAX_PATH];
+    dtk_uint32 flags;
+    char ignorePatterns[DRED_FIND_IN_FILES_MAX_IGNORE_PATTERNS][256];
+    dtk_uint32 ignorePatternCount;
+#ifndef DRED_WIN32
+    regex_t regex;
+#endif
+
+    // The text editor results are written to. This is validated against the open tabs before every use because the user
+    // may close it at any time.
+    dred_editor* pResultsEditor;
+
+    // The queue of files waiting to be searched. This is a ring buffer of DRED_FIND_IN_FILES_QUEUE_CAPACITY paths so files
+    // are searched in the order they were found. queueSemaphore counts the queued files and queueSpaceSemaphore counts the
+    // free slots.
+    dtk_mutex queueLock;
+    dtk_semaphore queueSemaphore;
+    dtk_semaphore queueSpaceSemaphore;
+    char** ppQueue;
+    size_t queueHead;
+    size_t queueCount;
+    dtk_bool32 isWalkingDone;
+
+    dtk_thread walkerThread;
+    dtk_thread workerThreads[DRED_FIND_IN_FILES_MAX_WORKER_THREADS];
+    dtk_uint32 workerThreadCount;
+    dtk_uint32 activeWorkerCount;       // Atomic. The last worker to finish posts DRED_EVENT_FIND_IN_FILES_DONE.
+    dtk_uint32 matchCount;              // Protected by queueLock.
+    dtk_uint32 matchedFileCount;        // Protected by queueLock.
+    dtk_uint32 searchedFileCount;       // Protected by queueLock.
+    volatile dtk_bool32 isCancelled;
+    dtk_bool32 isRunning;
+} dred_find_in_files;
+
+// Starts a new search. If a search is already running it will be cancelled.
+//
+// Results are written to a new text editor.
+dtk_bool32 dred_find_in_files_begin(dred_find_in_files* pFIF, dred_context* pDred, const char* query, const char* directory, dtk_uint32 flags, const char** ppIgnorePatterns, dtk_uint32 ignorePatternCount);
+
+// Cancels the running search, if any, and waits for it's threads to finish.
+void dred_find_in_files_cancel(dred_find_in_files* pFIF);
+
+// Called from the main thread when a DRED_EVENT_FIND_IN_FILES_* event is received.
+void dred_find_in_files_on_event(dred_find_in_files* pFIF, dtk_uint32 eventID, const void* pData, size_t dataSize);
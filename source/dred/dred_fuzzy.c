@@ -0,0 +1,647 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+#define DRED_FUZZY_CHAR_CLASS_WHITESPACE    0
+#define DRED_FUZZY_CHAR_CLASS_DELIMITER     1
+#define DRED_FUZZY_CHAR_CLASS_NONWORD       2
+#define DRED_FUZZY_CHAR_CLASS_LOWER         3
+#define DRED_FUZZY_CHAR_CLASS_UPPER         4
+#define DRED_FUZZY_CHAR_CLASS_DIGIT         5
+
+DTK_INLINE char dred_fuzzy__to_lower(char c)
+{
+    if (c >= 'A' && c <= 'Z') {
+        return c + ('a' - 'A');
+    }
+
+    return c;
+}
+
+DTK_INLINE dtk_uint64 dred_fuzzy__get_char_bit(char c)
+{
+    unsigned char uc = (unsigned char)dred_fuzzy__to_lower(c);
+    if (uc >= 'a' && uc <= 'z') {
+        return ((dtk_uint64)1) << (uc - 'a');
+    }
+    if (uc >= '0' && uc <= '9') {
+        return ((dtk_uint64)1) << (26 + (uc - '0'));
+    }
+
+    return ((dtk_uint64)1) << (36 + (uc % 28));
+}
+
+static dtk_uint64 dred_fuzzy__calculate_char_mask(const char* text, size_t textLength)
+{
+    dtk_uint64 mask = 0;
+    for (size_t i = 0; i < textLength; ++i) {
+        mask |= dred_fuzzy__get_char_bit(text[i]);
+    }
+
+    return mask;
+}
+
+static int dred_fuzzy__get_char_class(char c)
+{
+    if (c >= 'a' && c <= 'z') return DRED_FUZZY_CHAR_CLASS_LOWER;
+    if (c >= 'A' && c <= 'Z') return DRED_FUZZY_CHAR_CLASS_UPPER;
+    if (c >= '0' && c <= '9') return DRED_FUZZY_CHAR_CLASS_DIGIT;
+    if ((unsigned char)c >= 0x80) return DRED_FUZZY_CHAR_CLASS_LOWER;  // Treat anything non-ASCII as part of a word.
+
+    switch (c)
+    {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+            return DRED_FUZZY_CHAR_CLASS_WHITESPACE;
+
+        case '/':
+        case '\\':
+        case ':':
+        case ';':
+        case ',':
+        case '|':
+            return DRED_FUZZY_CHAR_CLASS_DELIMITER;
+
+        case '_':
+            return DRED_FUZZY_CHAR_CLASS_LOWER;
+
+        default: return DRED_FUZZY_CHAR_CLASS_NONWORD;
+    }
+}
+
+static dtk_int32 dred_fuzzy__get_bonus(int prevClass, int thisClass)
+{
+    if (thisClass >= DRED_FUZZY_CHAR_CLASS_LOWER) {
+        // Start of a word.
+        if (prevClass == DRED_FUZZY_CHAR_CLASS_WHITESPACE) return DRED_FUZZY_BONUS_BOUNDARY_WHITESPACE;
+        if (prevClass == DRED_FUZZY_CHAR_CLASS_DELIMITER)  return DRED_FUZZY_BONUS_BOUNDARY_DELIMITER;
+        if (prevClass == DRED_FUZZY_CHAR_CLASS_NONWORD)    return DRED_FUZZY_BONUS_BOUNDARY;
+    }
+
+    if ((prevClass == DRED_FUZZY_CHAR_CLASS_LOWER && thisClass == DRED_FUZZY_CHAR_CLASS_UPPER) ||
+        (prevClass != DRED_FUZZY_CHAR_CLASS_DIGIT && thisClass == DRED_FUZZY_CHAR_CLASS_DIGIT)) {
+        return DRED_FUZZY_BONUS_CAMEL;
+    }
+
+    if (thisClass == DRED_FUZZY_CHAR_CLASS_WHITESPACE) return DRED_FUZZY_BONUS_BOUNDARY_WHITESPACE;
+    if (thisClass == DRED_FUZZY_CHAR_CLASS_DELIMITER)  return DRED_FUZZY_BONUS_BOUNDARY_DELIMITER;
+    if (thisClass == DRED_FUZZY_CHAR_CLASS_NONWORD)    return DRED_FUZZY_BONUS_BOUNDARY;
+
+    return 0;
+}
+
+static dtk_bool32 dred_fuzzy__is_case_sensitive(const char* pattern, size_t patternLength)
+{
+    for (size_t i = 0; i < patternLength; ++i) {
+        if (pattern[i] >= 'A' && pattern[i] <= 'Z') {
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+// Greedily matches pattern[iPatternBeg..iPatternEnd) against text starting at textPos. On success, <pMatchEnd> is set to one
+// past the position of the last matched character.
+//
+// <searchText> is the text to search, which should be the case folded copy of the text when matching case insensitively.
+static dtk_bool32 dred_fuzzy__scan_forward(const char* searchText, size_t textLength, size_t textPos, const char* pattern, size_t iPatternBeg, size_t iPatternEnd, dtk_bool32 caseSensitive, dtk_uint32* pMatchEnd)
+{
+    for (size_t iPattern = iPatternBeg; iPattern < iPatternEnd; ++iPattern) {
+        char p = (caseSensitive) ? pattern[iPattern] : dred_fuzzy__to_lower(pattern[iPattern]);
+
+        const char* pFound = (const char*)memchr(searchText + textPos, p, textLength - textPos);
+        if (pFound == NULL) {
+            return DTK_FALSE;
+        }
+
+        textPos = (size_t)(pFound - searchText) + 1;
+    }
+
+    *pMatchEnd = (dtk_uint32)textPos;
+    return DTK_TRUE;
+}
+
+// Scores the match of the whole pattern where the last pattern character was matched at matchEnd-1. The match is first
+// shortened by scanning backwards from the end to find the latest possible start. <searchText> is the same as what was given
+// to dred_fuzzy__scan_forward(), whereas <text> is always the original text which is needed for classifying characters.
+static dtk_int32 dred_fuzzy__calculate_score(const char* text, const char* searchText, size_t matchEnd, const char* pattern, size_t patternLength, dtk_bool32 caseSensitive)
+{
+    dtk_assert(patternLength > 0);
+    dtk_assert(matchEnd > 0);
+
+    // Backward pass.
+    size_t matchBeg = matchEnd;
+    size_t iPattern = patternLength;
+    while (iPattern > 0) {
+        char p = (caseSensitive) ? pattern[iPattern-1] : dred_fuzzy__to_lower(pattern[iPattern-1]);
+
+        matchBeg -= 1;
+        if (searchText[matchBeg] == p) {
+            iPattern -= 1;
+        }
+    }
+
+    // Scoring pass. Characters in gaps don't need to be looked at individually. Only the matched characters and the characters
+    // immediately before them are needed for working out bonuses.
+    dtk_int32 score = 0;
+    dtk_int32 firstBonus = 0;
+    dtk_uint32 consecutive = 0;
+
+    size_t textPos = matchBeg;
+    for (iPattern = 0; iPattern < patternLength; ++iPattern) {
+        char p = (caseSensitive) ? pattern[iPattern] : dred_fuzzy__to_lower(pattern[iPattern]);
+
+        const char* pFound = (const char*)memchr(searchText + textPos, p, matchEnd - textPos);
+        dtk_assert(pFound != NULL);
+
+        size_t matchPos = (size_t)(pFound - searchText);
+        if (matchPos > textPos && iPattern > 0) {
+            score += DRED_FUZZY_SCORE_GAP_START + (dtk_int32)(matchPos - textPos - 1)*DRED_FUZZY_SCORE_GAP_EXTENSION;
+            consecutive = 0;
+            firstBonus = 0;
+        }
+
+        int prevClass = (matchPos > 0) ? dred_fuzzy__get_char_class(text[matchPos-1]) : DRED_FUZZY_CHAR_CLASS_WHITESPACE;
+        int thisClass = dred_fuzzy__get_char_class(text[matchPos]);
+
+        dtk_int32 bonus = dred_fuzzy__get_bonus(prevClass, thisClass);
+        if (consecutive == 0) {
+            firstBonus = bonus;
+        } else {
+            // A boundary in the middle of a consecutive run takes over as the bonus of the run.
+            if (bonus >= DRED_FUZZY_BONUS_BOUNDARY && bonus > firstBonus) {
+                firstBonus = bonus;
+            }
+
+            bonus = dtk_max(dtk_max(bonus, firstBonus), DRED_FUZZY_BONUS_CONSECUTIVE);
+        }
+
+        score += DRED_FUZZY_SCORE_MATCH;
+        score += (iPattern == 0) ? bonus*DRED_FUZZY_BONUS_FIRST_CHAR_MULTIPLIER : bonus;
+
+        consecutive += 1;
+        textPos = matchPos + 1;
+    }
+
+    return score;
+}
+
+
+DTK_INLINE const char* dred_fuzzy_matcher__get_candidate_text(dred_fuzzy_matcher* pMatcher, dtk_uint32 candidateIndex)
+{
+    return pMatcher->pText + pMatcher->pCandidates[candidateIndex].textOffset;
+}
+
+// Retrieves the text to search with dred_fuzzy__scan_forward() for the given candidate.
+DTK_INLINE const char* dred_fuzzy_matcher__get_candidate_search_text(dred_fuzzy_matcher* pMatcher, dtk_uint32 candidateIndex, dtk_bool32 caseSensitive)
+{
+    const dred_fuzzy_candidate* pCandidate = &pMatcher->pCandidates[candidateIndex];
+    if (caseSensitive) {
+        return pMatcher->pText + pCandidate->textOffset;
+    } else {
+        return pMatcher->pFoldedText + pCandidate->textOffset;
+    }
+}
+
+// Returns true if result <a> ranks before <b>.
+DTK_INLINE dtk_bool32 dred_fuzzy_matcher__is_better(dred_fuzzy_matcher* pMatcher, const dred_fuzzy_result* a, const dred_fuzzy_result* b)
+{
+    if (a->score != b->score) {
+        return a->score > b->score;
+    }
+
+    dtk_uint32 aLength = pMatcher->pCandidates[a->candidateIndex].textLength;
+    dtk_uint32 bLength = pMatcher->pCandidates[b->candidateIndex].textLength;
+    if (aLength != bLength) {
+        return aLength < bLength;
+    }
+
+    return a->candidateIndex < b->candidateIndex;
+}
+
+// The results are kept in a min-heap while ranking, with the worst result at the root, so that the top results can be
+// selected without sorting every match.
+static void dred_fuzzy_matcher__heap_sift_down(dred_fuzzy_matcher* pMatcher, dtk_uint32 index, dtk_uint32 count)
+{
+    dred_fuzzy_result* pHeap = pMatcher->pResults;
+    for (;;) {
+        dtk_uint32 iWorst = index;
+        dtk_uint32 iLeft  = index*2 + 1;
+        dtk_uint32 iRight = index*2 + 2;
+        if (iLeft < count && dred_fuzzy_matcher__is_better(pMatcher, &pHeap[iWorst], &pHeap[iLeft])) {
+            iWorst = iLeft;
+        }
+        if (iRight < count && dred_fuzzy_matcher__is_better(pMatcher, &pHeap[iWorst], &pHeap[iRight])) {
+            iWorst = iRight;
+        }
+
+        if (iWorst == index) {
+            break;
+        }
+
+        dred_fuzzy_result temp = pHeap[index];
+        pHeap[index] = pHeap[iWorst];
+        pHeap[iWorst] = temp;
+        index = iWorst;
+    }
+}
+
+static void dred_fuzzy_matcher__heap_sift_up(dred_fuzzy_matcher* pMatcher, dtk_uint32 index)
+{
+    dred_fuzzy_result* pHeap = pMatcher->pResults;
+    while (index > 0) {
+        dtk_uint32 iParent = (index - 1) / 2;
+        if (!dred_fuzzy_matcher__is_better(pMatcher, &pHeap[iParent], &pHeap[index])) {
+            break;
+        }
+
+        dred_fuzzy_result temp = pHeap[index];
+        pHeap[index] = pHeap[iParent];
+        pHeap[iParent] = temp;
+        index = iParent;
+    }
+}
+
+static dtk_bool32 dred_fuzzy_matcher__reserve_results(dred_fuzzy_matcher* pMatcher, dtk_uint32 count)
+{
+    if (count > pMatcher->resultCapacity) {
+        dred_fuzzy_result* pNewResults = (dred_fuzzy_result*)dtk_realloc(pMatcher->pResults, count * sizeof(*pNewResults));
+        if (pNewResults == NULL) {
+            return DTK_FALSE;
+        }
+
+        pMatcher->pResults = pNewResults;
+        pMatcher->resultCapacity = count;
+    }
+
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_fuzzy_matcher__reserve_level_entries(dred_fuzzy_matcher* pMatcher, dtk_uint32 count)
+{
+    if (count > pMatcher->levelEntryCapacity) {
+        dtk_uint32 newCapacity = dtk_max(count, pMatcher->levelEntryCapacity*2);
+        dred_fuzzy_level_entry* pNewEntries = (dred_fuzzy_level_entry*)dtk_realloc(pMatcher->pLevelEntries, newCapacity * sizeof(*pNewEntries));
+        if (pNewEntries == NULL) {
+            return DTK_FALSE;
+        }
+
+        pMatcher->pLevelEntries = pNewEntries;
+        pMatcher->levelEntryCapacity = newCapacity;
+    }
+
+    return DTK_TRUE;
+}
+
+// Builds the next level from the current top level, for a pattern that is one character longer. This only filters. The
+// entries are not scored until the level is ranked.
+static dred_result dred_fuzzy_matcher__push_level(dred_fuzzy_matcher* pMatcher)
+{
+    dtk_uint32 newPatternLength = pMatcher->levelCount + 1;
+    dtk_assert(newPatternLength <= pMatcher->patternLength);
+
+    const char* pattern = pMatcher->pattern;
+    char newChar = pattern[newPatternLength-1];
+    dtk_uint64 newCharBit = dred_fuzzy__get_char_bit(newChar);
+
+    // The case sensitivity of each level depends only on its own prefix. When the new character is the first upper case
+    // character of the pattern, the previous greedy match positions can't be continued from because they may have matched
+    // earlier characters of the wrong case. In this case the whole prefix is scanned again, but only for the candidates
+    // that survived the previous level because a case sensitive match is always a case insensitive match.
+    dtk_bool32 caseSensitive = dred_fuzzy__is_case_sensitive(pattern, newPatternLength);
+    dtk_bool32 rescan = caseSensitive && !dred_fuzzy__is_case_sensitive(pattern, newPatternLength-1);
+
+    dtk_uint32 prevEntriesBeg = (pMatcher->levelCount > 0) ? pMatcher->levelOffsets[pMatcher->levelCount-1] : 0;
+    dtk_uint32 prevEntriesEnd = pMatcher->levelOffsets[pMatcher->levelCount];
+    dtk_uint32 prevEntryCount = (pMatcher->levelCount > 0) ? (prevEntriesEnd - prevEntriesBeg) : pMatcher->candidateCount;
+
+    if (!dred_fuzzy_matcher__reserve_level_entries(pMatcher, prevEntriesEnd + prevEntryCount)) {
+        return DRED_OUT_OF_MEMORY;
+    }
+
+    dtk_uint32 newEntryCount = 0;
+    dred_fuzzy_level_entry* pNewEntries = pMatcher->pLevelEntries + prevEntriesEnd;
+
+    for (dtk_uint32 iEntry = 0; iEntry < prevEntryCount; ++iEntry) {
+        dtk_uint32 candidateIndex;
+        dtk_uint32 textPos;
+        if (pMatcher->levelCount > 0) {
+            candidateIndex = pMatcher->pLevelEntries[prevEntriesBeg + iEntry].candidateIndex;
+            textPos = pMatcher->pLevelEntries[prevEntriesBeg + iEntry].matchEnd;
+        } else {
+            candidateIndex = iEntry;
+            textPos = 0;
+        }
+
+        if ((pMatcher->pCharMasks[candidateIndex] & newCharBit) == 0) {
+            continue;
+        }
+
+        const dred_fuzzy_candidate* pCandidate = &pMatcher->pCandidates[candidateIndex];
+
+        const char* searchText = dred_fuzzy_matcher__get_candidate_search_text(pMatcher, candidateIndex, caseSensitive);
+
+        dtk_uint32 matchEnd;
+        dtk_bool32 isMatch;
+        if (rescan) {
+            isMatch = dred_fuzzy__scan_forward(searchText, pCandidate->textLength, 0, pattern, 0, newPatternLength, caseSensitive, &matchEnd);
+        } else {
+            isMatch = dred_fuzzy__scan_forward(searchText, pCandidate->textLength, textPos, pattern, newPatternLength-1, newPatternLength, caseSensitive, &matchEnd);
+        }
+
+        if (isMatch) {
+            pNewEntries[newEntryCount].candidateIndex = candidateIndex;
+            pNewEntries[newEntryCount].matchEnd = matchEnd;
+            pNewEntries[newEntryCount].score = 0;   // Scored lazily by dred_fuzzy_matcher__rank().
+            newEntryCount += 1;
+        }
+    }
+
+    pMatcher->levelOffsets[newPatternLength] = prevEntriesEnd + newEntryCount;
+    pMatcher->isLevelScored[newPatternLength] = DTK_FALSE;
+    pMatcher->levelCount = newPatternLength;
+
+    return DRED_SUCCESS;
+}
+
+static dred_result dred_fuzzy_matcher__rank(dred_fuzzy_matcher* pMatcher)
+{
+    pMatcher->resultCount = 0;
+
+    if (pMatcher->patternLength == 0) {
+        dtk_uint32 count = pMatcher->candidateCount;
+        if (pMatcher->maxResultCount > 0 && count > pMatcher->maxResultCount) {
+            count = pMatcher->maxResultCount;
+        }
+
+        if (!dred_fuzzy_matcher__reserve_results(pMatcher, count)) {
+            return DRED_OUT_OF_MEMORY;
+        }
+
+        for (dtk_uint32 i = 0; i < count; ++i) {
+            pMatcher->pResults[i].candidateIndex = i;
+            pMatcher->pResults[i].score = 0;
+        }
+
+        pMatcher->resultCount = count;
+        return DRED_SUCCESS;
+    }
+
+    dtk_assert(pMatcher->levelCount == pMatcher->patternLength);
+
+    dtk_uint32 entriesBeg = pMatcher->levelOffsets[pMatcher->levelCount-1];
+    dtk_uint32 entriesEnd = pMatcher->levelOffsets[pMatcher->levelCount];
+    dtk_uint32 entryCount = entriesEnd - entriesBeg;
+
+    // Only the level being ranked is scored. Intermediate levels that are passed through while typing are never scored, and
+    // the scores are kept with the level so that deleting a character back to a level that was ranked before doesn't score
+    // it again.
+    if (!pMatcher->isLevelScored[pMatcher->levelCount]) {
+        dtk_bool32 caseSensitive = dred_fuzzy__is_case_sensitive(pMatcher->pattern, pMatcher->patternLength);
+        for (dtk_uint32 iEntry = entriesBeg; iEntry < entriesEnd; ++iEntry) {
+            dred_fuzzy_level_entry* pEntry = &pMatcher->pLevelEntries[iEntry];
+            const char* searchText = dred_fuzzy_matcher__get_candidate_search_text(pMatcher, pEntry->candidateIndex, caseSensitive);
+            pEntry->score = dred_fuzzy__calculate_score(dred_fuzzy_matcher__get_candidate_text(pMatcher, pEntry->candidateIndex), searchText, pEntry->matchEnd, pMatcher->pattern, pMatcher->patternLength, caseSensitive);
+        }
+
+        pMatcher->isLevelScored[pMatcher->levelCount] = DTK_TRUE;
+    }
+
+    dtk_uint32 maxResultCount = entryCount;
+    if (pMatcher->maxResultCount > 0 && maxResultCount > pMatcher->maxResultCount) {
+        maxResultCount = pMatcher->maxResultCount;
+    }
+
+    if (!dred_fuzzy_matcher__reserve_results(pMatcher, maxResultCount)) {
+        return DRED_OUT_OF_MEMORY;
+    }
+
+    if (maxResultCount == 0) {
+        return DRED_SUCCESS;
+    }
+
+    dtk_uint32 heapCount = 0;
+    for (dtk_uint32 iEntry = entriesBeg; iEntry < entriesEnd; ++iEntry) {
+        const dred_fuzzy_level_entry* pEntry = &pMatcher->pLevelEntries[iEntry];
+
+        dred_fuzzy_result result;
+        result.candidateIndex = pEntry->candidateIndex;
+        result.score = pEntry->score;
+
+        if (heapCount < maxResultCount) {
+            pMatcher->pResults[heapCount] = result;
+            dred_fuzzy_matcher__heap_sift_up(pMatcher, heapCount);
+            heapCount += 1;
+        } else if (dred_fuzzy_matcher__is_better(pMatcher, &result, &pMatcher->pResults[0])) {
+            pMatcher->pResults[0] = result;
+            dred_fuzzy_matcher__heap_sift_down(pMatcher, 0, heapCount);
+        }
+    }
+
+    // Heap sort. Popping the worst result each time and placing it at the end leaves the results from best to worst.
+    for (dtk_uint32 i = heapCount; i > 1; --i) {
+        dred_fuzzy_result temp = pMatcher->pResults[0];
+        pMatcher->pResults[0] = pMatcher->pResults[i-1];
+        pMatcher->pResults[i-1] = temp;
+        dred_fuzzy_matcher__heap_sift_down(pMatcher, 0, i-1);
+    }
+
+    pMatcher->resultCount = heapCount;
+    return DRED_SUCCESS;
+}
+
+
+dred_result dred_fuzzy_matcher_init(dred_fuzzy_matcher* pMatcher, dtk_uint32 maxResultCount)
+{
+    if (pMatcher == NULL) return DRED_INVALID_ARGS;
+    dtk_zero_object(pMatcher);
+
+    pMatcher->maxResultCount = maxResultCount;
+    return DRED_SUCCESS;
+}
+
+void dred_fuzzy_matcher_uninit(dred_fuzzy_matcher* pMatcher)
+{
+    if (pMatcher == NULL) return;
+
+    dtk_free(pMatcher->pText);
+    dtk_free(pMatcher->pFoldedText);
+    dtk_free(pMatcher->pCandidates);
+    dtk_free(pMatcher->pCharMasks);
+    dtk_free(pMatcher->pLevelEntries);
+    dtk_free(pMatcher->pResults);
+}
+
+void dred_fuzzy_matcher_clear(dred_fuzzy_matcher* pMatcher)
+{
+    if (pMatcher == NULL) return;
+
+    pMatcher->textSize = 0;
+    pMatcher->candidateCount = 0;
+    pMatcher->pattern[0] = '\0';
+    pMatcher->patternLength = 0;
+    pMatcher->levelCount = 0;
+    pMatcher->resultCount = 0;
+}
+
+dred_result dred_fuzzy_matcher_add_candidate(dred_fuzzy_matcher* pMatcher, const char* text, void* pUserData)
+{
+    if (pMatcher == NULL || text == NULL) return DRED_INVALID_ARGS;
+
+    size_t textLength = strlen(text);
+    if (textLength + 1 > (size_t)(0xFFFFFFFF - pMatcher->textSize)) {
+        return DRED_OUT_OF_MEMORY;
+    }
+
+    if (pMatcher->textSize + textLength + 1 > pMatcher->textCapacity) {
+        dtk_uint32 newCapacity = dtk_max((dtk_uint32)(pMatcher->textSize + textLength + 1), pMatcher->textCapacity*2);
+        char* pNewText = (char*)dtk_realloc(pMatcher->pText, newCapacity);
+        if (pNewText == NULL) {
+            return DRED_OUT_OF_MEMORY;
+        }
+        pMatcher->pText = pNewText;
+
+        char* pNewFoldedText = (char*)dtk_realloc(pMatcher->pFoldedText, newCapacity);
+        if (pNewFoldedText == NULL) {
+            return DRED_OUT_OF_MEMORY;
+        }
+        pMatcher->pFoldedText = pNewFoldedText;
+
+        pMatcher->textCapacity = newCapacity;
+    }
+
+    if (pMatcher->candidateCount == pMatcher->candidateCapacity) {
+        dtk_uint32 newCapacity = (pMatcher->candidateCapacity == 0) ? 64 : pMatcher->candidateCapacity*2;
+        dred_fuzzy_candidate* pNewCandidates = (dred_fuzzy_candidate*)dtk_realloc(pMatcher->pCandidates, newCapacity * sizeof(*pNewCandidates));
+        if (pNewCandidates == NULL) {
+            return DRED_OUT_OF_MEMORY;
+        }
+        pMatcher->pCandidates = pNewCandidates;
+
+        dtk_uint64* pNewCharMasks = (dtk_uint64*)dtk_realloc(pMatcher->pCharMasks, newCapacity * sizeof(*pNewCharMasks));
+        if (pNewCharMasks == NULL) {
+            return DRED_OUT_OF_MEMORY;
+        }
+        pMatcher->pCharMasks = pNewCharMasks;
+
+        pMatcher->candidateCapacity = newCapacity;
+    }
+
+    dred_fuzzy_candidate* pCandidate = &pMatcher->pCandidates[pMatcher->candidateCount];
+    pCandidate->textOffset = pMatcher->textSize;
+    pCandidate->textLength = (dtk_uint32)textLength;
+    pCandidate->pUserData = pUserData;
+    pMatcher->pCharMasks[pMatcher->candidateCount] = dred_fuzzy__calculate_char_mask(text, textLength);
+
+    memcpy(pMatcher->pText + pMatcher->textSize, text, textLength + 1);
+    for (size_t i = 0; i <= textLength; ++i) {
+        pMatcher->pFoldedText[pMatcher->textSize + i] = dred_fuzzy__to_lower(text[i]);
+    }
+
+    pMatcher->textSize += (dtk_uint32)(textLength + 1);
+    pMatcher->candidateCount += 1;
+
+    // The levels don't know about the new candidate.
+    pMatcher->levelCount = 0;
+
+    return DRED_SUCCESS;
+}
+
+dtk_uint32 dred_fuzzy_matcher_get_candidate_count(dred_fuzzy_matcher* pMatcher)
+{
+    if (pMatcher == NULL) return 0;
+    return pMatcher->candidateCount;
+}
+
+dred_result dred_fuzzy_matcher_set_pattern(dred_fuzzy_matcher* pMatcher, const char* pattern)
+{
+    if (pMatcher == NULL) return DRED_INVALID_ARGS;
+
+    if (pattern == NULL) {
+        pattern = "";
+    }
+
+    size_t patternLength = strlen(pattern);
+    if (patternLength > DRED_FUZZY_MAX_PATTERN_LENGTH) {
+        patternLength = DRED_FUZZY_MAX_PATTERN_LENGTH;
+    }
+
+    // Levels for the prefix in common with the previous pattern can be kept.
+    dtk_uint32 commonLength = 0;
+    while (commonLength < pMatcher->levelCount && commonLength < patternLength && pMatcher->pattern[commonLength] == pattern[commonLength]) {
+        commonLength += 1;
+    }
+
+    pMatcher->levelCount = commonLength;
+
+    memcpy(pMatcher->pattern, pattern, patternLength);
+    pMatcher->pattern[patternLength] = '\0';
+    pMatcher->patternLength = (dtk_uint32)patternLength;
+
+    while (pMatcher->levelCount < pMatcher->patternLength) {
+        dred_result result = dred_fuzzy_matcher__push_level(pMatcher);
+        if (result != DRED_SUCCESS) {
+            pMatcher->levelCount = 0;
+            pMatcher->resultCount = 0;
+            return result;
+        }
+    }
+
+    return dred_fuzzy_matcher__rank(pMatcher);
+}
+
+dtk_uint32 dred_fuzzy_matcher_get_result_count(dred_fuzzy_matcher* pMatcher)
+{
+    if (pMatcher == NULL) return 0;
+    return pMatcher->resultCount;
+}
+
+const char* dred_fuzzy_matcher_get_result_text(dred_fuzzy_matcher* pMatcher, dtk_uint32 index)
+{
+    if (pMatcher == NULL || index >= pMatcher->resultCount) return NULL;
+    return dred_fuzzy_matcher__get_candidate_text(pMatcher, pMatcher->pResults[index].candidateIndex);
+}
+
+void* dred_fuzzy_matcher_get_result_user_data(dred_fuzzy_matcher* pMatcher, dtk_uint32 index)
+{
+    if (pMatcher == NULL || index >= pMatcher->resultCount) return NULL;
+    return pMatcher->pCandidates[pMatcher->pResults[index].candidateIndex].pUserData;
+}
+
+dtk_int32 dred_fuzzy_matcher_get_result_score(dred_fuzzy_matcher* pMatcher, dtk_uint32 index)
+{
+    if (pMatcher == NULL || index >= pMatcher->resultCount) return 0;
+    return pMatcher->pResults[index].score;
+}
+
+
+dtk_bool32 dred_fuzzy_match(const char* pattern, const char* text, dtk_int32* pScore)
+{
+    if (pScore != NULL) {
+        *pScore = 0;
+    }
+
+    if (pattern == NULL || text == NULL) {
+        return DTK_FALSE;
+    }
+
+    // Use a matcher with a single candidate so that the text is stored the same way.
+    dred_fuzzy_matcher matcher;
+    if (dred_fuzzy_matcher_init(&matcher, 1) != DRED_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    dtk_bool32 isMatch = DTK_FALSE;
+    if (dred_fuzzy_matcher_add_candidate(&matcher, text, NULL) == DRED_SUCCESS && dred_fuzzy_matcher_set_pattern(&matcher, pattern) == DRED_SUCCESS) {
+        if (matcher.resultCount > 0) {
+            isMatch = DTK_TRUE;
+            if (pScore != NULL) {
+                *pScore = matcher.pResults[0].score;
+            }
+        }
+    }
+
+    dred_fuzzy_matcher_uninit(&matcher);
+    return isMatch;
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// Fuzzy matching for things like the command bar's command and file lists.
+//
+// A pattern matches a candidate when every character of the pattern appears in the candidate in order, but not necessarily
+// next to each other. Matches are scored in the same spirit as fzf: each matched character is worth a fixed amount, gaps
+// between matched characters are penalized, and characters that start a word (after a space or path separator, a camelCase
+// hump, etc.) or continue a run of consecutive matches earn a bonus. The bonus of the first pattern character is doubled.
+//
+// Smart case is used for matching. If the pattern is all lower case, matching is case insensitive. As soon as the pattern
+// contains an upper case character it becomes case sensitive. Case folding only applies to ASCII.
+//
+// The matcher is incremental. It keeps the set of matching candidates for every prefix of the pattern so that typing another
+// character only needs to look at the candidates that matched the previous pattern, and deleting a character just throws
+// away the last set. For each surviving candidate the end position of the greedy match is remembered so that the next
+// character continues scanning from there rather than from the start of the string. Building a level only filters. Matches
+// are scored lazily when the top results are selected, and only for the level of the full pattern, so the levels that are
+// passed through on the way are never scored. The scores are kept with the level so that deleting a character back to a
+// level that was already ranked only needs to pick the top results again. Candidates are also rejected early with a 64-bit
+// mask of the characters they contain.
+//
+// Results are ranked by score, then by length (shorter first), then by the order the candidates were added. When the pattern
+// is empty every candidate is returned in the order they were added.
+
+#define DRED_FUZZY_MAX_PATTERN_LENGTH   255
+
+// Scoring constants.
+#define DRED_FUZZY_SCORE_MATCH                  16
+#define DRED_FUZZY_SCORE_GAP_START              -3
+#define DRED_FUZZY_SCORE_GAP_EXTENSION          -1
+#define DRED_FUZZY_BONUS_BOUNDARY_WHITESPACE    10
+#define DRED_FUZZY_BONUS_BOUNDARY_DELIMITER     9
+#define DRED_FUZZY_BONUS_BOUNDARY               8
+#define DRED_FUZZY_BONUS_CAMEL                  7
+#define DRED_FUZZY_BONUS_CONSECUTIVE            4
+#define DRED_FUZZY_BONUS_FIRST_CHAR_MULTIPLIER  2
+
+typedef struct
+{
+    dtk_uint32 textOffset;  // Offset into the matcher's text buffers.
+    dtk_uint32 textLength;
+    void* pUserData;
+} dred_fuzzy_candidate;
+
+typedef struct
+{
+    dtk_uint32 candidateIndex;
+    dtk_uint32 matchEnd;    // One past the position of the last matched character of the greedy match.
+    dtk_int32 score;        // The score of the match against the level's prefix of the pattern. Only valid when the level has been scored.
+} dred_fuzzy_level_entry;
+
+typedef struct
+{
+    dtk_uint32 candidateIndex;
+    dtk_int32 score;
+} dred_fuzzy_result;
+
+typedef struct
+{
+    // The text of every candidate, and a case folded copy for case insensitive matching. Both use the same offsets. Keeping
+    // the folded text separate means case insensitive matching only needs to read that buffer for the most part.
+    char* pText;
+    char* pFoldedText;
+    dtk_uint32 textSize;
+    dtk_uint32 textCapacity;
+
+    dred_fuzzy_candidate* pCandidates;
+    dtk_uint64* pCharMasks;     // A bit for each (case folded) character of each candidate. Used for rejecting candidates without touching their text.
+    dtk_uint32 candidateCount;
+    dtk_uint32 candidateCapacity;
+
+    // The current pattern.
+    char pattern[DRED_FUZZY_MAX_PATTERN_LENGTH+1];
+    dtk_uint32 patternLength;
+
+    // The matching candidates for each prefix of the pattern. Level 0 is the empty pattern which implicitly matches every
+    // candidate and is not stored. The entries of level n (n > 0) start at pLevelEntries[levelOffsets[n-1]] and there are
+    // levelOffsets[n] - levelOffsets[n-1] of them, with levelOffsets[0] being 0. Only the first levelCount levels are valid.
+    dred_fuzzy_level_entry* pLevelEntries;
+    dtk_uint32 levelEntryCapacity;
+    dtk_uint32 levelOffsets[DRED_FUZZY_MAX_PATTERN_LENGTH+1];
+    dtk_bool8 isLevelScored[DRED_FUZZY_MAX_PATTERN_LENGTH+1];
+    dtk_uint32 levelCount;
+
+    // The ranked results of the current pattern.
+    dred_fuzzy_result* pResults;
+    dtk_uint32 resultCount;
+    dtk_uint32 resultCapacity;
+    dtk_uint32 maxResultCount;  // 0 = unlimited.
+} dred_fuzzy_matcher;
+
+// Initializes a fuzzy matcher.
+//
+// <maxResultCount> is the maximum number of ranked results to keep. Set this to 0 to keep every match. Limiting the result
+// count keeps ranking fast when there are a lot of candidates.
+dred_result dred_fuzzy_matcher_init(dred_fuzzy_matcher* pMatcher, dtk_uint32 maxResultCount);
+
+// Uninitializes a fuzzy matcher.
+void dred_fuzzy_matcher_uninit(dred_fuzzy_matcher* pMatcher);
+
+// Removes every candidate. This also resets the pattern.
+void dred_fuzzy_matcher_clear(dred_fuzzy_matcher* pMatcher);
+
+// Adds a candidate. The text is copied. This resets the incremental state, so the next call to dred_fuzzy_matcher_set_pattern()
+// will match the whole pattern from scratch.
+dred_result dred_fuzzy_matcher_add_candidate(dred_fuzzy_matcher* pMatcher, const char* text, void* pUserData);
+
+// Retrieves the number of candidates.
+dtk_uint32 dred_fuzzy_matcher_get_candidate_count(dred_fuzzy_matcher* pMatcher);
+
+// Sets the pattern and updates the ranked results. Any characters in common with the previous pattern are not matched again.
+dred_result dred_fuzzy_matcher_set_pattern(dred_fuzzy_matcher* pMatcher, const char* pattern);
+
+// Retrieves the number of ranked results.
+dtk_uint32 dred_fuzzy_matcher_get_result_count(dred_fuzzy_matcher* pMatcher);
+
+// Retrieves the text of the result at the given rank.
+const char* dred_fuzzy_matcher_get_result_text(dred_fuzzy_matcher* pMatcher, dtk_uint32 index);
+
+// Retrieves the user data of the result at the given rank.
+void* dred_fuzzy_matcher_get_result_user_data(dred_fuzzy_matcher* pMatcher, dtk_uint32 index);
+
+// Retrieves the score of the result at the given rank.
+dtk_int32 dred_fuzzy_matcher_get_result_score(dred_fuzzy_matcher* pMatcher, dtk_uint32 index);
+
+
+// Matches a single string against a pattern without a matcher object.
+//
+// Returns true if the pattern matches, in which case the score is returned in <pScore>. <pScore> can be null.
+dtk_bool32 dred_fuzzy_match(const char* pattern, const char* text, dtk_int32* pScore);
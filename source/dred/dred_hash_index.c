@@ -0,0 +1,166 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+#define DRED_HASH_INDEX_MIN_SLOT_COUNT  32
+
+static void dred_hash_index__insert_no_grow(dred_hash_index_slot* pSlots, dtk_uint32 slotCount, dtk_uint32 hash, dtk_uint32 value)
+{
+    assert(pSlots != NULL);
+
+    dtk_uint32 mask = slotCount-1;
+    for (dtk_uint32 iSlot = hash & mask; ; iSlot = (iSlot + 1) & mask) {
+        if (pSlots[iSlot].value == DRED_HASH_INDEX_EMPTY) {
+            pSlots[iSlot].hash  = hash;
+            pSlots[iSlot].value = value;
+            return;
+        }
+    }
+}
+
+static dtk_bool32 dred_hash_index__grow(dred_hash_index* pIndex)
+{
+    assert(pIndex != NULL);
+
+    dtk_uint32 newSlotCount = (pIndex->slotCount == 0) ? DRED_HASH_INDEX_MIN_SLOT_COUNT : pIndex->slotCount*2;
+    dred_hash_index_slot* pNewSlots = (dred_hash_index_slot*)dtk_malloc(newSlotCount * sizeof(*pNewSlots));
+    if (pNewSlots == NULL) {
+        return DTK_FALSE;
+    }
+
+    memset(pNewSlots, 0xFF, newSlotCount * sizeof(*pNewSlots));   // <-- Sets every value to DRED_HASH_INDEX_EMPTY.
+
+    for (dtk_uint32 iSlot = 0; iSlot < pIndex->slotCount; ++iSlot) {
+        if (pIndex->pSlots[iSlot].value != DRED_HASH_INDEX_EMPTY) {
+            dred_hash_index__insert_no_grow(pNewSlots, newSlotCount, pIndex->pSlots[iSlot].hash, pIndex->pSlots[iSlot].value);
+        }
+    }
+
+    dtk_free(pIndex->pSlots);
+    pIndex->pSlots = pNewSlots;
+    pIndex->slotCount = newSlotCount;
+
+    return DTK_TRUE;
+}
+
+
+dtk_bool32 dred_hash_index_init(dred_hash_index* pIndex)
+{
+    if (pIndex == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_zero_object(pIndex);
+    return DTK_TRUE;
+}
+
+void dred_hash_index_uninit(dred_hash_index* pIndex)
+{
+    if (pIndex == NULL) {
+        return;
+    }
+
+    dtk_free(pIndex->pSlots);
+    dtk_zero_object(pIndex);
+}
+
+void dred_hash_index_clear(dred_hash_index* pIndex)
+{
+    if (pIndex == NULL || pIndex->pSlots == NULL) {
+        return;
+    }
+
+    memset(pIndex->pSlots, 0xFF, pIndex->slotCount * sizeof(*pIndex->pSlots));
+    pIndex->count = 0;
+}
+
+dtk_bool32 dred_hash_index_insert(dred_hash_index* pIndex, dtk_uint32 hash, dtk_uint32 value)
+{
+    if (pIndex == NULL || value == DRED_HASH_INDEX_EMPTY) {
+        return DTK_FALSE;
+    }
+
+    // The load factor is kept at or below a half so that probe sequences stay short.
+    if ((pIndex->count+1)*2 > pIndex->slotCount) {
+        if (!dred_hash_index__grow(pIndex)) {
+            return DTK_FALSE;
+        }
+    }
+
+    dred_hash_index__insert_no_grow(pIndex->pSlots, pIndex->slotCount, hash, value);
+    pIndex->count += 1;
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_hash_index_remove(dred_hash_index* pIndex, dtk_uint32 hash, dtk_uint32 value)
+{
+    if (pIndex == NULL || pIndex->slotCount == 0) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint32 mask = pIndex->slotCount-1;
+    dtk_uint32 iSlot;
+    for (iSlot = hash & mask; ; iSlot = (iSlot + 1) & mask) {
+        if (pIndex->pSlots[iSlot].value == DRED_HASH_INDEX_EMPTY) {
+            return DTK_FALSE;   // Not found.
+        }
+
+        if (pIndex->pSlots[iSlot].hash == hash && pIndex->pSlots[iSlot].value == value) {
+            break;
+        }
+    }
+
+    // Backward shift deletion. Any slot further along the probe sequence that could have been placed in the hole is moved
+    // back into it, and the process repeats with the new hole. This keeps every remaining value reachable from its home slot.
+    dtk_uint32 iHole = iSlot;
+    for (dtk_uint32 iNext = (iHole + 1) & mask; pIndex->pSlots[iNext].value != DRED_HASH_INDEX_EMPTY; iNext = (iNext + 1) & mask) {
+        dtk_uint32 iHome = pIndex->pSlots[iNext].hash & mask;
+
+        // The value can be moved into the hole if its home slot is not cyclically within (iHole, iNext].
+        dtk_bool32 canMove;
+        if (iHole <= iNext) {
+            canMove = (iHome <= iHole) || (iHome > iNext);
+        } else {
+            canMove = (iHome <= iHole) && (iHome > iNext);
+        }
+
+        if (canMove) {
+            pIndex->pSlots[iHole] = pIndex->pSlots[iNext];
+            iHole = iNext;
+        }
+    }
+
+    pIndex->pSlots[iHole].value = DRED_HASH_INDEX_EMPTY;
+    pIndex->count -= 1;
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_hash_index_find_first(dred_hash_index* pIndex, dtk_uint32 hash, dred_hash_index_iterator* pIterator, dtk_uint32* pValueOut)
+{
+    if (pIndex == NULL || pIterator == NULL || pIndex->slotCount == 0) {
+        return DTK_FALSE;
+    }
+
+    pIterator->hash = hash;
+    pIterator->slot = (hash & (pIndex->slotCount-1)) - 1;  // <-- find_next() increments before checking. Wrapping is fine.
+
+    return dred_hash_index_find_next(pIndex, pIterator, pValueOut);
+}
+
+dtk_bool32 dred_hash_index_find_next(dred_hash_index* pIndex, dred_hash_index_iterator* pIterator, dtk_uint32* pValueOut)
+{
+    if (pIndex == NULL || pIterator == NULL || pIndex->slotCount == 0) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint32 mask = pIndex->slotCount-1;
+    for (dtk_uint32 iSlot = (pIterator->slot + 1) & mask; pIndex->pSlots[iSlot].value != DRED_HASH_INDEX_EMPTY; iSlot = (iSlot + 1) & mask) {
+        if (pIndex->pSlots[iSlot].hash == pIterator->hash) {
+            pIterator->slot = iSlot;
+            if (pValueOut) *pValueOut = pIndex->pSlots[iSlot].value;
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// A hash index maps a 32-bit hash to one or more 32-bit values, which are typically indices into an array owned by something
+// else. It does not store keys. Instead, lookups iterate over every value with a matching hash and the owner compares the
+// actual key. This keeps the owner in control of its own storage and ordering, which is important for things like the alias
+// map where the order of items must be preserved when they're saved.
+//
+// It's implemented as an open addressing hash table with linear probing. Removal uses backward shift deletion so there are
+// no tombstones.
+
+#define DRED_HASH_INDEX_EMPTY   0xFFFFFFFF
+
+typedef struct
+{
+    dtk_uint32 hash;
+    dtk_uint32 value;   // DRED_HASH_INDEX_EMPTY for an empty slot.
+} dred_hash_index_slot;
+
+typedef struct
+{
+    dred_hash_index_slot* pSlots;
+    dtk_uint32 slotCount;   // Always a power of 2, or 0.
+    dtk_uint32 count;
+} dred_hash_index;
+
+typedef struct
+{
+    dtk_uint32 hash;
+    dtk_uint32 slot;
+} dred_hash_index_iterator;
+
+// dred_hash_index_init()
+dtk_bool32 dred_hash_index_init(dred_hash_index* pIndex);
+
+// dred_hash_index_uninit()
+void dred_hash_index_uninit(dred_hash_index* pIndex);
+
+// Removes every value from the index without freeing memory.
+void dred_hash_index_clear(dred_hash_index* pIndex);
+
+// Inserts a value. This does not check whether or not the value already exists.
+dtk_bool32 dred_hash_index_insert(dred_hash_index* pIndex, dtk_uint32 hash, dtk_uint32 value);
+
+// Removes a value. Returns false if it could not be found.
+dtk_bool32 dred_hash_index_remove(dred_hash_index* pIndex, dtk_uint32 hash, dtk_uint32 value);
+
+// Iterates over each value with the given hash. The index must not be modified while iterating.
+//
+// Usage:
+//     dred_hash_index_iterator iterator;
+//     dtk_uint32 value;
+//     for (dtk_bool32 found = dred_hash_index_find_first(pIndex, hash, &iterator, &value); found; found = dred_hash_index_find_next(pIndex, &iterator, &value)) {
+//         ...
+//     }
+dtk_bool32 dred_hash_index_find_first(dred_hash_index* pIndex, dtk_uint32 hash, dred_hash_index_iterator* pIterator, dtk_uint32* pValueOut);
+dtk_bool32 dred_hash_index_find_next(dred_hash_index* pIndex, dred_hash_index_iterator* pIterator, dtk_uint32* pValueOut);
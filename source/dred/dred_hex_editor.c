@@ -1 +1,1675 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DRED_HEX_EDITOR_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
+
+// The scroll range of the vertical scrollbar. Files with more rows than this are scrolled multiple rows per step.
+#define DRED_HEX_EDITOR_SCROLL_RANGE        (1 << 24)
+
+// The size of each window that is mapped while searching. Searching uses it's own mappings rather than the page cache so
+// that a search through a big file doesn't evict the pages that are being displayed.
+#define DRED_HEX_EDITOR_SEARCH_WINDOW_SIZE  (8 * 1024 * 1024)
+
+// The longest pattern that can be searched for.
+#define DRED_HEX_EDITOR_MAX_PATTERN_LENGTH  1024
+
+#define DRED_HEX_EDITOR_NOT_FOUND           ((dtk_uint64)-1)
+
+// The column of the ASCII pane, relative to the start of the hex pane. The hex pane is two characters and a space for each
+// byte with an extra space in the middle, followed by another space.
+#define DRED_HEX_EDITOR_ASCII_COLUMN        (DRED_HEX_EDITOR_BYTES_PER_ROW*3 + 2)
+#define DRED_HEX_EDITOR_ROW_LENGTH          (DRED_HEX_EDITOR_ASCII_COLUMN + DRED_HEX_EDITOR_BYTES_PER_ROW)
+
+static const char g_dredHexDigits[] = "0123456789ABCDEF";
+
+dtk_bool32 dred_hex_editor_should_open(const char* filePath)
+{
+    if (filePath == NULL || filePath[0] == '\0') {
+        return DTK_FALSE;
+    }
+
+    dred_file file = dred_file_open(filePath, DRED_FILE_OPEN_MODE_READ);
+    if (file == NULL) {
+        return DTK_FALSE;
+    }
+
+    // Text files practically never contain null bytes, whereas almost every binary format does somewhere near the start.
+    dtk_uint8 data[DRED_HEX_EDITOR_SNIFF_SIZE];
+    size_t bytesRead = 0;
+    dred_file_read(file, data, sizeof(data), &bytesRead);
+    dred_file_close(file);
+
+    return memchr(data, 0, bytesRead) != NULL;
+}
+
+
+// Converts a row of bytes to hex characters and the characters of the ASCII pane. Non-printable bytes are shown as '.' in
+// the ASCII pane.
+static void dred_hex_editor__format_bytes(const dtk_uint8 bytes[DRED_HEX_EDITOR_BYTES_PER_ROW], char hexOut[DRED_HEX_EDITOR_BYTES_PER_ROW*2], char asciiOut[DRED_HEX_EDITOR_BYTES_PER_ROW])
+{
+#ifdef DRED_HEX_EDITOR_SUPPORT_SSE2
+    __m128i data = _mm_loadu_si128((const __m128i*)bytes);
+
+    // Each nibble is converted to a character by adding '0', and then another 7 if it's above 9 to get to 'A'.
+    __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(data, 4), nibbleMask);
+    __m128i lo = _mm_and_si128(data, nibbleMask);
+
+    __m128i nine   = _mm_set1_epi8(9);
+    __m128i zero   = _mm_set1_epi8('0');
+    __m128i letter = _mm_set1_epi8('A' - '0' - 10);
+    hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letter));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letter));
+
+    _mm_storeu_si128((__m128i*)(hexOut +  0), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i*)(hexOut + 16), _mm_unpackhi_epi8(hi, lo));
+
+    // The comparisons are signed so bytes of 0x80 and above fail the first one.
+    __m128i isPrintable = _mm_and_si128(_mm_cmpgt_epi8(data, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(data, _mm_set1_epi8(0x7F)));
+    _mm_storeu_si128((__m128i*)asciiOut, _mm_or_si128(_mm_and_si128(isPrintable, data), _mm_andnot_si128(isPrintable, _mm_set1_epi8('.'))));
+#else
+    for (int i = 0; i < DRED_HEX_EDITOR_BYTES_PER_ROW; ++i) {
+        hexOut[i*2 + 0] = g_dredHexDigits[bytes[i] >> 4];
+        hexOut[i*2 + 1] = g_dredHexDigits[bytes[i] & 0x0F];
+        asciiOut[i] = (bytes[i] >= 32 && bytes[i] < 127) ? (char)bytes[i] : '.';
+    }
+#endif
+}
+
+// Retrieves the column of the hex characters of the byte at the given index in a row.
+static size_t dred_hex_editor__get_hex_column(size_t iByte)
+{
+    return iByte*3 + ((iByte >= DRED_HEX_EDITOR_BYTES_PER_ROW/2) ? 1 : 0);
+}
+
+// Formats the hex and ASCII panes of a row. byteCount will be less than DRED_HEX_EDITOR_BYTES_PER_ROW for the last row of
+// the file, in which case the remaining columns are left blank. pOut must be at least DRED_HEX_EDITOR_ROW_LENGTH bytes.
+static void dred_hex_editor__format_row(const dtk_uint8 bytes[DRED_HEX_EDITOR_BYTES_PER_ROW], size_t byteCount, char* pOut)
+{
+    char hex[DRED_HEX_EDITOR_BYTES_PER_ROW*2];
+    char ascii[DRED_HEX_EDITOR_BYTES_PER_ROW];
+    dred_hex_editor__format_bytes(bytes, hex, ascii);
+
+    memset(pOut, ' ', DRED_HEX_EDITOR_ROW_LENGTH);
+    for (size_t i = 0; i < byteCount; ++i) {
+        size_t column = dred_hex_editor__get_hex_column(i);
+        pOut[column + 0] = hex[i*2 + 0];
+        pOut[column + 1] = hex[i*2 + 1];
+    }
+
+    memcpy(pOut + DRED_HEX_EDITOR_ASCII_COLUMN, ascii, byteCount);
+}
+
+// Formats an offset as a fixed number of hex digits.
+static void dred_hex_editor__format_offset(dtk_uint64 offset, unsigned int digitCount, char* pOut)
+{
+    for (unsigned int i = 0; i < digitCount; ++i) {
+        pOut[digitCount - i - 1] = g_dredHexDigits[offset & 0x0F];
+        offset >>= 4;
+    }
+}
+
+
+// Retrieves a page from the cache, mapping it if necessary. Returns null if the page is beyond the end of the file or could
+// not be mapped.
+static const dtk_uint8* dred_hex_editor__get_page(dred_hex_editor* pHexEditor, dtk_uint64 pageIndex, size_t* pSizeOut)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(pSizeOut != NULL);
+
+    *pSizeOut = 0;
+
+    pHexEditor->pageClock += 1;
+
+    dred_hex_editor_page* pVictim = &pHexEditor->pages[0];
+    for (size_t i = 0; i < DRED_HEX_EDITOR_PAGE_COUNT; ++i) {
+        dred_hex_editor_page* pPage = &pHexEditor->pages[i];
+        if (pPage->view.pData != NULL && pPage->pageIndex == pageIndex) {
+            pPage->lastUsed = pHexEditor->pageClock;
+            *pSizeOut = pPage->view.dataSize;
+            return pPage->view.pData;
+        }
+
+        // Empty slots are used before evicting anything.
+        if (pVictim->view.pData != NULL && (pPage->view.pData == NULL || pPage->lastUsed < pVictim->lastUsed)) {
+            pVictim = pPage;
+        }
+    }
+
+    if (pVictim->view.pData != NULL) {
+        dtk_mapped_file_unmap(&pHexEditor->file, &pVictim->view);
+        pVictim->view.pData = NULL;
+    }
+
+    if (dtk_mapped_file_map(&pHexEditor->file, pageIndex * DRED_HEX_EDITOR_PAGE_SIZE, DRED_HEX_EDITOR_PAGE_SIZE, &pVictim->view) != DTK_SUCCESS) {
+        pVictim->view.pData = NULL;
+        return NULL;
+    }
+
+    pVictim->pageIndex = pageIndex;
+    pVictim->lastUsed = pHexEditor->pageClock;
+
+    *pSizeOut = pVictim->view.dataSize;
+    return pVictim->view.pData;
+}
+
+// Unmaps every page in the cache. This needs to be done before the file is closed.
+static void dred_hex_editor__unmap_all_pages(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    for (size_t i = 0; i < DRED_HEX_EDITOR_PAGE_COUNT; ++i) {
+        if (pHexEditor->pages[i].view.pData != NULL) {
+            dtk_mapped_file_unmap(&pHexEditor->file, &pHexEditor->pages[i].view);
+            pHexEditor->pages[i].view.pData = NULL;
+        }
+    }
+}
+
+
+// Finds the index of the first extent that ends after the given offset. This is the extent containing the offset, if
+// any, or otherwise the first extent after it.
+static size_t dred_hex_editor__find_extent(dred_hex_editor* pHexEditor, dtk_uint64 offset)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    size_t lo = 0;
+    size_t hi = stb_sb_count(pHexEditor->pExtents);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo)/2;
+        if (pHexEditor->pExtents[mid].offset + pHexEditor->pExtents[mid].size <= offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Determines whether or not any part of the given range has been modified.
+static dtk_bool32 dred_hex_editor__is_range_modified(dred_hex_editor* pHexEditor, dtk_uint64 offset, size_t size)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    size_t iExtent = dred_hex_editor__find_extent(pHexEditor, offset);
+    return iExtent < (size_t)stb_sb_count(pHexEditor->pExtents) && pHexEditor->pExtents[iExtent].offset < offset + size;
+}
+
+// Applies the overlay on top of data read from the file. If pModifiedMask is not null, bit i is set for each modified
+// byte. pModifiedMask can only be used when size is no more than 32.
+static void dred_hex_editor__apply_overlay(dred_hex_editor* pHexEditor, dtk_uint64 offset, dtk_uint8* pData, size_t size, dtk_uint32* pModifiedMask)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(pModifiedMask == NULL || size <= 32);
+
+    if (pModifiedMask != NULL) {
+        *pModifiedMask = 0;
+    }
+
+    size_t extentCount = stb_sb_count(pHexEditor->pExtents);
+    for (size_t iExtent = dred_hex_editor__find_extent(pHexEditor, offset); iExtent < extentCount; ++iExtent) {
+        const dred_hex_editor_extent* pExtent = &pHexEditor->pExtents[iExtent];
+        if (pExtent->offset >= offset + size) {
+            break;
+        }
+
+        dtk_uint64 beg = dtk_max(pExtent->offset, offset);
+        dtk_uint64 end = dtk_min(pExtent->offset + pExtent->size, offset + size);
+        memcpy(pData + (size_t)(beg - offset), pExtent->pData + (size_t)(beg - pExtent->offset), (size_t)(end - beg));
+
+        if (pModifiedMask != NULL) {
+            for (dtk_uint64 i = beg; i < end; ++i) {
+                *pModifiedMask |= (1U << (dtk_uint32)(i - offset));
+            }
+        }
+    }
+}
+
+static dtk_bool32 dred_hex_editor__reserve_extent(dred_hex_editor_extent* pExtent, size_t capacity)
+{
+    dtk_assert(pExtent != NULL);
+
+    if (capacity <= pExtent->capacity) {
+        return DTK_TRUE;
+    }
+
+    size_t newCapacity = (pExtent->capacity == 0) ? 16 : pExtent->capacity*2;
+    while (newCapacity < capacity) {
+        newCapacity *= 2;
+    }
+
+    dtk_uint8* pNewData = (dtk_uint8*)realloc(pExtent->pData, newCapacity);
+    if (pNewData == NULL) {
+        return DTK_FALSE;
+    }
+
+    pExtent->pData = pNewData;
+    pExtent->capacity = newCapacity;
+    return DTK_TRUE;
+}
+
+static void dred_hex_editor__clear_overlay(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    for (int i = 0; i < stb_sb_count(pHexEditor->pExtents); ++i) {
+        free(pHexEditor->pExtents[i].pData);
+    }
+
+    stb_sb_free(pHexEditor->pExtents);
+    pHexEditor->pExtents = NULL;
+}
+
+// Writes a byte into the overlay. This does not touch the undo stack.
+static dtk_bool32 dred_hex_editor__set_byte_no_undo(dred_hex_editor* pHexEditor, dtk_uint64 offset, dtk_uint8 value)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(offset < pHexEditor->file.fileSize);
+
+    size_t extentCount = stb_sb_count(pHexEditor->pExtents);
+    size_t iExtent = dred_hex_editor__find_extent(pHexEditor, offset);
+
+    // The simple case is when the byte has already been modified.
+    if (iExtent < extentCount && pHexEditor->pExtents[iExtent].offset <= offset) {
+        dred_hex_editor_extent* pExtent = &pHexEditor->pExtents[iExtent];
+        pExtent->pData[offset - pExtent->offset] = value;
+        return DTK_TRUE;
+    }
+
+    // The byte is not in an extent, so it's either appended to the previous one, prepended to the next one, or it's given
+    // a new one. When it fills a one byte gap, the previous and next extents are merged.
+    dtk_bool32 touchesPrev = iExtent > 0 && pHexEditor->pExtents[iExtent-1].offset + pHexEditor->pExtents[iExtent-1].size == offset;
+    dtk_bool32 touchesNext = iExtent < extentCount && pHexEditor->pExtents[iExtent].offset == offset + 1;
+
+    if (touchesPrev) {
+        dred_hex_editor_extent* pPrev = &pHexEditor->pExtents[iExtent-1];
+        size_t nextSize = (touchesNext) ? pHexEditor->pExtents[iExtent].size : 0;
+        if (!dred_hex_editor__reserve_extent(pPrev, pPrev->size + 1 + nextSize)) {
+            return DTK_FALSE;
+        }
+
+        pPrev->pData[pPrev->size] = value;
+        pPrev->size += 1;
+
+        if (touchesNext) {
+            dred_hex_editor_extent* pNext = &pHexEditor->pExtents[iExtent];
+            memcpy(pPrev->pData + pPrev->size, pNext->pData, pNext->size);
+            pPrev->size += pNext->size;
+            free(pNext->pData);
+
+            memmove(pHexEditor->pExtents + iExtent, pHexEditor->pExtents + iExtent + 1, (extentCount - iExtent - 1) * sizeof(*pHexEditor->pExtents));
+            stb__sbn(pHexEditor->pExtents) -= 1;
+        }
+
+        return DTK_TRUE;
+    }
+
+    if (touchesNext) {
+        dred_hex_editor_extent* pNext = &pHexEditor->pExtents[iExtent];
+        if (!dred_hex_editor__reserve_extent(pNext, pNext->size + 1)) {
+            return DTK_FALSE;
+        }
+
+        memmove(pNext->pData + 1, pNext->pData, pNext->size);
+        pNext->pData[0] = value;
+        pNext->offset = offset;
+        pNext->size += 1;
+        return DTK_TRUE;
+    }
+
+    dred_hex_editor_extent extent;
+    memset(&extent, 0, sizeof(extent));
+    if (!dred_hex_editor__reserve_extent(&extent, 1)) {
+        return DTK_FALSE;
+    }
+
+    extent.offset = offset;
+    extent.size = 1;
+    extent.pData[0] = value;
+
+    stb_sb_push(pHexEditor->pExtents, extent);
+    memmove(pHexEditor->pExtents + iExtent + 1, pHexEditor->pExtents + iExtent, (extentCount - iExtent) * sizeof(*pHexEditor->pExtents));
+    pHexEditor->pExtents[iExtent] = extent;
+
+    return DTK_TRUE;
+}
+
+static void dred_hex_editor__refresh_modified_state(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    if (pHexEditor->undoIndex == pHexEditor->savedUndoIndex) {
+        dred_editor_unmark_as_modified(DRED_EDITOR(pHexEditor));
+    } else {
+        dred_editor_mark_as_modified(DRED_EDITOR(pHexEditor));
+    }
+}
+
+
+static float dred_hex_editor__get_scrollbar_width(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pHexEditor));
+    return pDred->config.textEditorSBSize * dtk_control_get_scaling_factor(DTK_CONTROL(pHexEditor));
+}
+
+static float dred_hex_editor__get_text_scale(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+    return pHexEditor->textScale * dtk_control_get_scaling_factor(DTK_CONTROL(pHexEditor));
+}
+
+static dtk_int32 dred_hex_editor__get_line_height(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_font_metrics metrics;
+    if (dtk_font_get_metrics(pHexEditor->pFont, dred_hex_editor__get_text_scale(pHexEditor), &metrics) != DTK_SUCCESS || metrics.lineHeight <= 0) {
+        return 1;
+    }
+
+    return metrics.lineHeight;
+}
+
+// The layout relies on the font being fixed width, which the text editor's font is expected to be.
+static float dred_hex_editor__get_char_width(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_int32 width;
+    if (dtk_font_measure_string(pHexEditor->pFont, dred_hex_editor__get_text_scale(pHexEditor), "0", 1, &width, NULL) != DTK_SUCCESS || width <= 0) {
+        return 1;
+    }
+
+    return (float)width;
+}
+
+// Files bigger than 4GB need 16 digits for the offsets.
+static unsigned int dred_hex_editor__get_offset_digit_count(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+    return (pHexEditor->file.fileSize > 0xFFFFFFFF) ? 16 : 8;
+}
+
+static float dred_hex_editor__get_offset_pane_width(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    float padding = pHexEditor->offsetPadding * dtk_control_get_scaling_factor(DTK_CONTROL(pHexEditor));
+    return (dred_hex_editor__get_offset_digit_count(pHexEditor) * dred_hex_editor__get_char_width(pHexEditor)) + padding*2;
+}
+
+// The position of the first column of the hex pane.
+static float dred_hex_editor__get_data_pos_x(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+    return dred_hex_editor__get_offset_pane_width(pHexEditor) + dred_hex_editor__get_char_width(pHexEditor);
+}
+
+static dtk_uint64 dred_hex_editor__get_row_count(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+    return (pHexEditor->file.fileSize + DRED_HEX_EDITOR_BYTES_PER_ROW - 1) / DRED_HEX_EDITOR_BYTES_PER_ROW;
+}
+
+// Retrieves the number of rows that fit entirely in the editor. This is at least 1.
+static dtk_uint32 dred_hex_editor__get_page_row_count(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint32 rowCount = (dtk_uint32)(dred_control_get_height(DRED_CONTROL(pHexEditor)) / dred_hex_editor__get_line_height(pHexEditor));
+    return (rowCount > 0) ? rowCount : 1;
+}
+
+static dtk_uint64 dred_hex_editor__get_max_top_row(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint64 rowCount = dred_hex_editor__get_row_count(pHexEditor);
+    dtk_uint32 pageRowCount = dred_hex_editor__get_page_row_count(pHexEditor);
+    return (rowCount > pageRowCount) ? rowCount - pageRowCount : 0;
+}
+
+static void dred_hex_editor__refresh_scrollbar(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint64 rowCount = dred_hex_editor__get_row_count(pHexEditor);
+    if (rowCount == 0) {
+        rowCount = 1;
+    }
+
+    pHexEditor->rowsPerScrollStep = (rowCount + DRED_HEX_EDITOR_SCROLL_RANGE - 1) / DRED_HEX_EDITOR_SCROLL_RANGE;
+
+    dtk_int32 stepCount = (dtk_int32)((rowCount + pHexEditor->rowsPerScrollStep - 1) / pHexEditor->rowsPerScrollStep);
+    dtk_int32 pageStepCount = (dtk_int32)(dred_hex_editor__get_page_row_count(pHexEditor) / pHexEditor->rowsPerScrollStep);
+    if (pageStepCount < 1) {
+        pageStepCount = 1;
+    }
+
+    dtk_scrollbar_set_range_and_page_size(&pHexEditor->vertScrollbar, 0, stepCount - 1, pageStepCount);
+    dtk_scrollbar_set_scroll_position(&pHexEditor->vertScrollbar, (dtk_int32)(pHexEditor->topRow / pHexEditor->rowsPerScrollStep));
+}
+
+static void dred_hex_editor__set_top_row(dred_hex_editor* pHexEditor, dtk_uint64 topRow)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint64 maxTopRow = dred_hex_editor__get_max_top_row(pHexEditor);
+    if (topRow > maxTopRow) {
+        topRow = maxTopRow;
+    }
+
+    pHexEditor->topRow = topRow;
+
+    dtk_scrollbar_set_scroll_position(&pHexEditor->vertScrollbar, (dtk_int32)(pHexEditor->topRow / pHexEditor->rowsPerScrollStep));
+    dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+}
+
+static void dred_hex_editor__on_vscroll(dtk_scrollbar* pScrollbar, dtk_int32 scrollPos)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(DTK_CONTROL(pScrollbar)->pUserData);
+    if (pHexEditor == NULL) {
+        return;
+    }
+
+    dtk_uint64 maxTopRow = dred_hex_editor__get_max_top_row(pHexEditor);
+    dtk_uint64 topRow = (dtk_uint64)scrollPos * pHexEditor->rowsPerScrollStep;
+
+    // When each step covers multiple rows the last step may not land exactly on the last row.
+    dtk_int32 rangeMin;
+    dtk_int32 rangeMax;
+    dtk_scrollbar_get_range(pScrollbar, &rangeMin, &rangeMax);
+    if (scrollPos >= rangeMax - dtk_scrollbar_get_page_size(pScrollbar) + 1 || topRow > maxTopRow) {
+        topRow = maxTopRow;
+    }
+
+    pHexEditor->topRow = topRow;
+    dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+}
+
+// Makes sure the cursor is visible, scrolling if necessary.
+static void dred_hex_editor__scroll_to_cursor(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint64 cursorRow = pHexEditor->cursorOffset / DRED_HEX_EDITOR_BYTES_PER_ROW;
+    dtk_uint32 pageRowCount = dred_hex_editor__get_page_row_count(pHexEditor);
+
+    if (cursorRow < pHexEditor->topRow) {
+        dred_hex_editor__set_top_row(pHexEditor, cursorRow);
+    } else if (cursorRow >= pHexEditor->topRow + pageRowCount) {
+        dred_hex_editor__set_top_row(pHexEditor, cursorRow - pageRowCount + 1);
+    } else {
+        dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+    }
+}
+
+static void dred_hex_editor__set_cursor(dred_hex_editor* pHexEditor, dtk_uint64 offset, dtk_bool32 isOnLowNibble)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    if (pHexEditor->file.fileSize == 0) {
+        offset = 0;
+        isOnLowNibble = DTK_FALSE;
+    } else if (offset >= pHexEditor->file.fileSize) {
+        offset = pHexEditor->file.fileSize - 1;
+    }
+
+    pHexEditor->cursorOffset = offset;
+    pHexEditor->isCursorOnLowNibble = isOnLowNibble;
+
+    dred_hex_editor__scroll_to_cursor(pHexEditor);
+    dred_update_info_bar(dred_control_get_context(DRED_CONTROL(pHexEditor)), DRED_CONTROL(pHexEditor));
+}
+
+// Moves the cursor by the given number of bytes, clamping to the start and end of the file.
+static void dred_hex_editor__move_cursor(dred_hex_editor* pHexEditor, dtk_int64 delta)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_uint64 offset = pHexEditor->cursorOffset;
+    if (delta < 0) {
+        offset = ((dtk_uint64)-delta > offset) ? 0 : offset - (dtk_uint64)-delta;
+    } else {
+        offset = offset + (dtk_uint64)delta;
+    }
+
+    dred_hex_editor__set_cursor(pHexEditor, offset, DTK_FALSE);
+}
+
+
+static void dred_hex_editor__refresh_layout(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    float scrollbarWidth = dred_hex_editor__get_scrollbar_width(pHexEditor);
+
+    dtk_control_set_size(DTK_CONTROL(&pHexEditor->vertScrollbar), (dtk_int32)scrollbarWidth, (dtk_int32)dred_control_get_height(DRED_CONTROL(pHexEditor)));
+    dtk_control_set_relative_position(DTK_CONTROL(&pHexEditor->vertScrollbar), (dtk_int32)(dred_control_get_width(DRED_CONTROL(pHexEditor)) - scrollbarWidth), 0);
+
+    // The page size of the scrollbar depends on the height.
+    dred_hex_editor__refresh_scrollbar(pHexEditor);
+    dred_hex_editor__set_top_row(pHexEditor, pHexEditor->topRow);
+}
+
+static void dred_hex_editor__on_size(dred_control* pControl, float newWidth, float newHeight)
+{
+    (void)newWidth;
+    (void)newHeight;
+
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    dred_hex_editor__refresh_layout(pHexEditor);
+}
+
+static void dred_hex_editor__on_mouse_wheel(dred_control* pControl, int delta, int relativeMousePosX, int relativeMousePosY, int stateFlags)
+{
+    (void)relativeMousePosX;
+    (void)relativeMousePosY;
+    (void)stateFlags;
+
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    dred_hex_editor_scroll_rows(pHexEditor, -delta * 3);
+}
+
+static void dred_hex_editor__on_mouse_button_down(dred_control* pControl, int mouseButton, int relativeMousePosX, int relativeMousePosY, int stateFlags)
+{
+    (void)stateFlags;
+
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    if (mouseButton != DTK_MOUSE_BUTTON_LEFT) {
+        return;
+    }
+
+    dred_control_capture_keyboard(pControl);
+
+    float charWidth = dred_hex_editor__get_char_width(pHexEditor);
+    float dataPosX = dred_hex_editor__get_data_pos_x(pHexEditor);
+    if (relativeMousePosX < dataPosX) {
+        return;
+    }
+
+    size_t column = (size_t)((relativeMousePosX - dataPosX) / charWidth);
+    dtk_uint64 row = pHexEditor->topRow + (dtk_uint64)(relativeMousePosY / dred_hex_editor__get_line_height(pHexEditor));
+    dtk_uint64 rowOffset = row * DRED_HEX_EDITOR_BYTES_PER_ROW;
+
+    if (column >= DRED_HEX_EDITOR_ASCII_COLUMN) {
+        if (column >= DRED_HEX_EDITOR_ROW_LENGTH) {
+            return;
+        }
+
+        pHexEditor->isCursorInASCIIPane = DTK_TRUE;
+        dred_hex_editor__set_cursor(pHexEditor, rowOffset + (column - DRED_HEX_EDITOR_ASCII_COLUMN), DTK_FALSE);
+    } else {
+        // Clicking on the space after a byte selects that byte.
+        size_t iByte = 0;
+        while (iByte+1 < DRED_HEX_EDITOR_BYTES_PER_ROW && column >= dred_hex_editor__get_hex_column(iByte+1)) {
+            iByte += 1;
+        }
+
+        pHexEditor->isCursorInASCIIPane = DTK_FALSE;
+        dred_hex_editor__set_cursor(pHexEditor, rowOffset + iByte, column == dred_hex_editor__get_hex_column(iByte) + 1);
+    }
+}
+
+static void dred_hex_editor__on_key_down(dred_control* pControl, dtk_key key, int stateFlags)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    dtk_int64 pageByteCount = (dtk_int64)dred_hex_editor__get_page_row_count(pHexEditor) * DRED_HEX_EDITOR_BYTES_PER_ROW;
+    dtk_uint64 rowOffset = pHexEditor->cursorOffset - (pHexEditor->cursorOffset % DRED_HEX_EDITOR_BYTES_PER_ROW);
+
+    switch (key)
+    {
+        case DTK_KEY_ARROW_LEFT:
+        case DTK_KEY_BACKSPACE:
+        {
+            // In the hex pane the cursor moves one nibble at a time.
+            if (!pHexEditor->isCursorInASCIIPane && pHexEditor->isCursorOnLowNibble) {
+                dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset, DTK_FALSE);
+            } else if (pHexEditor->cursorOffset > 0) {
+                dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset - 1, !pHexEditor->isCursorInASCIIPane);
+            }
+        } break;
+
+        case DTK_KEY_ARROW_RIGHT:
+        {
+            if (!pHexEditor->isCursorInASCIIPane && !pHexEditor->isCursorOnLowNibble) {
+                dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset, DTK_TRUE);
+            } else if (pHexEditor->cursorOffset+1 < pHexEditor->file.fileSize) {
+                dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset + 1, DTK_FALSE);
+            }
+        } break;
+
+        case DTK_KEY_ARROW_UP:   dred_hex_editor__move_cursor(pHexEditor, -DRED_HEX_EDITOR_BYTES_PER_ROW); break;
+        case DTK_KEY_ARROW_DOWN: dred_hex_editor__move_cursor(pHexEditor,  DRED_HEX_EDITOR_BYTES_PER_ROW); break;
+        case DTK_KEY_PAGE_UP:    dred_hex_editor__move_cursor(pHexEditor, -pageByteCount); break;
+        case DTK_KEY_PAGE_DOWN:  dred_hex_editor__move_cursor(pHexEditor,  pageByteCount); break;
+
+        case DTK_KEY_HOME:
+        {
+            if (stateFlags & DTK_MODIFIER_CTRL) {
+                dred_hex_editor_goto_ratio(pHexEditor, 0);
+            } else {
+                dred_hex_editor__set_cursor(pHexEditor, rowOffset, DTK_FALSE);
+            }
+        } break;
+
+        case DTK_KEY_END:
+        {
+            if (stateFlags & DTK_MODIFIER_CTRL) {
+                dred_hex_editor_goto_ratio(pHexEditor, 100);
+            } else {
+                dred_hex_editor__set_cursor(pHexEditor, rowOffset + DRED_HEX_EDITOR_BYTES_PER_ROW - 1, DTK_FALSE);
+            }
+        } break;
+
+        default: break;
+    }
+}
+
+static void dred_hex_editor__on_printable_key_down(dred_control* pControl, unsigned int utf32, int stateFlags)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    if ((stateFlags & (DTK_MODIFIER_CTRL | DTK_MODIFIER_ALT)) != 0) {
+        return;
+    }
+
+    // Tab switches between the hex and ASCII panes.
+    if (utf32 == '\t') {
+        pHexEditor->isCursorInASCIIPane = !pHexEditor->isCursorInASCIIPane;
+        dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset, DTK_FALSE);
+        return;
+    }
+
+    if (pHexEditor->cursorOffset >= pHexEditor->file.fileSize) {
+        return; // Empty file.
+    }
+
+    if (pHexEditor->isCursorInASCIIPane) {
+        if (utf32 < 32 || utf32 >= 127) {
+            return;
+        }
+
+        if (dred_hex_editor_set_byte(pHexEditor, pHexEditor->cursorOffset, (dtk_uint8)utf32)) {
+            dred_hex_editor__move_cursor(pHexEditor, 1);
+        }
+    } else {
+        dtk_uint8 nibble;
+        if (utf32 >= '0' && utf32 <= '9') {
+            nibble = (dtk_uint8)(utf32 - '0');
+        } else if (utf32 >= 'a' && utf32 <= 'f') {
+            nibble = (dtk_uint8)(utf32 - 'a' + 10);
+        } else if (utf32 >= 'A' && utf32 <= 'F') {
+            nibble = (dtk_uint8)(utf32 - 'A' + 10);
+        } else {
+            return;
+        }
+
+        dtk_uint8 value;
+        if (dred_hex_editor_read(pHexEditor, pHexEditor->cursorOffset, &value, 1) != 1) {
+            return;
+        }
+
+        if (pHexEditor->isCursorOnLowNibble) {
+            value = (dtk_uint8)((value & 0xF0) | nibble);
+        } else {
+            value = (dtk_uint8)((value & 0x0F) | (nibble << 4));
+        }
+
+        if (dred_hex_editor_set_byte(pHexEditor, pHexEditor->cursorOffset, value)) {
+            if (pHexEditor->isCursorOnLowNibble) {
+                dred_hex_editor__move_cursor(pHexEditor, 1);
+            } else {
+                dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset, DTK_TRUE);
+            }
+        }
+    }
+}
+
+static void dred_hex_editor__on_capture_keyboard(dred_control* pControl, dtk_control* pPrevCapturedControl)
+{
+    (void)pPrevCapturedControl;
+
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    dred_update_info_bar(dred_control_get_context(pControl), pControl);
+    dred_control_dirty(pControl, dred_control_get_local_rect(pControl));
+}
+
+static void dred_hex_editor__on_release_keyboard(dred_control* pControl, dtk_control* pNewCapturedControl)
+{
+    (void)pNewCapturedControl;
+
+    // The cursor is only shown while the editor has the keyboard.
+    dred_control_dirty(pControl, dred_control_get_local_rect(pControl));
+}
+
+// Draws the cells of a byte in both panes over the top of what's already been drawn for the row.
+static void dred_hex_editor__draw_byte_cells(dred_hex_editor* pHexEditor, const char* rowText, size_t iByte, float posY, dtk_color bgColor, dtk_surface* pSurface)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    float scale = dred_hex_editor__get_text_scale(pHexEditor);
+    float charWidth = dred_hex_editor__get_char_width(pHexEditor);
+    float dataPosX = dred_hex_editor__get_data_pos_x(pHexEditor);
+
+    size_t hexColumn = dred_hex_editor__get_hex_column(iByte);
+    size_t asciiColumn = DRED_HEX_EDITOR_ASCII_COLUMN + iByte;
+    dred_control_draw_text(DRED_CONTROL(pHexEditor), pHexEditor->pFont, scale, rowText + hexColumn, 2, dataPosX + hexColumn*charWidth, posY, pHexEditor->textColor, bgColor, pSurface);
+    dred_control_draw_text(DRED_CONTROL(pHexEditor), pHexEditor->pFont, scale, rowText + asciiColumn, 1, dataPosX + asciiColumn*charWidth, posY, pHexEditor->textColor, bgColor, pSurface);
+}
+
+static void dred_hex_editor__on_paint(dred_control* pControl, dred_rect rect, dtk_surface* pSurface)
+{
+    (void)rect;
+
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pControl);
+    assert(pHexEditor != NULL);
+
+    float scale = dred_hex_editor__get_text_scale(pHexEditor);
+    float padding = pHexEditor->offsetPadding * dtk_control_get_scaling_factor(DTK_CONTROL(pHexEditor));
+    float charWidth = dred_hex_editor__get_char_width(pHexEditor);
+    dtk_int32 lineHeight = dred_hex_editor__get_line_height(pHexEditor);
+    unsigned int offsetDigitCount = dred_hex_editor__get_offset_digit_count(pHexEditor);
+
+    float offsetPaneWidth = dred_hex_editor__get_offset_pane_width(pHexEditor);
+    float dataPosX = dred_hex_editor__get_data_pos_x(pHexEditor);
+    float viewWidth  = dred_control_get_width(DRED_CONTROL(pHexEditor)) - dred_hex_editor__get_scrollbar_width(pHexEditor);
+    float viewHeight = dred_control_get_height(DRED_CONTROL(pHexEditor));
+
+    dred_control_draw_rect(pControl, dred_make_rect(0, 0, offsetPaneWidth, viewHeight), pHexEditor->offsetBGColor, pSurface);
+    dred_control_draw_rect(pControl, dred_make_rect(offsetPaneWidth, 0, viewWidth, viewHeight), pHexEditor->bgColor, pSurface);
+
+    dtk_bool32 isFocused = dtk_control_has_keyboard_capture(DTK_CONTROL(pHexEditor));
+    dtk_uint32 visibleRowCount = dred_hex_editor__get_page_row_count(pHexEditor) + 1;
+
+    for (dtk_uint32 iRow = 0; iRow < visibleRowCount; ++iRow) {
+        dtk_uint64 rowOffset = (pHexEditor->topRow + iRow) * DRED_HEX_EDITOR_BYTES_PER_ROW;
+        if (rowOffset >= pHexEditor->file.fileSize) {
+            break;
+        }
+
+        float penPosY = (float)(iRow * lineHeight);
+
+        // Rows never straddle pages so the whole row can be read straight from the page.
+        size_t pageSize;
+        const dtk_uint8* pPage = dred_hex_editor__get_page(pHexEditor, rowOffset / DRED_HEX_EDITOR_PAGE_SIZE, &pageSize);
+        if (pPage == NULL) {
+            break;
+        }
+
+        size_t pageOffset = (size_t)(rowOffset % DRED_HEX_EDITOR_PAGE_SIZE);
+        size_t byteCount = dtk_min(DRED_HEX_EDITOR_BYTES_PER_ROW, pageSize - pageOffset);
+
+        dtk_uint8 bytes[DRED_HEX_EDITOR_BYTES_PER_ROW] = {0};
+        memcpy(bytes, pPage + pageOffset, byteCount);
+
+        dtk_uint32 modifiedMask;
+        dred_hex_editor__apply_overlay(pHexEditor, rowOffset, bytes, byteCount, &modifiedMask);
+
+        char offsetText[16];
+        dred_hex_editor__format_offset(rowOffset, offsetDigitCount, offsetText);
+        dred_control_draw_text(pControl, pHexEditor->pFont, scale, offsetText, (int)offsetDigitCount, padding, penPosY, pHexEditor->offsetColor, pHexEditor->offsetBGColor, pSurface);
+
+        char rowText[DRED_HEX_EDITOR_ROW_LENGTH];
+        dred_hex_editor__format_row(bytes, byteCount, rowText);
+        dred_control_draw_text(pControl, pHexEditor->pFont, scale, rowText, DRED_HEX_EDITOR_ROW_LENGTH, dataPosX, penPosY, pHexEditor->textColor, pHexEditor->bgColor, pSurface);
+
+        // Modified bytes and the search result are highlighted.
+        for (size_t iByte = 0; iByte < byteCount; ++iByte) {
+            dtk_uint64 offset = rowOffset + iByte;
+            if (pHexEditor->matchLength > 0 && offset >= pHexEditor->matchOffset && offset < pHexEditor->matchOffset + pHexEditor->matchLength) {
+                dred_hex_editor__draw_byte_cells(pHexEditor, rowText, iByte, penPosY, pHexEditor->matchBGColor, pSurface);
+            } else if ((modifiedMask & (1U << iByte)) != 0) {
+                dred_hex_editor__draw_byte_cells(pHexEditor, rowText, iByte, penPosY, pHexEditor->modifiedBGColor, pSurface);
+            }
+        }
+
+        if (isFocused && pHexEditor->cursorOffset >= rowOffset && pHexEditor->cursorOffset < rowOffset + byteCount) {
+            size_t iByte = (size_t)(pHexEditor->cursorOffset - rowOffset);
+
+            size_t cursorColumn;
+            if (pHexEditor->isCursorInASCIIPane) {
+                cursorColumn = DRED_HEX_EDITOR_ASCII_COLUMN + iByte;
+            } else {
+                cursorColumn = dred_hex_editor__get_hex_column(iByte) + (pHexEditor->isCursorOnLowNibble ? 1 : 0);
+            }
+
+            float cursorPosX = dataPosX + cursorColumn*charWidth;
+            float cursorWidth = pHexEditor->cursorWidth * dtk_control_get_scaling_factor(DTK_CONTROL(pHexEditor));
+            dred_control_draw_rect(pControl, dred_make_rect(cursorPosX, penPosY, cursorPosX + cursorWidth, penPosY + lineHeight), pHexEditor->cursorColor, pSurface);
+        }
+    }
+}
+
+
+// Stops the search that is in progress, if any.
+static void dred_hex_editor__end_find(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    if (pHexEditor->isFinding) {
+        dtk_timer_uninit(&pHexEditor->findTimer);
+        pHexEditor->isFinding = DTK_FALSE;
+    }
+
+    free(pHexEditor->pFindPattern);
+    pHexEditor->pFindPattern = NULL;
+    pHexEditor->findPatternLength = 0;
+
+    free(pHexEditor->pFindScratchBuffer);
+    pHexEditor->pFindScratchBuffer = NULL;
+}
+
+static void dred_hex_editor__close_file(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    // The search maps the file itself so it can't continue once the file is closed.
+    dred_hex_editor__end_find(pHexEditor);
+    dred_hex_editor__unmap_all_pages(pHexEditor);
+
+    if (pHexEditor->isFileOpen) {
+        dtk_mapped_file_close(&pHexEditor->file);
+        pHexEditor->isFileOpen = DTK_FALSE;
+    }
+}
+
+// Switches the editor over to the given file. The current file is left open if the new one can't be opened.
+static dtk_bool32 dred_hex_editor__reopen(dred_hex_editor* pHexEditor, const char* filePath)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dtk_mapped_file file;
+    if (dtk_mapped_file_open(filePath, DTK_FALSE, &file) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor__close_file(pHexEditor);
+    pHexEditor->file = file;
+    pHexEditor->isFileOpen = DTK_TRUE;
+
+    return DTK_TRUE;
+}
+
+// Called after the contents of the editor, including the overlay, have been written to filePath. The editor is switched over
+// to the new file and the overlay is discarded since the changes are now in the file. The undo stack is kept.
+static void dred_hex_editor__on_saved(dred_hex_editor* pHexEditor, const char* filePath)
+{
+    dtk_assert(pHexEditor != NULL);
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pHexEditor));
+
+    if (dred_hex_editor__reopen(pHexEditor, filePath)) {
+        dred_hex_editor__clear_overlay(pHexEditor);
+    } else {
+        // The overlay is kept so nothing is lost.
+        dred_warningf(pDred, "Failed to reopen %s after saving.", filePath);
+    }
+
+    pHexEditor->savedUndoIndex = pHexEditor->undoIndex;
+    dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+}
+
+// Writes the modified extents straight into the given file, one page at a time since extents can be arbitrarily big. The
+// bytes being overwritten are kept in ppOldData, which is allocated by this function, so that a failed write can be undone
+// with dred_hex_editor__rollback_extents(). Returns the number of bytes that were written before any failure.
+static dtk_uint64 dred_hex_editor__write_extents(dred_hex_editor* pHexEditor, dtk_mapped_file* pFile, dtk_uint8** ppOldData, dtk_bool32* pResult)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(pFile != NULL);
+    dtk_assert(ppOldData != NULL);
+    dtk_assert(pResult != NULL);
+
+    *pResult = DTK_TRUE;
+
+    size_t totalSize = 0;
+    for (int iExtent = 0; iExtent < stb_sb_count(pHexEditor->pExtents); ++iExtent) {
+        totalSize += pHexEditor->pExtents[iExtent].size;
+    }
+
+    *ppOldData = (dtk_uint8*)malloc(dtk_max(totalSize, 1));
+    if (*ppOldData == NULL) {
+        *pResult = DTK_FALSE;
+        return 0;
+    }
+
+    dtk_uint64 totalWritten = 0;
+    for (int iExtent = 0; iExtent < stb_sb_count(pHexEditor->pExtents); ++iExtent) {
+        const dred_hex_editor_extent* pExtent = &pHexEditor->pExtents[iExtent];
+        for (size_t written = 0; written < pExtent->size; ) {
+            size_t chunkSize = dtk_min(pExtent->size - written, DRED_HEX_EDITOR_PAGE_SIZE);
+
+            dtk_mapped_view view;
+            if (dtk_mapped_file_map(pFile, pExtent->offset + written, chunkSize, &view) != DTK_SUCCESS) {
+                *pResult = DTK_FALSE;
+                return totalWritten;
+            }
+            if (view.dataSize != chunkSize) {
+                dtk_mapped_file_unmap(pFile, &view);
+                *pResult = DTK_FALSE;
+                return totalWritten;
+            }
+
+            memcpy(*ppOldData + totalWritten, view.pData, chunkSize);
+            memcpy(view.pData, pExtent->pData + written, chunkSize);
+            totalWritten += chunkSize;
+
+            dtk_result flushResult = dtk_mapped_file_flush(pFile, &view);
+            dtk_mapped_file_unmap(pFile, &view);
+            if (flushResult != DTK_SUCCESS) {
+                *pResult = DTK_FALSE;
+                return totalWritten;
+            }
+
+            written += chunkSize;
+        }
+    }
+
+    return totalWritten;
+}
+
+// Restores the first byteCount bytes that were overwritten by dred_hex_editor__write_extents().
+static dtk_bool32 dred_hex_editor__rollback_extents(dred_hex_editor* pHexEditor, dtk_mapped_file* pFile, const dtk_uint8* pOldData, dtk_uint64 byteCount)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(pFile != NULL);
+
+    dtk_bool32 result = DTK_TRUE;
+    dtk_uint64 totalRestored = 0;
+    for (int iExtent = 0; iExtent < stb_sb_count(pHexEditor->pExtents) && totalRestored < byteCount; ++iExtent) {
+        const dred_hex_editor_extent* pExtent = &pHexEditor->pExtents[iExtent];
+        for (size_t restored = 0; restored < pExtent->size && totalRestored < byteCount; ) {
+            size_t chunkSize = (size_t)dtk_min(dtk_min(pExtent->size - restored, DRED_HEX_EDITOR_PAGE_SIZE), byteCount - totalRestored);
+
+            dtk_mapped_view view;
+            if (dtk_mapped_file_map(pFile, pExtent->offset + restored, chunkSize, &view) == DTK_SUCCESS) {
+                if (view.dataSize == chunkSize) {
+                    memcpy(view.pData, pOldData + totalRestored, chunkSize);
+                    if (dtk_mapped_file_flush(pFile, &view) != DTK_SUCCESS) {
+                        result = DTK_FALSE;
+                    }
+                } else {
+                    result = DTK_FALSE;
+                }
+                dtk_mapped_file_unmap(pFile, &view);
+            } else {
+                result = DTK_FALSE;
+            }
+
+            restored      += chunkSize;
+            totalRestored += chunkSize;
+        }
+    }
+
+    return result;
+}
+
+// Saves to the editor's own file. Only the modified extents are written, directly into the file at their offsets, so the
+// cost of a save depends only on how much was changed and not on the size of the file. The bytes being replaced are kept
+// in memory while writing so that if a write fails part way through, the parts that were already written can be put back
+// and the file is left as it was.
+static dtk_bool32 dred_hex_editor__on_save_in_place(dred_editor* pEditor)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pEditor);
+    assert(pHexEditor != NULL);
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pHexEditor));
+    const char* filePath = dred_editor_get_file_path(pEditor);
+    dtk_uint64 fileSize = pHexEditor->file.fileSize;
+
+    // The file is opened read-only without write sharing on Windows so it needs to be closed before it can be opened for
+    // writing. It's reopened read-only afterwards whether or not the save succeeds.
+    dred_hex_editor__close_file(pHexEditor);
+
+    dtk_mapped_file file;
+    if (dtk_mapped_file_open(filePath, DTK_TRUE, &file) != DTK_SUCCESS) {
+        dred_hex_editor__reopen(pHexEditor, filePath);
+        dred_errorf(pDred, "Failed to open %s for writing.", filePath);
+        return DTK_FALSE;
+    }
+
+    if (file.fileSize != fileSize) {
+        dtk_mapped_file_close(&file);
+        dred_hex_editor__reopen(pHexEditor, filePath);
+        dred_errorf(pDred, "%s has changed size since it was opened. Reload it before saving.", filePath);
+        return DTK_FALSE;
+    }
+
+    dtk_uint8* pOldData = NULL;
+    dtk_bool32 result;
+    dtk_uint64 bytesWritten = dred_hex_editor__write_extents(pHexEditor, &file, &pOldData, &result);
+    if (!result && bytesWritten > 0) {
+        if (!dred_hex_editor__rollback_extents(pHexEditor, &file, pOldData, bytesWritten)) {
+            dred_errorf(pDred, "Failed to restore %s after a failed save. The file may be partially written.", filePath);
+        }
+    }
+
+    free(pOldData);
+    dtk_mapped_file_close(&file);
+
+    if (!result) {
+        dred_hex_editor__reopen(pHexEditor, filePath);
+        dred_errorf(pDred, "Failed to write changes to %s.", filePath);
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor__on_saved(pHexEditor, filePath);
+    return DTK_TRUE;
+}
+
+// Saves to a different file. The whole file needs to be written.
+static dtk_bool32 dred_hex_editor__on_save(dred_editor* pEditor, dred_file file, const char* filePath)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pEditor);
+    assert(pHexEditor != NULL);
+
+    dtk_uint8* pBuffer = (dtk_uint8*)malloc(DRED_HEX_EDITOR_PAGE_SIZE);
+    if (pBuffer == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_bool32 result = DTK_TRUE;
+    for (dtk_uint64 offset = 0; offset < pHexEditor->file.fileSize; offset += DRED_HEX_EDITOR_PAGE_SIZE) {
+        size_t size = dred_hex_editor_read(pHexEditor, offset, pBuffer, DRED_HEX_EDITOR_PAGE_SIZE);
+        if (size == 0 || !dred_file_write(file, pBuffer, size, NULL)) {
+            result = DTK_FALSE;
+            break;
+        }
+    }
+
+    free(pBuffer);
+
+    if (!result) {
+        return DTK_FALSE;
+    }
+
+    // The editor is about to be switched over to the new file, so it needs to be remapped from there. Otherwise the next save
+    // in place would write the overlay to the new file and then show the pages of the old one.
+    dred_file_flush(file);
+    dred_hex_editor__on_saved(pHexEditor, filePath);
+
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_hex_editor__on_reload(dred_editor* pEditor)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pEditor);
+    assert(pHexEditor != NULL);
+
+    if (!dred_hex_editor__reopen(pHexEditor, dred_editor_get_file_path(pEditor))) {
+        return DTK_FALSE;
+    }
+
+    // Unsaved changes and the undo history are lost on reload, the same as with the text editor.
+    dred_hex_editor__clear_overlay(pHexEditor);
+    stb_sb_free(pHexEditor->pEdits);
+    pHexEditor->pEdits = NULL;
+    pHexEditor->undoIndex = 0;
+    pHexEditor->savedUndoIndex = 0;
+    pHexEditor->matchLength = 0;
+    dred_editor_unmark_as_modified(pEditor);
+
+    dred_hex_editor__refresh_scrollbar(pHexEditor);
+    dred_hex_editor__set_cursor(pHexEditor, pHexEditor->cursorOffset, DTK_FALSE);
+    dred_hex_editor__set_top_row(pHexEditor, pHexEditor->topRow);
+
+    return DTK_TRUE;
+}
+
+
+static dtk_bool32 dred_hex_editor_event_handler(dtk_event* pEvent)
+{
+    dred_hex_editor* pHexEditor = DRED_HEX_EDITOR(pEvent->pControl);
+
+    switch (pEvent->type)
+    {
+        case DTK_EVENT_REFRESH_LAYOUT:
+        {
+            dred_hex_editor__refresh_layout(pHexEditor);
+        } break;
+
+        default: break;
+    }
+
+    return dred_control_event_handler(pEvent);
+}
+
+dred_hex_editor* dred_hex_editor_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute)
+{
+    if (filePathAbsolute == NULL || filePathAbsolute[0] == '\0') {
+        return NULL;    // The hex editor can only be used with files on disk.
+    }
+
+    dred_hex_editor* pHexEditor = (dred_hex_editor*)calloc(1, sizeof(*pHexEditor));
+    if (pHexEditor == NULL) {
+        return NULL;
+    }
+
+    if (dtk_mapped_file_open(filePathAbsolute, DTK_FALSE, &pHexEditor->file) != DTK_SUCCESS) {
+        dred_errorf(pDred, "Failed to open file: %s", filePathAbsolute);
+        free(pHexEditor);
+        return NULL;
+    }
+
+    pHexEditor->isFileOpen = DTK_TRUE;
+
+    if (!dred_editor_init(DRED_EDITOR(pHexEditor), pDred, pParent, DRED_CONTROL_TYPE_HEX_EDITOR, dred_hex_editor_event_handler, sizeX, sizeY, filePathAbsolute)) {
+        dtk_mapped_file_close(&pHexEditor->file);
+        free(pHexEditor);
+        return NULL;
+    }
+
+    if (dtk_scrollbar_init(&pDred->tk, NULL, DTK_CONTROL(pHexEditor), dtk_scrollbar_orientation_vertical, &pHexEditor->vertScrollbar) != DTK_SUCCESS) {
+        dred_editor_uninit(DRED_EDITOR(pHexEditor));
+        dtk_mapped_file_close(&pHexEditor->file);
+        free(pHexEditor);
+        return NULL;
+    }
+
+    DTK_CONTROL(&pHexEditor->vertScrollbar)->pUserData = pHexEditor;
+    dtk_scrollbar_set_on_scroll(&pHexEditor->vertScrollbar, dred_hex_editor__on_vscroll);
+    pHexEditor->rowsPerScrollStep = 1;
+
+
+    // Events.
+    dred_control_set_on_size(DRED_CONTROL(pHexEditor), dred_hex_editor__on_size);
+    dred_control_set_on_mouse_wheel(DRED_CONTROL(pHexEditor), dred_hex_editor__on_mouse_wheel);
+    dred_control_set_on_mouse_button_down(DRED_CONTROL(pHexEditor), dred_hex_editor__on_mouse_button_down);
+    dred_control_set_on_key_down(DRED_CONTROL(pHexEditor), dred_hex_editor__on_key_down);
+    dred_control_set_on_printable_key_down(DRED_CONTROL(pHexEditor), dred_hex_editor__on_printable_key_down);
+    dred_control_set_on_capture_keyboard(DRED_CONTROL(pHexEditor), dred_hex_editor__on_capture_keyboard);
+    dred_control_set_on_release_keyboard(DRED_CONTROL(pHexEditor), dred_hex_editor__on_release_keyboard);
+    dred_control_set_on_paint(DRED_CONTROL(pHexEditor), dred_hex_editor__on_paint);
+
+    dred_editor_set_on_save(DRED_EDITOR(pHexEditor), dred_hex_editor__on_save);
+    dred_editor_set_on_save_in_place(DRED_EDITOR(pHexEditor), dred_hex_editor__on_save_in_place);
+    dred_editor_set_on_reload(DRED_EDITOR(pHexEditor), dred_hex_editor__on_reload);
+
+    dred_hex_editor_refresh_styling(pHexEditor);
+    dred_hex_editor__refresh_layout(pHexEditor);
+
+    return pHexEditor;
+}
+
+void dred_hex_editor_delete(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL) {
+        return;
+    }
+
+    dred_hex_editor__clear_overlay(pHexEditor);
+    stb_sb_free(pHexEditor->pEdits);
+
+    dred_hex_editor__close_file(pHexEditor);
+
+    dtk_scrollbar_uninit(&pHexEditor->vertScrollbar);
+    dred_editor_uninit(DRED_EDITOR(pHexEditor));
+    free(pHexEditor);
+}
+
+
+dtk_uint64 dred_hex_editor_get_file_size(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL) {
+        return 0;
+    }
+
+    return pHexEditor->file.fileSize;
+}
+
+size_t dred_hex_editor_get_memory_usage(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL) {
+        return 0;
+    }
+
+    size_t size = sizeof(*pHexEditor);
+    for (dtk_uint32 iPage = 0; iPage < DRED_HEX_EDITOR_PAGE_COUNT; ++iPage) {
+        if (pHexEditor->pages[iPage].view.pData != NULL) {
+            size += pHexEditor->pages[iPage].view.mappedSize;
+        }
+    }
+
+    for (size_t iExtent = 0; iExtent < (size_t)stb_sb_count(pHexEditor->pExtents); ++iExtent) {
+        size += sizeof(*pHexEditor->pExtents) + pHexEditor->pExtents[iExtent].capacity;
+    }
+
+    size += (size_t)stb_sb_count(pHexEditor->pEdits) * sizeof(*pHexEditor->pEdits);
+    return size;
+}
+
+dtk_uint64 dred_hex_editor_get_cursor_offset(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL) {
+        return 0;
+    }
+
+    return pHexEditor->cursorOffset;
+}
+
+size_t dred_hex_editor_read(dred_hex_editor* pHexEditor, dtk_uint64 offset, void* pDataOut, size_t size)
+{
+    if (pHexEditor == NULL || pDataOut == NULL || offset >= pHexEditor->file.fileSize) {
+        return 0;
+    }
+
+    if (size > pHexEditor->file.fileSize - offset) {
+        size = (size_t)(pHexEditor->file.fileSize - offset);
+    }
+
+    size_t bytesRead = 0;
+    while (bytesRead < size) {
+        dtk_uint64 runningOffset = offset + bytesRead;
+
+        size_t pageSize;
+        const dtk_uint8* pPage = dred_hex_editor__get_page(pHexEditor, runningOffset / DRED_HEX_EDITOR_PAGE_SIZE, &pageSize);
+        if (pPage == NULL) {
+            break;
+        }
+
+        size_t pageOffset = (size_t)(runningOffset % DRED_HEX_EDITOR_PAGE_SIZE);
+        size_t chunkSize = dtk_min(size - bytesRead, pageSize - pageOffset);
+        memcpy((dtk_uint8*)pDataOut + bytesRead, pPage + pageOffset, chunkSize);
+        bytesRead += chunkSize;
+    }
+
+    dred_hex_editor__apply_overlay(pHexEditor, offset, (dtk_uint8*)pDataOut, bytesRead, NULL);
+    return bytesRead;
+}
+
+dtk_bool32 dred_hex_editor_set_byte(dred_hex_editor* pHexEditor, dtk_uint64 offset, dtk_uint8 value)
+{
+    if (pHexEditor == NULL || offset >= pHexEditor->file.fileSize) {
+        return DTK_FALSE;
+    }
+
+    if (dred_editor_is_read_only(DRED_EDITOR(pHexEditor))) {
+        dred_cmdbar_set_message(&dred_control_get_context(DRED_CONTROL(pHexEditor))->cmdBar, "File is read only.");
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor_edit edit;
+    edit.offset = offset;
+    edit.newValue = value;
+    if (dred_hex_editor_read(pHexEditor, offset, &edit.oldValue, 1) != 1) {
+        return DTK_FALSE;
+    }
+
+    if (edit.oldValue == edit.newValue) {
+        return DTK_TRUE;
+    }
+
+    if (!dred_hex_editor__set_byte_no_undo(pHexEditor, offset, value)) {
+        return DTK_FALSE;
+    }
+
+    // Making an edit discards anything that was undone. If the saved state was amongst the discarded edits it can never be
+    // returned to.
+    if (pHexEditor->pEdits != NULL) {
+        stb__sbn(pHexEditor->pEdits) = (int)pHexEditor->undoIndex;
+    }
+    if (pHexEditor->savedUndoIndex > pHexEditor->undoIndex) {
+        pHexEditor->savedUndoIndex = (size_t)-1;
+    }
+
+    stb_sb_push(pHexEditor->pEdits, edit);
+    pHexEditor->undoIndex += 1;
+
+    dred_hex_editor__refresh_modified_state(pHexEditor);
+    dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+    return DTK_TRUE;
+}
+
+
+void dred_hex_editor_scroll_rows(dred_hex_editor* pHexEditor, dtk_int64 rowCount)
+{
+    if (pHexEditor == NULL || rowCount == 0) {
+        return;
+    }
+
+    dtk_uint64 topRow = pHexEditor->topRow;
+    if (rowCount < 0) {
+        topRow = ((dtk_uint64)-rowCount > topRow) ? 0 : topRow - (dtk_uint64)-rowCount;
+    } else {
+        topRow = topRow + (dtk_uint64)rowCount;
+    }
+
+    dred_hex_editor__set_top_row(pHexEditor, topRow);
+}
+
+void dred_hex_editor_goto_offset(dred_hex_editor* pHexEditor, dtk_uint64 offset)
+{
+    if (pHexEditor == NULL) {
+        return;
+    }
+
+    dred_hex_editor__set_cursor(pHexEditor, offset, DTK_FALSE);
+}
+
+void dred_hex_editor_goto_ratio(dred_hex_editor* pHexEditor, unsigned int ratio)
+{
+    if (pHexEditor == NULL || pHexEditor->file.fileSize == 0) {
+        return;
+    }
+
+    if (ratio > 100) {
+        ratio = 100;
+    }
+
+    dred_hex_editor_goto_offset(pHexEditor, (dtk_uint64)(((double)ratio / 100.0) * (double)pHexEditor->file.fileSize));
+}
+
+// Parses a search query into the bytes to search for. See dred_hex_editor_find_next().
+static size_t dred_hex_editor__parse_pattern(const char* query, dtk_uint8* pPatternOut, size_t patternCap)
+{
+    size_t patternLength = 0;
+    dtk_bool32 isHex = DTK_TRUE;
+
+    const char* pRunning = query;
+    while (*pRunning != '\0' && isHex) {
+        if (*pRunning == ' ') {
+            pRunning += 1;
+            continue;
+        }
+
+        unsigned int hi;
+        unsigned int lo;
+        if (!dtk_hex_char_to_uint(pRunning[0], &hi) || !dtk_hex_char_to_uint(pRunning[1], &lo) || patternLength == patternCap) {
+            isHex = DTK_FALSE;
+            break;
+        }
+
+        pPatternOut[patternLength++] = (dtk_uint8)((hi << 4) | lo);
+        pRunning += 2;
+    }
+
+    if (isHex && patternLength > 0) {
+        return patternLength;
+    }
+
+    patternLength = strlen(query);
+    if (patternLength > patternCap) {
+        return 0;
+    }
+
+    memcpy(pPatternOut, query, patternLength);
+    return patternLength;
+}
+
+// Searches for a pattern that starts within the given range. Returns DRED_HEX_EDITOR_NOT_FOUND if it could not be found.
+static dtk_uint64 dred_hex_editor__find(dred_hex_editor* pHexEditor, const dtk_uint8* pPattern, size_t patternLength, dtk_uint64 offsetBeg, dtk_uint64 offsetEnd, dtk_uint8** ppScratchBuffer)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(patternLength > 0 && patternLength <= DRED_HEX_EDITOR_MAX_PATTERN_LENGTH);
+
+    while (offsetBeg < offsetEnd) {
+        dtk_mapped_view view;
+        if (dtk_mapped_file_map(&pHexEditor->file, offsetBeg, DRED_HEX_EDITOR_SEARCH_WINDOW_SIZE, &view) != DTK_SUCCESS) {
+            break;
+        }
+
+        // Unmodified windows are searched directly from the mapping. Modified ones need to be copied out so the overlay can
+        // be applied.
+        const dtk_uint8* pData = view.pData;
+        if (dred_hex_editor__is_range_modified(pHexEditor, view.offset, view.dataSize)) {
+            if (*ppScratchBuffer == NULL) {
+                *ppScratchBuffer = (dtk_uint8*)malloc(DRED_HEX_EDITOR_SEARCH_WINDOW_SIZE);
+                if (*ppScratchBuffer == NULL) {
+                    dtk_mapped_file_unmap(&pHexEditor->file, &view);
+                    break;
+                }
+            }
+
+            memcpy(*ppScratchBuffer, view.pData, view.dataSize);
+            dred_hex_editor__apply_overlay(pHexEditor, view.offset, *ppScratchBuffer, view.dataSize, NULL);
+            pData = *ppScratchBuffer;
+        }
+
+        // Only matches that start in this window and fit entirely within it are checked here. Ones that cross into the next
+        // window are found when searching that window since windows overlap by the length of the pattern.
+        size_t searchLength = (view.dataSize >= patternLength) ? view.dataSize - patternLength + 1 : 0;
+        if (searchLength > offsetEnd - offsetBeg) {
+            searchLength = (size_t)(offsetEnd - offsetBeg);
+        }
+
+        const dtk_uint8* pRunning = pData;
+        const dtk_uint8* pEnd = pData + searchLength;
+        while (pRunning < pEnd) {
+            const dtk_uint8* pCandidate = (const dtk_uint8*)memchr(pRunning, pPattern[0], (size_t)(pEnd - pRunning));
+            if (pCandidate == NULL) {
+                break;
+            }
+
+            if (memcmp(pCandidate, pPattern, patternLength) == 0) {
+                dtk_uint64 matchOffset = view.offset + (dtk_uint64)(pCandidate - pData);
+                dtk_mapped_file_unmap(&pHexEditor->file, &view);
+                return matchOffset;
+            }
+
+            pRunning = pCandidate + 1;
+        }
+
+        dtk_bool32 isAtEnd = view.offset + view.dataSize >= pHexEditor->file.fileSize;
+        dtk_mapped_file_unmap(&pHexEditor->file, &view);
+
+        if (isAtEnd || searchLength == 0) {
+            break;
+        }
+
+        offsetBeg += searchLength;
+    }
+
+    return DRED_HEX_EDITOR_NOT_FOUND;
+}
+
+// Searches the next chunk of the search that is in progress. Returns DTK_TRUE when the search is finished, in which case
+// matchLength will be 0 if the pattern was not found.
+static dtk_bool32 dred_hex_editor__find_chunk(dred_hex_editor* pHexEditor)
+{
+    dtk_assert(pHexEditor != NULL);
+    dtk_assert(pHexEditor->pFindPattern != NULL);
+
+    dtk_uint64 offsetEnd = (pHexEditor->hasFindWrapped) ? pHexEditor->findStartOffset : pHexEditor->file.fileSize;
+    dtk_uint64 chunkEnd = offsetEnd;
+    if (chunkEnd - pHexEditor->findOffset > DRED_HEX_EDITOR_FIND_CHUNK_SIZE) {
+        chunkEnd = pHexEditor->findOffset + DRED_HEX_EDITOR_FIND_CHUNK_SIZE;
+    }
+
+    // Matches are allowed to start in this chunk and end in the next one.
+    dtk_uint64 matchOffset = dred_hex_editor__find(pHexEditor, pHexEditor->pFindPattern, pHexEditor->findPatternLength, pHexEditor->findOffset, chunkEnd, &pHexEditor->pFindScratchBuffer);
+    if (matchOffset != DRED_HEX_EDITOR_NOT_FOUND) {
+        pHexEditor->matchOffset = matchOffset;
+        pHexEditor->matchLength = pHexEditor->findPatternLength;
+        dred_hex_editor__set_cursor(pHexEditor, matchOffset, DTK_FALSE);
+        return DTK_TRUE;
+    }
+
+    pHexEditor->findOffset = chunkEnd;
+    if (pHexEditor->findOffset == offsetEnd) {
+        if (pHexEditor->hasFindWrapped || pHexEditor->findStartOffset == 0) {
+            pHexEditor->matchLength = 0;
+            dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+            return DTK_TRUE;
+        }
+
+        pHexEditor->hasFindWrapped = DTK_TRUE;
+        pHexEditor->findOffset = 0;
+    }
+
+    return DTK_FALSE;
+}
+
+static void dred_hex_editor__on_find_timer(dtk_timer* pTimer, void* pUserData)
+{
+    (void)pTimer;
+
+    dred_hex_editor* pHexEditor = (dred_hex_editor*)pUserData;
+    dtk_assert(pHexEditor != NULL);
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pHexEditor));
+
+    if (!dred_hex_editor__find_chunk(pHexEditor)) {
+        if (pDred != NULL) {
+            dtk_uint64 searchedSize = pHexEditor->findOffset - pHexEditor->findStartOffset;
+            if (pHexEditor->hasFindWrapped) {
+                searchedSize = (pHexEditor->file.fileSize - pHexEditor->findStartOffset) + pHexEditor->findOffset;
+            }
+
+            char message[64];
+            snprintf(message, sizeof(message), "Searching... %u%%", (unsigned int)((searchedSize * 100) / dtk_max(pHexEditor->file.fileSize, 1)));
+            dred_cmdbar_set_message(&pDred->cmdBar, message);
+        }
+
+        return;
+    }
+
+    dred_hex_editor__end_find(pHexEditor);
+
+    if (pDred != NULL) {
+        if (pHexEditor->matchLength == 0) {
+            dred_cmdbar_set_message(&pDred->cmdBar, "No results found.");
+        } else {
+            dred_cmdbar_clear_message(&pDred->cmdBar);
+        }
+    }
+}
+
+dtk_bool32 dred_hex_editor_find_next(dred_hex_editor* pHexEditor, const char* query)
+{
+    if (pHexEditor == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor__end_find(pHexEditor);
+
+    if (query == NULL || query[0] == '\0' || !pHexEditor->isFileOpen) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint8 pattern[DRED_HEX_EDITOR_MAX_PATTERN_LENGTH];
+    size_t patternLength = dred_hex_editor__parse_pattern(query, pattern, sizeof(pattern));
+    if (patternLength == 0) {
+        return DTK_FALSE;
+    }
+
+    // The search starts from just after the previous result if the cursor is still on it, or the cursor otherwise.
+    dtk_uint64 startOffset = pHexEditor->cursorOffset;
+    if (pHexEditor->matchLength > 0 && pHexEditor->matchOffset == pHexEditor->cursorOffset) {
+        startOffset = pHexEditor->matchOffset + 1;
+    }
+    if (startOffset > pHexEditor->file.fileSize) {
+        startOffset = pHexEditor->file.fileSize;
+    }
+
+    pHexEditor->pFindPattern = (dtk_uint8*)malloc(patternLength);
+    if (pHexEditor->pFindPattern == NULL) {
+        return DTK_FALSE;
+    }
+
+    memcpy(pHexEditor->pFindPattern, pattern, patternLength);
+    pHexEditor->findPatternLength = patternLength;
+    pHexEditor->findStartOffset   = startOffset;
+    pHexEditor->findOffset        = startOffset;
+    pHexEditor->hasFindWrapped    = DTK_FALSE;
+
+    // Results near the cursor are the common case so the first chunk is searched straight away.
+    if (!dred_hex_editor__find_chunk(pHexEditor)) {
+        if (dtk_timer_init(DTK_CONTROL(pHexEditor)->pTK, 1, dred_hex_editor__on_find_timer, pHexEditor, &pHexEditor->findTimer) == DTK_SUCCESS) {
+            pHexEditor->isFinding = DTK_TRUE;
+            return DTK_TRUE;
+        }
+
+        // If the timer couldn't be created we have no choice but to search the rest of the file now.
+        while (!dred_hex_editor__find_chunk(pHexEditor)) {
+        }
+    }
+
+    dred_hex_editor__end_find(pHexEditor);
+    return pHexEditor->matchLength > 0;
+}
+
+
+dtk_bool32 dred_hex_editor_undo(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL || pHexEditor->undoIndex == 0) {
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor_edit edit = pHexEditor->pEdits[pHexEditor->undoIndex - 1];
+    if (!dred_hex_editor__set_byte_no_undo(pHexEditor, edit.offset, edit.oldValue)) {
+        return DTK_FALSE;
+    }
+
+    pHexEditor->undoIndex -= 1;
+
+    dred_hex_editor__refresh_modified_state(pHexEditor);
+    dred_hex_editor__set_cursor(pHexEditor, edit.offset, DTK_FALSE);
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_hex_editor_redo(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL || pHexEditor->undoIndex == (size_t)stb_sb_count(pHexEditor->pEdits)) {
+        return DTK_FALSE;
+    }
+
+    dred_hex_editor_edit edit = pHexEditor->pEdits[pHexEditor->undoIndex];
+    if (!dred_hex_editor__set_byte_no_undo(pHexEditor, edit.offset, edit.newValue)) {
+        return DTK_FALSE;
+    }
+
+    pHexEditor->undoIndex += 1;
+
+    dred_hex_editor__refresh_modified_state(pHexEditor);
+    dred_hex_editor__set_cursor(pHexEditor, edit.offset, DTK_FALSE);
+    return DTK_TRUE;
+}
+
+
+void dred_hex_editor_refresh_styling(dred_hex_editor* pHexEditor)
+{
+    if (pHexEditor == NULL) {
+        return;
+    }
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pHexEditor));
+    if (pDred == NULL) {
+        return;
+    }
+
+    pHexEditor->pFont           = &pDred->config.pTextEditorFont->fontDTK;
+    pHexEditor->textScale       = pDred->config.textEditorScale;
+    pHexEditor->textColor       = pDred->config.textEditorTextColor;
+    pHexEditor->bgColor         = pDred->config.textEditorBGColor;
+    pHexEditor->offsetColor     = pDred->config.textEditorLineNumbersColor;
+    pHexEditor->offsetBGColor   = pDred->config.textEditorLineNumbersBGColor;
+    pHexEditor->offsetPadding   = pDred->config.textEditorLineNumbersPadding;
+    pHexEditor->cursorColor     = pDred->config.textEditorCursorColor;
+    pHexEditor->cursorWidth     = pDred->config.textEditorCursorWidth;
+    pHexEditor->matchBGColor    = pDred->config.textEditorSelectionBGColor;
+    pHexEditor->modifiedBGColor = pDred->config.textEditorActiveLineColor;
+
+    dtk_scrollbar_set_track_color(&pHexEditor->vertScrollbar, pDred->config.textEditorSBTrackColor);
+    dtk_scrollbar_set_default_thumb_color(&pHexEditor->vertScrollbar, pDred->config.textEditorSBThumbColor);
+    dtk_scrollbar_set_hovered_thumb_color(&pHexEditor->vertScrollbar, pDred->config.textEditorSBThumbColorHovered);
+    dtk_scrollbar_set_pressed_thumb_color(&pHexEditor->vertScrollbar, pDred->config.textEditorSBThumbColorPressed);
+
+    dred_hex_editor__refresh_layout(pHexEditor);
+    dred_control_dirty(DRED_CONTROL(pHexEditor), dred_control_get_local_rect(DRED_CONTROL(pHexEditor)));
+}
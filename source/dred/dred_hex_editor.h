@@ -1 +1,185 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The hex editor is used for binary files. Like the large file viewer, the file is never loaded in it's entirety. Instead it
+// is accessed through a small cache of memory mapped pages of DRED_HEX_EDITOR_PAGE_SIZE bytes each. Only the least recently
+// used page is unmapped when a new one is needed, so scrolling around one part of the file doesn't cause any remapping, and
+// the amount of mapped memory never goes above DRED_HEX_EDITOR_PAGE_COUNT pages no matter how big the file is.
+//
+// Changes are not made to the mapped pages. They are instead stored in a sparse overlay which is a sorted list of modified
+// byte ranges. When the file is read, the overlay is applied on top of the data from the pages. Saving over the original writes
+// only the modified ranges, directly into the file at their offsets, rather than rewriting the whole file from the overlay.
+//
+// Editing is in overwrite mode only - the size of the file never changes.
+
+#define DRED_CONTROL_TYPE_HEX_EDITOR  "dred.editor.hex"
+
+typedef struct dred_hex_editor dred_hex_editor;
+#define DRED_HEX_EDITOR(a) ((dred_hex_editor*)(a))
+
+// The size of each page that is mapped into memory. This must be a multiple of DRED_HEX_EDITOR_BYTES_PER_ROW so that rows
+// never straddle pages.
+#define DRED_HEX_EDITOR_PAGE_SIZE       (1024 * 1024)
+
+// The maximum number of pages that are mapped at any given time.
+#define DRED_HEX_EDITOR_PAGE_COUNT      16
+
+// The number of bytes shown on each row.
+#define DRED_HEX_EDITOR_BYTES_PER_ROW   16
+
+// The number of bytes at the start of a file that are inspected when determining whether or not it's binary.
+#define DRED_HEX_EDITOR_SNIFF_SIZE      8192
+
+// The number of bytes that are searched at a time. Searching is done in chunks between events so that searching a big file
+// never stalls the UI.
+#define DRED_HEX_EDITOR_FIND_CHUNK_SIZE (32 * 1024 * 1024)
+
+typedef struct
+{
+    dtk_mapped_view view;       // view.pData is null when the slot is not in use.
+    dtk_uint64 pageIndex;
+    dtk_uint64 lastUsed;        // The value of the editor's page clock when the page was last accessed.
+} dred_hex_editor_page;
+
+typedef struct
+{
+    dtk_uint64 offset;
+    size_t size;
+    size_t capacity;
+    dtk_uint8* pData;
+} dred_hex_editor_extent;
+
+typedef struct
+{
+    dtk_uint64 offset;
+    dtk_uint8 oldValue;
+    dtk_uint8 newValue;
+} dred_hex_editor_edit;
+
+struct dred_hex_editor
+{
+    // The base editor.
+    dred_editor editor;
+
+    // The vertical scrollbar. For files with more rows than the scrollbar can represent, each scroll step covers multiple rows.
+    dtk_scrollbar vertScrollbar;
+    dtk_uint64 rowsPerScrollStep;
+
+    // The file being edited. This is opened read-only. Saving closes it, writes the modified ranges through a writable
+    // mapping and then reopens it. isFileOpen is only false if reopening failed.
+    dtk_mapped_file file;
+    dtk_bool32 isFileOpen;
+
+    // The page cache.
+    dred_hex_editor_page pages[DRED_HEX_EDITOR_PAGE_COUNT];
+    dtk_uint64 pageClock;
+
+    // The modifications that have not yet been saved, sorted by offset. Extents never overlap or touch - adjacent extents
+    // are merged. This is an stb_stretchy_buffer object.
+    dred_hex_editor_extent* pExtents;
+
+    // The undo stack. Edits at and after undoIndex have been undone and are available for redo. This is an stb_stretchy_buffer
+    // object.
+    dred_hex_editor_edit* pEdits;
+    size_t undoIndex;
+    size_t savedUndoIndex;      // The value of undoIndex when the file was last saved. Used for tracking the modified state.
+
+    // The first visible row.
+    dtk_uint64 topRow;
+
+    // The cursor. When in the hex pane, isCursorOnLowNibble controls which half of the byte is overwritten next.
+    dtk_uint64 cursorOffset;
+    dtk_bool32 isCursorOnLowNibble;
+    dtk_bool32 isCursorInASCIIPane;
+
+    // The range of the last search result. matchLength is set to 0 when there is no result.
+    dtk_uint64 matchOffset;
+    size_t matchLength;
+
+    // The search that is in progress, if any. The search runs from findStartOffset to the end of the file and then wraps
+    // around to the start. findOffset is where the next chunk starts.
+    dtk_timer findTimer;
+    dtk_bool32 isFinding;
+    dtk_uint8* pFindPattern;
+    size_t findPatternLength;
+    dtk_uint64 findStartOffset;
+    dtk_uint64 findOffset;
+    dtk_bool32 hasFindWrapped;
+    dtk_uint8* pFindScratchBuffer;  // Used for applying the overlay to modified parts of the file while searching.
+
+
+    // Styling.
+    dtk_font* pFont;
+    float textScale;
+    dtk_color textColor;
+    dtk_color bgColor;
+    dtk_color offsetColor;
+    dtk_color offsetBGColor;
+    float offsetPadding;
+    dtk_color cursorColor;
+    float cursorWidth;
+    dtk_color matchBGColor;
+    dtk_color modifiedBGColor;
+};
+
+
+// Determines whether or not the file at the given path looks like a binary file and should be opened with the hex editor.
+dtk_bool32 dred_hex_editor_should_open(const char* filePath);
+
+// dred_hex_editor_create()
+dred_hex_editor* dred_hex_editor_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute);
+
+// dred_hex_editor_delete()
+void dred_hex_editor_delete(dred_hex_editor* pHexEditor);
+
+
+// Retrieves the size of the file.
+dtk_uint64 dred_hex_editor_get_file_size(dred_hex_editor* pHexEditor);
+
+// Retrieves an estimate of the amount of memory being used by the editor, in bytes. Mapped pages are counted at their full
+// size even though the operating system may not have all of them resident.
+size_t dred_hex_editor_get_memory_usage(dred_hex_editor* pHexEditor);
+
+// Retrieves the offset of the byte under the cursor.
+dtk_uint64 dred_hex_editor_get_cursor_offset(dred_hex_editor* pHexEditor);
+
+// Reads a range of bytes with any unsaved changes applied. Returns the number of bytes read, which will be less than the
+// requested size if the end of the file is reached.
+size_t dred_hex_editor_read(dred_hex_editor* pHexEditor, dtk_uint64 offset, void* pDataOut, size_t size);
+
+// Overwrites the byte at the given offset. This is undoable.
+dtk_bool32 dred_hex_editor_set_byte(dred_hex_editor* pHexEditor, dtk_uint64 offset, dtk_uint8 value);
+
+
+// Scrolls the editor by the given number of rows. Negative values scroll up.
+void dred_hex_editor_scroll_rows(dred_hex_editor* pHexEditor, dtk_int64 rowCount);
+
+// Moves the cursor to the given offset and scrolls it into view.
+void dred_hex_editor_goto_offset(dred_hex_editor* pHexEditor, dtk_uint64 offset);
+
+// Moves the cursor to the given ratio of the file, in percent.
+void dred_hex_editor_goto_ratio(dred_hex_editor* pHexEditor, unsigned int ratio);
+
+// Finds the next occurance of the given pattern, starting from just after the previous result or the cursor, and moves
+// the cursor to it. The search wraps around to the start of the file.
+//
+// If the query is made up only of pairs of hex digits, optionally separated by spaces ("7f 45 4c 46"), it's treated as a
+// sequence of bytes. Otherwise the query is searched for as text.
+//
+// Only the first DRED_HEX_EDITOR_FIND_CHUNK_SIZE bytes are searched straight away. If the pattern is not found in that
+// range the rest of the file is searched in the background, one chunk at a time, with progress shown in the command bar.
+// Starting another search, saving, reloading or closing the editor cancels it.
+//
+// Returns DTK_FALSE if the search finished without finding the pattern. If the search is continuing in the background
+// DTK_TRUE is returned, and "No results found." is shown in the command bar if it turns out there are none.
+dtk_bool32 dred_hex_editor_find_next(dred_hex_editor* pHexEditor, const char* query);
+
+
+// Undoes the last edit.
+dtk_bool32 dred_hex_editor_undo(dred_hex_editor* pHexEditor);
+
+// Redoes the last undone edit.
+dtk_bool32 dred_hex_editor_redo(dred_hex_editor* pHexEditor);
+
+
+// Refreshes the styling of the given hex editor.
+void dred_hex_editor_refresh_styling(dred_hex_editor* pHexEditor);
@@ -1,21 +1,55 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
-dtk_bool32 dred_image_library_init__stock_images(dred_image_library* pLibrary)
+// NOTE: Order is important. SVGs come first, then raster images. The reason is the order in which IDs are generated by the code generation tool.
+void dred_image_library__decode_stock_svgs(dred_image_library* pLibrary)
 {
     assert(pLibrary != NULL);
 
-    // NOTE: Order is important. SVGs come first, then raster images. The reason is the order in which IDs are generated by the code generation tool.
-    dtk_uint32 runningIndex = 0;
-
-    // SVG images.
+    // This is run from a worker thread so it must not touch the toolkit. That's why the DPI scale is retrieved beforehand.
     for (dtk_uint32 i = 0; i < DRED_STOCK_IMAGE_COUNT_SVG; ++i) {
-        if (dtk_image_init_svg(&pLibrary->pDred->tk, g_StockImagesSVG[i].pSVGData, &pLibrary->pStockImages[runningIndex]) != DTK_SUCCESS) {
-            dtk_zero_object(&pLibrary->pStockImages[runningIndex]);    // Failed to initialize the image. Zero it out. TODO: Replace this with a default fallback.
+        if (dtk_image_init_svg_with_dpi_scale(&pLibrary->pDred->tk, g_StockImagesSVG[i].pSVGData, pLibrary->stockImageDPIScale, &pLibrary->pStockImages[i]) != DTK_SUCCESS) {
+            dtk_zero_object(&pLibrary->pStockImages[i]);    // Failed to initialize the image. Zero it out. TODO: Replace this with a default fallback.
         }
+    }
+}
 
-        runningIndex += 1;
+dtk_thread_result DTK_THREADCALL dred_image_library__stock_svg_thread_proc(void* pData)
+{
+    dred_image_library* pLibrary = (dred_image_library*)pData;
+    assert(pLibrary != NULL);
+
+    dred_image_library__decode_stock_svgs(pLibrary);
+    return 0;
+}
+
+void dred_image_library__wait_for_stock_svgs(dred_image_library* pLibrary)
+{
+    assert(pLibrary != NULL);
+
+    if (pLibrary->areStockSVGsLoaded) {
+        return;
+    }
+
+    // If the worker thread was never started we just decode them now. This is the case when an image is needed before the
+    // first paint.
+    if (pLibrary->isStockSVGThreadRunning) {
+        dtk_thread_wait(&pLibrary->stockSVGThread);
+        pLibrary->isStockSVGThreadRunning = DTK_FALSE;
+    } else {
+        dred_image_library__decode_stock_svgs(pLibrary);
     }
 
+    pLibrary->areStockSVGsLoaded = DTK_TRUE;
+}
+
+dtk_bool32 dred_image_library_init__stock_images(dred_image_library* pLibrary)
+{
+    assert(pLibrary != NULL);
+
+    // SVG images are not decoded here. They're done on a worker thread after the first paint with dred_image_library_load_stock_images_async().
+    pLibrary->stockImageDPIScale = dtk_get_system_dpi_scale(&pLibrary->pDred->tk);
+    dtk_uint32 runningIndex = DRED_STOCK_IMAGE_COUNT_SVG;
+
     // Raster images.
     for (dtk_uint32 i = 0; i < DRED_STOCK_IMAGE_COUNT_RASTER; ++i) {
         if (dtk_image_init_raster(&pLibrary->pDred->tk, g_StockImagesRaster[i].width, g_StockImagesRaster[i].height, g_StockImagesRaster[i].width*4, g_StockImagesRaster[i].pImageData, &pLibrary->pStockImages[runningIndex]) != DTK_SUCCESS) {
@@ -39,6 +73,8 @@ dtk_bool32 dred_image_library_init(dred_image_library* pLibrary, dred_context* p
     pLibrary->imageBufferSize = 0;
     pLibrary->imageCount = 0;
     pLibrary->pImages = NULL;
+    pLibrary->isStockSVGThreadRunning = DTK_FALSE;
+    pLibrary->areStockSVGsLoaded = DTK_FALSE;
 
     return dred_image_library_init__stock_images(pLibrary);
 }
@@ -49,6 +85,12 @@ void dred_image_library_uninit(dred_image_library* pLibrary)
         return;
     }
 
+    // The worker thread may still be running.
+    if (pLibrary->isStockSVGThreadRunning) {
+        dtk_thread_wait(&pLibrary->stockSVGThread);
+        pLibrary->isStockSVGThreadRunning = DTK_FALSE;
+    }
+
 #if 0
     while (pLibrary->imageCount > 0) {
         dred_image_library__delete_image_for_real(pLibrary, pLibrary->pImages[pLibrary->imageCount-1]);
@@ -89,6 +131,20 @@ void dred_image_library_delete_image(dred_image_library* pLibrary, dred_image* p
 #endif
 
 
+void dred_image_library_load_stock_images_async(dred_image_library* pLibrary)
+{
+    if (pLibrary == NULL || pLibrary->areStockSVGsLoaded || pLibrary->isStockSVGThreadRunning) {
+        return;
+    }
+
+    if (dtk_thread_create(&pLibrary->stockSVGThread, dred_image_library__stock_svg_thread_proc, pLibrary) == DTK_SUCCESS) {
+        pLibrary->isStockSVGThreadRunning = DTK_TRUE;
+    } else {
+        dred_image_library__wait_for_stock_svgs(pLibrary);  // Failed to create the thread. Fall back to loading synchronously.
+    }
+}
+
+
 dtk_image* dred_image_library_get_image_by_id(dred_image_library* pLibrary, unsigned int id)
 {
     if (pLibrary == NULL) {
@@ -101,6 +157,10 @@ dtk_image* dred_image_library_get_image_by_id(dred_image_library* pLibrary, unsi
     }
 
     if (id-DTK_STOCK_IMAGE_COUNT < DRED_STOCK_IMAGE_COUNT) {
+        if (id-DTK_STOCK_IMAGE_COUNT < DRED_STOCK_IMAGE_COUNT_SVG) {
+            dred_image_library__wait_for_stock_svgs(pLibrary);
+        }
+
         return &pLibrary->pStockImages[id-DTK_STOCK_IMAGE_COUNT];
     }
 
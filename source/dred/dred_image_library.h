@@ -19,6 +19,12 @@ struct dred_image_library
     dred_context* pDred;
     dtk_image pStockImages[DRED_STOCK_IMAGE_COUNT];
 
+    // Stock SVG images are decoded on a worker thread. Everything here is only accessed from the main thread.
+    float stockImageDPIScale;
+    dtk_thread stockSVGThread;
+    dtk_bool32 isStockSVGThreadRunning;
+    dtk_bool32 areStockSVGsLoaded;
+
     size_t imageBufferSize;
     size_t imageCount;
     dred_image_library_item* pImages;
@@ -30,6 +36,11 @@ dtk_bool32 dred_image_library_init(dred_image_library* pLibrary, dred_context* p
 // Uninitializes the given image library.
 void dred_image_library_uninit(dred_image_library* pLibrary);
 
+// Starts decoding the stock SVG images on a worker thread. None of them are needed to show the main window so this is called
+// after the first paint. If a stock SVG image is retrieved before the worker has finished, dred_image_library_get_image_by_id()
+// will wait for it.
+void dred_image_library_load_stock_images_async(dred_image_library* pLibrary);
+
 
 // Creates an image, or returns a reference to an already-loaded one.
 //
@@ -2,9 +2,7 @@
 
 dtk_bool32 dred_ipc_post_message(dtk_pipe clientPipe, uint32_t message, const void* pData, size_t dataSize)
 {
-    size_t messageSize = sizeof(dred_ipc_message_header) + dataSize;
-    uint8_t* pMessageData = (uint8_t*)malloc(messageSize);
-    if (pMessageData == NULL) {
+    if (dataSize > DRED_IPC_MAX_MESSAGE_SIZE - sizeof(dred_ipc_message_header)) {
         return DTK_FALSE;
     }
 
@@ -13,25 +11,21 @@ dtk_bool32 dred_ipc_post_message(dtk_pipe clientPipe, uint32_t message, const vo
     header.message = message;
     header.size = (uint32_t)dataSize;
 
+    // The header and the data must go out in a single write so that the write is atomic. See DRED_IPC_MAX_MESSAGE_SIZE.
+    uint8_t pMessageData[DRED_IPC_MAX_MESSAGE_SIZE];
     memcpy(pMessageData, &header, sizeof(header));
-    
     if (dataSize > 0) {
         memcpy(pMessageData + sizeof(header), pData, dataSize);
     }
 
     size_t bytesWritten;
-    dtk_result result = dtk_pipe_write(clientPipe, pMessageData, messageSize, &bytesWritten);
-
-    free(pMessageData);
-    return result == DTK_SUCCESS && bytesWritten == messageSize;
+    dtk_result result = dtk_pipe_write(clientPipe, pMessageData, sizeof(header) + dataSize, &bytesWritten);
+    return result == DTK_SUCCESS && bytesWritten == sizeof(header) + dataSize;
 }
 
-dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* pHeaderOut, void** ppDataOut)
+dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* pHeaderOut, void** ppBuffer, size_t* pBufferCap)
 {
-    if (ppDataOut == NULL) return DTK_FALSE;
-    *ppDataOut = NULL;
-
-    if (pHeaderOut == NULL) {
+    if (pHeaderOut == NULL || ppBuffer == NULL || pBufferCap == NULL) {
         return DTK_FALSE;
     }
 
@@ -42,7 +36,7 @@ dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* p
         return DTK_FALSE;
     }
 
-    if (pHeaderOut->magic != DRED_IPC_MAGIC_NUMBER) {
+    if (pHeaderOut->magic != DRED_IPC_MAGIC_NUMBER || pHeaderOut->size > DRED_IPC_MAX_MESSAGE_SIZE - sizeof(*pHeaderOut)) {
         return DTK_FALSE;
     }
 
@@ -50,16 +44,18 @@ dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* p
         return DTK_TRUE;
     }
 
-    void* pData = malloc(pHeaderOut->size);
-    if (pData == NULL) {
-        return DTK_FALSE;
-    }
+    if (pHeaderOut->size > *pBufferCap) {
+        void* pNewBuffer = realloc(*ppBuffer, pHeaderOut->size);
+        if (pNewBuffer == NULL) {
+            return DTK_FALSE;
+        }
 
-    *ppDataOut = pData;
+        *ppBuffer = pNewBuffer;
+        *pBufferCap = pHeaderOut->size;
+    }
 
-    result = dtk_pipe_read_exact(serverPipe, pData, pHeaderOut->size, &bytesRead);
+    result = dtk_pipe_read_exact(serverPipe, *ppBuffer, pHeaderOut->size, &bytesRead);
     if (result != DTK_SUCCESS) {
-        free(pData);
         return DTK_FALSE;
     }
 
@@ -3,9 +3,25 @@
 #define DRED_IPC_MESSAGE_TERMINATOR     DRED_EVENT_IPC_TERMINATOR
 #define DRED_IPC_MESSAGE_ACTIVATE       DRED_EVENT_IPC_ACTIVATE
 #define DRED_IPC_MESSAGE_OPEN           DRED_EVENT_IPC_OPEN
+#define DRED_IPC_MESSAGE_OPEN_FILES     DRED_EVENT_IPC_OPEN_FILES   // The data is a list of null terminated file paths, back to back.
 
 #define DRED_IPC_MAGIC_NUMBER       0x2F8A572D
 
+// When shutting down, the IPC thread is stopped by connecting to it and posting a terminator. These control how many times
+// connecting is attempted, and the number of milliseconds to wait between attempts.
+#define DRED_IPC_SHUTDOWN_CONNECT_ATTEMPTS  200
+#define DRED_IPC_SHUTDOWN_CONNECT_INTERVAL  10
+
+// The maximum size of a message, including the header. On *nix platforms every client writes to the same FIFO, and only
+// writes of up to PIPE_BUF bytes are guaranteed to be atomic. Keeping each message within a single write of that size means
+// messages from different clients can never be interleaved, and a client that dies can never leave half a message behind.
+// Bigger messages are rejected by both ends.
+#if defined(PIPE_BUF) && PIPE_BUF < 4096
+#define DRED_IPC_MAX_MESSAGE_SIZE   PIPE_BUF
+#else
+#define DRED_IPC_MAX_MESSAGE_SIZE   4096
+#endif
+
 #pragma pack(4)
 typedef struct
 {
@@ -15,13 +31,19 @@ typedef struct
 } dred_ipc_message_header;
 #pragma pack()
 
+// Posts a message to the server. The message is written in a single write.
+//
+// Returns DTK_FALSE if the message, including the header, is bigger than DRED_IPC_MAX_MESSAGE_SIZE.
 dtk_bool32 dred_ipc_post_message(dtk_pipe clientPipe, uint32_t message, const void* pData, size_t dataSize);
 
-// Free the returned data with free().
+// Reads the next message from the pipe.
+//
+// The data is read into *ppBuffer which is grown as required, with the capacity stored in *pBufferCap. The same buffer
+// should be passed to each call so that it can be reused between messages. Free it with free() when no longer needed.
 //
-// If the size of the data is 0, the returned pointer will be null. Do not use the returned pointer for
-// error checking. Use the return value for error checking.
-dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* pHeaderOut, void** ppDataOut);
+// If the size of the data is 0, the buffer is left unchanged. Do not use the buffer for error checking. Use the return
+// value for error checking.
+dtk_bool32 dred_ipc_read_message(dtk_pipe serverPipe, dred_ipc_message_header* pHeaderOut, void** ppBuffer, size_t* pBufferCap);
 
 
 // Retrieves the name to use for the IPC pipe. This will be namespaced based on the username of the current user.
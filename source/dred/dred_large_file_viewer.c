@@ -0,0 +1,1028 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The scroll range of the vertical scrollbar. The scroll position maps to a byte offset in the file.
+#define DRED_LARGE_FILE_VIEWER_SCROLL_RANGE (1 << 24)
+
+#define DRED_LARGE_FILE_VIEWER_NOT_FOUND    ((dtk_uint64)-1)
+
+dtk_bool32 dred_large_file_viewer_should_open(const char* filePath)
+{
+    if (filePath == NULL || filePath[0] == '\0') {
+        return DTK_FALSE;
+    }
+
+    dtk_mapped_file file;
+    if (dtk_mapped_file_open(filePath, DTK_FALSE, &file) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    dtk_bool32 result = file.fileSize >= DRED_LARGE_FILE_VIEWER_THRESHOLD || file.fileSize > SIZE_MAX;
+    dtk_mapped_file_close(&file);
+
+    return result;
+}
+
+
+// Makes sure the byte at the given offset is mapped. When "backwards" is set, the window will be positioned such that
+// the offset is at the end of the window which is more efficient for backwards scans.
+static dtk_bool32 dred_large_file_viewer__map(dred_large_file_viewer* pViewer, dtk_uint64 offset, dtk_bool32 backwards)
+{
+    dtk_assert(pViewer != NULL);
+
+    if (offset >= pViewer->file.fileSize) {
+        return DTK_FALSE;
+    }
+
+    if (pViewer->window.pData != NULL && offset >= pViewer->window.offset && offset < pViewer->window.offset + pViewer->window.dataSize) {
+        return DTK_TRUE;
+    }
+
+    dtk_mapped_file_unmap(&pViewer->file, &pViewer->window);
+
+    // A bit of data before the offset is also mapped so that scrolling up a few lines doesn't require a remap.
+    dtk_uint64 windowOffset;
+    if (backwards) {
+        windowOffset = (offset + 1 > DRED_LARGE_FILE_VIEWER_WINDOW_SIZE) ? (offset + 1 - DRED_LARGE_FILE_VIEWER_WINDOW_SIZE) : 0;
+    } else {
+        windowOffset = (offset > DRED_LARGE_FILE_VIEWER_WINDOW_SIZE/4) ? (offset - DRED_LARGE_FILE_VIEWER_WINDOW_SIZE/4) : 0;
+    }
+
+    return dtk_mapped_file_map(&pViewer->file, windowOffset, DRED_LARGE_FILE_VIEWER_WINDOW_SIZE, &pViewer->window) == DTK_SUCCESS;
+}
+
+// Retrieves a pointer to the data at the given offset. The number of bytes returned in pSizeOut may be less than the
+// requested size if the end of the file is reached.
+static const dtk_uint8* dred_large_file_viewer__get_data(dred_large_file_viewer* pViewer, dtk_uint64 offset, size_t size, size_t* pSizeOut)
+{
+    dtk_assert(pViewer != NULL);
+    dtk_assert(pSizeOut != NULL);
+    dtk_assert(size <= DRED_LARGE_FILE_VIEWER_WINDOW_SIZE/2);
+
+    *pSizeOut = 0;
+
+    if (offset >= pViewer->file.fileSize) {
+        return NULL;
+    }
+
+    if (size > pViewer->file.fileSize - offset) {
+        size = (size_t)(pViewer->file.fileSize - offset);
+    }
+
+    // The whole range needs to be mapped. If the end of the range is outside of the window we'll need a remap.
+    if (!dred_large_file_viewer__map(pViewer, offset, DTK_FALSE)) {
+        return NULL;
+    }
+
+    if (offset + size > pViewer->window.offset + pViewer->window.dataSize) {
+        dtk_mapped_file_unmap(&pViewer->file, &pViewer->window);
+        if (!dred_large_file_viewer__map(pViewer, offset, DTK_FALSE)) {
+            return NULL;
+        }
+    }
+
+    *pSizeOut = size;
+    return pViewer->window.pData + (size_t)(offset - pViewer->window.offset);
+}
+
+// Finds the first occurance of the given byte at or after the given offset and before offsetEnd. Returns
+// DRED_LARGE_FILE_VIEWER_NOT_FOUND if it could not be found.
+static dtk_uint64 dred_large_file_viewer__find_byte_forward(dred_large_file_viewer* pViewer, dtk_uint64 offset, dtk_uint64 offsetEnd, dtk_uint8 c)
+{
+    dtk_assert(pViewer != NULL);
+
+    if (offsetEnd > pViewer->file.fileSize) {
+        offsetEnd = pViewer->file.fileSize;
+    }
+
+    while (offset < offsetEnd) {
+        if (!dred_large_file_viewer__map(pViewer, offset, DTK_FALSE)) {
+            break;
+        }
+
+        size_t localOffset = (size_t)(offset - pViewer->window.offset);
+        size_t available = pViewer->window.dataSize - localOffset;
+        if (available > offsetEnd - offset) {
+            available = (size_t)(offsetEnd - offset);
+        }
+
+        const dtk_uint8* pBeg = pViewer->window.pData + localOffset;
+        const dtk_uint8* pFound = (const dtk_uint8*)memchr(pBeg, c, available);
+        if (pFound != NULL) {
+            return offset + (dtk_uint64)(pFound - pBeg);
+        }
+
+        offset += available;
+    }
+
+    return DRED_LARGE_FILE_VIEWER_NOT_FOUND;
+}
+
+// Finds the last occurance of the given byte before the given offset. Returns DRED_LARGE_FILE_VIEWER_NOT_FOUND if it could
+// not be found.
+static dtk_uint64 dred_large_file_viewer__find_byte_backward(dred_large_file_viewer* pViewer, dtk_uint64 offset, dtk_uint8 c)
+{
+    dtk_assert(pViewer != NULL);
+
+    while (offset > 0) {
+        if (!dred_large_file_viewer__map(pViewer, offset - 1, DTK_TRUE)) {
+            break;
+        }
+
+        size_t i = (size_t)(offset - pViewer->window.offset);
+        while (i > 0) {
+            i -= 1;
+            if (pViewer->window.pData[i] == c) {
+                return pViewer->window.offset + i;
+            }
+        }
+
+        offset = pViewer->window.offset;
+    }
+
+    return DRED_LARGE_FILE_VIEWER_NOT_FOUND;
+}
+
+// Counts the number of new-line characters in the given range.
+static dtk_uint64 dred_large_file_viewer__count_lines(dred_large_file_viewer* pViewer, dtk_uint64 offsetBeg, dtk_uint64 offsetEnd)
+{
+    dtk_assert(pViewer != NULL);
+
+    dtk_uint64 count = 0;
+    for (;;) {
+        dtk_uint64 newLineOffset = dred_large_file_viewer__find_byte_forward(pViewer, offsetBeg, offsetEnd, '\n');
+        if (newLineOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND || newLineOffset >= offsetEnd) {
+            break;
+        }
+
+        count += 1;
+        offsetBeg = newLineOffset + 1;
+    }
+
+    return count;
+}
+
+// Retrieves the offset of the start of the line containing the given offset.
+static dtk_uint64 dred_large_file_viewer__get_line_start(dred_large_file_viewer* pViewer, dtk_uint64 offset)
+{
+    dtk_uint64 newLineOffset = dred_large_file_viewer__find_byte_backward(pViewer, offset, '\n');
+    if (newLineOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND) {
+        return 0;
+    }
+
+    return newLineOffset + 1;
+}
+
+// Retrieves the offset of the start of the next line. Returns DRED_LARGE_FILE_VIEWER_NOT_FOUND if the line at the given
+// offset is the last one.
+static dtk_uint64 dred_large_file_viewer__get_next_line_start(dred_large_file_viewer* pViewer, dtk_uint64 offset)
+{
+    dtk_uint64 newLineOffset = dred_large_file_viewer__find_byte_forward(pViewer, offset, pViewer->file.fileSize, '\n');
+    if (newLineOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND) {
+        return DRED_LARGE_FILE_VIEWER_NOT_FOUND;
+    }
+
+    return newLineOffset + 1;
+}
+
+
+// The entry point for the thread that builds the sparse line index. This uses it's own mapping of the file so it does not
+// need to synchronize access to the viewer's window.
+static dtk_thread_result DTK_THREADCALL dred_large_file_viewer__index_thread_proc(void* pData)
+{
+    dred_large_file_viewer* pViewer = (dred_large_file_viewer*)pData;
+    dtk_assert(pViewer != NULL);
+
+    dtk_mapped_file file;
+    if (dtk_mapped_file_open(dred_editor_get_file_path(DRED_EDITOR(pViewer)), DTK_FALSE, &file) != DTK_SUCCESS) {
+        return 0;
+    }
+
+    // Checkpoints are batched so we're not constantly locking the mutex.
+    dtk_uint64 pendingCheckpoints[256];
+    size_t pendingCheckpointCount = 0;
+    pendingCheckpoints[pendingCheckpointCount++] = 0;   // The first line always starts at offset 0.
+
+    dtk_uint64 lineCount = 0;
+    dtk_uint64 offset = 0;
+    while (offset < file.fileSize && !pViewer->isIndexCancelled) {
+        dtk_mapped_view view;
+        if (dtk_mapped_file_map(&file, offset, DRED_LARGE_FILE_VIEWER_WINDOW_SIZE, &view) != DTK_SUCCESS) {
+            break;
+        }
+
+        const dtk_uint8* pBeg = view.pData;
+        const dtk_uint8* pEnd = view.pData + view.dataSize;
+        const dtk_uint8* pRunning = pBeg;
+        for (;;) {
+            const dtk_uint8* pNewLine = (const dtk_uint8*)memchr(pRunning, '\n', (size_t)(pEnd - pRunning));
+            if (pNewLine == NULL) {
+                break;
+            }
+
+            lineCount += 1;
+            if ((lineCount % DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT) == 0) {
+                pendingCheckpoints[pendingCheckpointCount++] = offset + (dtk_uint64)(pNewLine - pBeg) + 1;
+                if (pendingCheckpointCount == dtk_count_of(pendingCheckpoints)) {
+                    break;
+                }
+            }
+
+            pRunning = pNewLine + 1;
+        }
+
+        // If the batch of checkpoints was filled we need to resume from just after the last new-line character.
+        dtk_uint64 nextOffset = offset + view.dataSize;
+        if (pendingCheckpointCount == dtk_count_of(pendingCheckpoints)) {
+            nextOffset = pendingCheckpoints[pendingCheckpointCount-1];
+        }
+
+        dtk_mapped_file_unmap(&file, &view);
+
+
+        if (pendingCheckpointCount > 0) {
+            dtk_mutex_lock(&pViewer->indexLock);
+            {
+                if (pViewer->checkpointCount + pendingCheckpointCount > pViewer->checkpointCapacity) {
+                    size_t newCapacity = (pViewer->checkpointCapacity == 0) ? 1024 : pViewer->checkpointCapacity*2;
+                    while (newCapacity < pViewer->checkpointCount + pendingCheckpointCount) {
+                        newCapacity *= 2;
+                    }
+
+                    dtk_uint64* pNewCheckpoints = (dtk_uint64*)realloc(pViewer->pCheckpoints, newCapacity * sizeof(*pNewCheckpoints));
+                    if (pNewCheckpoints == NULL) {
+                        dtk_mutex_unlock(&pViewer->indexLock);
+                        break;  // Out of memory. The index will remain incomplete.
+                    }
+
+                    pViewer->pCheckpoints = pNewCheckpoints;
+                    pViewer->checkpointCapacity = newCapacity;
+                }
+
+                memcpy(pViewer->pCheckpoints + pViewer->checkpointCount, pendingCheckpoints, pendingCheckpointCount * sizeof(*pendingCheckpoints));
+                pViewer->checkpointCount += pendingCheckpointCount;
+            }
+            dtk_mutex_unlock(&pViewer->indexLock);
+
+            pendingCheckpointCount = 0;
+        }
+
+        offset = nextOffset;
+    }
+
+    if (offset >= file.fileSize && pendingCheckpointCount == 0) {
+        dtk_mutex_lock(&pViewer->indexLock);
+        {
+            pViewer->totalLineCount = lineCount + 1;
+            pViewer->isIndexComplete = DTK_TRUE;
+        }
+        dtk_mutex_unlock(&pViewer->indexLock);
+    }
+
+    dtk_mapped_file_close(&file);
+    return 0;
+}
+
+// Attempts to resolve the line index of the top line from the line index.
+static void dred_large_file_viewer__resolve_top_line_index(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    if (pViewer->isTopLineIndexKnown) {
+        return;
+    }
+
+    dtk_bool32 found = DTK_FALSE;
+    size_t iCheckpoint = 0;
+    dtk_uint64 checkpointOffset = 0;
+
+    dtk_mutex_lock(&pViewer->indexLock);
+    {
+        // Binary search for the last checkpoint at or before the top line.
+        size_t lo = 0;
+        size_t hi = pViewer->checkpointCount;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo)/2;
+            if (pViewer->pCheckpoints[mid] <= pViewer->topLineOffset) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        // We can only use the checkpoint if the index has moved past the top line. Otherwise there's no way to know how
+        // far we'd need to scan.
+        if (lo > 0 && (lo < pViewer->checkpointCount || pViewer->isIndexComplete)) {
+            iCheckpoint = lo - 1;
+            checkpointOffset = pViewer->pCheckpoints[iCheckpoint];
+            found = DTK_TRUE;
+        }
+    }
+    dtk_mutex_unlock(&pViewer->indexLock);
+
+    if (found) {
+        pViewer->topLineIndex = ((dtk_uint64)iCheckpoint * DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT) + dred_large_file_viewer__count_lines(pViewer, checkpointOffset, pViewer->topLineOffset);
+        pViewer->isTopLineIndexKnown = DTK_TRUE;
+    }
+}
+
+
+static float dred_large_file_viewer__get_scrollbar_width(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pViewer));
+    return pDred->config.textEditorSBSize * dtk_control_get_scaling_factor(DTK_CONTROL(pViewer));
+}
+
+static dtk_int32 dred_large_file_viewer__get_line_height(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    dtk_font_metrics metrics;
+    if (dtk_font_get_metrics(pViewer->pFont, pViewer->textScale * dtk_control_get_scaling_factor(DTK_CONTROL(pViewer)), &metrics) != DTK_SUCCESS || metrics.lineHeight <= 0) {
+        return 1;
+    }
+
+    return metrics.lineHeight;
+}
+
+static dtk_uint32 dred_large_file_viewer__get_visible_line_count(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    return (dtk_uint32)(dred_control_get_height(DRED_CONTROL(pViewer)) / dred_large_file_viewer__get_line_height(pViewer)) + 1;
+}
+
+static void dred_large_file_viewer__refresh_scrollbar(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    dtk_int32 scrollPos = 0;
+    if (pViewer->file.fileSize > 0) {
+        scrollPos = (dtk_int32)(((double)pViewer->topLineOffset / (double)pViewer->file.fileSize) * DRED_LARGE_FILE_VIEWER_SCROLL_RANGE);
+    }
+
+    dtk_scrollbar_set_scroll_position(&pViewer->vertScrollbar, scrollPos);
+}
+
+static void dred_large_file_viewer__set_top_line_offset(dred_large_file_viewer* pViewer, dtk_uint64 offset)
+{
+    dtk_assert(pViewer != NULL);
+
+    if (pViewer->topLineOffset != offset) {
+        pViewer->topLineOffset = offset;
+        pViewer->isTopLineIndexKnown = DTK_FALSE;
+    }
+
+    dred_large_file_viewer__refresh_scrollbar(pViewer);
+    dred_control_dirty(DRED_CONTROL(pViewer), dred_control_get_local_rect(DRED_CONTROL(pViewer)));
+}
+
+static void dred_large_file_viewer__on_vscroll(dtk_scrollbar* pScrollbar, dtk_int32 scrollPos)
+{
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(DTK_CONTROL(pScrollbar)->pUserData);
+    if (pViewer == NULL) {
+        return;
+    }
+
+    dtk_uint64 offset = (dtk_uint64)(((double)scrollPos / DRED_LARGE_FILE_VIEWER_SCROLL_RANGE) * (double)pViewer->file.fileSize);
+    if (offset >= pViewer->file.fileSize) {
+        offset = (pViewer->file.fileSize > 0) ? pViewer->file.fileSize - 1 : 0;
+    }
+
+    pViewer->topLineOffset = dred_large_file_viewer__get_line_start(pViewer, offset);
+    pViewer->isTopLineIndexKnown = DTK_FALSE;
+    dred_control_dirty(DRED_CONTROL(pViewer), dred_control_get_local_rect(DRED_CONTROL(pViewer)));
+}
+
+
+static void dred_large_file_viewer__refresh_layout(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    float scrollbarWidth = dred_large_file_viewer__get_scrollbar_width(pViewer);
+
+    dtk_control_set_size(DTK_CONTROL(&pViewer->vertScrollbar), (dtk_int32)scrollbarWidth, (dtk_int32)dred_control_get_height(DRED_CONTROL(pViewer)));
+    dtk_control_set_relative_position(DTK_CONTROL(&pViewer->vertScrollbar), (dtk_int32)(dred_control_get_width(DRED_CONTROL(pViewer)) - scrollbarWidth), 0);
+}
+
+static void dred_large_file_viewer__on_size(dred_control* pControl, float newWidth, float newHeight)
+{
+    (void)newWidth;
+    (void)newHeight;
+
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(pControl);
+    assert(pViewer != NULL);
+
+    dred_large_file_viewer__refresh_layout(pViewer);
+}
+
+static void dred_large_file_viewer__on_mouse_wheel(dred_control* pControl, int delta, int relativeMousePosX, int relativeMousePosY, int stateFlags)
+{
+    (void)relativeMousePosX;
+    (void)relativeMousePosY;
+    (void)stateFlags;
+
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(pControl);
+    assert(pViewer != NULL);
+
+    dred_large_file_viewer_scroll_lines(pViewer, -delta * 3);
+}
+
+static void dred_large_file_viewer__on_key_down(dred_control* pControl, dtk_key key, int stateFlags)
+{
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(pControl);
+    assert(pViewer != NULL);
+
+    dtk_int32 pageLineCount = (dtk_int32)dred_large_file_viewer__get_visible_line_count(pViewer) - 1;
+    if (pageLineCount < 1) {
+        pageLineCount = 1;
+    }
+
+    switch (key)
+    {
+        case DTK_KEY_ARROW_UP:   dred_large_file_viewer_scroll_lines(pViewer, -1); break;
+        case DTK_KEY_ARROW_DOWN: dred_large_file_viewer_scroll_lines(pViewer,  1); break;
+        case DTK_KEY_PAGE_UP:    dred_large_file_viewer_scroll_lines(pViewer, -pageLineCount); break;
+        case DTK_KEY_PAGE_DOWN:  dred_large_file_viewer_scroll_lines(pViewer,  pageLineCount); break;
+
+        case DTK_KEY_HOME:
+        {
+            if (stateFlags & DTK_MODIFIER_CTRL) {
+                dred_large_file_viewer_goto_ratio(pViewer, 0);
+            }
+        } break;
+
+        case DTK_KEY_END:
+        {
+            if (stateFlags & DTK_MODIFIER_CTRL) {
+                dred_large_file_viewer_goto_ratio(pViewer, 100);
+            }
+        } break;
+
+        default: break;
+    }
+}
+
+static void dred_large_file_viewer__on_capture_keyboard(dred_control* pControl, dtk_control* pPrevCapturedControl)
+{
+    (void)pControl;
+    (void)pPrevCapturedControl;
+}
+
+// Converts a line of raw file data into something that can be drawn. Tabs are expanded and control characters are replaced
+// with spaces. The range of the search result, if any, is converted to the equivalent range in the output.
+static size_t dred_large_file_viewer__prepare_line_for_display(dred_large_file_viewer* pViewer, const dtk_uint8* pLine, size_t lineLength, size_t matchBeg, size_t matchEnd, char* pOut, size_t outCap, size_t* pMatchBegOut, size_t* pMatchEndOut)
+{
+    dtk_assert(pViewer != NULL);
+
+    size_t outLength = 0;
+    size_t column = 0;
+    for (size_t i = 0; i < lineLength; ++i) {
+        if (i == matchBeg) *pMatchBegOut = outLength;
+        if (i == matchEnd) *pMatchEndOut = outLength;
+
+        dtk_uint8 c = pLine[i];
+        if (c == '\t') {
+            size_t spaceCount = (pViewer->tabSizeInSpaces > 0) ? pViewer->tabSizeInSpaces - (column % pViewer->tabSizeInSpaces) : 1;
+            while (spaceCount > 0 && outLength < outCap) {
+                pOut[outLength++] = ' ';
+                column += 1;
+                spaceCount -= 1;
+            }
+        } else {
+            if (outLength == outCap) {
+                break;
+            }
+
+            pOut[outLength++] = (c < 32) ? ' ' : (char)c;
+            if ((c & 0xC0) != 0x80) {
+                column += 1;    // Only count the lead byte of UTF-8 sequences.
+            }
+        }
+    }
+
+    if (matchEnd >= lineLength && *pMatchBegOut != (size_t)-1) {
+        *pMatchEndOut = outLength;
+    }
+
+    return outLength;
+}
+
+static void dred_large_file_viewer__on_paint(dred_control* pControl, dred_rect rect, dtk_surface* pSurface)
+{
+    (void)rect;
+
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(pControl);
+    assert(pViewer != NULL);
+
+    float scale = pViewer->textScale * dtk_control_get_scaling_factor(DTK_CONTROL(pViewer));
+    dtk_int32 lineHeight = dred_large_file_viewer__get_line_height(pViewer);
+    dtk_uint32 visibleLineCount = dred_large_file_viewer__get_visible_line_count(pViewer);
+
+    float viewWidth  = dred_control_get_width(DRED_CONTROL(pViewer)) - dred_large_file_viewer__get_scrollbar_width(pViewer);
+    float viewHeight = dred_control_get_height(DRED_CONTROL(pViewer));
+
+    // Line numbers are only shown when we know the index of the top line.
+    float textPosX = 0;
+    if (pViewer->showLineNumbers) {
+        dred_large_file_viewer__resolve_top_line_index(pViewer);
+        if (pViewer->isTopLineIndexKnown) {
+            char lastLineNumberStr[32];
+            snprintf(lastLineNumberStr, sizeof(lastLineNumberStr), "%llu", (unsigned long long)(pViewer->topLineIndex + visibleLineCount));
+
+            dtk_int32 lastLineNumberWidth;
+            dtk_font_measure_string(pViewer->pFont, scale, lastLineNumberStr, strlen(lastLineNumberStr), &lastLineNumberWidth, NULL);
+
+            textPosX = lastLineNumberWidth + (pViewer->lineNumbersPadding * dtk_control_get_scaling_factor(DTK_CONTROL(pViewer)) * 2);
+            dred_control_draw_rect(pControl, dred_make_rect(0, 0, textPosX, viewHeight), pViewer->lineNumbersBGColor, pSurface);
+        }
+    }
+
+    dred_control_draw_rect(pControl, dred_make_rect(textPosX, 0, viewWidth, viewHeight), pViewer->bgColor, pSurface);
+
+    char displayText[DRED_LARGE_FILE_VIEWER_MAX_DISPLAY_LENGTH];
+    dtk_uint64 lineOffset = pViewer->topLineOffset;
+    for (dtk_uint32 iLine = 0; iLine < visibleLineCount && lineOffset != DRED_LARGE_FILE_VIEWER_NOT_FOUND; ++iLine) {
+        float penPosY = (float)(iLine * lineHeight);
+
+        if (textPosX > 0) {
+            char lineNumberStr[32];
+            snprintf(lineNumberStr, sizeof(lineNumberStr), "%llu", (unsigned long long)(pViewer->topLineIndex + iLine + 1));
+            dred_control_draw_text(pControl, pViewer->pFont, scale, lineNumberStr, (int)strlen(lineNumberStr), pViewer->lineNumbersPadding * dtk_control_get_scaling_factor(DTK_CONTROL(pViewer)), penPosY, pViewer->lineNumbersColor, pViewer->lineNumbersBGColor, pSurface);
+        }
+
+        size_t dataSize;
+        const dtk_uint8* pData = dred_large_file_viewer__get_data(pViewer, lineOffset, DRED_LARGE_FILE_VIEWER_MAX_DISPLAY_LENGTH, &dataSize);
+        if (pData == NULL) {
+            break;
+        }
+
+        size_t lineLength = dataSize;
+        const dtk_uint8* pNewLine = (const dtk_uint8*)memchr(pData, '\n', dataSize);
+        if (pNewLine != NULL) {
+            lineLength = (size_t)(pNewLine - pData);
+        } else if (lineOffset + dataSize < pViewer->file.fileSize) {
+            // The line is being truncated. Make sure we don't split a UTF-8 sequence by dropping any trailing sequence.
+            size_t i = lineLength;
+            while (i > 0 && (pData[i-1] & 0xC0) == 0x80) {
+                i -= 1;
+            }
+            if (i > 0 && pData[i-1] >= 0xC0) {
+                lineLength = i-1;
+            }
+        }
+
+        // Check if the search result is on this line.
+        size_t matchBeg = (size_t)-1;
+        size_t matchEnd = (size_t)-1;
+        if (pViewer->matchLength > 0 && pViewer->matchOffset >= lineOffset && pViewer->matchOffset < lineOffset + lineLength) {
+            matchBeg = (size_t)(pViewer->matchOffset - lineOffset);
+            matchEnd = matchBeg + pViewer->matchLength;
+        }
+
+        size_t displayMatchBeg = (size_t)-1;
+        size_t displayMatchEnd = (size_t)-1;
+        size_t displayLength = dred_large_file_viewer__prepare_line_for_display(pViewer, pData, lineLength, matchBeg, matchEnd, displayText, sizeof(displayText), &displayMatchBeg, &displayMatchEnd);
+        if (displayLength > 0) {
+            dred_control_draw_text(pControl, pViewer->pFont, scale, displayText, (int)displayLength, textPosX, penPosY, pViewer->textColor, pViewer->bgColor, pSurface);
+
+            if (displayMatchBeg != (size_t)-1 && displayMatchEnd != (size_t)-1 && displayMatchEnd > displayMatchBeg) {
+                dtk_int32 matchPosX;
+                dtk_font_measure_string(pViewer->pFont, scale, displayText, displayMatchBeg, &matchPosX, NULL);
+                dred_control_draw_text(pControl, pViewer->pFont, scale, displayText + displayMatchBeg, (int)(displayMatchEnd - displayMatchBeg), textPosX + matchPosX, penPosY, pViewer->textColor, pViewer->matchBGColor, pSurface);
+            }
+        }
+
+        lineOffset = dred_large_file_viewer__get_next_line_start(pViewer, lineOffset);
+    }
+}
+
+
+static dtk_bool32 dred_large_file_viewer_event_handler(dtk_event* pEvent)
+{
+    dred_large_file_viewer* pViewer = DRED_LARGE_FILE_VIEWER(pEvent->pControl);
+
+    switch (pEvent->type)
+    {
+        case DTK_EVENT_REFRESH_LAYOUT:
+        {
+            dred_large_file_viewer__refresh_layout(pViewer);
+        } break;
+
+        default: break;
+    }
+
+    return dred_control_event_handler(pEvent);
+}
+
+dred_large_file_viewer* dred_large_file_viewer_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute)
+{
+    if (filePathAbsolute == NULL || filePathAbsolute[0] == '\0') {
+        return NULL;    // The viewer can only be used with files on disk.
+    }
+
+    dred_large_file_viewer* pViewer = (dred_large_file_viewer*)calloc(1, sizeof(*pViewer));
+    if (pViewer == NULL) {
+        return NULL;
+    }
+
+    if (dtk_mapped_file_open(filePathAbsolute, DTK_FALSE, &pViewer->file) != DTK_SUCCESS) {
+        dred_errorf(pDred, "Failed to open file: %s", filePathAbsolute);
+        free(pViewer);
+        return NULL;
+    }
+
+    if (!dred_editor_init(DRED_EDITOR(pViewer), pDred, pParent, DRED_CONTROL_TYPE_LARGE_FILE_VIEWER, dred_large_file_viewer_event_handler, sizeX, sizeY, filePathAbsolute)) {
+        dtk_mapped_file_close(&pViewer->file);
+        free(pViewer);
+        return NULL;
+    }
+
+    // The viewer never writes to the file.
+    DRED_EDITOR(pViewer)->isReadOnly = DTK_TRUE;
+
+    if (dtk_scrollbar_init(&pDred->tk, NULL, DTK_CONTROL(pViewer), dtk_scrollbar_orientation_vertical, &pViewer->vertScrollbar) != DTK_SUCCESS) {
+        dred_editor_uninit(DRED_EDITOR(pViewer));
+        dtk_mapped_file_close(&pViewer->file);
+        free(pViewer);
+        return NULL;
+    }
+
+    DTK_CONTROL(&pViewer->vertScrollbar)->pUserData = pViewer;
+    dtk_scrollbar_set_range_and_page_size(&pViewer->vertScrollbar, 0, DRED_LARGE_FILE_VIEWER_SCROLL_RANGE-1, 1);
+    dtk_scrollbar_set_on_scroll(&pViewer->vertScrollbar, dred_large_file_viewer__on_vscroll);
+
+
+    // The line index is built in the background.
+    if (dtk_mutex_init(&pViewer->indexLock) == DTK_SUCCESS) {
+        if (dtk_thread_create(&pViewer->indexThread, dred_large_file_viewer__index_thread_proc, pViewer) == DTK_SUCCESS) {
+            pViewer->isIndexThreadRunning = DTK_TRUE;
+        } else {
+            dred_warningf(pDred, "Failed to start line indexing for %s. Line numbers will be unavailable.\n", filePathAbsolute);
+        }
+    }
+
+
+    // Events.
+    dred_control_set_on_size(DRED_CONTROL(pViewer), dred_large_file_viewer__on_size);
+    dred_control_set_on_mouse_wheel(DRED_CONTROL(pViewer), dred_large_file_viewer__on_mouse_wheel);
+    dred_control_set_on_key_down(DRED_CONTROL(pViewer), dred_large_file_viewer__on_key_down);
+    dred_control_set_on_capture_keyboard(DRED_CONTROL(pViewer), dred_large_file_viewer__on_capture_keyboard);
+    dred_control_set_on_paint(DRED_CONTROL(pViewer), dred_large_file_viewer__on_paint);
+
+    dred_large_file_viewer_refresh_styling(pViewer);
+    dred_large_file_viewer__refresh_layout(pViewer);
+
+    return pViewer;
+}
+
+// Stops the search that is in progress, if any.
+static void dred_large_file_viewer__end_find(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+
+    if (pViewer->isFinding) {
+        dtk_timer_uninit(&pViewer->findTimer);
+        pViewer->isFinding = DTK_FALSE;
+    }
+
+    dtk_free_string(pViewer->findText);
+    pViewer->findText = NULL;
+}
+
+void dred_large_file_viewer_delete(dred_large_file_viewer* pViewer)
+{
+    if (pViewer == NULL) {
+        return;
+    }
+
+    dred_large_file_viewer__end_find(pViewer);
+
+    // The indexing thread needs to be stopped before anything else.
+    if (pViewer->isIndexThreadRunning) {
+        pViewer->isIndexCancelled = DTK_TRUE;
+        dtk_thread_wait(&pViewer->indexThread);
+        pViewer->isIndexThreadRunning = DTK_FALSE;
+    }
+    dtk_mutex_uninit(&pViewer->indexLock);
+    free(pViewer->pCheckpoints);
+
+    dtk_mapped_file_unmap(&pViewer->file, &pViewer->window);
+    dtk_mapped_file_close(&pViewer->file);
+
+    dtk_scrollbar_uninit(&pViewer->vertScrollbar);
+    dred_editor_uninit(DRED_EDITOR(pViewer));
+    free(pViewer);
+}
+
+
+void dred_large_file_viewer_scroll_lines(dred_large_file_viewer* pViewer, dtk_int32 lineCount)
+{
+    if (pViewer == NULL || lineCount == 0) {
+        return;
+    }
+
+    dred_large_file_viewer__resolve_top_line_index(pViewer);
+
+    dtk_uint64 offset = pViewer->topLineOffset;
+    dtk_uint64 lineIndex = pViewer->topLineIndex;
+    if (lineCount > 0) {
+        for (dtk_int32 i = 0; i < lineCount; ++i) {
+            dtk_uint64 nextOffset = dred_large_file_viewer__get_next_line_start(pViewer, offset);
+            if (nextOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND) {
+                break;
+            }
+
+            offset = nextOffset;
+            lineIndex += 1;
+        }
+    } else {
+        for (dtk_int32 i = 0; i > lineCount && offset > 0; --i) {
+            offset = dred_large_file_viewer__get_line_start(pViewer, offset - 1);
+            lineIndex -= 1;
+        }
+    }
+
+    dtk_bool32 isTopLineIndexKnown = pViewer->isTopLineIndexKnown;
+    dred_large_file_viewer__set_top_line_offset(pViewer, offset);
+
+    if (isTopLineIndexKnown) {
+        pViewer->topLineIndex = lineIndex;
+        pViewer->isTopLineIndexKnown = DTK_TRUE;
+    }
+}
+
+dtk_bool32 dred_large_file_viewer_goto_line(dred_large_file_viewer* pViewer, dtk_uint64 lineNumber)
+{
+    if (pViewer == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint64 lineIndex = (lineNumber > 0) ? lineNumber - 1 : 0;
+
+    dtk_bool32 found = DTK_FALSE;
+    dtk_uint64 checkpointOffset = 0;
+
+    dtk_mutex_lock(&pViewer->indexLock);
+    {
+        if (pViewer->isIndexComplete && lineIndex >= pViewer->totalLineCount) {
+            lineIndex = pViewer->totalLineCount - 1;
+        }
+
+        dtk_uint64 iCheckpoint = lineIndex / DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT;
+        if (iCheckpoint < pViewer->checkpointCount) {
+            checkpointOffset = pViewer->pCheckpoints[iCheckpoint];
+            found = DTK_TRUE;
+        }
+    }
+    dtk_mutex_unlock(&pViewer->indexLock);
+
+    if (!found) {
+        return DTK_FALSE;
+    }
+
+    dtk_uint64 offset = checkpointOffset;
+    for (dtk_uint64 i = 0; i < (lineIndex % DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT); ++i) {
+        dtk_uint64 nextOffset = dred_large_file_viewer__get_next_line_start(pViewer, offset);
+        if (nextOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND) {
+            break;
+        }
+
+        offset = nextOffset;
+    }
+
+    dred_large_file_viewer__set_top_line_offset(pViewer, offset);
+    pViewer->topLineIndex = lineIndex;
+    pViewer->isTopLineIndexKnown = DTK_TRUE;
+
+    return DTK_TRUE;
+}
+
+size_t dred_large_file_viewer_get_memory_usage(dred_large_file_viewer* pViewer)
+{
+    if (pViewer == NULL) {
+        return 0;
+    }
+
+    size_t size = sizeof(*pViewer) + pViewer->window.mappedSize;
+
+    dtk_mutex_lock(&pViewer->indexLock);
+    {
+        size += pViewer->checkpointCapacity * sizeof(*pViewer->pCheckpoints);
+    }
+    dtk_mutex_unlock(&pViewer->indexLock);
+
+    return size;
+}
+
+void dred_large_file_viewer_goto_ratio(dred_large_file_viewer* pViewer, unsigned int ratio)
+{
+    if (pViewer == NULL || pViewer->file.fileSize == 0) {
+        return;
+    }
+
+    if (ratio > 100) {
+        ratio = 100;
+    }
+
+    dtk_uint64 offset = (dtk_uint64)(((double)ratio / 100.0) * (double)pViewer->file.fileSize);
+    if (offset >= pViewer->file.fileSize) {
+        offset = pViewer->file.fileSize - 1;
+    }
+
+    dred_large_file_viewer__set_top_line_offset(pViewer, dred_large_file_viewer__get_line_start(pViewer, offset));
+}
+
+// Searches for the given text in the given range. Returns DRED_LARGE_FILE_VIEWER_NOT_FOUND if it could not be found.
+static dtk_uint64 dred_large_file_viewer__find(dred_large_file_viewer* pViewer, const char* text, size_t textLength, dtk_uint64 offsetBeg, dtk_uint64 offsetEnd)
+{
+    dtk_assert(pViewer != NULL);
+    dtk_assert(textLength > 0 && textLength <= DRED_LARGE_FILE_VIEWER_WINDOW_SIZE/4);
+
+    while (offsetBeg < offsetEnd) {
+        dtk_uint64 candidate = dred_large_file_viewer__find_byte_forward(pViewer, offsetBeg, offsetEnd, (dtk_uint8)text[0]);
+        if (candidate == DRED_LARGE_FILE_VIEWER_NOT_FOUND || candidate >= offsetEnd) {
+            break;
+        }
+
+        size_t dataSize;
+        const dtk_uint8* pData = dred_large_file_viewer__get_data(pViewer, candidate, textLength, &dataSize);
+        if (pData == NULL || dataSize < textLength) {
+            break;  // Hit the end of the file.
+        }
+
+        if (memcmp(pData, text, textLength) == 0) {
+            return candidate;
+        }
+
+        offsetBeg = candidate + 1;
+    }
+
+    return DRED_LARGE_FILE_VIEWER_NOT_FOUND;
+}
+
+// Marks the given search result and scrolls to it if it's not already in view.
+static void dred_large_file_viewer__select_match(dred_large_file_viewer* pViewer, dtk_uint64 matchOffset, size_t matchLength)
+{
+    dtk_assert(pViewer != NULL);
+
+    pViewer->matchOffset = matchOffset;
+    pViewer->matchLength = matchLength;
+
+    // Only scroll if the result is not already in view.
+    dtk_uint64 lineOffset = pViewer->topLineOffset;
+    dtk_uint32 visibleLineCount = dred_large_file_viewer__get_visible_line_count(pViewer);
+    dtk_bool32 isInView = DTK_FALSE;
+    if (matchOffset >= lineOffset) {
+        for (dtk_uint32 iLine = 0; iLine + 1 < visibleLineCount; ++iLine) {
+            lineOffset = dred_large_file_viewer__get_next_line_start(pViewer, lineOffset);
+            if (lineOffset == DRED_LARGE_FILE_VIEWER_NOT_FOUND || matchOffset < lineOffset) {
+                isInView = DTK_TRUE;
+                break;
+            }
+        }
+    }
+
+    if (isInView) {
+        dred_control_dirty(DRED_CONTROL(pViewer), dred_control_get_local_rect(DRED_CONTROL(pViewer)));
+    } else {
+        dred_large_file_viewer__set_top_line_offset(pViewer, dred_large_file_viewer__get_line_start(pViewer, matchOffset));
+    }
+}
+
+// Searches the next chunk of the search that is in progress. Returns DTK_TRUE when the search is finished, in which case
+// matchLength will be 0 if the text was not found.
+static dtk_bool32 dred_large_file_viewer__find_chunk(dred_large_file_viewer* pViewer)
+{
+    dtk_assert(pViewer != NULL);
+    dtk_assert(pViewer->findText != NULL);
+
+    dtk_uint64 offsetEnd = (pViewer->hasFindWrapped) ? pViewer->findStartOffset : pViewer->file.fileSize;
+    dtk_uint64 chunkEnd = offsetEnd;
+    if (chunkEnd - pViewer->findOffset > DRED_LARGE_FILE_VIEWER_FIND_CHUNK_SIZE) {
+        chunkEnd = pViewer->findOffset + DRED_LARGE_FILE_VIEWER_FIND_CHUNK_SIZE;
+    }
+
+    // Matches are allowed to start in this chunk and end in the next one.
+    dtk_uint64 matchOffset = dred_large_file_viewer__find(pViewer, pViewer->findText, pViewer->findTextLength, pViewer->findOffset, chunkEnd);
+    if (matchOffset != DRED_LARGE_FILE_VIEWER_NOT_FOUND) {
+        dred_large_file_viewer__select_match(pViewer, matchOffset, pViewer->findTextLength);
+        return DTK_TRUE;
+    }
+
+    pViewer->findOffset = chunkEnd;
+    if (pViewer->findOffset == offsetEnd) {
+        if (pViewer->hasFindWrapped || pViewer->findStartOffset == 0) {
+            pViewer->matchLength = 0;
+            dred_control_dirty(DRED_CONTROL(pViewer), dred_control_get_local_rect(DRED_CONTROL(pViewer)));
+            return DTK_TRUE;
+        }
+
+        pViewer->hasFindWrapped = DTK_TRUE;
+        pViewer->findOffset = 0;
+    }
+
+    return DTK_FALSE;
+}
+
+static void dred_large_file_viewer__on_find_timer(dtk_timer* pTimer, void* pUserData)
+{
+    (void)pTimer;
+
+    dred_large_file_viewer* pViewer = (dred_large_file_viewer*)pUserData;
+    dtk_assert(pViewer != NULL);
+
+    if (!dred_large_file_viewer__find_chunk(pViewer)) {
+        return;
+    }
+
+    dred_large_file_viewer__end_find(pViewer);
+
+    if (pViewer->matchLength == 0) {
+        dred_context* pDred = dred_control_get_context(DRED_CONTROL(pViewer));
+        if (pDred != NULL) {
+            dred_cmdbar_set_message(&pDred->cmdBar, "No results found.");
+        }
+    }
+}
+
+dtk_bool32 dred_large_file_viewer_find_next(dred_large_file_viewer* pViewer, const char* text)
+{
+    if (pViewer == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_large_file_viewer__end_find(pViewer);
+
+    if (text == NULL || text[0] == '\0') {
+        return DTK_FALSE;
+    }
+
+    size_t textLength = strlen(text);
+    if (textLength > DRED_LARGE_FILE_VIEWER_WINDOW_SIZE/4) {
+        return DTK_FALSE;
+    }
+
+    // The search starts from just after the previous result, or the top of the view if there is no previous result.
+    dtk_uint64 startOffset = pViewer->topLineOffset;
+    if (pViewer->matchLength > 0 && pViewer->matchOffset >= pViewer->topLineOffset) {
+        startOffset = pViewer->matchOffset + 1;
+    }
+
+    pViewer->findText = dtk_make_string(text);
+    if (pViewer->findText == NULL) {
+        return DTK_FALSE;
+    }
+
+    pViewer->findTextLength  = textLength;
+    pViewer->findStartOffset = startOffset;
+    pViewer->findOffset      = startOffset;
+    pViewer->hasFindWrapped  = DTK_FALSE;
+
+    // Results near the current position are the common case so the first chunk is searched straight away.
+    if (!dred_large_file_viewer__find_chunk(pViewer)) {
+        if (dtk_timer_init(DTK_CONTROL(pViewer)->pTK, 1, dred_large_file_viewer__on_find_timer, pViewer, &pViewer->findTimer) == DTK_SUCCESS) {
+            pViewer->isFinding = DTK_TRUE;
+            return DTK_TRUE;
+        }
+
+        // If the timer couldn't be created we have no choice but to search the rest of the file now.
+        while (!dred_large_file_viewer__find_chunk(pViewer)) {
+        }
+    }
+
+    dred_large_file_viewer__end_find(pViewer);
+    return pViewer->matchLength > 0;
+}
+
+void dred_large_file_viewer_refresh_styling(dred_large_file_viewer* pViewer)
+{
+    if (pViewer == NULL) {
+        return;
+    }
+
+    dred_context* pDred = dred_control_get_context(DRED_CONTROL(pViewer));
+    if (pDred == NULL) {
+        return;
+    }
+
+    pViewer->pFont              = &pDred->config.pTextEditorFont->fontDTK;
+    pViewer->textScale          = pDred->config.textEditorScale;
+    pViewer->textColor          = pDred->config.textEditorTextColor;
+    pViewer->bgColor            = pDred->config.textEditorBGColor;
+    pViewer->lineNumbersColor   = pDred->config.textEditorLineNumbersColor;
+    pViewer->lineNumbersBGColor = pDred->config.textEditorLineNumbersBGColor;
+    pViewer->lineNumbersPadding = pDred->config.textEditorLineNumbersPadding;
+    pViewer->matchBGColor       = pDred->config.textEditorSelectionBGColor;
+    pViewer->showLineNumbers    = pDred->config.textEditorShowLineNumbers;
+    pViewer->tabSizeInSpaces    = pDred->config.textEditorTabSizeInSpaces;
+
+    dtk_scrollbar_set_track_color(&pViewer->vertScrollbar, pDred->config.textEditorSBTrackColor);
+    dtk_scrollbar_set_default_thumb_color(&pViewer->vertScrollbar, pDred->config.textEditorSBThumbColor);
+    dtk_scrollbar_set_hovered_thumb_color(&pViewer->vertScrollbar, pDred->config.textEditorSBThumbColorHovered);
+    dtk_scrollbar_set_pressed_thumb_color(&pViewer->vertScrollbar, pDred->config.textEditorSBThumbColorPressed);
+
+    dred_large_file_viewer__refresh_layout(pViewer);
+    dred_control_dirty(DRED_CONTROL(pViewer), dred_control_get_local_rect(DRED_CONTROL(pViewer)));
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The large file viewer is a read-only editor for files that are too big to be loaded into memory. The file is never loaded
+// in it's entirety - instead it is accessed through a single memory mapped window of DRED_LARGE_FILE_VIEWER_WINDOW_SIZE
+// bytes which is moved around the file as required. This keeps the amount of resident memory bounded no matter how big the
+// file is.
+//
+// Line numbers are resolved with a sparse index which records the byte offset of every DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT
+// lines. This index is built on a background thread so that the file can be viewed immediately after opening. Until the index
+// has reached a particular part of the file, line numbers for that part are unknown and will not be shown.
+
+#define DRED_CONTROL_TYPE_LARGE_FILE_VIEWER  "dred.editor.largefile"
+
+typedef struct dred_large_file_viewer dred_large_file_viewer;
+#define DRED_LARGE_FILE_VIEWER(a) ((dred_large_file_viewer*)(a))
+
+// Files of this size or bigger are opened with the large file viewer rather than the text editor.
+#define DRED_LARGE_FILE_VIEWER_THRESHOLD            ((dtk_uint64)256 * 1024 * 1024)
+
+// The size of the window that is mapped into memory.
+#define DRED_LARGE_FILE_VIEWER_WINDOW_SIZE          (8 * 1024 * 1024)
+
+// The number of lines between each entry in the sparse line index.
+#define DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT 1024
+
+// Lines longer than this are truncated when displayed.
+#define DRED_LARGE_FILE_VIEWER_MAX_DISPLAY_LENGTH   1024
+
+// Searches are done in chunks of this many bytes, one chunk per timer tick, so that the UI stays responsive.
+#define DRED_LARGE_FILE_VIEWER_FIND_CHUNK_SIZE      (32 * 1024 * 1024)
+
+struct dred_large_file_viewer
+{
+    // The base editor.
+    dred_editor editor;
+
+    // The vertical scrollbar. The scroll position is proportional to the byte offset of the top line rather than the line
+    // number because we don't necessarily know the line count, and the line count may not fit in 32 bits anyway.
+    dtk_scrollbar vertScrollbar;
+
+    // The file being viewed.
+    dtk_mapped_file file;
+
+    // The window of the file that is currently mapped into memory. Only a single window is ever mapped at a time.
+    dtk_mapped_view window;
+
+    // The byte offset of the first visible line.
+    dtk_uint64 topLineOffset;
+
+    // The index of the first visible line. Only valid when isTopLineIndexKnown is true.
+    dtk_uint64 topLineIndex;
+    dtk_bool32 isTopLineIndexKnown;
+
+    // The range of the last search result. matchLength is set to 0 when there is no result.
+    dtk_uint64 matchOffset;
+    size_t matchLength;
+
+    // The search that is in progress, if any. The search runs from findStartOffset to the end of the file and then wraps
+    // around to the start. findOffset is where the next chunk starts.
+    dtk_timer findTimer;
+    dtk_bool32 isFinding;
+    char* findText;
+    size_t findTextLength;
+    dtk_uint64 findStartOffset;
+    dtk_uint64 findOffset;
+    dtk_bool32 hasFindWrapped;
+
+
+    // The sparse line index. pCheckpoints[i] is the byte offset of line i*DRED_LARGE_FILE_VIEWER_LINES_PER_CHECKPOINT. This
+    // is built by the indexing thread, and must only be accessed while indexLock is locked.
+    dtk_mutex indexLock;
+    dtk_uint64* pCheckpoints;
+    size_t checkpointCount;
+    size_t checkpointCapacity;
+    dtk_uint64 totalLineCount;      // Only valid once isIndexComplete is true.
+    dtk_thread indexThread;
+    dtk_bool32 isIndexThreadRunning;
+    volatile dtk_bool32 isIndexComplete;
+    volatile dtk_bool32 isIndexCancelled;
+
+
+    // Styling.
+    dtk_font* pFont;
+    float textScale;
+    dtk_color textColor;
+    dtk_color bgColor;
+    dtk_color lineNumbersColor;
+    dtk_color lineNumbersBGColor;
+    dtk_color matchBGColor;
+    float lineNumbersPadding;
+    dtk_bool32 showLineNumbers;
+    int tabSizeInSpaces;
+};
+
+
+// Determines whether or not the file at the given path should be opened with the large file viewer.
+dtk_bool32 dred_large_file_viewer_should_open(const char* filePath);
+
+// dred_large_file_viewer_create()
+dred_large_file_viewer* dred_large_file_viewer_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute);
+
+// dred_large_file_viewer_delete()
+void dred_large_file_viewer_delete(dred_large_file_viewer* pViewer);
+
+
+// Scrolls the viewer by the given number of lines. Negative values scroll up.
+void dred_large_file_viewer_scroll_lines(dred_large_file_viewer* pViewer, dtk_int32 lineCount);
+
+// Moves the view such that the given line is at the top. Line numbers are 1 based.
+//
+// Returns DTK_FALSE if the line index has not yet been built up to the given line.
+dtk_bool32 dred_large_file_viewer_goto_line(dred_large_file_viewer* pViewer, dtk_uint64 lineNumber);
+
+// Moves the view to the given ratio of the file, in percent.
+void dred_large_file_viewer_goto_ratio(dred_large_file_viewer* pViewer, unsigned int ratio);
+
+// Finds the next occurance of the given text, starting from the previous result, and scrolls to it. The search wraps
+// around to the start of the file.
+//
+// The first chunk is searched straight away. If the text isn't found in it, the rest of the file is searched in the
+// background a chunk at a time and "No results found." is shown in the command bar if it isn't found anywhere. Calling
+// this while a search is in progress replaces it.
+//
+// Returns DTK_FALSE if the text is known not to be in the file by the time this returns.
+dtk_bool32 dred_large_file_viewer_find_next(dred_large_file_viewer* pViewer, const char* text);
+
+// Retrieves an estimate of the amount of memory being used by the viewer, in bytes. This includes the mapped window and the
+// line index.
+size_t dred_large_file_viewer_get_memory_usage(dred_large_file_viewer* pViewer);
+
+// Refreshes the styling of the given viewer.
+void dred_large_file_viewer_refresh_styling(dred_large_file_viewer* pViewer);
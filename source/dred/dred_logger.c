@@ -0,0 +1,681 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+#if defined(_MSC_VER)
+#define dred_logger__atomic_compare_exchange_32(dst, expected, desired) (dtk_uint32)InterlockedCompareExchange((volatile LONG*)(dst), (LONG)(desired), (LONG)(expected))
+#define dred_logger__atomic_exchange_32(dst, value)                     (dtk_uint32)InterlockedExchange((volatile LONG*)(dst), (LONG)(value))
+#define dred_logger__atomic_increment_32(dst)                           (dtk_uint32)InterlockedIncrement((volatile LONG*)(dst))
+#define dred_logger__atomic_load_32(src)                                (dtk_uint32)InterlockedCompareExchange((volatile LONG*)(src), 0, 0)
+#define dred_logger__atomic_store_32(dst, value)                        (void)InterlockedExchange((volatile LONG*)(dst), (LONG)(value))
+#define DRED_LOGGER_THREAD_LOCAL                                        __declspec(thread)
+#else
+#define dred_logger__atomic_compare_exchange_32(dst, expected, desired) __sync_val_compare_and_swap((dst), (expected), (desired))
+#define dred_logger__atomic_exchange_32(dst, value)                     __sync_lock_test_and_set((dst), (value))
+#define dred_logger__atomic_increment_32(dst)                           __sync_add_and_fetch((dst), 1)
+#define dred_logger__atomic_load_32(src)                                __atomic_load_n((src), __ATOMIC_ACQUIRE)
+#define dred_logger__atomic_store_32(dst, value)                        __atomic_store_n((dst), (value), __ATOMIC_RELEASE)
+#define DRED_LOGGER_THREAD_LOCAL                                        __thread
+#endif
+
+// Every message in a ring is made up of this header followed by the message itself. Records are padded to a multiple of 8
+// bytes. A record can wrap around the end of the ring.
+typedef struct
+{
+    dtk_uint32 recordSize;      // Including the header and padding.
+    dtk_uint32 messageLength;   // Not including a null terminator. Messages are not null terminated in the ring.
+    dtk_uint32 sequence;
+    dtk_uint32 level;
+    dtk_int64 time;
+} dred_logger_record_header;
+
+// The size of the writer's output buffer. Formatted messages are accumulated here and written to the file in one go.
+#define DRED_LOGGER_OUTPUT_BUFFER_SIZE  (64 * 1024)
+
+// The index of the ring the calling thread last posted to, plus one. Zero means the thread hasn't posted anything yet.
+static DRED_LOGGER_THREAD_LOCAL dtk_uint32 g_dredLoggerRingHint = 0;
+
+// The logger that is flushed at exit and when the application crashes. There's only ever one logger per process.
+static dred_logger* g_pDredCrashLogger = NULL;
+
+
+const char* dred_logger_get_level_prefix(dtk_uint32 level)
+{
+    switch (level)
+    {
+        case DRED_LOG_LEVEL_ERROR:   return "[ERROR] ";
+        case DRED_LOG_LEVEL_WARNING: return "[WARNING] ";
+        case DRED_LOG_LEVEL_DEBUG:   return "[DEBUG] ";
+        default: return "";
+    }
+}
+
+
+static void dred_logger__yield()
+{
+#ifdef DRED_WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+
+static void dred_logger_ring__write(dred_logger_ring* pRing, dtk_uint32 pos, const void* pData, size_t size)
+{
+    size_t offset = pos & (DRED_LOGGER_RING_SIZE - 1);
+    size_t sizeBeforeWrap = DRED_LOGGER_RING_SIZE - offset;
+    if (sizeBeforeWrap >= size) {
+        memcpy(pRing->data + offset, pData, size);
+    } else {
+        memcpy(pRing->data + offset, pData, sizeBeforeWrap);
+        memcpy(pRing->data, (const dtk_uint8*)pData + sizeBeforeWrap, size - sizeBeforeWrap);
+    }
+}
+
+static void dred_logger_ring__read(const dred_logger_ring* pRing, dtk_uint32 pos, void* pDataOut, size_t size)
+{
+    size_t offset = pos & (DRED_LOGGER_RING_SIZE - 1);
+    size_t sizeBeforeWrap = DRED_LOGGER_RING_SIZE - offset;
+    if (sizeBeforeWrap >= size) {
+        memcpy(pDataOut, pRing->data + offset, size);
+    } else {
+        memcpy(pDataOut, pRing->data + offset, sizeBeforeWrap);
+        memcpy((dtk_uint8*)pDataOut + sizeBeforeWrap, pRing->data, size - sizeBeforeWrap);
+    }
+}
+
+
+static void dred_logger__get_rotated_file_path(dred_logger* pLogger, unsigned int index, char* pathOut, size_t pathOutSize)
+{
+    char extension[16];
+    snprintf(extension, sizeof(extension), "%u", index);
+    dtk_path_append_extension(pathOut, pathOutSize, pLogger->filePath, extension);
+}
+
+// Moves the current log file out of the way. The file must be closed before calling this.
+static void dred_logger__rotate_files(dred_logger* pLogger)
+{
+    char srcPath[DRED_MAX_PATH];
+    char dstPath[DRED_MAX_PATH];
+
+    dred_logger__get_rotated_file_path(pLogger, DRED_LOGGER_MAX_ROTATED_FILES, dstPath, sizeof(dstPath));
+    if (dtk_file_exists(dstPath)) {
+        dtk_delete_file(dstPath);
+    }
+
+    for (unsigned int i = DRED_LOGGER_MAX_ROTATED_FILES; i > 1; --i) {
+        dred_logger__get_rotated_file_path(pLogger, i - 1, srcPath, sizeof(srcPath));
+        dred_logger__get_rotated_file_path(pLogger, i,     dstPath, sizeof(dstPath));
+        if (dtk_file_exists(srcPath)) {
+            dtk_move_file(srcPath, dstPath);
+        }
+    }
+
+    if (dtk_file_exists(pLogger->filePath)) {
+        dred_logger__get_rotated_file_path(pLogger, 1, dstPath, sizeof(dstPath));
+        dtk_move_file(pLogger->filePath, dstPath);
+    }
+}
+
+static void dred_logger__rotate(dred_logger* pLogger)
+{
+#ifndef DRED_WIN32
+    pLogger->fd = -1;
+#endif
+
+    if (pLogger->file != NULL) {
+        dred_file_close(pLogger->file);
+    }
+
+    dred_logger__rotate_files(pLogger);
+
+    pLogger->file = dred_file_open(pLogger->filePath, DRED_FILE_OPEN_MODE_WRITE);
+    pLogger->fileSize = 0;
+
+#ifndef DRED_WIN32
+    if (pLogger->file != NULL) {
+        pLogger->fd = fileno((FILE*)pLogger->file);
+    }
+#endif
+}
+
+static void dred_logger__write_output(dred_logger* pLogger, const char* pData, size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    if (pLogger->file != NULL) {
+        size_t bytesWritten = 0;
+        dred_file_write(pLogger->file, pData, size, &bytesWritten);
+        pLogger->fileSize += bytesWritten;
+
+        if (pLogger->fileSize >= DRED_LOGGER_MAX_FILE_SIZE) {
+            dred_logger__rotate(pLogger);
+        }
+    }
+}
+
+// Appends a formatted message to the output buffer, flushing the buffer to the file first if it's too full. Returns the
+// new length of the buffer.
+static size_t dred_logger__append_output(dred_logger* pLogger, size_t outputLength, const char* dateTime, dtk_uint32 level, const char* message, size_t messageLength)
+{
+    const char* prefix = dred_logger_get_level_prefix(level);
+    size_t dateTimeLength = strlen(dateTime);
+    size_t prefixLength = strlen(prefix);
+    size_t lineLength = 1 + dateTimeLength + 1 + prefixLength + messageLength + 1;  // "[" + dateTime + "]" + prefix + message + "\n"
+
+    // Messages are truncated to DRED_LOGGER_MAX_MESSAGE_LENGTH when they are posted so a line will always fit in an empty buffer.
+    dred_assert(lineLength <= DRED_LOGGER_OUTPUT_BUFFER_SIZE);
+
+    if (outputLength + lineLength > DRED_LOGGER_OUTPUT_BUFFER_SIZE) {
+        dred_logger__write_output(pLogger, pLogger->pOutputBuffer, outputLength);
+        outputLength = 0;
+    }
+
+    char* pLine = pLogger->pOutputBuffer + outputLength;
+    *pLine++ = '[';
+    memcpy(pLine, dateTime, dateTimeLength); pLine += dateTimeLength;
+    *pLine++ = ']';
+    memcpy(pLine, prefix, prefixLength); pLine += prefixLength;
+    memcpy(pLine, message, messageLength); pLine += messageLength;
+    *pLine++ = '\n';
+
+    if (pLogger->isTerminalOutputEnabled) {
+        printf("%s%.*s\n", prefix, (int)messageLength, message);
+    }
+
+    return outputLength + lineLength;
+}
+
+// Writes out everything that has been posted to the rings so far. Returns DTK_FALSE if another thread is already draining, or
+// if the drain stopped early because a message with an earlier sequence number hasn't been committed yet.
+static dtk_bool32 dred_logger__drain(dred_logger* pLogger)
+{
+    if (dred_logger__atomic_compare_exchange_32(&pLogger->isDraining, 0, 1) != 0) {
+        return DTK_FALSE;
+    }
+
+    // Only records that were fully written at this point are drained. Anything posted while draining is picked up next time.
+    dtk_uint32 readPos[DRED_LOGGER_RING_COUNT];
+    dtk_uint32 writePos[DRED_LOGGER_RING_COUNT];
+    for (dtk_uint32 iRing = 0; iRing < DRED_LOGGER_RING_COUNT; ++iRing) {
+        readPos[iRing]  = pLogger->pRings[iRing].readPos;
+        writePos[iRing] = dred_logger__atomic_load_32(&pLogger->pRings[iRing].writePos);
+    }
+
+    // Formatting the date is relatively expensive, but most messages are posted within the same second as the previous one.
+    dtk_int64 dateTimeSource = -1;
+    char dateTime[64];
+    dateTime[0] = '\0';
+
+    char message[DRED_LOGGER_MAX_MESSAGE_LENGTH];
+    size_t outputLength = 0;
+    dtk_bool32 isComplete = DTK_TRUE;
+    for (;;) {
+        // The next record to write out is the one with the lowest sequence number out of the records at the front of each ring.
+        dtk_uint32 nextRing = DRED_LOGGER_RING_COUNT;
+        dred_logger_record_header nextHeader;
+        for (dtk_uint32 iRing = 0; iRing < DRED_LOGGER_RING_COUNT; ++iRing) {
+            if (readPos[iRing] == writePos[iRing]) {
+                continue;
+            }
+
+            dred_logger_record_header header;
+            dred_logger_ring__read(&pLogger->pRings[iRing], readPos[iRing], &header, sizeof(header));
+            if (nextRing == DRED_LOGGER_RING_COUNT || (dtk_int32)(header.sequence - nextHeader.sequence) < 0) {
+                nextRing = iRing;
+                nextHeader = header;
+            }
+        }
+
+        if (nextRing == DRED_LOGGER_RING_COUNT) {
+            break;
+        }
+
+        // A thread that has taken a sequence number but not yet made it's record visible leaves a gap. Records are committed
+        // to each ring in sequence order so the missing record can't be behind any of the ones we can see, and we need to
+        // stop here and let the next drain pick it up.
+        if (nextHeader.sequence != pLogger->nextWriteSequence) {
+            isComplete = DTK_FALSE;
+            break;
+        }
+
+        pLogger->nextWriteSequence += 1;
+
+        dred_logger_ring__read(&pLogger->pRings[nextRing], readPos[nextRing] + sizeof(nextHeader), message, nextHeader.messageLength);
+        readPos[nextRing] += nextHeader.recordSize;
+
+        // The space can be reused by producers as soon as the message has been copied out.
+        dred_logger__atomic_store_32(&pLogger->pRings[nextRing].readPos, readPos[nextRing]);
+
+        if (nextHeader.time != dateTimeSource) {
+            dateTimeSource = nextHeader.time;
+            dtk_datetime_short((time_t)nextHeader.time, dateTime, sizeof(dateTime));
+        }
+
+        outputLength = dred_logger__append_output(pLogger, outputLength, dateTime, nextHeader.level, message, nextHeader.messageLength);
+    }
+
+    if (outputLength > 0) {
+        dred_logger__write_output(pLogger, pLogger->pOutputBuffer, outputLength);
+        if (pLogger->file != NULL) {
+            dred_file_flush(pLogger->file);
+        }
+        if (pLogger->isTerminalOutputEnabled) {
+            fflush(stdout);
+        }
+    }
+
+    dred_logger__atomic_store_32(&pLogger->isDraining, 0);
+    return isComplete;
+}
+
+static void dred_logger__signal_writer(dred_logger* pLogger)
+{
+    if (!pLogger->hasWriterThread) {
+        dred_logger_flush(pLogger);
+        return;
+    }
+
+    if (dred_logger__atomic_exchange_32(&pLogger->isWriterSignalled, 1) == 0) {
+        dtk_semaphore_release(&pLogger->writerSemaphore);
+    }
+}
+
+static dtk_thread_result DTK_THREADCALL dred_logger__writer_thread_proc(void* pData)
+{
+    dred_logger* pLogger = (dred_logger*)pData;
+    dred_assert(pLogger != NULL);
+
+    for (;;) {
+        dtk_semaphore_wait(&pLogger->writerSemaphore);
+
+        // The flag needs to be cleared before draining. Otherwise a message posted during the drain could be missed.
+        dred_logger__atomic_exchange_32(&pLogger->isWriterSignalled, 0);
+
+        if (dred_logger__atomic_load_32(&pLogger->isStopping)) {
+            break;
+        }
+
+        // If this fails it means the logger is being flushed by another thread which will pick up everything anyway.
+        dred_logger__drain(pLogger);
+    }
+
+    return 0;
+}
+
+
+static void dred_logger__on_exit()
+{
+    dred_logger_flush(g_pDredCrashLogger);
+}
+
+#ifdef DRED_WIN32
+static LPTOP_LEVEL_EXCEPTION_FILTER g_dredLoggerPrevExceptionFilter = NULL;
+
+static LONG WINAPI dred_logger__on_unhandled_exception(EXCEPTION_POINTERS* pExceptionInfo)
+{
+    // Only a single attempt is made. If the writer is in the middle of a drain it may be the thread that crashed.
+    if (g_pDredCrashLogger != NULL) {
+        dred_logger__drain(g_pDredCrashLogger);
+    }
+
+    if (g_dredLoggerPrevExceptionFilter != NULL) {
+        return g_dredLoggerPrevExceptionFilter(pExceptionInfo);
+    }
+
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+#else
+// Only async-signal-safe functions can be called from the signal handler, which rules out the normal drain since it formats
+// dates and writes through stdio. The messages written by the handler are therefore prepared up front.
+typedef struct
+{
+    int sig;
+    const char* message;
+} dred_logger_crash_signal;
+
+static const dred_logger_crash_signal g_dredLoggerCrashSignals[] = {
+    {SIGSEGV, "[ERROR] Crashed with SIGSEGV.\n"},
+    {SIGABRT, "[ERROR] Crashed with SIGABRT.\n"},
+    {SIGFPE,  "[ERROR] Crashed with SIGFPE.\n"},
+    {SIGILL,  "[ERROR] Crashed with SIGILL.\n"},
+    {SIGBUS,  "[ERROR] Crashed with SIGBUS.\n"}
+};
+
+#define DRED_LOGGER_CRASH_SIGNAL_COUNT  (sizeof(g_dredLoggerCrashSignals) / sizeof(g_dredLoggerCrashSignals[0]))
+
+// The handlers that were installed before ours. These are restored before the signal is raised again.
+static struct sigaction g_dredLoggerPrevCrashActions[DRED_LOGGER_CRASH_SIGNAL_COUNT];
+
+static void dred_logger__write_on_crash(int fd, const void* pData, size_t size)
+{
+    const char* pBytes = (const char*)pData;
+    while (size > 0) {
+        ssize_t bytesWritten = write(fd, pBytes, size);
+        if (bytesWritten < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesWritten <= 0) {
+            return;
+        }
+
+        pBytes += bytesWritten;
+        size   -= (size_t)bytesWritten;
+    }
+}
+
+// Writes the messages that are still in the rings straight to the log file, without a timestamp. Sequence gaps are ignored
+// since the thread that left the gap may never get to fill it. This must only be called while holding isDraining.
+static void dred_logger__write_pending_on_crash(dred_logger* pLogger, int fd)
+{
+    dtk_uint32 readPos[DRED_LOGGER_RING_COUNT];
+    dtk_uint32 writePos[DRED_LOGGER_RING_COUNT];
+    for (dtk_uint32 iRing = 0; iRing < DRED_LOGGER_RING_COUNT; ++iRing) {
+        readPos[iRing]  = pLogger->pRings[iRing].readPos;
+        writePos[iRing] = dred_logger__atomic_load_32(&pLogger->pRings[iRing].writePos);
+    }
+
+    for (;;) {
+        dtk_uint32 nextRing = DRED_LOGGER_RING_COUNT;
+        dred_logger_record_header nextHeader;
+        for (dtk_uint32 iRing = 0; iRing < DRED_LOGGER_RING_COUNT; ++iRing) {
+            if (readPos[iRing] == writePos[iRing]) {
+                continue;
+            }
+
+            dred_logger_record_header header;
+            dred_logger_ring__read(&pLogger->pRings[iRing], readPos[iRing], &header, sizeof(header));
+            if (nextRing == DRED_LOGGER_RING_COUNT || (dtk_int32)(header.sequence - nextHeader.sequence) < 0) {
+                nextRing = iRing;
+                nextHeader = header;
+            }
+        }
+
+        if (nextRing == DRED_LOGGER_RING_COUNT) {
+            break;
+        }
+
+        // The message is written directly out of the ring, in two parts if it wraps around the end.
+        const char* prefix = dred_logger_get_level_prefix(nextHeader.level);
+        dred_logger__write_on_crash(fd, prefix, strlen(prefix));
+
+        size_t offset = (readPos[nextRing] + sizeof(nextHeader)) & (DRED_LOGGER_RING_SIZE - 1);
+        size_t sizeBeforeWrap = DRED_LOGGER_RING_SIZE - offset;
+        if (sizeBeforeWrap >= nextHeader.messageLength) {
+            dred_logger__write_on_crash(fd, pLogger->pRings[nextRing].data + offset, nextHeader.messageLength);
+        } else {
+            dred_logger__write_on_crash(fd, pLogger->pRings[nextRing].data + offset, sizeBeforeWrap);
+            dred_logger__write_on_crash(fd, pLogger->pRings[nextRing].data, nextHeader.messageLength - sizeBeforeWrap);
+        }
+
+        dred_logger__write_on_crash(fd, "\n", 1);
+
+        readPos[nextRing] += nextHeader.recordSize;
+    }
+}
+
+static void dred_logger__on_crash_signal(int sig)
+{
+    size_t iSignal = 0;
+    while (iSignal < DRED_LOGGER_CRASH_SIGNAL_COUNT && g_dredLoggerCrashSignals[iSignal].sig != sig) {
+        iSignal += 1;
+    }
+
+    dred_logger* pLogger = g_pDredCrashLogger;
+    if (pLogger != NULL && iSignal < DRED_LOGGER_CRASH_SIGNAL_COUNT) {
+        const char* message = g_dredLoggerCrashSignals[iSignal].message;
+
+        // The log file is only touched if no drain is in progress. Waiting for one to finish is pointless because the writer
+        // may be the thread that crashed. Anything already drained has been flushed so nothing is buffered by stdio.
+        if (dred_logger__atomic_compare_exchange_32(&pLogger->isDraining, 0, 1) == 0) {
+            int fd = pLogger->fd;
+            if (fd != -1) {
+                dred_logger__write_pending_on_crash(pLogger, fd);
+                dred_logger__write_on_crash(fd, message, strlen(message));
+            }
+        }
+
+        if (pLogger->isTerminalOutputEnabled) {
+            dred_logger__write_on_crash(STDERR_FILENO, message, strlen(message));
+        }
+    }
+
+    // Restore the handler that was installed before ours and raise the signal again so that it runs. If there wasn't one the
+    // default action terminates the process so the exit code and core dump are the same as they would have been.
+    if (iSignal < DRED_LOGGER_CRASH_SIGNAL_COUNT) {
+        sigaction(sig, &g_dredLoggerPrevCrashActions[iSignal], NULL);
+    } else {
+        signal(sig, SIG_DFL);
+    }
+
+    raise(sig);
+}
+#endif
+
+static dtk_bool32 g_dredLoggerHasCrashHandlers = DTK_FALSE;
+
+static void dred_logger__install_crash_handlers()
+{
+    static dtk_bool32 isAtExitRegistered = DTK_FALSE;
+    if (!isAtExitRegistered) {
+        isAtExitRegistered = DTK_TRUE;
+        atexit(dred_logger__on_exit);
+    }
+
+    if (g_dredLoggerHasCrashHandlers) {
+        return;
+    }
+
+    g_dredLoggerHasCrashHandlers = DTK_TRUE;
+
+#ifdef DRED_WIN32
+    g_dredLoggerPrevExceptionFilter = SetUnhandledExceptionFilter(dred_logger__on_unhandled_exception);
+#else
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = dred_logger__on_crash_signal;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t iSignal = 0; iSignal < DRED_LOGGER_CRASH_SIGNAL_COUNT; ++iSignal) {
+        sigaction(g_dredLoggerCrashSignals[iSignal].sig, &action, &g_dredLoggerPrevCrashActions[iSignal]);
+    }
+#endif
+}
+
+static void dred_logger__uninstall_crash_handlers()
+{
+    if (!g_dredLoggerHasCrashHandlers) {
+        return;
+    }
+
+    g_dredLoggerHasCrashHandlers = DTK_FALSE;
+
+#ifdef DRED_WIN32
+    SetUnhandledExceptionFilter(g_dredLoggerPrevExceptionFilter);
+    g_dredLoggerPrevExceptionFilter = NULL;
+#else
+    for (size_t iSignal = 0; iSignal < DRED_LOGGER_CRASH_SIGNAL_COUNT; ++iSignal) {
+        sigaction(g_dredLoggerCrashSignals[iSignal].sig, &g_dredLoggerPrevCrashActions[iSignal], NULL);
+    }
+#endif
+}
+
+
+dtk_bool32 dred_logger_init(dred_logger* pLogger, const char* logFilePath, dtk_uint32 level, dtk_bool32 isTerminalOutputEnabled)
+{
+    if (pLogger == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_zero_object(pLogger);
+    pLogger->level = level;
+    pLogger->isTerminalOutputEnabled = isTerminalOutputEnabled;
+    pLogger->nextWriteSequence = 1;     // dred_logger__atomic_increment_32() returns the incremented value so the first message is 1.
+#ifndef DRED_WIN32
+    pLogger->fd = -1;
+#endif
+
+    pLogger->pRings = (dred_logger_ring*)dred_calloc(DRED_LOGGER_RING_COUNT, sizeof(*pLogger->pRings));
+    if (pLogger->pRings == NULL) {
+        return DTK_FALSE;
+    }
+
+    pLogger->pOutputBuffer = (char*)dred_malloc(DRED_LOGGER_OUTPUT_BUFFER_SIZE);
+    if (pLogger->pOutputBuffer == NULL) {
+        dred_free(pLogger->pRings);
+        pLogger->pRings = NULL;
+        return DTK_FALSE;
+    }
+
+    // The log from the previous session is kept by rotating it rather than overwriting it.
+    if (logFilePath != NULL && logFilePath[0] != '\0') {
+        dtk_strcpy_s(pLogger->filePath, sizeof(pLogger->filePath), logFilePath);
+        dred_logger__rotate(pLogger);
+    }
+
+    // If the writer thread can't be created messages are written out synchronously when they're posted.
+    if (dtk_semaphore_init(&pLogger->writerSemaphore, 0) == DTK_SUCCESS) {
+        if (dtk_thread_create(&pLogger->writerThread, dred_logger__writer_thread_proc, pLogger) == DTK_SUCCESS) {
+            pLogger->hasWriterThread = DTK_TRUE;
+        } else {
+            dtk_semaphore_uninit(&pLogger->writerSemaphore);
+        }
+    }
+
+    g_pDredCrashLogger = pLogger;
+    dred_logger__install_crash_handlers();
+
+    return DTK_TRUE;
+}
+
+void dred_logger_uninit(dred_logger* pLogger)
+{
+    if (pLogger == NULL || pLogger->pRings == NULL) {
+        return;
+    }
+
+    if (pLogger->hasWriterThread) {
+        dred_logger__atomic_store_32(&pLogger->isStopping, DTK_TRUE);
+        dtk_semaphore_release(&pLogger->writerSemaphore);
+        dtk_thread_wait(&pLogger->writerThread);
+        dtk_semaphore_uninit(&pLogger->writerSemaphore);
+        pLogger->hasWriterThread = DTK_FALSE;
+    }
+
+    dred_logger_flush(pLogger);
+
+    if (g_pDredCrashLogger == pLogger) {
+        dred_logger__uninstall_crash_handlers();
+        g_pDredCrashLogger = NULL;
+    }
+
+#ifndef DRED_WIN32
+    pLogger->fd = -1;
+#endif
+
+    if (pLogger->file != NULL) {
+        dred_file_close(pLogger->file);
+        pLogger->file = NULL;
+    }
+
+    dred_free(pLogger->pOutputBuffer);
+    pLogger->pOutputBuffer = NULL;
+
+    dred_free(pLogger->pRings);
+    pLogger->pRings = NULL;
+}
+
+void dred_logger_set_level(dred_logger* pLogger, dtk_uint32 level)
+{
+    if (pLogger == NULL) {
+        return;
+    }
+
+    pLogger->level = level;
+}
+
+void dred_logger_post(dred_logger* pLogger, dtk_uint32 level, const char* message)
+{
+    if (pLogger == NULL || message == NULL || pLogger->pRings == NULL || !dred_logger_is_level_enabled(pLogger, level)) {
+        return;
+    }
+
+    size_t messageLength = strlen(message);
+    if (messageLength > DRED_LOGGER_MAX_MESSAGE_LENGTH) {
+        messageLength = DRED_LOGGER_MAX_MESSAGE_LENGTH;
+    }
+
+    dtk_uint32 recordSize = (dtk_uint32)((sizeof(dred_logger_record_header) + messageLength + 7) & ~(size_t)7);
+
+
+    // Claim a ring with enough room for the message, starting with the one this thread used last. If every ring is in use we
+    // just try again since rings are only held while a message is being copied. If the ring is full the rings are written out
+    // from this thread so the message doesn't need to be dropped.
+    dtk_uint32 firstRing;
+    if (g_dredLoggerRingHint == 0) {
+        firstRing = dred_logger__atomic_increment_32(&pLogger->nextRingHint) % DRED_LOGGER_RING_COUNT;
+    } else {
+        firstRing = g_dredLoggerRingHint - 1;
+    }
+
+    dred_logger_ring* pRing = NULL;
+    dtk_uint32 writePos;
+    for (;;) {
+        for (dtk_uint32 i = 0; i < DRED_LOGGER_RING_COUNT; ++i) {
+            dtk_uint32 iRing = (firstRing + i) % DRED_LOGGER_RING_COUNT;
+            if (dred_logger__atomic_compare_exchange_32(&pLogger->pRings[iRing].isInUse, 0, 1) == 0) {
+                pRing = &pLogger->pRings[iRing];
+                g_dredLoggerRingHint = iRing + 1;
+                break;
+            }
+        }
+
+        if (pRing == NULL) {
+            dred_logger__yield();
+            continue;
+        }
+
+        writePos = pRing->writePos;
+        dtk_uint32 readPos = dred_logger__atomic_load_32(&pRing->readPos);
+        if (DRED_LOGGER_RING_SIZE - (writePos - readPos) >= recordSize) {
+            break;
+        }
+
+        dred_logger__atomic_store_32(&pRing->isInUse, 0);
+        pRing = NULL;
+
+        dred_logger_flush(pLogger);
+    }
+
+    dred_logger_ring__write(pRing, writePos + sizeof(dred_logger_record_header), message, messageLength);
+
+    // The sequence number is taken at the last moment so that the order of sequence numbers matches the order in which records
+    // are committed. The writer waits out the small window between this and the store below.
+    dred_logger_record_header header;
+    header.recordSize    = recordSize;
+    header.messageLength = (dtk_uint32)messageLength;
+    header.sequence      = dred_logger__atomic_increment_32(&pLogger->nextSequence);
+    header.level         = level;
+    header.time          = (dtk_int64)dtk_now();
+    dred_logger_ring__write(pRing, writePos, &header, sizeof(header));
+
+    // The record must be fully written before the writer can see it.
+    dred_logger__atomic_store_32(&pRing->writePos, writePos + recordSize);
+    dred_logger__atomic_store_32(&pRing->isInUse, 0);
+
+    dred_logger__signal_writer(pLogger);
+}
+
+void dred_logger_flush(dred_logger* pLogger)
+{
+    if (pLogger == NULL || pLogger->pRings == NULL) {
+        return;
+    }
+
+    // The writer thread may be in the middle of a drain, in which case we need to wait for it to finish and then drain again
+    // to pick up anything it missed. A drain can also stop at a message that another thread is still committing.
+    while (!dred_logger__drain(pLogger)) {
+        dred_logger__yield();
+    }
+}
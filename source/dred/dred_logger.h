@@ -0,0 +1,119 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The logger is asynchronous. Posting a message copies it into a ring buffer and returns without touching the file or the
+// terminal. A background thread drains the ring buffers, formats the messages and writes them out in batches.
+//
+// The ring buffers are a small shared pool rather than one per thread. Each ring has a single producer at a time and a single
+// consumer (the writer thread) so they can be implemented without locks. A thread claims a ring by setting it's in-use flag
+// for the duration of the post, and it starts with whichever ring it used last, so as long as there are no more threads
+// logging than there are rings each thread tends to stick to one ring and there's no contention. If every ring is claimed
+// the thread simply tries again since a ring is only held for as long as it takes to copy the message.
+//
+// Every message is given a sequence number when it's committed to the ring, and the writer merges the rings in sequence
+// order so messages from different threads are written in the order they were committed. The writer never skips over a
+// sequence number that hasn't been committed yet.
+//
+// Messages are never dropped. If the ring is full the posting thread writes out the rings itself and then tries again, so
+// posting only blocks when messages are posted faster than they can be written.
+//
+// The log file is rotated once it reaches DRED_LOGGER_MAX_FILE_SIZE bytes. The current file is renamed to dred.log.1, the
+// previous dred.log.1 is renamed to dred.log.2, and so on up to DRED_LOGGER_MAX_ROTATED_FILES. The log from the previous
+// session is rotated in the same way at startup rather than being overwritten.
+//
+// Everything that has been posted is written out when the logger is uninitialized and at exit. When the application crashes
+// on POSIX the signal handler only uses write() on the log file's descriptor, so messages that are still in the rings are
+// written without a timestamp, followed by a line naming the signal. The previous signal handlers are restored and the
+// signal is raised again so that they still run.
+
+// Log levels. Messages with a level higher than DRED_LOG_LEVEL_MAX are compiled out. Messages with a level higher than the
+// logger's runtime level, which is controlled with the "log-level" config variable, are discarded when they are posted.
+#define DRED_LOG_LEVEL_ERROR    1
+#define DRED_LOG_LEVEL_WARNING  2
+#define DRED_LOG_LEVEL_INFO     3
+#define DRED_LOG_LEVEL_DEBUG    4
+
+#ifndef DRED_LOG_LEVEL_MAX
+#ifdef DRED_DEBUG
+#define DRED_LOG_LEVEL_MAX      DRED_LOG_LEVEL_DEBUG
+#else
+#define DRED_LOG_LEVEL_MAX      DRED_LOG_LEVEL_INFO
+#endif
+#endif
+
+// The number of ring buffers. This does not need to match the number of threads, but it should be enough that threads
+// logging at the same time don't need to share.
+#define DRED_LOGGER_RING_COUNT          8
+
+// The size of each ring buffer in bytes. This must be a power of 2.
+#define DRED_LOGGER_RING_SIZE           (64 * 1024)
+
+// Messages longer than this are truncated.
+#define DRED_LOGGER_MAX_MESSAGE_LENGTH  4096
+
+// The size at which the log file is rotated.
+#define DRED_LOGGER_MAX_FILE_SIZE       (4 * 1024 * 1024)
+
+// The number of rotated log files to keep.
+#define DRED_LOGGER_MAX_ROTATED_FILES   3
+
+typedef struct
+{
+    volatile dtk_uint32 isInUse;        // Set by a producer for the duration of a post.
+    volatile dtk_uint32 writePos;       // Only ever increases. Wraps around at 2^32 which is fine since the ring size is a power of 2.
+    volatile dtk_uint32 readPos;
+    dtk_uint8 data[DRED_LOGGER_RING_SIZE];
+} dred_logger_ring;
+
+typedef struct
+{
+    char filePath[DRED_MAX_PATH];       // Empty if there is no log file.
+    dred_file file;
+    dtk_uint64 fileSize;
+    volatile dtk_uint32 level;
+    volatile dtk_bool32 isTerminalOutputEnabled;
+
+#ifndef DRED_WIN32
+    volatile int fd;                    // The descriptor of the log file for use by the crash handler. -1 if there is no log file.
+#endif
+
+    dred_logger_ring* pRings;           // DRED_LOGGER_RING_COUNT rings. Null when the logger is not initialized.
+    volatile dtk_uint32 nextSequence;
+    volatile dtk_uint32 nextRingHint;
+    dtk_uint32 nextWriteSequence;       // The sequence number of the next message to write out. Only accessed while draining.
+    char* pOutputBuffer;                // Used by the writer for formatting messages before writing them to the file.
+
+    // The writer thread waits on the semaphore. It's only released when the writer is not already signalled so that posting
+    // doesn't require a system call in the common case.
+    dtk_thread writerThread;
+    dtk_semaphore writerSemaphore;
+    volatile dtk_uint32 isWriterSignalled;
+    volatile dtk_uint32 isDraining;     // Guards against the writer and a crash handler draining at the same time.
+    volatile dtk_bool32 isStopping;
+    dtk_bool32 hasWriterThread;
+} dred_logger;
+
+// Initializes the logger. The log file path can be null in which case messages are only written to the terminal.
+dtk_bool32 dred_logger_init(dred_logger* pLogger, const char* logFilePath, dtk_uint32 level, dtk_bool32 isTerminalOutputEnabled);
+
+// Uninitializes the logger. Everything that has been posted is written out before this returns.
+void dred_logger_uninit(dred_logger* pLogger);
+
+// Sets the runtime log level.
+void dred_logger_set_level(dred_logger* pLogger, dtk_uint32 level);
+
+// Determines whether or not messages of the given level are currently being logged. Use this to avoid formatting messages
+// that will just be discarded.
+DTK_INLINE dtk_bool32 dred_logger_is_level_enabled(const dred_logger* pLogger, dtk_uint32 level)
+{
+    return level <= DRED_LOG_LEVEL_MAX && pLogger != NULL && level <= pLogger->level;
+}
+
+// Posts a message. This is thread-safe and only blocks when the ring buffer is full, in which case the rings are written out
+// from the calling thread. Messages posted while the logger is not initialized are discarded.
+void dred_logger_post(dred_logger* pLogger, dtk_uint32 level, const char* message);
+
+// Writes out everything that has been posted so far from the calling thread.
+void dred_logger_flush(dred_logger* pLogger);
+
+// Retrieves the prefix that is written before messages of the given level, such as "[WARNING] ".
+const char* dred_logger_get_level_prefix(dtk_uint32 level);
@@ -17,12 +17,15 @@
 
 #include "dred.c"
 
-dtk_bool32 dred_parse_cmdline__post_startup_files_to_server(const char* key, const char* value, void* pUserData)
+dtk_bool32 dred_parse_cmdline__collect_startup_files(const char* key, const char* value, void* pUserData)
 {
-    dtk_pipe client = (dtk_pipe)pUserData;
+    char** ppFilePaths = (char**)pUserData;
+    assert(ppFilePaths != NULL);
 
+    // Each file path is appended to the list with it's null terminator.
     if (key == NULL) {
-        dred_ipc_post_message(client, DRED_IPC_MESSAGE_OPEN, value, strlen(value)+1);   // +1 for null terminator.
+        size_t valueSize = strlen(value) + 1;
+        memcpy(stb_sb_add(*ppFilePaths, (int)valueSize), value, valueSize);
         return DTK_TRUE;
     }
 
@@ -42,8 +45,36 @@ dtk_bool32 dred__try_opening_existing_process(int argc, char** argv)
         // of creating a new one. The first thing to do is notify the server that it should be activated.
         dred_ipc_post_message(client, DRED_IPC_MESSAGE_ACTIVATE, NULL, 0);
 
-        // After activating the server we need to let it know which files to open.
-        dtk_argv_parse(argc, argv, dred_parse_cmdline__post_startup_files_to_server, client);
+        // After activating the server we need to let it know which files to open. As many as will fit are packed into each
+        // message so that opening a large number of files doesn't result in a round trip for each one. A path that is too
+        // long to fit in a message on it's own can't be sent at all.
+        char* pFilePaths = NULL;
+        dtk_argv_parse(argc, argv, dred_parse_cmdline__collect_startup_files, &pFilePaths);
+
+        const size_t maxDataSize = DRED_IPC_MAX_MESSAGE_SIZE - sizeof(dred_ipc_message_header);
+        size_t filePathsSize = (size_t)stb_sb_count(pFilePaths);
+        size_t batchBeg = 0;
+        size_t batchEnd = 0;
+        while (batchEnd < filePathsSize) {
+            size_t filePathSize = strlen(pFilePaths + batchEnd) + 1;
+            if (batchEnd + filePathSize - batchBeg > maxDataSize) {
+                if (batchEnd > batchBeg) {
+                    dred_ipc_post_message(client, DRED_IPC_MESSAGE_OPEN_FILES, pFilePaths + batchBeg, batchEnd - batchBeg);
+                    batchBeg = batchEnd;
+                    continue;
+                }
+
+                batchBeg += filePathSize;   // Too long to send.
+            }
+
+            batchEnd += filePathSize;
+        }
+
+        if (batchEnd > batchBeg) {
+            dred_ipc_post_message(client, DRED_IPC_MESSAGE_OPEN_FILES, pFilePaths + batchBeg, batchEnd - batchBeg);
+        }
+
+        stb_sb_free(pFilePaths);
 
         // The server should be notified of the file, so we just need to return now.
         dred_ipc_post_message(client, DRED_IPC_MESSAGE_TERMINATOR, NULL, 0);
@@ -58,13 +89,13 @@ dtk_bool32 dred__try_opening_existing_process(int argc, char** argv)
 
 int main(int argc, char** argv)
 {
-    // Packages need to be loaded first.
+    // Packages need to be found first. This only reads their manifests - the packages themselves are loaded when they're needed.
     dred_package_library packages;
     dred_package_library_init(&packages);
 
     // Go down a different branch for command-line functions.
     if (dtk_argv_exists(argc, argv, "f")) {
-        return dred_main_f(argc, argv);    // <-- Implemented in cmdline_funcs/dred_main_f.c
+        return dred_main_f(argc, argv, &packages);    // <-- Implemented in cmdline_funcs/dred_main_f.c
     }
 
 
@@ -192,4 +192,26 @@ dtk_color dred_parse_color(const char* color)
     }
 
     return dred_rgb(0, 0, 0);
+}
+
+dtk_uint32 dred_perfect_hash_find(const char* key, const dtk_uint32* pSeeds, const dtk_uint16* pIndices, dtk_uint32 tableSize, const char* const* ppStrings, dtk_uint32 stringCount)
+{
+    assert(pSeeds != NULL);
+    assert(pIndices != NULL);
+    assert(ppStrings != NULL);
+    assert((tableSize & (tableSize-1)) == 0);
+
+    if (key == NULL) {
+        return (dtk_uint32)-1;
+    }
+
+    dtk_uint32 bucket = dtk_hash_string(key, 0) & (tableSize-1);
+    dtk_uint32 slot   = dtk_hash_string(key, pSeeds[bucket]) & (tableSize-1);
+
+    dtk_uint32 index = pIndices[slot];
+    if (index == DRED_PERFECT_HASH_EMPTY_SLOT || index >= stringCount || strcmp(key, ppStrings[index]) != 0) {
+        return (dtk_uint32)-1;
+    }
+
+    return index;
 }
\ No newline at end of file
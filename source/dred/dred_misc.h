@@ -17,6 +17,19 @@ dtk_font_slant dred_font_slant_from_pango(PangoStyle slant);
 dtk_color dred_parse_color(const char* color);
 
 
+// Perfect Hashing
+//
+// dred_build generates perfect hash tables for fixed sets of strings such as command names and config variables. A table
+// is made up of a seed for each bucket and a string index for each slot. The key is hashed with a seed of 0 to find its
+// bucket, and then with the bucket's seed to find its slot. Only a single string comparison is needed to confirm a match.
+#define DRED_PERFECT_HASH_EMPTY_SLOT    0xFFFF
+
+// Finds the index of the given key in a table generated by dred_build. tableSize must be a power of 2.
+//
+// Returns (dtk_uint32)-1 if the key is not in the set.
+dtk_uint32 dred_perfect_hash_find(const char* key, const dtk_uint32* pSeeds, const dtk_uint16* pIndices, dtk_uint32 tableSize, const char* const* ppStrings, dtk_uint32 stringCount);
+
+
 
 // Type conversion
 
@@ -3,15 +3,72 @@
 
 typedef struct
 {
-    char name[256];
-    char libraryName[256];
-} dred_package_info;
+    dred_package_library* pLibrary;
+    dred_package_info* pInfo;
+    dtk_uint32 packageInfoIndex;
+} dred_load_package_info__data;
+
+void dred_package_library__add_capability(dred_package_library* pLibrary, dtk_uint32 type, const char* name, dtk_uint32 packageInfoIndex)
+{
+    assert(pLibrary != NULL);
+    assert(name != NULL);
+
+    dred_package_capability capability;
+    capability.type = type;
+    capability.packageInfoIndex = packageInfoIndex;
+    if (strcpy_s(capability.name, sizeof(capability.name), name) != 0) {
+        return;
+    }
+
+    // Extensions are not case sensitive.
+    if (type == DRED_PACKAGE_CAPABILITY_EXTENSION) {
+        for (char* pChar = capability.name; *pChar != '\0'; ++pChar) {
+            if (*pChar >= 'A' && *pChar <= 'Z') {
+                *pChar += 'a' - 'A';
+            }
+        }
+    }
+
+    if (!dred_hash_index_insert(&pLibrary->capabilityIndex, dtk_hash_string(capability.name, type), (dtk_uint32)stb_sb_count(pLibrary->pCapabilities))) {
+        return;
+    }
+
+    stb_sb_push(pLibrary->pCapabilities, capability);
+}
+
+void dred_load_package_info__add_capabilities(dred_load_package_info__data* pData, dtk_uint32 type, const char* value)
+{
+    // The value is a list of names separated by whitespace. The whole list may or may not be quoted.
+    char list[1024];
+    if (dtk_next_token(value, list, sizeof(list)) == NULL) {
+        return;
+    }
+
+    const char* runningList = (strchr(value, '\"') != NULL) ? list : value;
+
+    char name[64];
+    while ((runningList = dtk_next_token(runningList, name, sizeof(name))) != NULL) {
+        // Extensions can be written with or without the leading period.
+        const char* pName = name;
+        if (type == DRED_PACKAGE_CAPABILITY_EXTENSION && pName[0] == '.') {
+            pName += 1;
+        }
+
+        if (pName[0] != '\0') {
+            dred_package_library__add_capability(pData->pLibrary, type, pName, pData->packageInfoIndex);
+            pData->pInfo->hasCapabilities = DTK_TRUE;
+        }
+    }
+}
 
 void dred_load_package_info__on_pair(void* pUserData, const char* key, const char* value)
 {
     if (pUserData == NULL || key == NULL || value == NULL) return;
 
-    dred_package_info* pInfo = (dred_package_info*)pUserData;
+    dred_load_package_info__data* pData = (dred_load_package_info__data*)pUserData;
+    assert(pData != NULL);
+
+    dred_package_info* pInfo = pData->pInfo;
     assert(pInfo != NULL);
 
     if (strcmp(key, "Name") == 0) {
@@ -34,22 +91,42 @@ void dred_load_package_info__on_pair(void* pUserData, const char* key, const cha
         return;
     }
 
+    if (strcmp(key, "Extensions") == 0) {
+        dred_load_package_info__add_capabilities(pData, DRED_PACKAGE_CAPABILITY_EXTENSION, value);
+        return;
+    }
+
+    if (strcmp(key, "CmdLineFuncs") == 0) {
+        dred_load_package_info__add_capabilities(pData, DRED_PACKAGE_CAPABILITY_CMDLINE_FUNC, value);
+        return;
+    }
+
     // If we get here it means it's an unknown property. Don't throw an error here - the package may want to use custom
     // properties for it's own internal configuration.
 }
 
-dtk_bool32 dred_load_package_info(const char* dredpackagePath, dred_package_info* pInfo)
+dtk_bool32 dred_load_package_info(dred_package_library* pLibrary, const char* dredpackagePath, dred_package_info* pInfo, dtk_uint32 packageInfoIndex)
 {
+    assert(pLibrary != NULL);
     assert(dredpackagePath != NULL);
     assert(pInfo != NULL);
 
     memset(pInfo, 0, sizeof(*pInfo));
 
-    if (!dtk_parse_key_value_pairs_from_file(dredpackagePath, dred_load_package_info__on_pair, NULL, pInfo)) {
-        return DTK_FALSE;
-    }
+    dred_load_package_info__data data;
+    data.pLibrary = pLibrary;
+    data.pInfo = pInfo;
+    data.packageInfoIndex = packageInfoIndex;
+
+    int capabilityCount = stb_sb_count(pLibrary->pCapabilities);
+    if (!dtk_parse_key_value_pairs_from_file(dredpackagePath, dred_load_package_info__on_pair, NULL, &data) || pInfo->name[0] == '\0' || pInfo->libraryName[0] == '\0') {
+        // Any capabilities that were declared before finding out the package is invalid need to be removed.
+        while (stb_sb_count(pLibrary->pCapabilities) > capabilityCount) {
+            dred_package_capability* pCapability = &stb_sb_last(pLibrary->pCapabilities);
+            dred_hash_index_remove(&pLibrary->capabilityIndex, dtk_hash_string(pCapability->name, pCapability->type), (dtk_uint32)stb_sb_count(pLibrary->pCapabilities)-1);
+            stb__sbn(pLibrary->pCapabilities) -= 1;
+        }
 
-    if (pInfo->name[0] == '\0' || pInfo->libraryName[0] == '\0') {
         return DTK_FALSE;
     }
 
@@ -93,33 +170,33 @@ dtk_bool32 dred_construct_library_path(char* pathOut, size_t pathOutSize, const
         strcat_s(pathOut, pathOutSize, libraryExt) == 0;
 }
 
-dred_package* dred_package_library_load_package(dred_package_library* pLibrary, const char* packageFolderPath)
+dred_package* dred_package_library_load_package(dred_package_library* pLibrary, dred_package_info* pInfo)
 {
-    if (pLibrary == NULL || packageFolderPath == NULL) return DTK_FALSE;
+    if (pLibrary == NULL || pInfo == NULL) return NULL;
 
-    // Look for a .dredpackage file. If it doesn't exist, just skip it. Inside the .dredpackage file is information
-    // about the package that we'll need in order to load it; in particular the name of the DLL/SO.
-    char dredpackagePath[DRED_MAX_PATH];
-    if (dtk_path_append(dredpackagePath, sizeof(dredpackagePath), packageFolderPath, ".dredpackage")) {
-        dred_package_info info;
-        if (dred_load_package_info(dredpackagePath, &info)) {
-            char libraryPath[DRED_MAX_PATH];
-            if (dred_construct_library_path(libraryPath, sizeof(libraryPath), packageFolderPath, &info)) {
-                dred_dl dl = dred_dlopen(libraryPath);
-                if (dl != NULL) {
-                    dred_package_create_proc package_create = (dred_package_create_proc)dred_dlsym(dl, "dred_package_create");
-                    if (package_create != NULL) {
-                        dred_package* pPackage = package_create();
-                        if (pPackage != NULL) {
-                            pPackage->_dl = dl;
-                            return pPackage;
-                        } else {
-                            dred_dlclose(libraryPath);  // Failed to create the package instance.
-                        }
-                    } else {
-                        dred_dlclose(libraryPath);  // Could not find the "dred_package_create()" function.
-                    }
+    if (pInfo->isLoadAttempted) {
+        return pInfo->pPackage;
+    }
+
+    pInfo->isLoadAttempted = DTK_TRUE;
+
+    char libraryPath[DRED_MAX_PATH];
+    if (dred_construct_library_path(libraryPath, sizeof(libraryPath), pInfo->folderPath, pInfo)) {
+        dred_dl dl = dred_dlopen(libraryPath);
+        if (dl != NULL) {
+            dred_package_create_proc package_create = (dred_package_create_proc)dred_dlsym(dl, "dred_package_create");
+            if (package_create != NULL) {
+                dred_package* pPackage = package_create();
+                if (pPackage != NULL) {
+                    pPackage->_dl = dl;
+                    pInfo->pPackage = pPackage;
+                    stb_sb_push(pLibrary->pPackages, pPackage);
+                    return pPackage;
+                } else {
+                    dred_dlclose(dl);  // Failed to create the package instance.
                 }
+            } else {
+                dred_dlclose(dl);  // Could not find the "dred_package_create()" function.
             }
         }
     }
@@ -143,16 +220,20 @@ void dred_package_library_unload_package(dred_package_library* pLibrary, dred_pa
 }
 
 
-dtk_bool32 dred_package_library_package_iterator_cb(const char* filePath, void* pUserData)
+dtk_bool32 dred_package_library_package_iterator_cb(const dtk_walk_directory_entry* pEntry, void* pUserData)
 {
     dred_package_library* pLibrary = (dred_package_library*)pUserData;
     assert(pLibrary != NULL);
 
-    dtk_bool32 isDirectory = dtk_is_directory(filePath);
-    if (isDirectory) {
-        dred_package* pPackage = dred_package_library_load_package(pLibrary, filePath);
-        if (pPackage != NULL) {
-            stb_sb_push(pLibrary->pPackages, pPackage);
+    // Look for a .dredpackage file. If it doesn't exist, just skip it. Inside the .dredpackage file is information
+    // about the package that we'll need in order to load it; in particular the name of the DLL/SO and what it can do.
+    char dredpackagePath[DRED_MAX_PATH];
+    if (dtk_path_append(dredpackagePath, sizeof(dredpackagePath), pEntry->path, ".dredpackage")) {
+        dred_package_info info;
+        if (dred_load_package_info(pLibrary, dredpackagePath, &info, (dtk_uint32)stb_sb_count(pLibrary->pPackageInfos))) {
+            if (strcpy_s(info.folderPath, sizeof(info.folderPath), pEntry->path) == 0) {
+                stb_sb_push(pLibrary->pPackageInfos, info);
+            }
         }
     }
 
@@ -165,6 +246,10 @@ dtk_bool32 dred_package_library_init(dred_package_library* pLibrary)
 
     memset(pLibrary, 0, sizeof(*pLibrary));
 
+    if (!dred_hash_index_init(&pLibrary->capabilityIndex)) {
+        return DTK_FALSE;
+    }
+
     // Packages will be relative to the executable in the "packages" directory. Each package will be in it's own
     // directory which will include a .dredpackage file with information about the package.
     char basePackageDir[DRED_MAX_PATH];
@@ -172,7 +257,19 @@ dtk_bool32 dred_package_library_init(dred_package_library* pLibrary)
         return DTK_FALSE;
     }
 
-    dtk_iterate_files(basePackageDir, DTK_FALSE, dred_package_library_package_iterator_cb, pLibrary);
+    // Only the directories directly inside the packages folder are packages.
+    dtk_walk_directory_config config;
+    dtk_zero_object(&config);
+    config.maxDepth = 1;
+    config.flags = DTK_WALK_DIRECTORY_EXCLUDE_FILES;
+    dtk_walk_directory(basePackageDir, &config, dred_package_library_package_iterator_cb, pLibrary);
+
+    // Packages that haven't told us what they can do need to be loaded now.
+    for (int iPackageInfo = 0; iPackageInfo < stb_sb_count(pLibrary->pPackageInfos); ++iPackageInfo) {
+        if (!pLibrary->pPackageInfos[iPackageInfo].hasCapabilities) {
+            dred_package_library_load_package(pLibrary, &pLibrary->pPackageInfos[iPackageInfo]);
+        }
+    }
 
     return DTK_TRUE;
 }
@@ -186,6 +283,9 @@ void dred_package_library_uninit(dred_package_library* pLibrary)
     }
 
     stb_sb_free(pLibrary->pPackages);
+    stb_sb_free(pLibrary->pPackageInfos);
+    stb_sb_free(pLibrary->pCapabilities);
+    dred_hash_index_uninit(&pLibrary->capabilityIndex);
 }
 
 size_t dred_package_library_get_package_count(dred_package_library* pLibrary)
@@ -199,3 +299,47 @@ dred_package* dred_package_library_get_package(dred_package_library* pLibrary, s
     if (pLibrary == NULL || index >= dred_package_library_get_package_count(pLibrary)) return NULL;
     return pLibrary->pPackages[index];
 }
+
+void dred_package_library_load_packages_for_file(dred_package_library* pLibrary, const char* filePath)
+{
+    if (pLibrary == NULL || filePath == NULL) return;
+
+    char extension[64];
+    if (strcpy_s(extension, sizeof(extension), dtk_path_extension(filePath)) != 0 || extension[0] == '\0') {
+        return;
+    }
+
+    for (char* pChar = extension; *pChar != '\0'; ++pChar) {
+        if (*pChar >= 'A' && *pChar <= 'Z') {
+            *pChar += 'a' - 'A';
+        }
+    }
+
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pLibrary->capabilityIndex, dtk_hash_string(extension, DRED_PACKAGE_CAPABILITY_EXTENSION), &iterator, &index); found; found = dred_hash_index_find_next(&pLibrary->capabilityIndex, &iterator, &index)) {
+        dred_package_capability* pCapability = &pLibrary->pCapabilities[index];
+        if (pCapability->type == DRED_PACKAGE_CAPABILITY_EXTENSION && strcmp(pCapability->name, extension) == 0) {
+            dred_package_library_load_package(pLibrary, &pLibrary->pPackageInfos[pCapability->packageInfoIndex]);
+        }
+    }
+}
+
+dred_package* dred_package_library_load_package_for_cmdline_func(dred_package_library* pLibrary, const char* funcName)
+{
+    if (pLibrary == NULL || funcName == NULL) return NULL;
+
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pLibrary->capabilityIndex, dtk_hash_string(funcName, DRED_PACKAGE_CAPABILITY_CMDLINE_FUNC), &iterator, &index); found; found = dred_hash_index_find_next(&pLibrary->capabilityIndex, &iterator, &index)) {
+        dred_package_capability* pCapability = &pLibrary->pCapabilities[index];
+        if (pCapability->type == DRED_PACKAGE_CAPABILITY_CMDLINE_FUNC && strcmp(pCapability->name, funcName) == 0) {
+            dred_package* pPackage = dred_package_library_load_package(pLibrary, &pLibrary->pPackageInfos[pCapability->packageInfoIndex]);
+            if (pPackage != NULL) {
+                return pPackage;
+            }
+        }
+    }
+
+    return NULL;
+}
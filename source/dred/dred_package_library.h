@@ -1,11 +1,46 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+// Packages are loaded lazily. At startup only the .dredpackage file of each package is read, and the capabilities declared
+// in it are added to an index. The package's library is not loaded until one of those capabilities is first needed:
+//
+//     Name          "Image Viewer"
+//     SO            "dred_image_viewer"
+//     Extensions    "png jpg jpeg bmp"   <-- The file extensions the package has editors for.
+//     CmdLineFuncs  "image2c"            <-- The functions the package exposes to "dred -f".
+//
+// Packages that do not declare any capabilities are loaded at startup, since there's no way of knowing when they'll be needed.
+
+#define DRED_PACKAGE_CAPABILITY_EXTENSION       1
+#define DRED_PACKAGE_CAPABILITY_CMDLINE_FUNC    2
+
+typedef struct
+{
+    char name[256];
+    char libraryName[256];
+    char folderPath[DRED_MAX_PATH];
+    dtk_bool32 hasCapabilities;
+    dtk_bool32 isLoadAttempted;     // Set after the first attempt at loading so that a broken package is only tried once.
+    dred_package* pPackage;         // Null until loaded.
+} dred_package_info;
+
+typedef struct
+{
+    dtk_uint32 type;                // DRED_PACKAGE_CAPABILITY_*
+    dtk_uint32 packageInfoIndex;
+    char name[64];                  // Extensions are stored in lower case.
+} dred_package_capability;
+
 struct dred_package_library
 {
-    dred_package** pPackages;   // <-- This is an stb_stretchy_buffer object.
+    dred_package** pPackages;   // <-- This is an stb_stretchy_buffer object. Only the packages that have been loaded.
+
+    dred_package_info* pPackageInfos;               // <-- stb_stretchy_buffer. Every package that was found, loaded or not.
+    dred_package_capability* pCapabilities;         // <-- stb_stretchy_buffer.
+    dred_hash_index capabilityIndex;                // Maps the hash of a capability's type and name to its index in pCapabilities.
 };
 
-// Initializes the package library by loading every active package.
+// Initializes the package library. This reads the manifest of every active package, but only loads those without declared
+// capabilities.
 dtk_bool32 dred_package_library_init(dred_package_library* pLibrary);
 
 // Uninitializes the package library.
@@ -14,5 +49,13 @@ void dred_package_library_uninit(dred_package_library* pLibrary);
 // Retrieves the number of loaded packages.
 size_t dred_package_library_get_package_count(dred_package_library* pLibrary);
 
-// Retrieves a pointer to the package at the given index.
-dred_package* dred_package_library_get_package(dred_package_library* pLibrary, size_t index);
\ No newline at end of file
+// Retrieves a pointer to the loaded package at the given index.
+dred_package* dred_package_library_get_package(dred_package_library* pLibrary, size_t index);
+
+// Loads every package that declares an editor for the extension of the given file. Call this before iterating over the loaded
+// packages to find an editor for the file.
+void dred_package_library_load_packages_for_file(dred_package_library* pLibrary, const char* filePath);
+
+// Finds and loads the package that declares the given command line function. Returns null if no package declares it, or it
+// failed to load.
+dred_package* dred_package_library_load_package_for_cmdline_func(dred_package_library* pLibrary, const char* funcName);
@@ -0,0 +1,363 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+static void dred_perf_hud__format_size(size_t sizeInBytes, char* strOut, size_t strOutSize)
+{
+    if (sizeInBytes >= 1024*1024) {
+        snprintf(strOut, strOutSize, "%.1f MB", sizeInBytes / (1024.0*1024.0));
+    } else {
+        snprintf(strOut, strOutSize, "%.1f KB", sizeInBytes / 1024.0);
+    }
+}
+
+static void dred_perf_hud__add_line(dred_perf_hud* pHUD, const char* format, ...)
+{
+    if (pHUD->lineCount == DRED_PERF_HUD_MAX_LINES) {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(pHUD->lines[pHUD->lineCount], sizeof(pHUD->lines[pHUD->lineCount]), format, args);
+    va_end(args);
+
+    pHUD->lineCount += 1;
+}
+
+static void dred_perf_hud__refresh_lines(dred_perf_hud* pHUD)
+{
+    dred_perf_snapshot snapshot;
+    dred_perf_take_snapshot(&snapshot);
+
+    double seconds = (snapshot.time - pHUD->prevSnapshot.time) / 1000000000.0;
+    if (seconds <= 0) {
+        seconds = DRED_PERF_HUD_REFRESH_INTERVAL / 1000.0;
+    }
+
+    // Everything is based on what's happened since the last refresh.
+    dred_perf_counter delta[DRED_PERF_COUNTER_COUNT];
+    for (dtk_uint32 iCounter = 0; iCounter < DRED_PERF_COUNTER_COUNT; ++iCounter) {
+        delta[iCounter].count     = snapshot.counters[iCounter].count     - pHUD->prevSnapshot.counters[iCounter].count;
+        delta[iCounter].totalTime = snapshot.counters[iCounter].totalTime - pHUD->prevSnapshot.counters[iCounter].totalTime;
+        delta[iCounter].maxTime   = snapshot.counters[iCounter].maxTime;
+        for (dtk_uint32 iBucket = 0; iBucket < DRED_PERF_HISTOGRAM_BUCKET_COUNT; ++iBucket) {
+            delta[iCounter].histogram[iBucket] = snapshot.counters[iCounter].histogram[iBucket] - pHUD->prevSnapshot.counters[iCounter].histogram[iBucket];
+        }
+    }
+
+    pHUD->prevSnapshot = snapshot;
+    pHUD->lineCount = 0;
+
+    const dred_perf_counter* pFrame = &delta[DRED_PERF_COUNTER_FRAME];
+    double frameAvg = (pFrame->count > 0) ? (double)pFrame->totalTime / pFrame->count : 0;
+    dred_perf_hud__add_line(pHUD, "frame: %.2f ms avg, < %.2f ms p90, %.1f fps", frameAvg / 1000000.0, dred_perf_get_percentile(pFrame, 0.90) / 1000000.0, pFrame->count / seconds);
+
+    const dred_perf_counter* pViewPaint = &delta[DRED_PERF_COUNTER_VIEW_PAINT];
+    double viewPaintAvg = (pViewPaint->count > 0) ? (double)pViewPaint->totalTime / pViewPaint->count : 0;
+    dred_perf_hud__add_line(pHUD, "view paints: %.1f/s, %.2f ms avg", pViewPaint->count / seconds, viewPaintAvg / 1000000.0);
+
+    const dred_perf_counter* pMeasure = &delta[DRED_PERF_COUNTER_MEASURE_STRING];
+    double measureAvg = (pMeasure->count > 0) ? (double)pMeasure->totalTime / pMeasure->count : 0;
+    double measuresPerFrame = (pFrame->count > 0) ? (double)pMeasure->count / pFrame->count : 0;
+    dred_perf_hud__add_line(pHUD, "measure calls: %.1f/frame, %.2f us avg", measuresPerFrame, measureAvg / 1000.0);
+
+    const dred_perf_counter* pWordWrap = &delta[DRED_PERF_COUNTER_WORD_WRAP];
+    dred_perf_hud__add_line(pHUD, "word wraps: %.1f/s, %.2f ms total", pWordWrap->count / seconds, pWordWrap->totalTime / 1000000.0);
+
+    dred_perf_hud__add_line(pHUD, "paint requests: %.1f/s", delta[DRED_PERF_COUNTER_PAINT_QUEUE_ENQUEUE].count / seconds);
+    dred_perf_hud__add_line(pHUD, "undo commits: %.1f/s", delta[DRED_PERF_COUNTER_UNDO_COMMIT].count / seconds);
+
+    // File loads and saves are rare so these show the totals since the counters were reset rather than the last interval.
+    const dred_perf_counter* pLoad = &snapshot.counters[DRED_PERF_COUNTER_FILE_LOAD];
+    const dred_perf_counter* pSave = &snapshot.counters[DRED_PERF_COUNTER_FILE_SAVE];
+    dred_perf_hud__add_line(pHUD, "file loads: %llu, %.2f ms max", (unsigned long long)pLoad->count, pLoad->maxTime / 1000000.0);
+    dred_perf_hud__add_line(pHUD, "file saves: %llu, %.2f ms max", (unsigned long long)pSave->count, pSave->maxTime / 1000000.0);
+
+
+    // Memory.
+    dtk_uint32 editorCount = 0;
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pHUD->pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pHUD->pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            dtk_control* pTabPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
+            if (pTabPage == NULL || pTabPage->type != DTK_CONTROL_TYPE_DRED || !dred_control_is_of_type(DRED_CONTROL(pTabPage), DRED_CONTROL_TYPE_EDITOR)) {
+                continue;
+            }
+
+            size_t memoryUsage = dred_editor_get_memory_usage(DRED_EDITOR(pTabPage));
+            if (memoryUsage == 0) {
+                continue;
+            }
+
+            editorCount += 1;
+            if (editorCount > DRED_PERF_HUD_MAX_EDITORS) {
+                continue;
+            }
+
+            const char* editorFilePath = dred_editor_get_file_path(DRED_EDITOR(pTabPage));
+            const char* editorFileName = (editorFilePath != NULL && editorFilePath[0] != '\0') ? dtk_path_file_name(editorFilePath) : "[untitled]";
+
+            char sizeStr[32];
+            dred_perf_hud__format_size(memoryUsage, sizeStr, sizeof(sizeStr));
+            dred_perf_hud__add_line(pHUD, "%s: %s", editorFileName, sizeStr);
+        }
+    }
+
+    if (editorCount > DRED_PERF_HUD_MAX_EDITORS) {
+        dred_perf_hud__add_line(pHUD, "(%u more editors)", editorCount - DRED_PERF_HUD_MAX_EDITORS);
+    }
+}
+
+static void dred_perf_hud__on_timer(dtk_timer* pTimer, void* pUserData)
+{
+    (void)pTimer;
+
+    dred_perf_hud* pHUD = (dred_perf_hud*)pUserData;
+    dtk_assert(pHUD != NULL);
+
+    dred_perf_hud__refresh_lines(pHUD);
+    dred_perf_hud_refresh_layout(pHUD);
+    dtk_control_scheduled_redraw(DTK_CONTROL(pHUD), dtk_control_get_local_rect(DTK_CONTROL(pHUD)));
+}
+
+static dtk_bool32 dred_perf_hud__on_hit_test(dtk_control* pControl, dtk_int32 relativePosX, dtk_int32 relativePosY)
+{
+    (void)pControl;
+    (void)relativePosX;
+    (void)relativePosY;
+
+    // The HUD is just an overlay. Mouse input goes to whatever is underneath.
+    return DTK_FALSE;
+}
+
+static dtk_bool32 dred_perf_hud_event_handler(dtk_event* pEvent)
+{
+    dred_perf_hud* pHUD = (dred_perf_hud*)pEvent->pControl;
+    dred_context* pDred = pHUD->pDred;
+
+    switch (pEvent->type)
+    {
+        case DTK_EVENT_PAINT:
+        {
+            float uiScale = dtk_control_get_scaling_factor(pEvent->pControl);
+            dtk_int32 padding = (dtk_int32)(4*uiScale);
+
+            dtk_surface_draw_rect(pEvent->paint.pSurface, dtk_control_get_local_rect(pEvent->pControl), pDred->config.cmdbarBGColor);
+
+            dtk_font* pFont = &pDred->config.pUIFont->fontDTK;
+            dtk_font_metrics fontMetrics;
+            dtk_font_get_metrics(pFont, uiScale, &fontMetrics);
+
+            for (dtk_uint32 iLine = 0; iLine < pHUD->lineCount; ++iLine) {
+                dtk_surface_draw_text(pEvent->paint.pSurface, pFont, uiScale, pHUD->lines[iLine], strlen(pHUD->lines[iLine]), padding, padding + (dtk_int32)iLine*fontMetrics.lineHeight, pDred->config.cmdbarTextColor, pDred->config.cmdbarBGColor);
+            }
+        } break;
+
+        default: break;
+    }
+
+    return dtk_control_default_event_handler(pEvent);
+}
+
+dtk_result dred_perf_hud_init(dred_context* pDred, dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL) return DTK_INVALID_ARGS;
+    dtk_zero_object(pHUD);
+
+    if (pDred == NULL) return DTK_INVALID_ARGS;
+    pHUD->pDred = pDred;
+
+    dtk_result result = dtk_control_init(&pDred->tk, DTK_CONTROL_TYPE_EMPTY, dred_perf_hud_event_handler, DTK_CONTROL(&pDred->mainWindow), DTK_CONTROL(pHUD));
+    if (result != DTK_SUCCESS) {
+        return result;
+    }
+
+    dtk_control_set_hit_test_proc(DTK_CONTROL(pHUD), dred_perf_hud__on_hit_test);
+    dtk_control_hide(DTK_CONTROL(pHUD));
+
+    return DTK_SUCCESS;
+}
+
+dtk_result dred_perf_hud_uninit(dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL) return DTK_INVALID_ARGS;
+
+    dred_perf_hud_hide(pHUD);
+    return dtk_control_uninit(DTK_CONTROL(pHUD));
+}
+
+void dred_perf_hud_show(dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL || dred_perf_hud_is_showing(pHUD)) {
+        return;
+    }
+
+    dred_perf_set_enabled(DTK_TRUE);
+    dred_perf_take_snapshot(&pHUD->prevSnapshot);
+
+    if (dtk_timer_init(&pHUD->pDred->tk, DRED_PERF_HUD_REFRESH_INTERVAL, dred_perf_hud__on_timer, pHUD, &pHUD->timer) == DTK_SUCCESS) {
+        pHUD->isTimerInitialized = DTK_TRUE;
+    }
+
+    // Start with a full set of lines so the HUD has a sensible size straight away. The rates will be zero until the first tick.
+    dred_perf_hud__refresh_lines(pHUD);
+    dred_perf_hud_refresh_layout(pHUD);
+    dtk_control_show(DTK_CONTROL(pHUD));
+}
+
+void dred_perf_hud_hide(dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL) {
+        return;
+    }
+
+    if (pHUD->isTimerInitialized) {
+        dtk_timer_uninit(&pHUD->timer);
+        pHUD->isTimerInitialized = DTK_FALSE;
+    }
+
+    if (!pHUD->pDred->isRecordingPerfCounters) {
+        dred_perf_set_enabled(DTK_FALSE);
+    }
+
+    dtk_control_hide(DTK_CONTROL(pHUD));
+}
+
+dtk_bool32 dred_perf_hud_is_showing(dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL) {
+        return DTK_FALSE;
+    }
+
+    return dtk_control_is_visible(DTK_CONTROL(pHUD));
+}
+
+void dred_perf_hud_refresh_layout(dred_perf_hud* pHUD)
+{
+    if (pHUD == NULL) {
+        return;
+    }
+
+    dred_context* pDred = pHUD->pDred;
+
+    float uiScale = dtk_control_get_scaling_factor(DTK_CONTROL(pHUD));
+    dtk_int32 padding = (dtk_int32)(4*uiScale);
+
+    dtk_font* pFont = &pDred->config.pUIFont->fontDTK;
+    dtk_font_metrics fontMetrics;
+    dtk_font_get_metrics(pFont, uiScale, &fontMetrics);
+
+    dtk_int32 maxLineWidth = 0;
+    for (dtk_uint32 iLine = 0; iLine < pHUD->lineCount; ++iLine) {
+        dtk_int32 lineWidth;
+        if (dtk_font_measure_string(pFont, uiScale, pHUD->lines[iLine], strlen(pHUD->lines[iLine]), &lineWidth, NULL) == DTK_SUCCESS) {
+            if (maxLineWidth < lineWidth) {
+                maxLineWidth = lineWidth;
+            }
+        }
+    }
+
+    dtk_int32 width  = maxLineWidth + padding*2;
+    dtk_int32 height = (dtk_int32)pHUD->lineCount*fontMetrics.lineHeight + padding*2;
+    dtk_control_set_size(DTK_CONTROL(pHUD), width, height);
+
+    // The main tab group covers everything above the command bar.
+    dtk_int32 areaWidth;
+    dtk_int32 areaHeight;
+    dtk_control_get_size(DTK_CONTROL(&pDred->mainTabGroup), &areaWidth, &areaHeight);
+    dtk_control_set_relative_position(DTK_CONTROL(pHUD), areaWidth - width - padding, areaHeight - height - padding);
+}
+
+
+static void dred_perf_hud__write_histogram(dred_file file, const dred_perf_counter* pCounter)
+{
+    char buffer[256];
+    for (dtk_uint32 iBucket = 0; iBucket < DRED_PERF_HISTOGRAM_BUCKET_COUNT; ++iBucket) {
+        if (pCounter->histogram[iBucket] == 0) {
+            continue;
+        }
+
+        char range[64];
+        if (iBucket == 0) {
+            snprintf(range, sizeof(range), "< 1 us");
+        } else if (iBucket == DRED_PERF_HISTOGRAM_BUCKET_COUNT-1) {
+            snprintf(range, sizeof(range), ">= %u us", 1U << (iBucket-1));
+        } else {
+            snprintf(range, sizeof(range), "%u-%u us", 1U << (iBucket-1), 1U << iBucket);
+        }
+
+        snprintf(buffer, sizeof(buffer), "    %-20s %12llu\n", range, (unsigned long long)pCounter->histogram[iBucket]);
+        dred_file_write_string(file, buffer);
+    }
+}
+
+dtk_bool32 dred_perf_dump(dred_context* pDred, const char* filePath)
+{
+    if (pDred == NULL || filePath == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_file file = dred_file_open(filePath, DRED_FILE_OPEN_MODE_WRITE);
+    if (file == NULL) {
+        dred_errorf(pDred, "Failed to open %s for writing the performance counters.", filePath);
+        return DTK_FALSE;
+    }
+
+    dred_perf_snapshot snapshot;
+    dred_perf_take_snapshot(&snapshot);
+
+    dtk_uint64 enabledTime = dred_perf_get_enabled_time();
+
+    char buffer[DRED_MAX_PATH + 256];
+    char dateTime[64];
+    dtk_datetime_short(dtk_now(), dateTime, sizeof(dateTime));
+    snprintf(buffer, sizeof(buffer), "dred performance counters - %s\n", dateTime);
+    dred_file_write_string(file, buffer);
+    snprintf(buffer, sizeof(buffer), "Counters are %s and have been enabled for %.3f seconds.\n\n", dred_perf_is_enabled() ? "enabled" : "disabled", enabledTime / 1000000000.0);
+    dred_file_write_string(file, buffer);
+
+    snprintf(buffer, sizeof(buffer), "%-20s %12s %12s %12s %12s %12s %12s %12s\n", "counter", "count", "total ms", "avg us", "max us", "p50 us", "p90 us", "p99 us");
+    dred_file_write_string(file, buffer);
+    for (dtk_uint32 iCounter = 0; iCounter < DRED_PERF_COUNTER_COUNT; ++iCounter) {
+        const dred_perf_counter* pCounter = &snapshot.counters[iCounter];
+        double avgTime = (pCounter->count > 0) ? (double)pCounter->totalTime / pCounter->count : 0;
+
+        // Percentiles come from the histogram so they're the upper bound of the bucket they fall in.
+        snprintf(buffer, sizeof(buffer), "%-20s %12llu %12.3f %12.3f %12.3f %11s%llu %11s%llu %11s%llu\n",
+            dred_perf_get_counter_name(iCounter),
+            (unsigned long long)pCounter->count,
+            pCounter->totalTime / 1000000.0,
+            avgTime / 1000.0,
+            pCounter->maxTime / 1000.0,
+            "<", (unsigned long long)(dred_perf_get_percentile(pCounter, 0.50) / 1000),
+            "<", (unsigned long long)(dred_perf_get_percentile(pCounter, 0.90) / 1000),
+            "<", (unsigned long long)(dred_perf_get_percentile(pCounter, 0.99) / 1000));
+        dred_file_write_string(file, buffer);
+    }
+
+    dred_file_write_string(file, "\nHistograms\n");
+    for (dtk_uint32 iCounter = 0; iCounter < DRED_PERF_COUNTER_COUNT; ++iCounter) {
+        if (snapshot.counters[iCounter].count == 0) {
+            continue;
+        }
+
+        snprintf(buffer, sizeof(buffer), "  %s\n", dred_perf_get_counter_name(iCounter));
+        dred_file_write_string(file, buffer);
+        dred_perf_hud__write_histogram(file, &snapshot.counters[iCounter]);
+    }
+
+    dred_file_write_string(file, "\nEditor memory (bytes)\n");
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            dtk_control* pTabPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
+            if (pTabPage == NULL || pTabPage->type != DTK_CONTROL_TYPE_DRED || !dred_control_is_of_type(DRED_CONTROL(pTabPage), DRED_CONTROL_TYPE_EDITOR)) {
+                continue;
+            }
+
+            const char* editorFilePath = dred_editor_get_file_path(DRED_EDITOR(pTabPage));
+            snprintf(buffer, sizeof(buffer), "  %12llu  %s\n", (unsigned long long)dred_editor_get_memory_usage(DRED_EDITOR(pTabPage)), (editorFilePath != NULL && editorFilePath[0] != '\0') ? editorFilePath : "[untitled]");
+            dred_file_write_string(file, buffer);
+        }
+    }
+
+    dred_file_close(file);
+    return DTK_TRUE;
+}
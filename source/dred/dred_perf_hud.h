@@ -0,0 +1,44 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The performance HUD is a small overlay in the bottom right corner of the main window which shows the runtime performance
+// counters from dred_profiler.h. The counters are enabled while the HUD is showing so they cost nothing otherwise, unless
+// they have also been turned on with dred_enable_perf_counters(), in which case hiding the HUD leaves them enabled.
+//
+// The values are refreshed every DRED_PERF_HUD_REFRESH_INTERVAL milliseconds from the difference between two snapshots, so
+// rates are per second and averages are over the last interval rather than since startup. The HUD's own repaint is counted
+// as a frame.
+//
+// dred_perf_dump() is also here rather than with the counters because it needs to walk the open editors.
+
+#define DRED_PERF_HUD_REFRESH_INTERVAL  500
+#define DRED_PERF_HUD_MAX_LINES         24
+#define DRED_PERF_HUD_MAX_EDITORS       8
+
+typedef struct
+{
+    dtk_control control;
+    dred_context* pDred;
+    dtk_timer timer;
+    dtk_bool32 isTimerInitialized;
+    dred_perf_snapshot prevSnapshot;
+    dtk_uint32 lineCount;
+    char lines[DRED_PERF_HUD_MAX_LINES][128];
+} dred_perf_hud;
+
+dtk_result dred_perf_hud_init(dred_context* pDred, dred_perf_hud* pHUD);
+dtk_result dred_perf_hud_uninit(dred_perf_hud* pHUD);
+
+// Shows the HUD and enables the performance counters.
+void dred_perf_hud_show(dred_perf_hud* pHUD);
+
+// Hides the HUD and disables the performance counters, unless they were turned on with dred_enable_perf_counters(). The
+// counters are not reset so they can still be dumped.
+void dred_perf_hud_hide(dred_perf_hud* pHUD);
+
+dtk_bool32 dred_perf_hud_is_showing(dred_perf_hud* pHUD);
+
+// Sizes the HUD to fit it's text and moves it to the bottom right corner of the area above the command bar.
+void dred_perf_hud_refresh_layout(dred_perf_hud* pHUD);
+
+// Writes the counters and the memory usage of each open editor to a text file.
+dtk_bool32 dred_perf_dump(dred_context* pDred, const char* filePath);
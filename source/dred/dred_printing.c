@@ -3,3 +3,651 @@
 // This file contains only cross-platform printing related code. For platform specific stuff such as the
 // standard print dialogs will be in the platform layer.
 
+
+
+// The size of the window that's mapped into memory when exporting a file. Lines longer than this are split.
+#define DRED_PDF_EXPORT_FILE_WINDOW_SIZE    (8 * 1024 * 1024)
+
+dred_pdf_export_config dred_pdf_export_config_init()
+{
+    dred_pdf_export_config config;
+    config.title = NULL;
+    config.fontFamily = "monospace";
+    config.fontSize = 9;
+    config.tabSizeInSpaces = 4;
+    config.pageSizeX = 595;
+    config.pageSizeY = 842;
+    config.margin = 36;
+    config.showLineNumbers = DTK_FALSE;
+    config.lineCount = 0;
+
+    return config;
+}
+
+typedef struct
+{
+    const dred_pdf_export_config* pConfig;
+    double lineHeight;
+    double ascent;
+    double charWidth;
+    double gutterWidth;
+    size_t rowsPerPage;
+    size_t rowsOnPage;
+    dtk_uint32 pageCount;
+
+#ifdef DRED_GTK
+    cairo_surface_t* pSurface;
+    cairo_t* cr;
+#else
+    // Without cairo the PDF is written directly. Text uses the standard Courier font which every PDF reader has, so nothing
+    // needs to be embedded. Each page's content is built up in memory and written when the page ends. Objects 1, 2 and 3 are
+    // the catalog, the page tree and the font, which are written at the end. Each page then gets two objects, its content and
+    // the page itself.
+    FILE* pFile;
+    dtk_uint64 fileOffset;
+    dtk_uint64* pObjectOffsets;     // Indexed by object number. Only pages are recorded until the end.
+    dtk_uint32 objectCount;         // Including the reserved object 0.
+    dtk_uint32 objectCapacity;
+    char* pContent;
+    size_t contentSize;
+    size_t contentCapacity;
+    dtk_bool32 hasError;
+#endif
+} dred_pdf_export__state;
+
+#ifdef DRED_GTK
+dtk_bool32 dred_pdf_export__begin(dred_pdf_export__state* pState, const char* outputFilePath)
+{
+    assert(pState != NULL);
+
+    const dred_pdf_export_config* pConfig = pState->pConfig;
+
+    pState->pSurface = cairo_pdf_surface_create(outputFilePath, pConfig->pageSizeX, pConfig->pageSizeY);
+    if (cairo_surface_status(pState->pSurface) != CAIRO_STATUS_SUCCESS) {
+        cairo_surface_destroy(pState->pSurface);
+        pState->pSurface = NULL;
+        return DTK_FALSE;
+    }
+
+    pState->cr = cairo_create(pState->pSurface);
+    cairo_select_font_face(pState->cr, pConfig->fontFamily, CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+    cairo_set_font_size(pState->cr, pConfig->fontSize);
+    cairo_set_source_rgb(pState->cr, 0, 0, 0);
+
+    cairo_font_extents_t fontExtents;
+    cairo_font_extents(pState->cr, &fontExtents);
+    pState->lineHeight = fontExtents.height;
+    pState->ascent = fontExtents.ascent;
+
+    cairo_text_extents_t charExtents;
+    cairo_text_extents(pState->cr, "M", &charExtents);
+    pState->charWidth = charExtents.x_advance;
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_pdf_export__end(dred_pdf_export__state* pState)
+{
+    assert(pState != NULL);
+
+    if (pState->pSurface == NULL) {
+        return DTK_FALSE;
+    }
+
+    cairo_destroy(pState->cr);
+    cairo_surface_finish(pState->pSurface);
+    dtk_bool32 isSuccessful = cairo_surface_status(pState->pSurface) == CAIRO_STATUS_SUCCESS;
+    cairo_surface_destroy(pState->pSurface);
+
+    return isSuccessful;
+}
+
+double dred_pdf_export__measure_text(dred_pdf_export__state* pState, const char* text)
+{
+    cairo_text_extents_t extents;
+    cairo_text_extents(pState->cr, text, &extents);
+    return extents.x_advance;
+}
+
+// <posY> is the baseline, measured from the top of the page.
+void dred_pdf_export__show_text(dred_pdf_export__state* pState, double posX, double posY, const char* text, double gray)
+{
+    cairo_set_source_rgb(pState->cr, gray, gray, gray);
+    cairo_move_to(pState->cr, posX, posY);
+    cairo_show_text(pState->cr, text);
+}
+
+dtk_bool32 dred_pdf_export__show_page(dred_pdf_export__state* pState)
+{
+    cairo_show_page(pState->cr);
+    return cairo_status(pState->cr) == CAIRO_STATUS_SUCCESS;
+}
+#else
+void dred_pdf_export__write(dred_pdf_export__state* pState, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int length = vfprintf(pState->pFile, format, args);
+    va_end(args);
+
+    if (length < 0) {
+        pState->hasError = DTK_TRUE;
+    } else {
+        pState->fileOffset += (dtk_uint64)length;
+    }
+}
+
+void dred_pdf_export__append_content(dred_pdf_export__state* pState, const char* pData, size_t dataSize)
+{
+    if (pState->contentSize + dataSize > pState->contentCapacity) {
+        size_t newCapacity = dtk_max(pState->contentCapacity*2, pState->contentSize + dataSize + 4096);
+        char* pNewContent = (char*)dtk_realloc(pState->pContent, newCapacity);
+        if (pNewContent == NULL) {
+            pState->hasError = DTK_TRUE;
+            return;
+        }
+
+        pState->pContent = pNewContent;
+        pState->contentCapacity = newCapacity;
+    }
+
+    memcpy(pState->pContent + pState->contentSize, pData, dataSize);
+    pState->contentSize += dataSize;
+}
+
+// Records the offset of the next object in the file and returns its number.
+dtk_uint32 dred_pdf_export__begin_object(dred_pdf_export__state* pState, dtk_uint32 objectNumber)
+{
+    if (objectNumber >= pState->objectCapacity) {
+        dtk_uint32 newCapacity = dtk_max(pState->objectCapacity*2, objectNumber + 64);
+        dtk_uint64* pNewObjectOffsets = (dtk_uint64*)dtk_realloc(pState->pObjectOffsets, newCapacity * sizeof(*pNewObjectOffsets));
+        if (pNewObjectOffsets == NULL) {
+            pState->hasError = DTK_TRUE;
+            return objectNumber;
+        }
+
+        pState->pObjectOffsets = pNewObjectOffsets;
+        pState->objectCapacity = newCapacity;
+    }
+
+    pState->pObjectOffsets[objectNumber] = pState->fileOffset;
+    pState->objectCount = dtk_max(pState->objectCount, objectNumber + 1);
+
+    dred_pdf_export__write(pState, "%u 0 obj\n", objectNumber);
+    return objectNumber;
+}
+
+dtk_bool32 dred_pdf_export__begin(dred_pdf_export__state* pState, const char* outputFilePath)
+{
+    assert(pState != NULL);
+
+    if (dtk_fopen(outputFilePath, "wb", &pState->pFile) != DTK_SUCCESS) {
+        return DTK_FALSE;
+    }
+
+    // The metrics of Courier, which has a fixed advance of 600 units per em.
+    pState->charWidth  = pState->pConfig->fontSize * 0.6;
+    pState->ascent     = pState->pConfig->fontSize * 0.8;
+    pState->lineHeight = pState->pConfig->fontSize * 1.2;
+
+    pState->objectCount = 4;     // Object 0 is reserved, and 1, 2 and 3 are written at the end.
+    dred_pdf_export__write(pState, "%%PDF-1.4\n%%\xE2\xE3\xCF\xD3\n");
+
+    return !pState->hasError;
+}
+
+dtk_bool32 dred_pdf_export__end(dred_pdf_export__state* pState)
+{
+    assert(pState != NULL);
+
+    if (pState->pFile == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_pdf_export__begin_object(pState, 1);
+    dred_pdf_export__write(pState, "<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+
+    dred_pdf_export__begin_object(pState, 2);
+    dred_pdf_export__write(pState, "<< /Type /Pages /Count %u /Kids [", pState->pageCount);
+    for (dtk_uint32 iPage = 0; iPage < pState->pageCount; ++iPage) {
+        dred_pdf_export__write(pState, "%s%u 0 R", ((iPage % 16) == 0) ? "\n" : " ", 5 + iPage*2);
+    }
+    dred_pdf_export__write(pState, "\n] >>\nendobj\n");
+
+    dred_pdf_export__begin_object(pState, 3);
+    dred_pdf_export__write(pState, "<< /Type /Font /Subtype /Type1 /BaseFont /Courier /Encoding /WinAnsiEncoding >>\nendobj\n");
+
+    if (!pState->hasError) {
+        dtk_uint64 xrefOffset = pState->fileOffset;
+        dred_pdf_export__write(pState, "xref\n0 %u\n0000000000 65535 f \n", pState->objectCount);
+        for (dtk_uint32 iObject = 1; iObject < pState->objectCount; ++iObject) {
+            dred_pdf_export__write(pState, "%010llu 00000 n \n", (unsigned long long)pState->pObjectOffsets[iObject]);
+        }
+        dred_pdf_export__write(pState, "trailer\n<< /Size %u /Root 1 0 R >>\nstartxref\n%llu\n%%%%EOF\n", pState->objectCount, (unsigned long long)xrefOffset);
+    }
+
+    if (fclose(pState->pFile) != 0) {
+        pState->hasError = DTK_TRUE;
+    }
+
+    dtk_free(pState->pObjectOffsets);
+    dtk_free(pState->pContent);
+
+    return !pState->hasError;
+}
+
+double dred_pdf_export__measure_text(dred_pdf_export__state* pState, const char* text)
+{
+    size_t charCount = 0;
+    size_t textLength = strlen(text);
+    for (size_t iByte = 0; iByte < textLength; charCount += 1) {
+        uint32_t utf32;
+        iByte += drte_utf8_decode(text + iByte, textLength - iByte, &utf32);
+    }
+
+    return charCount * pState->charWidth;
+}
+
+// <posY> is the baseline, measured from the top of the page. The text is converted to the font's encoding. Characters it
+// doesn't have are shown as "?".
+void dred_pdf_export__show_text(dred_pdf_export__state* pState, double posX, double posY, const char* text, double gray)
+{
+    char header[128];
+    int headerLength = snprintf(header, sizeof(header), "%.2f g BT /F1 %.2f Tf %.2f %.2f Td (", gray, pState->pConfig->fontSize, posX, pState->pConfig->pageSizeY - posY);
+    dred_pdf_export__append_content(pState, header, (size_t)headerLength);
+
+    size_t textLength = strlen(text);
+    for (size_t iByte = 0; iByte < textLength;) {
+        uint32_t utf32;
+        iByte += drte_utf8_decode(text + iByte, textLength - iByte, &utf32);
+
+        char encoded[2];
+        size_t encodedLength = 0;
+        if (utf32 == '(' || utf32 == ')' || utf32 == '\\') {
+            encoded[encodedLength++] = '\\';
+        }
+        encoded[encodedLength++] = ((utf32 >= 32 && utf32 < 127) || (utf32 >= 160 && utf32 <= 255)) ? (char)utf32 : '?';
+
+        dred_pdf_export__append_content(pState, encoded, encodedLength);
+    }
+
+    dred_pdf_export__append_content(pState, ") Tj ET\n", 8);
+}
+
+dtk_bool32 dred_pdf_export__show_page(dred_pdf_export__state* pState)
+{
+    // pageCount has already been incremented for this page.
+    dtk_uint32 contentObject = 4 + (pState->pageCount-1)*2;
+
+    dred_pdf_export__begin_object(pState, contentObject);
+    dred_pdf_export__write(pState, "<< /Length %llu >>\nstream\n", (unsigned long long)pState->contentSize);
+    if (pState->contentSize > 0 && fwrite(pState->pContent, 1, pState->contentSize, pState->pFile) != pState->contentSize) {
+        pState->hasError = DTK_TRUE;
+    }
+    pState->fileOffset += pState->contentSize;
+    dred_pdf_export__write(pState, "\nendstream\nendobj\n");
+
+    dred_pdf_export__begin_object(pState, contentObject + 1);
+    dred_pdf_export__write(pState, "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 %.2f %.2f] /Resources << /Font << /F1 3 0 R >> >> /Contents %u 0 R >>\nendobj\n",
+        pState->pConfig->pageSizeX, pState->pConfig->pageSizeY, contentObject);
+
+    pState->contentSize = 0;
+    return !pState->hasError;
+}
+#endif
+
+dtk_bool32 dred_pdf_export__end_page(dred_pdf_export__state* pState)
+{
+    assert(pState != NULL);
+
+    const dred_pdf_export_config* pConfig = pState->pConfig;
+    double footerY = pConfig->pageSizeY - pConfig->margin - (pState->lineHeight - pState->ascent);
+
+    if (pConfig->title != NULL) {
+        dred_pdf_export__show_text(pState, pConfig->margin, footerY, pConfig->title, 0);
+    }
+
+    char pageNumber[32];
+    snprintf(pageNumber, sizeof(pageNumber), "%u", pState->pageCount);
+    dred_pdf_export__show_text(pState, pConfig->pageSizeX - pConfig->margin - dred_pdf_export__measure_text(pState, pageNumber), footerY, pageNumber, 0);
+
+    pState->rowsOnPage = 0;
+    return dred_pdf_export__show_page(pState);
+}
+
+dtk_bool32 dred_pdf_export__emit_row(dred_pdf_export__state* pState, const char* pRow, dtk_uint64 lineNumber)
+{
+    assert(pState != NULL);
+    assert(pRow != NULL);
+
+    if (pState->rowsOnPage == pState->rowsPerPage) {
+        if (!dred_pdf_export__end_page(pState)) {
+            return DTK_FALSE;
+        }
+    }
+
+    if (pState->rowsOnPage == 0) {
+        pState->pageCount += 1;
+    }
+
+    const dred_pdf_export_config* pConfig = pState->pConfig;
+    double posY = pConfig->margin + (pState->rowsOnPage * pState->lineHeight) + pState->ascent;
+
+    // Only the first row of a wrapped line gets a line number.
+    if (pConfig->showLineNumbers && lineNumber > 0) {
+        char lineNumberStr[32];
+        snprintf(lineNumberStr, sizeof(lineNumberStr), "%llu", (unsigned long long)lineNumber);
+        dred_pdf_export__show_text(pState, pConfig->margin + pState->gutterWidth - dred_pdf_export__measure_text(pState, lineNumberStr) - pState->charWidth, posY, lineNumberStr, 0.5);
+    }
+
+    if (pRow[0] != '\0') {
+        dred_pdf_export__show_text(pState, pConfig->margin + pState->gutterWidth, posY, pRow, 0);
+    }
+
+    pState->rowsOnPage += 1;
+    return DTK_TRUE;
+}
+
+dred_result dred_export_pdf(const char* outputFilePath, const dred_pdf_export_config* pConfig, dred_pdf_export_next_line_proc onNextLine, void* pUserData, dtk_uint32* pPageCountOut)
+{
+    if (pPageCountOut) *pPageCountOut = 0;
+    if (outputFilePath == NULL || onNextLine == NULL) {
+        return DRED_INVALID_ARGS;
+    }
+
+    dred_pdf_export_config config;
+    if (pConfig != NULL) {
+        config = *pConfig;
+    } else {
+        config = dred_pdf_export_config_init();
+    }
+
+    if (config.fontFamily == NULL) {
+        config.fontFamily = "monospace";
+    }
+    if (config.fontSize <= 0) {
+        config.fontSize = 9;
+    }
+    if (config.tabSizeInSpaces == 0) {
+        config.tabSizeInSpaces = 1;
+    }
+
+    dred_pdf_export__state state;
+    memset(&state, 0, sizeof(state));
+    state.pConfig = &config;
+    if (!dred_pdf_export__begin(&state, outputFilePath)) {
+        return DRED_ERROR;
+    }
+
+    dred_result result = DRED_SUCCESS;
+    char* pRow = NULL;
+    size_t columnsPerRow;
+    dtk_uint64 lineNumber = 0;
+    const char* pLine;
+    size_t lineLength;
+
+    if (state.charWidth <= 0 || state.lineHeight <= 0) {
+        result = DRED_ERROR;
+        goto done;
+    }
+
+    if (config.showLineNumbers) {
+        unsigned int digitCount = 1;
+        for (dtk_uint64 n = (config.lineCount > 0) ? config.lineCount : 999999; n >= 10; n /= 10) {
+            digitCount += 1;
+        }
+
+        state.gutterWidth = (digitCount + 2) * state.charWidth;
+    }
+
+    // The last two rows of each page are reserved for the footer.
+    columnsPerRow = (size_t)((config.pageSizeX - (config.margin*2) - state.gutterWidth) / state.charWidth);
+    if (columnsPerRow == 0) {
+        columnsPerRow = 1;
+    }
+
+    state.rowsPerPage = (size_t)((config.pageSizeY - (config.margin*2)) / state.lineHeight);
+    state.rowsPerPage = (state.rowsPerPage > 2) ? state.rowsPerPage - 2 : 1;
+
+    pRow = (char*)malloc((columnsPerRow * 4) + 1);
+    if (pRow == NULL) {
+        result = DRED_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    while (onNextLine(pUserData, &pLine, &lineLength)) {
+        lineNumber += 1;
+
+        // Each iteration fills one row. Tabs are expanded to spaces and control characters are replaced with spaces. Invalid
+        // UTF-8 is replaced with U+FFFD so the PDF backend never sees it.
+        size_t iByte = 0;
+        dtk_bool32 isFirstRow = DTK_TRUE;
+        do {
+            size_t rowLength = 0;
+            size_t column = 0;
+            while (iByte < lineLength && column < columnsPerRow) {
+                uint32_t utf32;
+                size_t byteCount = drte_utf8_decode(pLine + iByte, lineLength - iByte, &utf32);
+
+                if (utf32 == '\t') {
+                    size_t spaceCount = config.tabSizeInSpaces - (column % config.tabSizeInSpaces);
+                    if (spaceCount > columnsPerRow - column) {
+                        spaceCount = columnsPerRow - column;
+                    }
+
+                    memset(pRow + rowLength, ' ', spaceCount);
+                    rowLength += spaceCount;
+                    column += spaceCount;
+                } else {
+                    if (utf32 < 32 || utf32 == 127) {
+                        utf32 = ' ';
+                    }
+
+                    rowLength += drte_utf8_encode(utf32, pRow + rowLength);
+                    column += 1;
+                }
+
+                iByte += byteCount;
+            }
+
+            pRow[rowLength] = '\0';
+            if (!dred_pdf_export__emit_row(&state, pRow, (isFirstRow) ? lineNumber : 0)) {
+                result = DRED_ERROR;
+                goto done;
+            }
+
+            isFirstRow = DTK_FALSE;
+        } while (iByte < lineLength);
+    }
+
+    // An empty document still gets a single blank page.
+    if (state.rowsOnPage > 0 || state.pageCount == 0) {
+        if (state.pageCount == 0) {
+            state.pageCount = 1;
+        }
+
+        if (!dred_pdf_export__end_page(&state)) {
+            result = DRED_ERROR;
+            goto done;
+        }
+    }
+
+done:
+    free(pRow);
+    if (!dred_pdf_export__end(&state) && result == DRED_SUCCESS) {
+        result = DRED_ERROR;
+    }
+
+    if (result == DRED_SUCCESS && pPageCountOut) {
+        *pPageCountOut = state.pageCount;
+    }
+
+    return result;
+}
+
+
+typedef struct
+{
+    drte_engine* pEngine;
+    size_t iLine;
+    size_t lineCount;
+} dred_pdf_export__engine_source;
+
+dtk_bool32 dred_pdf_export__on_next_engine_line(void* pUserData, const char** ppLine, size_t* pLineLength)
+{
+    dred_pdf_export__engine_source* pSource = (dred_pdf_export__engine_source*)pUserData;
+    assert(pSource != NULL);
+
+    if (pSource->iLine >= pSource->lineCount) {
+        return DTK_FALSE;
+    }
+
+    size_t iLineCharBeg;
+    size_t iLineCharEnd;
+    drte_engine__get_unwrapped_line_range(pSource->pEngine, pSource->iLine, &iLineCharBeg, &iLineCharEnd);
+
+    *ppLine = pSource->pEngine->text + iLineCharBeg;
+    *pLineLength = iLineCharEnd - iLineCharBeg;
+
+    pSource->iLine += 1;
+    return DTK_TRUE;
+}
+
+dred_result dred_export_text_engine_to_pdf(drte_engine* pEngine, const char* outputFilePath, const dred_pdf_export_config* pConfig, dtk_uint32* pPageCountOut)
+{
+    if (pPageCountOut) *pPageCountOut = 0;
+    if (pEngine == NULL) {
+        return DRED_INVALID_ARGS;
+    }
+
+    dred_pdf_export__engine_source source;
+    source.pEngine = pEngine;
+    source.iLine = 0;
+    source.lineCount = (pEngine->text != NULL) ? drte_line_cache_get_line_count(pEngine->pUnwrappedLines) : 0;
+
+    dred_pdf_export_config config = (pConfig != NULL) ? *pConfig : dred_pdf_export_config_init();
+    config.lineCount = source.lineCount;
+
+    return dred_export_pdf(outputFilePath, &config, dred_pdf_export__on_next_engine_line, &source, pPageCountOut);
+}
+
+
+typedef struct
+{
+    dtk_mapped_file file;
+    dtk_mapped_view window;     // window.pData is null when nothing is mapped.
+    dtk_uint64 offset;          // The offset of the next line.
+} dred_pdf_export__file_source;
+
+dtk_bool32 dred_pdf_export__map_file_window(dred_pdf_export__file_source* pSource, dtk_uint64 offset)
+{
+    assert(pSource != NULL);
+
+    if (pSource->window.pData != NULL) {
+        dtk_mapped_file_unmap(&pSource->file, &pSource->window);
+        pSource->window.pData = NULL;
+    }
+
+    if (dtk_mapped_file_map(&pSource->file, offset, DRED_PDF_EXPORT_FILE_WINDOW_SIZE, &pSource->window) != DTK_SUCCESS) {
+        pSource->window.pData = NULL;
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
+dtk_bool32 dred_pdf_export__on_next_file_line(void* pUserData, const char** ppLine, size_t* pLineLength)
+{
+    dred_pdf_export__file_source* pSource = (dred_pdf_export__file_source*)pUserData;
+    assert(pSource != NULL);
+
+    if (pSource->offset >= pSource->file.fileSize) {
+        return DTK_FALSE;
+    }
+
+    if (pSource->window.pData == NULL || pSource->offset < pSource->window.offset || pSource->offset >= pSource->window.offset + pSource->window.dataSize) {
+        if (!dred_pdf_export__map_file_window(pSource, pSource->offset)) {
+            return DTK_FALSE;
+        }
+    }
+
+    size_t iLineBeg = (size_t)(pSource->offset - pSource->window.offset);
+    const char* pLineBeg = (const char*)pSource->window.pData + iLineBeg;
+    const char* pLineEnd = (const char*)memchr(pLineBeg, '\n', pSource->window.dataSize - iLineBeg);
+
+    // If the new line is not in the current window, try again with the window starting at this line. If it's still not found
+    // the line is either the last one or longer than the window, in which case it'll be split.
+    if (pLineEnd == NULL && pSource->window.offset + pSource->window.dataSize < pSource->file.fileSize && iLineBeg > 0) {
+        if (!dred_pdf_export__map_file_window(pSource, pSource->offset)) {
+            return DTK_FALSE;
+        }
+
+        iLineBeg = 0;
+        pLineBeg = (const char*)pSource->window.pData;
+        pLineEnd = (const char*)memchr(pLineBeg, '\n', pSource->window.dataSize);
+    }
+
+    size_t lineLength;
+    if (pLineEnd != NULL) {
+        lineLength = (size_t)(pLineEnd - pLineBeg);
+        pSource->offset += lineLength + 1;
+    } else {
+        lineLength = pSource->window.dataSize - iLineBeg;
+        pSource->offset += lineLength;
+    }
+
+    if (lineLength > 0 && pLineBeg[lineLength-1] == '\r') {
+        lineLength -= 1;
+    }
+
+    *ppLine = pLineBeg;
+    *pLineLength = lineLength;
+    return DTK_TRUE;
+}
+
+dred_result dred_export_file_to_pdf(const char* inputFilePath, const char* outputFilePath, const dred_pdf_export_config* pConfig, dtk_uint32* pPageCountOut)
+{
+    if (pPageCountOut) *pPageCountOut = 0;
+    if (inputFilePath == NULL) {
+        return DRED_INVALID_ARGS;
+    }
+
+    dred_pdf_export__file_source source;
+    memset(&source, 0, sizeof(source));
+    if (dtk_mapped_file_open(inputFilePath, DTK_FALSE, &source.file) != DTK_SUCCESS) {
+        return DRED_ERROR;
+    }
+
+    dred_pdf_export_config config = (pConfig != NULL) ? *pConfig : dred_pdf_export_config_init();
+
+    // The line count is only needed for sizing the line number gutter. It's a quick pass over the file without any layout.
+    if (config.showLineNumbers && config.lineCount == 0 && source.file.fileSize > 0) {
+        config.lineCount = 1;
+        for (dtk_uint64 offset = 0; offset < source.file.fileSize; offset += source.window.dataSize) {
+            if (!dred_pdf_export__map_file_window(&source, offset)) {
+                break;
+            }
+
+            // A zero sized window would never advance the offset.
+            if (source.window.dataSize == 0) {
+                break;
+            }
+
+            const char* pData = (const char*)source.window.pData;
+            const char* pDataEnd = pData + source.window.dataSize;
+            while ((pData = (const char*)memchr(pData, '\n', (size_t)(pDataEnd - pData))) != NULL) {
+                config.lineCount += 1;
+                pData += 1;
+            }
+        }
+    }
+
+    dred_result result = dred_export_pdf(outputFilePath, &config, dred_pdf_export__on_next_file_line, &source, pPageCountOut);
+
+    if (source.window.pData != NULL) {
+        dtk_mapped_file_unmap(&source.file, &source.window);
+    }
+    dtk_mapped_file_close(&source.file);
+
+    return result;
+}
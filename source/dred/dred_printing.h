@@ -6,4 +6,44 @@ typedef struct
     unsigned int firstPage;
     unsigned int lastPage;
     unsigned int copies;
-} dred_print_info;
\ No newline at end of file
+} dred_print_info;
+
+// PDF Export
+//
+// Documents are exported to PDF without going through the print dialog or laying the document out through a text view. Lines
+// are pulled one at a time from a callback, broken into rows at a fixed number of columns (the font is assumed to be
+// monospaced), and each page is emitted as soon as it fills up. Only a single row is held in memory at a time, so exporting
+// doesn't get any more expensive as the document gets bigger.
+//
+// This does not require a display which means it can be used from "dred -f export-pdf". When cairo is available it's used for
+// rendering and the font family in the config is honoured. Otherwise the PDF is written directly using the standard Courier
+// font, in which case only characters in the Windows-1252 code page can be shown and the rest are replaced with "?".
+
+// Retrieves the next line of the document. The line should not include the new line character. Return DTK_FALSE when there
+// are no more lines. The returned pointer only needs to remain valid until the next call.
+typedef dtk_bool32 (* dred_pdf_export_next_line_proc)(void* pUserData, const char** ppLine, size_t* pLineLength);
+
+typedef struct
+{
+    const char* title;              // Shown at the bottom of each page. Can be null.
+    const char* fontFamily;         // Should be a monospaced font.
+    double fontSize;                // In points.
+    unsigned int tabSizeInSpaces;
+    double pageSizeX;               // In points. Defaults to A4.
+    double pageSizeY;
+    double margin;                  // In points.
+    dtk_bool32 showLineNumbers;
+    dtk_uint64 lineCount;           // Used for sizing the line number gutter. Can be 0 if unknown.
+} dred_pdf_export_config;
+
+// Initializes a PDF export config with default settings.
+dred_pdf_export_config dred_pdf_export_config_init();
+
+// Exports the lines returned by onNextLine to a PDF file. pPageCountOut can be null.
+dred_result dred_export_pdf(const char* outputFilePath, const dred_pdf_export_config* pConfig, dred_pdf_export_next_line_proc onNextLine, void* pUserData, dtk_uint32* pPageCountOut);
+
+// Exports the text of the given text engine to a PDF file. This reads straight from the engine's line index.
+dred_result dred_export_text_engine_to_pdf(drte_engine* pEngine, const char* outputFilePath, const dred_pdf_export_config* pConfig, dtk_uint32* pPageCountOut);
+
+// Exports a file to PDF. The file is streamed through a memory mapped window rather than being loaded in it's entirety.
+dred_result dred_export_file_to_pdf(const char* inputFilePath, const char* outputFilePath, const dred_pdf_export_config* pConfig, dtk_uint32* pPageCountOut);
@@ -0,0 +1,320 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+void dred_profiler_init(dred_profiler* pProfiler, const char* traceFilePath)
+{
+    if (pProfiler == NULL) {
+        return;
+    }
+
+    dred_zero_object(pProfiler);
+
+    if (traceFilePath != NULL) {
+        strcpy_s(pProfiler->traceFilePath, sizeof(pProfiler->traceFilePath), traceFilePath);
+    }
+
+    pProfiler->baseTime = dtk_now_nanoseconds();
+    pProfiler->isEnabled = DTK_TRUE;
+}
+
+dtk_bool32 dred_profiler_is_enabled(const dred_profiler* pProfiler)
+{
+    return pProfiler != NULL && pProfiler->isEnabled;
+}
+
+static dred_profiler_event* dred_profiler__push_event(dred_profiler* pProfiler, const char* name)
+{
+    dtk_assert(pProfiler != NULL);
+
+    if (pProfiler->eventCount == DRED_PROFILER_MAX_EVENTS) {
+        return NULL;
+    }
+
+    dred_profiler_event* pEvent = &pProfiler->events[pProfiler->eventCount];
+    pEvent->name    = name;
+    pEvent->begTime = dtk_now_nanoseconds() - pProfiler->baseTime;
+    pEvent->endTime = pEvent->begTime;
+    pEvent->depth   = pProfiler->depth;
+
+    pProfiler->eventCount += 1;
+    return pEvent;
+}
+
+void dred_profiler_begin(dred_profiler* pProfiler, const char* name)
+{
+    if (!dred_profiler_is_enabled(pProfiler)) {
+        return;
+    }
+
+    // When the stack is full the timer is still counted so that begin/end pairs stay balanced, it just isn't recorded.
+    if (pProfiler->depth < DRED_PROFILER_MAX_DEPTH) {
+        pProfiler->openEvents[pProfiler->depth] = (dred_profiler__push_event(pProfiler, name) != NULL) ? pProfiler->eventCount-1 : (dtk_uint32)-1;
+    }
+
+    pProfiler->depth += 1;
+}
+
+void dred_profiler_end(dred_profiler* pProfiler)
+{
+    if (!dred_profiler_is_enabled(pProfiler) || pProfiler->depth == 0) {
+        return;
+    }
+
+    pProfiler->depth -= 1;
+
+    if (pProfiler->depth < DRED_PROFILER_MAX_DEPTH) {
+        dtk_uint32 iEvent = pProfiler->openEvents[pProfiler->depth];
+        if (iEvent != (dtk_uint32)-1) {
+            pProfiler->events[iEvent].endTime = dtk_now_nanoseconds() - pProfiler->baseTime;
+        }
+    }
+}
+
+void dred_profiler_mark(dred_profiler* pProfiler, const char* name)
+{
+    if (!dred_profiler_is_enabled(pProfiler)) {
+        return;
+    }
+
+    dred_profiler__push_event(pProfiler, name);
+}
+
+
+static void dred_profiler__write_log(dred_profiler* pProfiler, dred_context* pDred)
+{
+    dtk_assert(pProfiler != NULL);
+
+    for (dtk_uint32 iEvent = 0; iEvent < pProfiler->eventCount; ++iEvent) {
+        const dred_profiler_event* pEvent = &pProfiler->events[iEvent];
+        if (pEvent->endTime == pEvent->begTime) {
+            dred_logf(pDred, "[PROFILE] %*s%s @ %.3f ms", (int)(pEvent->depth*2), "", pEvent->name, pEvent->begTime / 1000000.0);
+        } else {
+            dred_logf(pDred, "[PROFILE] %*s%s: %.3f ms", (int)(pEvent->depth*2), "", pEvent->name, (pEvent->endTime - pEvent->begTime) / 1000000.0);
+        }
+    }
+}
+
+static void dred_profiler__write_json_string(dred_file file, const char* str)
+{
+    char escaped[512];
+    size_t len = 0;
+    for (const char* c = str; *c != '\0' && len < sizeof(escaped)-3; ++c) {
+        if (*c == '"' || *c == '\\') {
+            escaped[len++] = '\\';
+        }
+        escaped[len++] = *c;
+    }
+    escaped[len] = '\0';
+
+    dred_file_write_string(file, "\"");
+    dred_file_write_string(file, escaped);
+    dred_file_write_string(file, "\"");
+}
+
+static dtk_bool32 dred_profiler__write_trace(dred_profiler* pProfiler, dred_context* pDred)
+{
+    dtk_assert(pProfiler != NULL);
+
+    dred_file file = dred_file_open(pProfiler->traceFilePath, DRED_FILE_OPEN_MODE_WRITE);
+    if (file == NULL) {
+        dred_errorf(pDred, "Failed to open %s for writing the startup profile.", pProfiler->traceFilePath);
+        return DTK_FALSE;
+    }
+
+    // Timestamps in the Chrome trace format are in microseconds, but fractions are allowed so no precision is lost.
+    dred_file_write_string(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (dtk_uint32 iEvent = 0; iEvent < pProfiler->eventCount; ++iEvent) {
+        const dred_profiler_event* pEvent = &pProfiler->events[iEvent];
+
+        char buffer[256];
+        dred_file_write_string(file, "{\"name\":");
+        dred_profiler__write_json_string(file, pEvent->name);
+        if (pEvent->endTime == pEvent->begTime) {
+            snprintf(buffer, sizeof(buffer), ",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":1}",
+                (unsigned long long)(pEvent->begTime / 1000), (unsigned int)(pEvent->begTime % 1000));
+        } else {
+            dtk_uint64 duration = pEvent->endTime - pEvent->begTime;
+            snprintf(buffer, sizeof(buffer), ",\"cat\":\"startup\",\"ph\":\"X\",\"ts\":%llu.%03u,\"dur\":%llu.%03u,\"pid\":1,\"tid\":1}",
+                (unsigned long long)(pEvent->begTime / 1000), (unsigned int)(pEvent->begTime % 1000),
+                (unsigned long long)(duration / 1000), (unsigned int)(duration % 1000));
+        }
+        dred_file_write_string(file, buffer);
+        dred_file_write_string(file, (iEvent+1 < pProfiler->eventCount) ? ",\n" : "\n");
+    }
+    dred_file_write_string(file, "]}\n");
+
+    dred_file_close(file);
+    return DTK_TRUE;
+}
+
+void dred_profiler_flush(dred_profiler* pProfiler, dred_context* pDred)
+{
+    if (!dred_profiler_is_enabled(pProfiler)) {
+        return;
+    }
+
+    while (pProfiler->depth > 0) {
+        dred_profiler_end(pProfiler);
+    }
+
+    if (pProfiler->traceFilePath[0] != '\0') {
+        if (dred_profiler__write_trace(pProfiler, pDred)) {
+            dred_logf(pDred, "Startup profile written to %s", pProfiler->traceFilePath);
+        }
+    } else {
+        dred_profiler__write_log(pProfiler, pDred);
+    }
+
+    if (pProfiler->eventCount == DRED_PROFILER_MAX_EVENTS) {
+        dred_warning(pDred, "The startup profile was truncated because it ran out of events.");
+    }
+
+    pProfiler->isEnabled = DTK_FALSE;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Runtime Performance Counters
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER)
+#define dred_perf__atomic_add_64(dst, value)                        InterlockedExchangeAdd64((volatile LONGLONG*)(dst), (LONGLONG)(value))
+#define dred_perf__atomic_compare_exchange_64(dst, expected, desired) (dtk_uint64)InterlockedCompareExchange64((volatile LONGLONG*)(dst), (LONGLONG)(desired), (LONGLONG)(expected))
+#else
+#define dred_perf__atomic_add_64(dst, value)                        __sync_add_and_fetch((dst), (value))
+#define dred_perf__atomic_compare_exchange_64(dst, expected, desired) __sync_val_compare_and_swap((dst), (expected), (desired))
+#endif
+
+volatile dtk_bool32 g_dredPerfCountersEnabled = DTK_FALSE;
+dred_perf_counter g_dredPerfCounters[DRED_PERF_COUNTER_COUNT];
+
+// The amount of time the counters have been enabled for since they were last reset. Used for reporting rates in the dump.
+static dtk_uint64 g_dredPerfEnabledTime = 0;
+static dtk_uint64 g_dredPerfEnabledSince = 0;
+
+void dred_perf_set_enabled(dtk_bool32 enabled)
+{
+    enabled = (enabled) ? DTK_TRUE : DTK_FALSE;
+    if (enabled == g_dredPerfCountersEnabled) {
+        return;
+    }
+
+    if (enabled) {
+        g_dredPerfEnabledSince = dtk_now_nanoseconds();
+    } else {
+        g_dredPerfEnabledTime += dtk_now_nanoseconds() - g_dredPerfEnabledSince;
+    }
+
+    g_dredPerfCountersEnabled = enabled;
+}
+
+dtk_bool32 dred_perf_is_enabled()
+{
+    return g_dredPerfCountersEnabled;
+}
+
+dtk_uint64 dred_perf_get_enabled_time()
+{
+    dtk_uint64 enabledTime = g_dredPerfEnabledTime;
+    if (g_dredPerfCountersEnabled) {
+        enabledTime += dtk_now_nanoseconds() - g_dredPerfEnabledSince;
+    }
+
+    return enabledTime;
+}
+
+void dred_perf_reset()
+{
+    dtk_zero_memory(g_dredPerfCounters, sizeof(g_dredPerfCounters));
+
+    g_dredPerfEnabledTime = 0;
+    g_dredPerfEnabledSince = dtk_now_nanoseconds();
+}
+
+const char* dred_perf_get_counter_name(dtk_uint32 counter)
+{
+    switch (counter)
+    {
+        case DRED_PERF_COUNTER_FRAME:               return "frame";
+        case DRED_PERF_COUNTER_VIEW_PAINT:          return "view-paint";
+        case DRED_PERF_COUNTER_MEASURE_STRING:      return "measure-string";
+        case DRED_PERF_COUNTER_WORD_WRAP:           return "word-wrap";
+        case DRED_PERF_COUNTER_PAINT_QUEUE_ENQUEUE: return "paint-queue-enqueue";
+        case DRED_PERF_COUNTER_FILE_LOAD:           return "file-load";
+        case DRED_PERF_COUNTER_FILE_SAVE:           return "file-save";
+        case DRED_PERF_COUNTER_UNDO_COMMIT:         return "undo-commit";
+        default: return "";
+    }
+}
+
+static dtk_uint32 dred_perf__get_histogram_bucket(dtk_uint64 duration)
+{
+    dtk_uint64 microseconds = duration / 1000;
+
+    dtk_uint32 bucket = 0;
+    while (microseconds > 0 && bucket < DRED_PERF_HISTOGRAM_BUCKET_COUNT-1) {
+        microseconds >>= 1;
+        bucket += 1;
+    }
+
+    return bucket;
+}
+
+void dred_perf_record(dtk_uint32 counter, dtk_uint64 duration)
+{
+    if (counter >= DRED_PERF_COUNTER_COUNT) {
+        return;
+    }
+
+    dred_perf_counter* pCounter = &g_dredPerfCounters[counter];
+    dred_perf__atomic_add_64(&pCounter->count, 1);
+    dred_perf__atomic_add_64(&pCounter->totalTime, duration);
+    dred_perf__atomic_add_64(&pCounter->histogram[dred_perf__get_histogram_bucket(duration)], 1);
+
+    // The maximum needs a compare-exchange loop so a longer duration from another thread is never overwritten.
+    dtk_uint64 maxTime = pCounter->maxTime;
+    while (duration > maxTime) {
+        dtk_uint64 prevMaxTime = dred_perf__atomic_compare_exchange_64(&pCounter->maxTime, maxTime, duration);
+        if (prevMaxTime == maxTime) {
+            break;
+        }
+
+        maxTime = prevMaxTime;
+    }
+}
+
+void dred_perf_take_snapshot(dred_perf_snapshot* pSnapshot)
+{
+    if (pSnapshot == NULL) {
+        return;
+    }
+
+    // Counters may be updated while they're being copied so the values can be slightly inconsistent with each other. That's
+    // fine for display purposes.
+    pSnapshot->time = dtk_now_nanoseconds();
+    memcpy(pSnapshot->counters, g_dredPerfCounters, sizeof(pSnapshot->counters));
+}
+
+dtk_uint64 dred_perf_get_percentile(const dred_perf_counter* pCounter, double percentile)
+{
+    if (pCounter == NULL || pCounter->count == 0) {
+        return 0;
+    }
+
+    dtk_uint64 target = (dtk_uint64)(pCounter->count * percentile);
+    dtk_uint64 runningCount = 0;
+    for (dtk_uint32 iBucket = 0; iBucket < DRED_PERF_HISTOGRAM_BUCKET_COUNT; ++iBucket) {
+        runningCount += pCounter->histogram[iBucket];
+        if (runningCount > target) {
+            if (iBucket == DRED_PERF_HISTOGRAM_BUCKET_COUNT-1) {
+                break;  // The last bucket has no upper bound.
+            }
+
+            return ((dtk_uint64)1 << iBucket) * 1000;
+        }
+    }
+
+    return pCounter->maxTime;
+}
+
@@ -0,0 +1,140 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// A simple scoped profiler for measuring where startup time goes. It's enabled by passing --profile-startup on the command
+// line. Timers are nested with dred_profiler_begin() and dred_profiler_end(), and the results are written once the main
+// window has been painted for the first time.
+//
+// By default the results are written to the log. To write a Chrome trace instead, pass --profile-startup-trace <path>, which
+// also enables the profiler. The trace can be viewed with chrome://tracing or any compatible viewer. The path is only ever
+// taken from this option so that a file passed on the command line can never be overwritten by the trace.
+//
+// The profiler is not thread-safe. It must only be used from the main thread.
+
+#define DRED_PROFILER_MAX_EVENTS    256
+#define DRED_PROFILER_MAX_DEPTH     16
+
+typedef struct
+{
+    const char* name;           // Not copied. Must be a string literal or otherwise outlive the profiler.
+    dtk_uint64 begTime;         // In nanoseconds, relative to when the profiler was initialized.
+    dtk_uint64 endTime;         // In nanoseconds, relative to when the profiler was initialized. Equal to begTime for marks.
+    dtk_uint32 depth;
+} dred_profiler_event;
+
+typedef struct
+{
+    dtk_bool32 isEnabled;
+    dtk_uint64 baseTime;
+    dred_profiler_event events[DRED_PROFILER_MAX_EVENTS];
+    dtk_uint32 eventCount;
+    dtk_uint32 openEvents[DRED_PROFILER_MAX_DEPTH];  // A stack of indices into events for timers that have not yet ended.
+    dtk_uint32 depth;
+    char traceFilePath[DRED_MAX_PATH];              // Empty when the results are written to the log.
+} dred_profiler;
+
+// Initializes and enables the profiler. The trace file path can be null in which case the results will be written to
+// the log when the profiler is flushed.
+void dred_profiler_init(dred_profiler* pProfiler, const char* traceFilePath);
+
+// Determines whether or not the profiler is enabled. Timers are ignored when the profiler is disabled.
+dtk_bool32 dred_profiler_is_enabled(const dred_profiler* pProfiler);
+
+// Starts a timer. Every call to this must be paired with a call to dred_profiler_end().
+void dred_profiler_begin(dred_profiler* pProfiler, const char* name);
+
+// Ends the most recently started timer.
+void dred_profiler_end(dred_profiler* pProfiler);
+
+// Records an instantaneous event.
+void dred_profiler_mark(dred_profiler* pProfiler, const char* name);
+
+// Writes the results to the log or trace file and then disables the profiler. Any timers that are still open are ended.
+void dred_profiler_flush(dred_profiler* pProfiler, dred_context* pDred);
+
+
+// Runtime Performance Counters
+// ============================
+//
+// The counters measure operations that happen while dred is running, such as painting and measuring strings, so that when
+// things feel slow it's possible to tell where the time is going. They can be viewed with the "toggle-perf-hud" command and
+// written to a file with the "perf-dump" command. The counters are recorded while the HUD is showing, or while recording has
+// been turned on with "perf-counters on", which is how to measure something without the HUD's own painting in the results.
+//
+// Each counter tracks the number of times the operation happened, the total and longest time spent in it, and a histogram of
+// durations. Some operations are inside dtk and the text engine, which feed the counters through the DTK_PERF_* and DRTE_PERF_*
+// hooks defined in dred.h. Because of this the counters are global rather than part of the context.
+//
+// The counters are disabled by default. While disabled, an instrumented operation costs a single branch. They can be updated
+// from any thread.
+
+#define DRED_PERF_COUNTER_FRAME                 0   // A paint of the main window.
+#define DRED_PERF_COUNTER_VIEW_PAINT            1   // drte_view_paint()
+#define DRED_PERF_COUNTER_MEASURE_STRING        2   // dtk_font_measure_string()
+#define DRED_PERF_COUNTER_WORD_WRAP             3   // Refreshing the word wrapping of a text view.
+#define DRED_PERF_COUNTER_PAINT_QUEUE_ENQUEUE   4   // dtk_paint_queue_enqueue()
+#define DRED_PERF_COUNTER_FILE_LOAD             5
+#define DRED_PERF_COUNTER_FILE_SAVE             6
+#define DRED_PERF_COUNTER_UNDO_COMMIT           7   // drte_engine_commit_undo_point()
+#define DRED_PERF_COUNTER_COUNT                 8
+
+// Bucket 0 of the histogram is for durations under 1 microsecond. Bucket i holds durations from 2^(i-1) up to, but not including,
+// 2^i microseconds, except for the last bucket which holds everything longer.
+#define DRED_PERF_HISTOGRAM_BUCKET_COUNT        20
+
+typedef struct
+{
+    dtk_uint64 count;
+    dtk_uint64 totalTime;       // In nanoseconds.
+    dtk_uint64 maxTime;         // In nanoseconds.
+    dtk_uint64 histogram[DRED_PERF_HISTOGRAM_BUCKET_COUNT];
+} dred_perf_counter;
+
+typedef struct
+{
+    dtk_uint64 time;            // The value of dtk_now_nanoseconds() when the snapshot was taken.
+    dred_perf_counter counters[DRED_PERF_COUNTER_COUNT];
+} dred_perf_snapshot;
+
+// These should not be accessed directly. They're only exposed so dred_perf_begin() and dred_perf_end() can be inlined.
+extern volatile dtk_bool32 g_dredPerfCountersEnabled;
+extern dred_perf_counter g_dredPerfCounters[DRED_PERF_COUNTER_COUNT];
+
+// Enables or disables the counters. Disabling the counters does not reset them.
+void dred_perf_set_enabled(dtk_bool32 enabled);
+
+// Determines whether or not the counters are enabled.
+dtk_bool32 dred_perf_is_enabled();
+
+// Retrieves the number of nanoseconds the counters have been enabled for since they were last reset.
+dtk_uint64 dred_perf_get_enabled_time();
+
+// Resets every counter to zero.
+void dred_perf_reset();
+
+// Retrieves the name of a counter, such as "measure-string".
+const char* dred_perf_get_counter_name(dtk_uint32 counter);
+
+// Records a single occurrence of an operation that took the given number of nanoseconds.
+void dred_perf_record(dtk_uint32 counter, dtk_uint64 duration);
+
+// Marks the beginning of an instrumented operation. The returned value is passed to dred_perf_end(). It's 0 when the counters
+// are disabled.
+DTK_INLINE dtk_uint64 dred_perf_begin()
+{
+    return g_dredPerfCountersEnabled ? dtk_now_nanoseconds() : 0;
+}
+
+// Marks the end of an instrumented operation.
+DTK_INLINE void dred_perf_end(dtk_uint32 counter, dtk_uint64 begTime)
+{
+    if (begTime != 0) {
+        dred_perf_record(counter, dtk_now_nanoseconds() - begTime);
+    }
+}
+
+// Takes a copy of every counter.
+void dred_perf_take_snapshot(dred_perf_snapshot* pSnapshot);
+
+// Estimates a percentile, between 0 and 1, of the durations recorded by a counter. This comes from the histogram so the returned
+// value is the upper bound of the bucket the percentile falls in, in nanoseconds.
+dtk_uint64 dred_perf_get_percentile(const dred_perf_counter* pCounter, double percentile);
@@ -0,0 +1,387 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+static void dred_placeholder_editor__on_paint(dred_control* pControl, dred_rect rect, dtk_surface* pSurface)
+{
+    (void)rect;
+
+    dred_context* pDred = dred_control_get_context(pControl);
+    assert(pDred != NULL);
+
+    // Placeholders are normally replaced before they're ever shown, but if the file failed to load we still need to draw
+    // something sensible.
+    dred_control_draw_rect(pControl, dred_make_rect(0, 0, dred_control_get_width(pControl), dred_control_get_height(pControl)), pDred->config.textEditorBGColor, pSurface);
+}
+
+dred_placeholder_editor* dred_placeholder_editor_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute, const char* editorType)
+{
+    if (filePathAbsolute == NULL || filePathAbsolute[0] == '\0' || editorType == NULL) {
+        return NULL;    // Only files on disk can be restored.
+    }
+
+    dred_placeholder_editor* pPlaceholder = (dred_placeholder_editor*)calloc(1, sizeof(*pPlaceholder));
+    if (pPlaceholder == NULL) {
+        return NULL;
+    }
+
+    if (strcpy_s(pPlaceholder->editorType, sizeof(pPlaceholder->editorType), editorType) != 0) {
+        free(pPlaceholder);
+        return NULL;
+    }
+
+    if (!dred_editor_init(DRED_EDITOR(pPlaceholder), pDred, pParent, DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR, NULL, sizeX, sizeY, filePathAbsolute)) {
+        free(pPlaceholder);
+        return NULL;
+    }
+
+    dred_control_set_on_paint(DRED_CONTROL(pPlaceholder), dred_placeholder_editor__on_paint);
+
+    return pPlaceholder;
+}
+
+void dred_placeholder_editor_delete(dred_placeholder_editor* pPlaceholder)
+{
+    if (pPlaceholder == NULL) {
+        return;
+    }
+
+    dred_editor_uninit(DRED_EDITOR(pPlaceholder));
+    free(pPlaceholder);
+}
+
+
+static size_t dred_session__get_file_path(dred_context* pDred, char* pathOut, size_t pathOutSize)
+{
+    char configFolderPath[DRED_MAX_PATH];
+    if (dred_get_config_folder_path(pDred, configFolderPath, sizeof(configFolderPath)) == 0) {
+        return 0;
+    }
+
+    return dtk_path_append(pathOut, pathOutSize, configFolderPath, ".dredsession");
+}
+
+// Paths and editor types are written inside double quotes, so any character that would end the token or the value early
+// is percent-encoded. The key/value parser treats '#' as the start of a comment, and the tokenizer gives a backslash before
+// a quote special meaning, so those are encoded as well as '%' itself and control characters.
+static dtk_bool32 dred_session__encode_string(const char* str, char* strOut, size_t strOutSize)
+{
+    static const char* hex = "0123456789ABCDEF";
+
+    size_t iOut = 0;
+    for (const unsigned char* pC = (const unsigned char*)str; pC[0] != '\0'; ++pC) {
+        if (pC[0] < 0x20 || pC[0] == 0x7F || pC[0] == '%' || pC[0] == '"' || pC[0] == '#' || pC[0] == '\\') {
+            if (iOut + 3 >= strOutSize) {
+                return DTK_FALSE;
+            }
+
+            strOut[iOut++] = '%';
+            strOut[iOut++] = hex[pC[0] >> 4];
+            strOut[iOut++] = hex[pC[0] & 0x0F];
+        } else {
+            if (iOut + 1 >= strOutSize) {
+                return DTK_FALSE;
+            }
+
+            strOut[iOut++] = (char)pC[0];
+        }
+    }
+
+    strOut[iOut] = '\0';
+    return DTK_TRUE;
+}
+
+static int dred_session__hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+// Decodes a string that was encoded with dred_session__encode_string(), in place. Returns false if the string is malformed.
+static dtk_bool32 dred_session__decode_string(char* str)
+{
+    char* pOut = str;
+    for (const char* pC = str; pC[0] != '\0'; ++pC) {
+        if (pC[0] == '%') {
+            int hi = dred_session__hex_digit_value(pC[1]);
+            int lo = (hi != -1) ? dred_session__hex_digit_value(pC[2]) : -1;
+            if (hi == -1 || lo == -1 || (hi == 0 && lo == 0)) {
+                return DTK_FALSE;
+            }
+
+            *pOut++ = (char)((hi << 4) | lo);
+            pC += 2;
+        } else {
+            *pOut++ = pC[0];
+        }
+    }
+
+    pOut[0] = '\0';
+    return DTK_TRUE;
+}
+
+static dtk_bool32 dred_session__write_tab(dred_file file, const char* editorType, const char* filePath, size_t cursorCharacter, dtk_int32 scrollX, dtk_int32 scrollY)
+{
+    char editorTypeEncoded[256*3];
+    if (!dred_session__encode_string(editorType, editorTypeEncoded, sizeof(editorTypeEncoded))) {
+        return DTK_FALSE;
+    }
+
+    char filePathEncoded[DRED_MAX_PATH*3];
+    if (!dred_session__encode_string(filePath, filePathEncoded, sizeof(filePathEncoded))) {
+        return DTK_FALSE;
+    }
+
+    char line[sizeof(editorTypeEncoded) + sizeof(filePathEncoded) + 128];
+    if (snprintf(line, sizeof(line), "tab \"%s\" \"%s\" %llu %d %d\n", editorTypeEncoded, filePathEncoded, (unsigned long long)cursorCharacter, scrollX, scrollY) < 0) {
+        return DTK_FALSE;
+    }
+
+    return dred_file_write_string(file, line);
+}
+
+dtk_bool32 dred_session_save(dred_context* pDred)
+{
+    if (pDred == NULL) {
+        return DTK_FALSE;
+    }
+
+    char sessionPath[DRED_MAX_PATH];
+    if (dred_session__get_file_path(pDred, sessionPath, sizeof(sessionPath)) == 0) {
+        return DTK_FALSE;
+    }
+
+    dred_file file = dred_file_open(sessionPath, DRED_FILE_OPEN_MODE_WRITE);
+    if (file == NULL) {
+        return DTK_FALSE;
+    }
+
+    dred_file_write_string(file, "# This file is generated by dred - do not modify.\n\n");
+
+    // The active tab is identified by it's path rather than it's index so that it can still be found if any of the files
+    // before it have been deleted by the time the session is restored.
+    const char* activeFilePath = NULL;
+
+    dtk_uint32 focusedTabIndex;
+    dtk_tabgroup* pFocusedTabGroup = dred_get_focused_tab(pDred, &focusedTabIndex);
+
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
+            if (pPage == NULL || pPage->type != DTK_CONTROL_TYPE_DRED || !dred_control_is_of_type(DRED_CONTROL(pPage), DRED_CONTROL_TYPE_EDITOR)) {
+                continue;
+            }
+
+            // Files that have never been saved can't be restored.
+            dred_editor* pEditor = DRED_EDITOR(pPage);
+            const char* filePath = dred_editor_get_file_path(pEditor);
+            if (filePath == NULL || filePath[0] == '\0') {
+                continue;
+            }
+
+            if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR)) {
+                // The tab was never loaded so just carry it's state over as-is.
+                dred_placeholder_editor* pPlaceholder = DRED_PLACEHOLDER_EDITOR(pEditor);
+                dred_session__write_tab(file, pPlaceholder->editorType, filePath, pPlaceholder->cursorCharacter, pPlaceholder->scrollX, pPlaceholder->scrollY);
+            } else {
+                size_t cursorCharacter = 0;
+                dtk_int32 scrollX = 0;
+                dtk_int32 scrollY = 0;
+                if (dred_control_is_of_type(DRED_CONTROL(pEditor), DRED_CONTROL_TYPE_TEXT_EDITOR)) {
+                    dred_text_editor_get_view_state(DRED_TEXT_EDITOR(pEditor), &cursorCharacter, &scrollX, &scrollY);
+                }
+
+                dred_session__write_tab(file, dred_control_get_type(DRED_CONTROL(pEditor)), filePath, cursorCharacter, scrollX, scrollY);
+            }
+
+            if (pTabGroup == pFocusedTabGroup && iTab == focusedTabIndex) {
+                activeFilePath = filePath;
+            }
+        }
+    }
+
+    char activeFilePathEncoded[DRED_MAX_PATH*3];
+    if (activeFilePath != NULL && dred_session__encode_string(activeFilePath, activeFilePathEncoded, sizeof(activeFilePathEncoded))) {
+        dred_file_write_string(file, "active-tab \"");
+        dred_file_write_string(file, activeFilePathEncoded);
+        dred_file_write_string(file, "\"\n");
+    }
+
+    dred_file_close(file);
+    return DTK_TRUE;
+}
+
+
+typedef struct
+{
+    dred_context* pDred;
+    dtk_tabgroup* pTabGroup;
+    char activeFilePath[DRED_MAX_PATH];
+} dred_session_restore__data;
+
+static void dred_session_restore__on_pair(void* pUserData, const char* key, const char* value)
+{
+    dred_session_restore__data* pData = (dred_session_restore__data*)pUserData;
+    assert(pData != NULL);
+
+    if (strcmp(key, "tab") == 0) {
+        // The encoded strings can be longer than the decoded ones.
+        char editorType[256*3];
+        value = dtk_next_token(value, editorType, sizeof(editorType));
+        if (value == NULL || !dred_session__decode_string(editorType)) {
+            return;
+        }
+
+        char filePath[DRED_MAX_PATH*3];
+        value = dtk_next_token(value, filePath, sizeof(filePath));
+        if (value == NULL || !dred_session__decode_string(filePath)) {
+            return;
+        }
+
+        // Files that have since been deleted are skipped.
+        if (!dtk_file_exists(filePath)) {
+            return;
+        }
+
+        char token[64];
+        size_t cursorCharacter = 0;
+        dtk_int32 scrollX = 0;
+        dtk_int32 scrollY = 0;
+        if ((value = dtk_next_token(value, token, sizeof(token))) != NULL) {
+            cursorCharacter = (size_t)strtoull(token, NULL, 10);
+        }
+        if (value != NULL && (value = dtk_next_token(value, token, sizeof(token))) != NULL) {
+            scrollX = atoi(token);
+        }
+        if (value != NULL && (value = dtk_next_token(value, token, sizeof(token))) != NULL) {
+            scrollY = atoi(token);
+        }
+
+        // Tabs that are already open are left alone.
+        if (dred_find_editor_tab_by_absolute_path(pData->pDred, filePath, NULL) != NULL) {
+            return;
+        }
+
+        dtk_int32 sizeX;
+        dtk_int32 sizeY;
+        dtk_tabgroup_get_container_size(pData->pTabGroup, &sizeX, &sizeY);
+
+        dred_placeholder_editor* pPlaceholder = dred_placeholder_editor_create(pData->pDred, dtk_tabgroup_get_tab_page_container(pData->pTabGroup), (float)sizeX, (float)sizeY, filePath, editorType);
+        if (pPlaceholder == NULL) {
+            return;
+        }
+
+        pPlaceholder->cursorCharacter = cursorCharacter;
+        pPlaceholder->scrollX = scrollX;
+        pPlaceholder->scrollY = scrollY;
+
+        if (!dred_append_editor_tab(pData->pDred, pData->pTabGroup, DRED_EDITOR(pPlaceholder), NULL)) {
+            dred_placeholder_editor_delete(pPlaceholder);
+        }
+
+        return;
+    }
+
+    if (strcmp(key, "active-tab") == 0) {
+        char activeFilePath[DRED_MAX_PATH*3];
+        if (dtk_next_token(value, activeFilePath, sizeof(activeFilePath)) != NULL && dred_session__decode_string(activeFilePath)) {
+            strcpy_s(pData->activeFilePath, sizeof(pData->activeFilePath), activeFilePath);
+        }
+        return;
+    }
+}
+
+static void dred_session_restore__on_error(void* pUserData, const char* message, unsigned int line)
+{
+    dred_session_restore__data* pData = (dred_session_restore__data*)pUserData;
+    assert(pData != NULL);
+
+    dred_warningf(pData->pDred, "Error reading session file: %s (line %u)", message, line);
+}
+
+dtk_uint32 dred_session_restore(dred_context* pDred)
+{
+    if (pDred == NULL) {
+        return 0;
+    }
+
+    char sessionPath[DRED_MAX_PATH];
+    if (dred_session__get_file_path(pDred, sessionPath, sizeof(sessionPath)) == 0) {
+        return 0;
+    }
+
+    dtk_tabgroup* pTabGroup = dred_get_focused_tabgroup(pDred);
+    if (pTabGroup == NULL) {
+        return 0;
+    }
+
+    dtk_uint32 tabCountBeforeRestore = dtk_tabgroup_get_tab_count(pTabGroup);
+
+    dred_session_restore__data data;
+    data.pDred = pDred;
+    data.pTabGroup = pTabGroup;
+    data.activeFilePath[0] = '\0';
+    if (!dtk_parse_key_value_pairs_from_file(sessionPath, dred_session_restore__on_pair, dred_session_restore__on_error, &data)) {
+        return 0;   // There is no session file. This is normal on first run.
+    }
+
+    dtk_uint32 restoredTabCount = dtk_tabgroup_get_tab_count(pTabGroup) - tabCountBeforeRestore;
+    if (restoredTabCount == 0) {
+        return 0;
+    }
+
+    // Activating the tab is what loads the file. If the active tab was not restored for whatever reason just fall back to
+    // the first one.
+    dtk_uint32 activeTab;
+    if (data.activeFilePath[0] == '\0' || dred_find_editor_tab_by_absolute_path(pDred, data.activeFilePath, &activeTab) != pTabGroup || activeTab < tabCountBeforeRestore) {
+        activeTab = tabCountBeforeRestore;
+    }
+    dtk_tabgroup_activate_tab(pTabGroup, activeTab);
+
+    dtk_control_hide(&pDred->backgroundControl);
+    dtk_control_show(DTK_CONTROL(pTabGroup));
+
+    // The remaining tabs are loaded in the background.
+    if (restoredTabCount > 1) {
+        dtk_post_custom_event(&pDred->tk, DTK_CONTROL(&pDred->mainWindow), DRED_EVENT_SESSION_PREFETCH, NULL, 0);
+    }
+
+    return restoredTabCount;
+}
+
+void dred_session_on_prefetch(dred_context* pDred)
+{
+    if (pDred == NULL || pDred->isClosing) {
+        return;
+    }
+
+    // Only a single tab is loaded per event so that any input events that were posted in the meantime are handled before
+    // loading the next one.
+    dtk_bool32 isLoaded = DTK_FALSE;
+    for (dtk_tabgroup* pTabGroup = dred_first_tabgroup(pDred); pTabGroup != NULL; pTabGroup = dred_next_tabgroup(pDred, pTabGroup)) {
+        for (dtk_uint32 iTab = 0; iTab < dtk_tabgroup_get_tab_count(pTabGroup); ++iTab) {
+            dtk_control* pPage = dtk_tabgroup_get_tab_page(pTabGroup, iTab);
+            if (pPage == NULL || pPage->type != DTK_CONTROL_TYPE_DRED || !dred_control_is_of_type(DRED_CONTROL(pPage), DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR)) {
+                continue;
+            }
+
+            dred_placeholder_editor* pPlaceholder = DRED_PLACEHOLDER_EDITOR(pPage);
+            if (pPlaceholder->isPrefetchFailed) {
+                continue;
+            }
+
+            if (isLoaded) {
+                // There's more to load.
+                dtk_post_custom_event(&pDred->tk, DTK_CONTROL(&pDred->mainWindow), DRED_EVENT_SESSION_PREFETCH, NULL, 0);
+                return;
+            }
+
+            // A tab that fails to load stays as a placeholder. It'll be tried again when the tab is activated, but the
+            // prefetcher won't try it again.
+            if (dred_load_placeholder_tab(pDred, pTabGroup, iTab) == NULL) {
+                pPlaceholder->isPrefetchFailed = DTK_TRUE;
+            }
+            isLoaded = DTK_TRUE;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2018 David Reid. See included LICENSE file.
+
+// The session is the list of tabs that were open when dred was closed. It is saved to ".dredsession" in the config folder,
+// next to ".dredprivate", and includes the position of the caret and the scroll position of each text editor. File paths
+// and editor types are percent-encoded in the session file so that quotes, '#' and control characters survive a round trip.
+// The session is saved when dred is closed, after the user has confirmed what to do with any unsaved changes.
+//
+// Restoring a session does not load any files. Each tab is restored as a placeholder editor which only remembers the path
+// of the file, the type of editor to create and the view state. The real editor is created when the tab is activated for
+// the first time, or by the prefetcher which loads the remaining placeholders one at a time, with each one being handled as
+// a separate event so that user input is never blocked for more than a single file. This keeps startup time independent
+// of the number of tabs in the session.
+
+#define DRED_CONTROL_TYPE_PLACEHOLDER_EDITOR  "dred.editor.placeholder"
+
+typedef struct dred_placeholder_editor dred_placeholder_editor;
+#define DRED_PLACEHOLDER_EDITOR(a) ((dred_placeholder_editor*)(a))
+
+struct dred_placeholder_editor
+{
+    // The base editor. The file path is stored in here which means placeholders are found by dred_find_editor_tab_by_absolute_path().
+    dred_editor editor;
+
+    // The type of the editor to create when the tab is loaded.
+    char editorType[256];
+
+    // The view state to restore after loading. Only used with text editors.
+    size_t cursorCharacter;
+    dtk_int32 scrollX;
+    dtk_int32 scrollY;
+
+    // Set when the prefetcher failed to load the file so that it doesn't keep trying.
+    dtk_bool32 isPrefetchFailed;
+};
+
+// dred_placeholder_editor_create()
+dred_placeholder_editor* dred_placeholder_editor_create(dred_context* pDred, dtk_control* pParent, float sizeX, float sizeY, const char* filePathAbsolute, const char* editorType);
+
+// dred_placeholder_editor_delete()
+void dred_placeholder_editor_delete(dred_placeholder_editor* pPlaceholder);
+
+
+// Saves the open tabs to the session file.
+dtk_bool32 dred_session_save(dred_context* pDred);
+
+// Restores the tabs from the session file as placeholders and activates the tab that was active when the session was saved.
+//
+// Returns the number of tabs that were restored.
+dtk_uint32 dred_session_restore(dred_context* pDred);
+
+// Called from the main thread when a DRED_EVENT_SESSION_PREFETCH event is received. This loads the next placeholder tab and
+// posts another event if there are any more.
+void dred_session_on_prefetch(dred_context* pDred);
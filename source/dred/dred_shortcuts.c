@@ -1,5 +1,46 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+static dtk_uint32 dred_shortcut_table__hash_accelerator(dtk_accelerator accelerator)
+{
+    // Must be consistent with dtk_accelerator_equal() which treats '\t' and DTK_KEY_TAB as the same key.
+    if (accelerator.key == '\t') accelerator.key = DTK_KEY_TAB;
+    return dtk_hash_uint32((dtk_uint32)accelerator.key ^ dtk_hash_uint32(accelerator.modifiers));
+}
+
+static dtk_bool32 dred_shortcut_table__index_shortcut(dred_shortcut_table* pTable, size_t shortcutIndex)
+{
+    assert(pTable != NULL);
+    assert(shortcutIndex < pTable->count);
+
+    dred_shortcut* pShortcut = &pTable->pShortcuts[shortcutIndex];
+    if (!dred_hash_index_insert(&pTable->idIndex, dtk_hash_uint32(pShortcut->id), (dtk_uint32)shortcutIndex)) {
+        return DTK_FALSE;
+    }
+    if (!dred_hash_index_insert(&pTable->nameIndex, dtk_hash_string(dred_string_pool_cstr(&pTable->pDred->stringPool, pShortcut->nameOffset), 0), (dtk_uint32)shortcutIndex)) {
+        return DTK_FALSE;
+    }
+    if (pShortcut->acceleratorCount > 0) {
+        if (!dred_hash_index_insert(&pTable->acceleratorIndex, dred_shortcut_table__hash_accelerator(pShortcut->accelerators[0]), (dtk_uint32)shortcutIndex)) {
+            return DTK_FALSE;
+        }
+    }
+
+    return DTK_TRUE;
+}
+
+static void dred_shortcut_table__rebuild_indices(dred_shortcut_table* pTable)
+{
+    assert(pTable != NULL);
+
+    dred_hash_index_clear(&pTable->idIndex);
+    dred_hash_index_clear(&pTable->nameIndex);
+    dred_hash_index_clear(&pTable->acceleratorIndex);
+
+    for (size_t i = 0; i < pTable->count; ++i) {
+        dred_shortcut_table__index_shortcut(pTable, i);
+    }
+}
+
 dtk_bool32 dred_shortcut_table_init(dred_context* pDred, dred_shortcut_table* pTable, size_t initialCapacity)
 {
     if (pTable == NULL) return DTK_FALSE;
@@ -20,6 +61,10 @@ dtk_bool32 dred_shortcut_table_init(dred_context* pDred, dred_shortcut_table* pT
     //    return DTK_FALSE;
     //}
 
+    dred_hash_index_init(&pTable->idIndex);
+    dred_hash_index_init(&pTable->nameIndex);
+    dred_hash_index_init(&pTable->acceleratorIndex);
+
     return DTK_TRUE;
 }
 
@@ -33,6 +78,10 @@ void dred_shortcut_table_uninit(dred_shortcut_table* pTable)
     pTable->count = 0;
     pTable->bufferSize = 0;
 
+    dred_hash_index_uninit(&pTable->idIndex);
+    dred_hash_index_uninit(&pTable->nameIndex);
+    dred_hash_index_uninit(&pTable->acceleratorIndex);
+
     //dred_accelerator_table_uninit(&pTable->acceleratorTable);
 }
 
@@ -89,6 +138,12 @@ dtk_bool32 dred_shortcut_table_bind(dred_shortcut_table* pTable, dtk_uint32 id,
     memcpy(pTable->pShortcuts[pTable->count].accelerators, pAccelerators, acceleratorCount * sizeof(*pAccelerators));
     pTable->count += 1;
 
+    if (!dred_shortcut_table__index_shortcut(pTable, pTable->count-1)) {
+        dred_shortcut_table__rebuild_indices(pTable);   // <-- Makes sure the partially indexed shortcut is not left in any of the indices.
+        pTable->count -= 1;
+        return DTK_FALSE;
+    }
+
     return DTK_TRUE;
 }
 
@@ -107,6 +162,9 @@ dtk_bool32 dred_shortcut_table_unbind(dred_shortcut_table* pTable, dtk_uint32 id
 
     pTable->count -= 1;
 
+    // Every shortcut after the removed one has moved so the indices need to be rebuilt.
+    dred_shortcut_table__rebuild_indices(pTable);
+
 
     // At this point the shortcut will be removed, but there may be a leftover accelerator in the accelerator table. We need
     // to check if those accelerators are now unused, and if so, remove them.
@@ -138,14 +196,20 @@ dtk_bool32 dred_shortcut_table_find(dred_shortcut_table* pTable, dtk_uint32 id,
         return DTK_FALSE;
     }
 
-    for (size_t i = 0; i < pTable->count; ++i) {
-        if (pTable->pShortcuts[i].id == id) {
-            if (pIndexOut) *pIndexOut = i;
-            return DTK_TRUE;
+    // There should only ever be one shortcut with a given ID, but the lowest index is returned to be safe.
+    dtk_bool32 result = DTK_FALSE;
+    size_t resultIndex = 0;
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pTable->idIndex, dtk_hash_uint32(id), &iterator, &index); found; found = dred_hash_index_find_next(&pTable->idIndex, &iterator, &index)) {
+        if (pTable->pShortcuts[index].id == id && (!result || index < resultIndex)) {
+            resultIndex = index;
+            result = DTK_TRUE;
         }
     }
 
-    return DTK_FALSE;
+    if (result && pIndexOut) *pIndexOut = resultIndex;
+    return result;
 }
 
 dtk_bool32 dred_shortcut_table_find_by_name(dred_shortcut_table* pTable, const char* name, size_t* pIndexOut)
@@ -155,14 +219,44 @@ dtk_bool32 dred_shortcut_table_find_by_name(dred_shortcut_table* pTable, const c
         return DTK_FALSE;
     }
 
-    for (size_t i = 0; i < pTable->count; ++i) {
-        if (strcmp(name, dred_string_pool_cstr(&pTable->pDred->stringPool, pTable->pShortcuts[i].nameOffset)) == 0) {
-            if (pIndexOut) *pIndexOut = i;
-            return DTK_TRUE;
+    // Names are not necessarily unique so the one with the lowest index is returned.
+    dtk_bool32 result = DTK_FALSE;
+    size_t resultIndex = 0;
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pTable->nameIndex, dtk_hash_string(name, 0), &iterator, &index); found; found = dred_hash_index_find_next(&pTable->nameIndex, &iterator, &index)) {
+        if (strcmp(name, dred_string_pool_cstr(&pTable->pDred->stringPool, pTable->pShortcuts[index].nameOffset)) == 0) {
+            if (!result || index < resultIndex) {
+                resultIndex = index;
+            }
+            result = DTK_TRUE;
         }
     }
 
-    return DTK_FALSE;
+    if (result && pIndexOut) *pIndexOut = resultIndex;
+    return result;
+}
+
+dtk_bool32 dred_shortcut_table_find_by_first_accelerator(dred_shortcut_table* pTable, dtk_accelerator accelerator, size_t startIndex, size_t* pIndexOut)
+{
+    if (pIndexOut) *pIndexOut = 0;  // Safety.
+    if (pTable == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_bool32 result = DTK_FALSE;
+    size_t resultIndex = 0;
+    dred_hash_index_iterator iterator;
+    dtk_uint32 index;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pTable->acceleratorIndex, dred_shortcut_table__hash_accelerator(accelerator), &iterator, &index); found; found = dred_hash_index_find_next(&pTable->acceleratorIndex, &iterator, &index)) {
+        if (index >= startIndex && (!result || index < resultIndex) && dtk_accelerator_equal(pTable->pShortcuts[index].accelerators[0], accelerator)) {
+            resultIndex = index;
+            result = DTK_TRUE;
+        }
+    }
+
+    if (result && pIndexOut) *pIndexOut = resultIndex;
+    return result;
 }
 
 void dred_shortcut_table_replace_by_index(dred_shortcut_table* pTable, size_t shortcutIndex, const char* name, const char* cmdStr, dtk_uint32 acceleratorCount, dtk_accelerator* pAccelerators)
@@ -171,10 +265,23 @@ void dred_shortcut_table_replace_by_index(dred_shortcut_table* pTable, size_t sh
         return;
     }
 
+    // The name and first accelerator may be changing so the shortcut needs to be removed from those indices and then added
+    // back afterwards. The ID does not change.
+    dred_shortcut* pShortcut = &pTable->pShortcuts[shortcutIndex];
+    dred_hash_index_remove(&pTable->nameIndex, dtk_hash_string(dred_string_pool_cstr(&pTable->pDred->stringPool, pShortcut->nameOffset), 0), (dtk_uint32)shortcutIndex);
+    if (pShortcut->acceleratorCount > 0) {
+        dred_hash_index_remove(&pTable->acceleratorIndex, dred_shortcut_table__hash_accelerator(pShortcut->accelerators[0]), (dtk_uint32)shortcutIndex);
+    }
+
     pTable->pShortcuts[shortcutIndex].nameOffset = dred_string_pool_find_or_add(&pTable->pDred->stringPool, name);
     pTable->pShortcuts[shortcutIndex].cmdOffset = dred_string_pool_find_or_add(&pTable->pDred->stringPool, cmdStr);
     pTable->pShortcuts[shortcutIndex].acceleratorCount = acceleratorCount;
     memcpy(pTable->pShortcuts[shortcutIndex].accelerators, pAccelerators, acceleratorCount * sizeof(*pAccelerators));
+
+    dred_hash_index_insert(&pTable->nameIndex, dtk_hash_string(dred_string_pool_cstr(&pTable->pDred->stringPool, pShortcut->nameOffset), 0), (dtk_uint32)shortcutIndex);
+    if (pShortcut->acceleratorCount > 0) {
+        dred_hash_index_insert(&pTable->acceleratorIndex, dred_shortcut_table__hash_accelerator(pShortcut->accelerators[0]), (dtk_uint32)shortcutIndex);
+    }
 }
 
 
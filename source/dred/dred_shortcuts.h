@@ -36,10 +36,15 @@ struct dred_shortcut
 struct dred_shortcut_table
 {
     dred_context* pDred;
-    dred_shortcut* pShortcuts;
+    dred_shortcut* pShortcuts;  // In the order they were bound. This is the order they're saved in.
     size_t count;
     size_t bufferSize;
 
+    // Hash indices for finding shortcuts by ID, by name and by their first accelerator. The values are indices into pShortcuts.
+    dred_hash_index idIndex;
+    dred_hash_index nameIndex;
+    dred_hash_index acceleratorIndex;
+
     // The table of accelerators used by every shortcut.
     //dred_accelerator_table acceleratorTable;
 };
@@ -52,6 +57,10 @@ dtk_bool32 dred_shortcut_table_unbind(dred_shortcut_table* pTable, dtk_uint32 id
 
 dtk_bool32 dred_shortcut_table_find(dred_shortcut_table* pTable, dtk_uint32 id, size_t* pIndexOut);
 dtk_bool32 dred_shortcut_table_find_by_name(dred_shortcut_table* pTable, const char* name, size_t* pIndexOut);
+
+// Finds the first shortcut at or after <startIndex> whose first accelerator is <accelerator>. To find every such shortcut, call
+// this again with a start index of one past the previous result.
+dtk_bool32 dred_shortcut_table_find_by_first_accelerator(dred_shortcut_table* pTable, dtk_accelerator accelerator, size_t startIndex, size_t* pIndexOut);
 void dred_shortcut_table_replace_by_index(dred_shortcut_table* pTable, size_t shortcutIndex, const char* name, const char* cmdStr, dtk_uint32 acceleratorCount, dtk_accelerator* pAccelerators);
 
 dtk_bool32 dred_shortcut_table_get_shortcut_by_index(dred_shortcut_table* pTable, size_t shortcutIndex, dred_shortcut* pShortcutOut);
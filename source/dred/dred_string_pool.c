@@ -1,17 +1,38 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
-// Optimization Ideas
-// ==================
-// - Consider embedding the length of each string for faster searching and comparisons.
-// - Consider aligning each string to a 32 or 64 bit boundary for fast SIMD-ified comparisons.
+// Layout
+// ======
+// The first DRED_STRING_POOL_ALIGNMENT bytes are zero, which is the empty string at offset 0. After that, each entry is
+// laid out like so, starting on an aligned boundary:
+//
+//     [dtk_uint32 length][characters][null terminator][padding]
+//
+// The offset of a string is the position of its first character. The length sits immediately before it and is always read
+// and written with dtk_load_uint32_le() and dtk_store_uint32_le().
+
+#define DRED_STRING_POOL_CHUNK_SIZE         256
+
+static dtk_uint32 dred_string_pool__get_length_at(const dred_string_pool* pPool, size_t offset)
+{
+    assert(pPool != NULL);
+    assert(offset >= DRED_STRING_POOL_ALIGNMENT);
 
-#define DRED_STRING_POOL_CHUNK_SIZE     256
+    return dtk_load_uint32_le(pPool->pData + offset - sizeof(dtk_uint32));
+}
 
 dtk_bool32 dred_string_pool_init(dred_string_pool* pPool, const char* pInitialData, size_t initialDataSize)
 {
     if (pPool == NULL) return DTK_FALSE;
     memset(pPool, 0, sizeof(*pPool));
 
+    if (pInitialData != NULL && initialDataSize < DRED_STRING_POOL_ALIGNMENT) {
+        return DTK_FALSE;   // Not a valid pool.
+    }
+
+    if (!dred_hash_index_init(&pPool->index)) {
+        return DTK_FALSE;
+    }
+
     if (pInitialData != NULL) {
         pPool->capacity = dtk_round_up(initialDataSize, DRED_STRING_POOL_CHUNK_SIZE);
     } else {
@@ -20,6 +41,7 @@ dtk_bool32 dred_string_pool_init(dred_string_pool* pPool, const char* pInitialDa
 
     pPool->pData = (char*)dtk_malloc(pPool->capacity);
     if (pPool->pData == NULL) {
+        dred_hash_index_uninit(&pPool->index);
         return DTK_FALSE;
     }
 
@@ -27,8 +49,24 @@ dtk_bool32 dred_string_pool_init(dred_string_pool* pPool, const char* pInitialDa
         pPool->byteCount = initialDataSize;
         memcpy(pPool->pData, pInitialData, initialDataSize);
     } else {
-        pPool->byteCount = 1;
-        pPool->pData[0] = '\0';
+        pPool->byteCount = DRED_STRING_POOL_ALIGNMENT;
+        memset(pPool->pData, 0, DRED_STRING_POOL_ALIGNMENT);
+    }
+
+    // The index is not stored in the pool data so it needs to be rebuilt.
+    for (size_t i = DRED_STRING_POOL_ALIGNMENT; i + sizeof(dtk_uint32) <= pPool->byteCount; /* DO NOTHING */) {
+        size_t offset = i + sizeof(dtk_uint32);
+        dtk_uint32 length = dred_string_pool__get_length_at(pPool, offset);
+        if (offset + length+1 > pPool->byteCount) {
+            break;  // Corrupt data.
+        }
+
+        if (!dred_hash_index_insert(&pPool->index, dtk_hash_string(pPool->pData + offset, 0), (dtk_uint32)offset)) {
+            dred_string_pool_uninit(pPool);
+            return DTK_FALSE;
+        }
+
+        i = dtk_round_up(offset + length+1, DRED_STRING_POOL_ALIGNMENT);
     }
 
     return DTK_TRUE;
@@ -38,6 +76,7 @@ dtk_bool32 dred_string_pool_uninit(dred_string_pool* pPool)
 {
     if (pPool == NULL) return DTK_FALSE;
 
+    dred_hash_index_uninit(&pPool->index);
     dtk_free(pPool->pData);
     return DTK_TRUE;
 }
@@ -51,9 +90,15 @@ size_t dred_string_pool_add(dred_string_pool* pPool, const char* str, size_t str
         strLen = strlen(str);
     }
 
-    size_t offset = pPool->byteCount;
-    if (offset + strLen+1 > pPool->capacity) {
-        size_t newCapacity = dtk_round_up(pPool->capacity + strLen+1, DRED_STRING_POOL_CHUNK_SIZE);
+    size_t entryPos = pPool->byteCount;
+    size_t offset = entryPos + sizeof(dtk_uint32);
+    size_t newByteCount = dtk_round_up(offset + strLen+1, DRED_STRING_POOL_ALIGNMENT);
+    if (newByteCount > 0xFFFFFFFF) {
+        return 0;   // Offsets are stored as 32-bit integers in the index.
+    }
+
+    if (newByteCount > pPool->capacity) {
+        size_t newCapacity = dtk_round_up(newByteCount, DRED_STRING_POOL_CHUNK_SIZE);
         char* pNewData = (char*)realloc(pPool->pData, newCapacity);
         if (pNewData == NULL) {
             return 0;
@@ -63,12 +108,20 @@ size_t dred_string_pool_add(dred_string_pool* pPool, const char* str, size_t str
         pPool->capacity = newCapacity;
     }
 
-    assert(offset + strLen+1 <= pPool->capacity);
+    assert(newByteCount <= pPool->capacity);
+    assert((entryPos % DRED_STRING_POOL_ALIGNMENT) == 0);
 
     // When copying the input string into the pool, keep in mind that the input string may not have been null terminated.
+    dtk_store_uint32_le(pPool->pData+entryPos, (dtk_uint32)strLen);
     memcpy(pPool->pData+offset, str, strLen);
-    pPool->pData[offset+strLen] = '\0';
-    pPool->byteCount += strLen+1;
+    memset(pPool->pData+offset+strLen, 0, newByteCount - (offset+strLen));   // Null terminator and padding.
+    pPool->byteCount = newByteCount;
+
+    // The string is hashed from the pool rather than the input string because the input string may not be null terminated.
+    if (!dred_hash_index_insert(&pPool->index, dtk_hash_string(pPool->pData + offset, 0), (dtk_uint32)offset)) {
+        pPool->byteCount = entryPos;
+        return 0;
+    }
 
     return offset;
 }
@@ -80,21 +133,15 @@ dtk_bool32 dred_string_pool_find(dred_string_pool* pPool, const char* str, size_
         return DTK_FALSE;
     }
 
-    // NOTE: This can be optimized. See optimization notes at the top of this file.
-
     size_t strLen = strlen(str);
 
-    for (size_t i = 0; i < pPool->byteCount; /* DO NOTHING */) {
-        char* pNextStr = pPool->pData + i;
-        size_t nextStrLen = strlen(pNextStr);
-        if (strLen == nextStrLen) {
-            if (strcmp(pNextStr, str) == 0) {
-                if (pOffset) *pOffset = i;
-                return DTK_TRUE; // Found it.
-            }
+    dred_hash_index_iterator iterator;
+    dtk_uint32 offset;
+    for (dtk_bool32 found = dred_hash_index_find_first(&pPool->index, dtk_hash_string(str, 0), &iterator, &offset); found; found = dred_hash_index_find_next(&pPool->index, &iterator, &offset)) {
+        if (dred_string_pool__get_length_at(pPool, offset) == strLen && memcmp(pPool->pData + offset, str, strLen) == 0) {
+            if (pOffset) *pOffset = offset;
+            return DTK_TRUE; // Found it.
         }
-
-        i += nextStrLen+1;
     }
 
     return DTK_FALSE;   // Didn't find it.
@@ -116,3 +163,9 @@ const char* dred_string_pool_cstr(dred_string_pool* pPool, size_t offset)
     if (pPool == NULL || offset >= pPool->byteCount) return NULL;
     return pPool->pData + offset;
 }
+
+size_t dred_string_pool_length(dred_string_pool* pPool, size_t offset)
+{
+    if (pPool == NULL || offset == 0 || offset >= pPool->byteCount) return 0;
+    return dred_string_pool__get_length_at(pPool, offset);
+}
@@ -9,20 +9,30 @@
 // NOTES:
 // - The first string in the pool is _always_ an empty string. Rationale: It allows an offset of 0 to be used
 //   for error conditions while also representing an empty string.
-// - This data structure is best used when the number of strings are relatively small, constant and long-
-//   living. Adding and searching for strings runs in linear time so it becomes less suitable as it becomes
-//   larger and the frequency of your search queries increase.
+// - Each string is prefixed with its length as a little-endian 32-bit integer and is aligned to
+//   DRED_STRING_POOL_ALIGNMENT. The offset of a string points to the first character rather than the length so that
+//   dred_string_pool_cstr() is just pointer arithmetic. The byte order is fixed because the initial pool is generated
+//   by the build tool.
+// - Strings are indexed with a dred_hash_index so finding a string runs in constant time. The index is not part of
+//   the pool data. It is rebuilt when the pool is initialized from existing data.
+// - This data structure is best used when the strings are long-living. Strings can not be removed.
+
+#define DRED_STRING_POOL_ALIGNMENT  4
 
 typedef struct
 {
     size_t capacity;
     size_t byteCount;
     char* pData;
+
+    // Maps the hash of each string to its offset.
+    dred_hash_index index;
 } dred_string_pool;
 
 // Initializes a string pool.
 //
-// Note that <initialDataSize> _must_ include null terminators.
+// <pInitialData> must be data that was produced by a string pool, which is how the pre-build tool generates the
+// initial pool. <initialDataSize> is the byteCount of that pool.
 dtk_bool32 dred_string_pool_init(dred_string_pool* pPool, const char* pInitialData, size_t initialDataSize);
 
 // Uninitializes a string pool.
@@ -35,7 +45,7 @@ size_t dred_string_pool_add(dred_string_pool* pPool, const char* str, size_t str
 
 // Finds a string in the given pool.
 //
-// Returns true if the string exists; false otherwise. If the string does not exist, 0 is returned in <pOffset>. This runs in linear time.
+// Returns true if the string exists; false otherwise. If the string does not exist, 0 is returned in <pOffset>. This runs in constant time.
 dtk_bool32 dred_string_pool_find(dred_string_pool* pPool, const char* str, size_t* pOffset);
 
 // A helper for finding a string, and if not found, adding it.
@@ -44,4 +54,7 @@ dtk_bool32 dred_string_pool_find(dred_string_pool* pPool, const char* str, size_
 size_t dred_string_pool_find_or_add(dred_string_pool* pPool, const char* str);
 
 // Retrieves a C-style string from the given string offset.
-const char* dred_string_pool_cstr(dred_string_pool* pPool, size_t offset);
\ No newline at end of file
+const char* dred_string_pool_cstr(dred_string_pool* pPool, size_t offset);
+
+// Retrieves the length of the string at the given offset, not including the null terminator.
+size_t dred_string_pool_length(dred_string_pool* pPool, size_t offset);
\ No newline at end of file
@@ -208,15 +208,7 @@ dtk_bool32 dred_text_editor__on_save(dred_editor* pEditor, dred_file file, const
         return DTK_FALSE;
     }
 
-    size_t textLength = dred_textview_get_text(pTextView, NULL, 0);
-    char* text = (char*)malloc(textLength + 1);
-    if (text == NULL) {
-        return DTK_FALSE;
-    }
-    dred_textview_get_text(pTextView, text, textLength+1);
-
-    dtk_bool32 result = dred_file_write_string(file, text);
-    free(text);
+    dtk_bool32 result = dred_text_editor_write_engine_text(&pTextEditor->engine, file);
 
     // After saving we need to update the base undo point and unmark the file as modified.
     if (result) {
@@ -239,6 +231,8 @@ dtk_bool32 dred_text_editor__on_reload(dred_editor* pEditor)
         return DTK_FALSE;
     }
 
+    dtk_uint64 perfBegTime = dred_perf_begin();
+
     char* pFileData;
     if (dtk_open_and_read_text_file(dred_editor_get_file_path(DRED_EDITOR(pTextEditor)), NULL, &pFileData) != DTK_SUCCESS) {
         return DTK_FALSE;
@@ -247,6 +241,8 @@ dtk_bool32 dred_text_editor__on_reload(dred_editor* pEditor)
     dred_textview_set_text(pTextEditor->pTextView, pFileData);
     dtk_free(pFileData);
 
+    dred_perf_end(DRED_PERF_COUNTER_FILE_LOAD, perfBegTime);
+
     // After reloading we need to update the base undo point and unmark the file as modified.
     pTextEditor->iBaseUndoPoint = dred_textview_get_undo_points_remaining_count(pTextView);
     dred_editor_unmark_as_modified(DRED_EDITOR(pTextEditor));
@@ -308,6 +304,8 @@ dred_text_editor* dred_text_editor_create(dred_context* pDred, dtk_control* pPar
     dred_text_editor_set_highlighter(pTextEditor, dred_get_language_by_file_path(pDred, filePathAbsolute));
 
     if (filePathAbsolute != NULL && filePathAbsolute[0] != '\0') {
+        dtk_uint64 perfBegTime = dred_perf_begin();
+
         char* pFileData;
         if (dtk_open_and_read_text_file(filePathAbsolute, NULL, &pFileData) != DTK_SUCCESS) {
             dred_textview_uninit(pTextEditor->pTextView);
@@ -320,6 +318,8 @@ dred_text_editor* dred_text_editor_create(dred_context* pDred, dtk_control* pPar
         dred_textview_set_text(pTextEditor->pTextView, pFileData);
         dred_textview_clear_undo_stack(pTextEditor->pTextView);
         dtk_free(pFileData);
+
+        dred_perf_end(DRED_PERF_COUNTER_FILE_LOAD, perfBegTime);
     }
 
 
@@ -379,6 +379,24 @@ void dred_text_editor_set_text(dred_text_editor* pTextEditor, const char* text)
     dred_textview_set_text(dred_text_editor_get_focused_view(pTextEditor), text);
 }
 
+void dred_text_editor_append_text(dred_text_editor* pTextEditor, const char* text)
+{
+    if (pTextEditor == NULL || text == NULL) {
+        return;
+    }
+
+    // Inserting text doesn't mark the document as modified by itself. That only happens when an undo point is committed,
+    // and if the user is in the middle of an edit the inserted text would be recorded as part of it. The prepared undo
+    // state is hidden from the engine for the duration of the insert so that the appended text never ends up in the undo
+    // history, and therefore never marks the document as modified.
+    drte_bool32 hasPreparedUndoState = pTextEditor->engine.hasPreparedUndoState;
+    pTextEditor->engine.hasPreparedUndoState = DRTE_FALSE;
+    {
+        drte_engine_insert_text(&pTextEditor->engine, text, pTextEditor->engine.textLength);
+    }
+    pTextEditor->engine.hasPreparedUndoState = hasPreparedUndoState;
+}
+
 size_t dred_text_editor_get_text(dred_text_editor* pTextEditor, char* pTextOut, size_t textOutSize)
 {
     if (pTextEditor == NULL) {
@@ -397,6 +415,39 @@ size_t dred_text_editor_get_subtext(dred_text_editor* pTextEditor, size_t charac
     return drte_engine_get_subtext(&pTextEditor->engine, characterBeg, characterEnd, pTextOut, textOutSize);
 }
 
+size_t dred_text_editor_get_memory_usage(dred_text_editor* pTextEditor)
+{
+    if (pTextEditor == NULL) {
+        return 0;
+    }
+
+    return sizeof(*pTextEditor) + drte_engine_get_memory_usage(&pTextEditor->engine);
+}
+
+dtk_bool32 dred_text_editor_write_engine_text(drte_engine* pEngine, dred_file file)
+{
+    if (pEngine == NULL || file == NULL) {
+        return DTK_FALSE;
+    }
+
+    // The text is written in chunks so that no single write is unbounded in size.
+    const char* pText = pEngine->text;
+    size_t bytesRemaining = (pText != NULL) ? pEngine->textLength : 0;
+    while (bytesRemaining > 0) {
+        size_t bytesToWrite = dtk_min(bytesRemaining, DRED_TEXT_EDITOR_SAVE_CHUNK_SIZE);
+
+        size_t bytesWritten;
+        if (!dred_file_write(file, pText, bytesToWrite, &bytesWritten) || bytesWritten != bytesToWrite) {
+            return DTK_FALSE;
+        }
+
+        pText += bytesToWrite;
+        bytesRemaining -= bytesToWrite;
+    }
+
+    return DTK_TRUE;
+}
+
 size_t dred_text_editor_get_selected_text(dred_text_editor* pTextEditor, char* pTextOut, size_t textOutSize)
 {
     if (pTextEditor == NULL) {
@@ -515,6 +566,7 @@ void dred_text_editor_refresh_styling(dred_text_editor* pTextEditor)
         dred_textview_set_line_numbers_color(pTextEditor->pTextView, pDred->config.textEditorLineNumbersColor);
         dred_textview_set_line_numbers_background_color(pTextEditor->pTextView, pDred->config.textEditorLineNumbersBGColor);
         dred_textview_set_line_numbers_padding(pTextEditor->pTextView, pDred->config.textEditorLineNumbersPadding);
+        dred_textview_set_cursor_blink_timeout(pTextEditor->pTextView, (pDred->config.textEditorCursorBlinkTimeout > 0) ? (unsigned int)pDred->config.textEditorCursorBlinkTimeout : 0);
     
         dred_textview_set_scrollbar_track_color(pTextEditor->pTextView, pDred->config.textEditorSBTrackColor);
         dred_textview_set_scrollbar_thumb_color(pTextEditor->pTextView, pDred->config.textEditorSBThumbColor);
@@ -682,6 +734,35 @@ void dred_text_editor_goto_line(dred_text_editor* pTextEditor, size_t lineNumber
 }
 
 
+void dred_text_editor_get_view_state(dred_text_editor* pTextEditor, size_t* pCursorCharacter, dtk_int32* pScrollX, dtk_int32* pScrollY)
+{
+    if (pTextEditor == NULL) {
+        if (pCursorCharacter) *pCursorCharacter = 0;
+        if (pScrollX) *pScrollX = 0;
+        if (pScrollY) *pScrollY = 0;
+        return;
+    }
+
+    if (pCursorCharacter) {
+        *pCursorCharacter = dred_textview_get_cursor_character(pTextEditor->pTextView, dred_textview_get_last_cursor(pTextEditor->pTextView));
+    }
+
+    dred_textview_get_scroll_position(pTextEditor->pTextView, pScrollX, pScrollY);
+}
+
+void dred_text_editor_set_view_state(dred_text_editor* pTextEditor, size_t cursorCharacter, dtk_int32 scrollX, dtk_int32 scrollY)
+{
+    if (pTextEditor == NULL) {
+        return;
+    }
+
+    // The cursor needs to be moved first because moving it may scroll the view.
+    dred_textview_deselect_all(pTextEditor->pTextView);
+    dred_textview_move_cursor_to_character(pTextEditor->pTextView, cursorCharacter);
+    dred_textview_set_scroll_position(pTextEditor->pTextView, scrollX, scrollY);
+}
+
+
 void dred_text_editor_deselect_all_in_focused_view(dred_text_editor* pTextEditor)
 {
     if (pTextEditor == NULL) {
@@ -5,6 +5,9 @@
 typedef struct dred_text_editor dred_text_editor;
 #define DRED_TEXT_EDITOR(a) ((dred_text_editor*)(a))
 
+// The maximum number of bytes passed to each write when saving.
+#define DRED_TEXT_EDITOR_SAVE_CHUNK_SIZE    (4 * 1024 * 1024)
+
 struct dred_text_editor
 {
     // The base editor.
@@ -32,12 +35,24 @@ void dred_text_editor_delete(dred_text_editor* pTextEditor);
 // Sets the text of the editor.
 void dred_text_editor_set_text(dred_text_editor* pTextEditor, const char* text);
 
+// Appends text to the end of the editor without creating an undo point. This is intended for output that is generated
+// incrementally, such as search results. The appended text is never recorded in the undo history, even if the user is in
+// the middle of an edit, so it does not mark the document as modified.
+void dred_text_editor_append_text(dred_text_editor* pTextEditor, const char* text);
+
 // Retrieves a copy of the text.
 size_t dred_text_editor_get_text(dred_text_editor* pTextEditor, char* pTextOut, size_t textOutSize);
 
 // Retrieves a region of text.
 size_t dred_text_editor_get_subtext(dred_text_editor* pTextEditor, size_t characterBeg, size_t characterEnd, char* pTextOut, size_t textOutSize);
 
+// Retrieves an estimate of the amount of memory being used by the text engine, in bytes.
+size_t dred_text_editor_get_memory_usage(dred_text_editor* pTextEditor);
+
+// Writes the text of the given engine to a file straight from the engine's buffer, without making a copy of it first. This is
+// what's used for saving, and does not depend on there being an editor so it can also be used by batch mode.
+dtk_bool32 dred_text_editor_write_engine_text(drte_engine* pEngine, dred_file file);
+
 // Retrieves the selected text in the currently focused view.
 size_t dred_text_editor_get_selected_text(dred_text_editor* pTextEditor, char* pTextOut, size_t textOutSize);
 
@@ -110,6 +125,14 @@ void dred_text_editor_goto_ratio(dred_text_editor* pTextEditor, size_t ratio);
 void dred_text_editor_goto_line(dred_text_editor* pTextEditor, size_t lineNumber);
 
 
+// Retrieves the position of the caret as a character index, and the scroll position of the view. This is what's saved in
+// the session file so the view can be restored the next time the file is opened.
+void dred_text_editor_get_view_state(dred_text_editor* pTextEditor, size_t* pCursorCharacter, dtk_int32* pScrollX, dtk_int32* pScrollY);
+
+// Restores the view state that was retrieved with dred_text_editor_get_view_state().
+void dred_text_editor_set_view_state(dred_text_editor* pTextEditor, size_t cursorCharacter, dtk_int32 scrollX, dtk_int32 scrollY);
+
+
 // Deslects everything in the focused view.
 void dred_text_editor_deselect_all_in_focused_view(dred_text_editor* pTextEditor);
 
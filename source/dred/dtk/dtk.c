@@ -35,6 +35,8 @@
 #include <pwd.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <dirent.h>
+#include <sys/mman.h>
 #endif
 #ifdef DTK_GTK
     #include <gdk/gdk.h>
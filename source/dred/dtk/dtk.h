@@ -128,6 +128,16 @@ typedef int dtk_result;
 #endif
 #define dtk_zero_object(p)                  dtk_zero_memory((p), sizeof(*(p)))
 
+// Performance instrumentation hooks. These are placed around operations that are worth measuring, such as measuring strings.
+// They do nothing by default, but the application can define them before including dtk.h to feed it's own counters. The
+// counter is an identifier naming the operation, such as MEASURE_STRING.
+#ifndef DTK_PERF_BEGIN
+#define DTK_PERF_BEGIN()                    0
+#endif
+#ifndef DTK_PERF_END
+#define DTK_PERF_END(counter, begTime)      (void)(begTime)
+#endif
+
 #define dtk_count_of(obj)                   (sizeof(obj) / sizeof(obj[0]))
 #define dtk_offset_ptr(p, offset)           (((dtk_uint8*)(p)) + (offset))
 #define dtk_min(x, y)                       (((x) < (y)) ? (x) : (y))
@@ -142,6 +152,23 @@ typedef int dtk_result;
 #define DTK_INLINE static inline
 #endif
 
+// Loads and stores a 32-bit integer as little-endian bytes. The pointer does not need to be aligned. Use these for data that
+// is shared between platforms, such as the data generated by the build tools.
+DTK_INLINE dtk_uint32 dtk_load_uint32_le(const void* p)
+{
+    const dtk_uint8* pBytes = (const dtk_uint8*)p;
+    return ((dtk_uint32)pBytes[0] << 0) | ((dtk_uint32)pBytes[1] << 8) | ((dtk_uint32)pBytes[2] << 16) | ((dtk_uint32)pBytes[3] << 24);
+}
+
+DTK_INLINE void dtk_store_uint32_le(void* p, dtk_uint32 x)
+{
+    dtk_uint8* pBytes = (dtk_uint8*)p;
+    pBytes[0] = (dtk_uint8)(x >> 0);
+    pBytes[1] = (dtk_uint8)(x >> 8);
+    pBytes[2] = (dtk_uint8)(x >> 16);
+    pBytes[3] = (dtk_uint8)(x >> 24);
+}
+
 typedef struct dtk_context dtk_context;
 typedef struct dtk_event dtk_event;
 typedef struct dtk_control dtk_control;
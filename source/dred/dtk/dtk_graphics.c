@@ -431,17 +431,31 @@ dtk_result dtk_font_get_text_cursor_position_from_char__gdi(dtk_font* pFont, flo
         return DTK_ERROR;
     }
 
+    // characterIndex is a byte offset into the UTF-8 string. The string is converted up to and including the character at that
+    // offset, and the caret position is looked up using the index of that character in the converted string.
+    size_t nextCharSize = 1;
+    unsigned char nextChar = (unsigned char)text[characterIndex];
+    if (nextChar >= 0xF0) {
+        nextCharSize = 4;
+    } else if (nextChar >= 0xE0) {
+        nextCharSize = 3;
+    } else if (nextChar >= 0xC0) {
+        nextCharSize = 2;
+    }
+
+    int iCharW = (characterIndex > 0) ? MultiByteToWideChar(CP_UTF8, 0, text, (int)characterIndex, NULL, 0) : 0;
+
     dtk_result result = DTK_ERROR;
     HGDIOBJ hPrevFont = SelectObject((HDC)pFont->pTK->win32.hGraphicsDC, (HFONT)pSubfont->gdi.hFont);
     {
-        GCP_RESULTSW results;
-        ZeroMemory(&results, sizeof(results));
-        results.lStructSize = sizeof(results);
-        results.nGlyphs     = (DWORD)(characterIndex + 1);
-
         size_t textWLength;
-        wchar_t* textW = dtk__mb_to_wchar__win32(pFont->pTK, text, (int)results.nGlyphs, &textWLength);
-        if (textW != NULL) {
+        wchar_t* textW = dtk__mb_to_wchar__win32(pFont->pTK, text, characterIndex + nextCharSize, &textWLength);
+        if (textW != NULL && (size_t)iCharW < textWLength) {
+            GCP_RESULTSW results;
+            ZeroMemory(&results, sizeof(results));
+            results.lStructSize = sizeof(results);
+            results.nGlyphs     = (DWORD)textWLength;
+
             if (results.nGlyphs > pFont->pTK->win32.glyphCacheSize) {
                 pFont->pTK->win32.pGlyphCache = (dtk_int32*)dtk_realloc(pFont->pTK->win32.pGlyphCache, results.nGlyphs * sizeof(*pFont->pTK->win32.pGlyphCache));
                 if (pFont->pTK->win32.pGlyphCache == NULL) {
@@ -454,7 +468,7 @@ dtk_result dtk_font_get_text_cursor_position_from_char__gdi(dtk_font* pFont, flo
             results.lpCaretPos = pFont->pTK->win32.pGlyphCache;
             if (results.lpCaretPos != NULL) {
                 if (GetCharacterPlacementW((HDC)pFont->pTK->win32.hGraphicsDC, textW, results.nGlyphs, 0, &results, GCP_USEKERNING) != 0) {
-                    if (pTextCursorPosX) *pTextCursorPosX = (float)results.lpCaretPos[characterIndex];
+                    if (pTextCursorPosX) *pTextCursorPosX = (float)results.lpCaretPos[iCharW];
                     result = DTK_SUCCESS;
                 }
             }
@@ -1045,53 +1059,65 @@ dtk_result dtk_font_get_text_cursor_position_from_point__cairo(dtk_font* pFont,
         return DTK_ERROR;
     }
 
+    // Clusters are used to map glyphs back to the bytes they were generated from. The returned character index is a byte offset
+    // into the UTF-8 string, which is always on a code point boundary.
     cairo_glyph_t* pGlyphs = NULL;
     int glyphCount = 0;
-    cairo_status_t result = cairo_scaled_font_text_to_glyphs((cairo_scaled_font_t*)pSubfont->cairo.pFont, 0, 0, text, textSizeInBytes, &pGlyphs, &glyphCount, NULL, NULL, NULL);
+    cairo_text_cluster_t* pClusters = NULL;
+    int clusterCount = 0;
+    cairo_text_cluster_flags_t clusterFlags;
+    cairo_status_t result = cairo_scaled_font_text_to_glyphs((cairo_scaled_font_t*)pSubfont->cairo.pFont, 0, 0, text, (int)textSizeInBytes, &pGlyphs, &glyphCount, &pClusters, &clusterCount, &clusterFlags);
     if (result != CAIRO_STATUS_SUCCESS) {
         return DTK_ERROR;
     }
 
     float cursorPosX = 0;
-    int charIndex = 0;
+    size_t charIndex = 0;
 
-    // We just iterate over each glyph until we find the one sitting under <inputPosX>.
+    // We just iterate over each cluster until we find the one sitting under <inputPosX>.
     float runningPosX = 0;
-    for (int iGlyph = 0; iGlyph < glyphCount; ++iGlyph) {
-        cairo_text_extents_t glyphMetrics;
-        cairo_scaled_font_glyph_extents((cairo_scaled_font_t*)pSubfont->cairo.pFont, pGlyphs + iGlyph, 1, &glyphMetrics);
-
-        float glyphLeft  = runningPosX;
-        float glyphRight = glyphLeft + glyphMetrics.x_advance;
+    size_t runningCharIndex = 0;
+    int iGlyph = 0;
+    for (int iCluster = 0; iCluster < clusterCount; ++iCluster) {
+        cairo_text_extents_t clusterMetrics;
+        cairo_scaled_font_glyph_extents((cairo_scaled_font_t*)pSubfont->cairo.pFont, pGlyphs + iGlyph, pClusters[iCluster].num_glyphs, &clusterMetrics);
+        iGlyph += pClusters[iCluster].num_glyphs;
+
+        float clusterLeft  = runningPosX;
+        float clusterRight = clusterLeft + (float)clusterMetrics.x_advance;
+        size_t clusterCharBeg = runningCharIndex;
+        size_t clusterCharEnd = runningCharIndex + pClusters[iCluster].num_bytes;
 
         // Are we sitting on top of inputPosX?
-        if (inputPosX >= glyphLeft && inputPosX <= glyphRight) {
-            float glyphHalf = glyphLeft + ceilf(((glyphRight - glyphLeft) / 2.0f));
-            if (inputPosX <= glyphHalf) {
-                cursorPosX = glyphLeft;
-                charIndex  = iGlyph;
+        if (inputPosX >= clusterLeft && inputPosX <= clusterRight) {
+            float clusterHalf = clusterLeft + ceilf(((clusterRight - clusterLeft) / 2.0f));
+            if (inputPosX <= clusterHalf) {
+                cursorPosX = clusterLeft;
+                charIndex  = clusterCharBeg;
             } else {
-                cursorPosX = glyphRight;
-                charIndex  = iGlyph + 1;
+                cursorPosX = clusterRight;
+                charIndex  = clusterCharEnd;
             }
 
             break;
         } else {
             // Have we moved past maxWidth?
-            if (glyphRight > maxWidth) {
+            if (clusterRight > maxWidth) {
                 cursorPosX = maxWidth;
-                charIndex  = iGlyph;
+                charIndex  = clusterCharBeg;
                 break;
             } else {
-                runningPosX = glyphRight;
+                runningPosX = clusterRight;
+                runningCharIndex = clusterCharEnd;
 
                 cursorPosX = runningPosX;
-                charIndex  = iGlyph;
+                charIndex  = clusterCharBeg;
             }
         }
     }
 
     cairo_glyph_free(pGlyphs);
+    cairo_text_cluster_free(pClusters);
 
     if (pTextCursorPosX) *pTextCursorPosX = cursorPosX;
     if (pCharacterIndex) *pCharacterIndex = charIndex;
@@ -1105,30 +1131,27 @@ dtk_result dtk_font_get_text_cursor_position_from_char__cairo(dtk_font* pFont, f
         return DTK_ERROR;
     }
 
+    // characterIndex is a byte offset into the UTF-8 string so only the text before it needs to be shaped. This is important
+    // because the text engine passes in a pointer to the middle of the document which is only terminated at the very end.
+    if (characterIndex == 0) {
+        if (pTextCursorPosX) *pTextCursorPosX = 0;
+        return DTK_SUCCESS;
+    }
+
     cairo_glyph_t* pGlyphs = NULL;
     int glyphCount = 0;
-    cairo_status_t result = cairo_scaled_font_text_to_glyphs((cairo_scaled_font_t*)pSubfont->cairo.pFont, 0, 0, text, -1, &pGlyphs, &glyphCount, NULL, NULL, NULL);
+    cairo_status_t result = cairo_scaled_font_text_to_glyphs((cairo_scaled_font_t*)pSubfont->cairo.pFont, 0, 0, text, (int)characterIndex, &pGlyphs, &glyphCount, NULL, NULL, NULL);
     if (result != CAIRO_STATUS_SUCCESS) {
         return DTK_ERROR;
     }
 
-    float cursorPosX = 0;
-
-    // We just iterate over each glyph until we find the one sitting under <inputPosX>.
-    for (int iGlyph = 0; iGlyph < glyphCount; ++iGlyph) {
-        if (iGlyph == (int)characterIndex) {
-            break;
-        }
-
-        cairo_text_extents_t glyphMetrics;
-        cairo_scaled_font_glyph_extents((cairo_scaled_font_t*)pSubfont->cairo.pFont, pGlyphs + iGlyph, 1, &glyphMetrics);
-
-        cursorPosX += glyphMetrics.x_advance;
-    }
+    // The position of the cursor is the combined advance of every glyph before it.
+    cairo_text_extents_t textMetrics;
+    cairo_scaled_font_glyph_extents((cairo_scaled_font_t*)pSubfont->cairo.pFont, pGlyphs, glyphCount, &textMetrics);
 
     cairo_glyph_free(pGlyphs);
 
-    if (pTextCursorPosX) *pTextCursorPosX = cursorPosX;
+    if (pTextCursorPosX) *pTextCursorPosX = (float)textMetrics.x_advance;
     return DTK_SUCCESS;
 }
 
@@ -1570,6 +1593,8 @@ dtk_result dtk_font_measure_string(dtk_font* pFont, float scale, const char* tex
     if (pHeight) *pHeight = 0;
     if (pFont == NULL || text == NULL) return DTK_INVALID_ARGS;
 
+    dtk_uint64 perfBegTime = DTK_PERF_BEGIN();
+
     dtk_result result = DTK_NO_BACKEND;
 #ifdef DTK_WIN32
     if (pFont->backend == dtk_graphics_backend_gdi) {
@@ -1582,6 +1607,7 @@ dtk_result dtk_font_measure_string(dtk_font* pFont, float scale, const char* tex
     }
 #endif
 
+    DTK_PERF_END(MEASURE_STRING, perfBegTime);
     return result;
 }
 
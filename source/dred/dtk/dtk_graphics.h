@@ -242,11 +242,16 @@ dtk_result dtk_font_measure_string(dtk_font* pFont, float scale, const char* tex
 
 // Retrieves the position to place a text cursor based on the given point for the given string when drawn with the given font.
 //
+// The character index that is returned is a byte offset into the UTF-8 string and is always on a code point boundary.
+//
 // NOTE: This API is tempoarary until an improved Unicode implementation is done.
 dtk_result dtk_font_get_text_cursor_position_from_point(dtk_font* pFont, float scale, const char* text, size_t textSizeInBytes, float maxWidth, float inputPosX, float* pTextCursorPosX, size_t* pCharacterIndex);
 
 // Retrieves the position to palce a text cursor based on the character at the given index for the given string when drawn with the given font.
 //
+// characterIndex is a byte offset into the UTF-8 string and should be on a code point boundary. Only the text before it is
+// looked at, so the string does not need to be terminated at the character.
+//
 // NOTE: This API is tempoarary until an improved Unicode implementation is done.
 dtk_result dtk_font_get_text_cursor_position_from_char(dtk_font* pFont, float scale, const char* text, size_t characterIndex, float* pTextCursorPosX);
 
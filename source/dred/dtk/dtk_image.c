@@ -26,13 +26,18 @@ dtk_result dtk_image_init_raster(dtk_context* pTK, dtk_uint32 width, dtk_uint32
 }
 
 dtk_result dtk_image_init_svg(dtk_context* pTK, const char* pSVGData, dtk_image* pImage)
+{
+    return dtk_image_init_svg_with_dpi_scale(pTK, pSVGData, dtk_get_system_dpi_scale(pTK), pImage);
+}
+
+dtk_result dtk_image_init_svg_with_dpi_scale(dtk_context* pTK, const char* pSVGData, float dpiScale, dtk_image* pImage)
 {
     dtk_result result = dtk_image_init(pTK, dtk_image_type_vector, pImage);
     if (result != DTK_SUCCESS) {
         return result;
     }
 
-    result = dtk_svg_init(pTK, pSVGData, &pImage->vectorImage);
+    result = dtk_svg_init_with_dpi_scale(pSVGData, dpiScale, &pImage->vectorImage);
     if (result != DTK_SUCCESS) {
         return result;
     }
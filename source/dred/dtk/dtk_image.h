@@ -2,6 +2,9 @@
 
 dtk_result dtk_image_init_raster(dtk_context* pTK, dtk_uint32 width, dtk_uint32 height, dtk_uint32 strideInBytes, const void* pImageData, dtk_image* pImage);
 dtk_result dtk_image_init_svg(dtk_context* pTK, const char* pSVGData, dtk_image* pImage);
+
+// Same as dtk_image_init_svg(), except the DPI scale is passed in explicitly so that it can be called from a worker thread.
+dtk_result dtk_image_init_svg_with_dpi_scale(dtk_context* pTK, const char* pSVGData, float dpiScale, dtk_image* pImage);
 dtk_result dtk_image_uninit(dtk_image* pImage);
 
 dtk_result dtk_image_get_size(dtk_image* pImage, dtk_uint32* pWidth, dtk_uint32* pHeight);
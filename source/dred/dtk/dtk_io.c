@@ -1,5 +1,67 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
+// State shared by every thread taking part in a dtk_walk_directory() call.
+typedef struct
+{
+    const dtk_walk_directory_config* pConfig;
+    dtk_walk_directory_proc proc;
+    void* pUserData;
+    volatile dtk_bool32 isCancelled;
+} dtk_walk_directory_context;
+
+static dtk_bool32 dtk_walk_directory__matches_any(const char* name, const char** ppPatterns, dtk_uint32 patternCount)
+{
+    for (dtk_uint32 iPattern = 0; iPattern < patternCount; ++iPattern) {
+        if (dtk_wildcard_match(ppPatterns[iPattern], name)) {
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+static dtk_bool32 dtk_walk_directory__is_excluded(dtk_walk_directory_context* pContext, const char* name)
+{
+    return dtk_walk_directory__matches_any(name, pContext->pConfig->ppExcludePatterns, pContext->pConfig->excludePatternCount);
+}
+
+static dtk_bool32 dtk_walk_directory__is_excluded_directory(dtk_walk_directory_context* pContext, const char* path)
+{
+    for (dtk_uint32 iDirectory = 0; iDirectory < pContext->pConfig->excludeDirectoryCount; ++iDirectory) {
+        if (dtk_path_equal(path, pContext->pConfig->ppExcludeDirectories[iDirectory])) {
+            return DTK_TRUE;
+        }
+    }
+
+    return DTK_FALSE;
+}
+
+// Passes the entry to the callback if it isn't filtered out. Returns DTK_FALSE if the walk should stop.
+static dtk_bool32 dtk_walk_directory__report(dtk_walk_directory_context* pContext, const dtk_walk_directory_entry* pEntry)
+{
+    const dtk_walk_directory_config* pConfig = pContext->pConfig;
+
+    if (pEntry->isDirectory) {
+        if ((pConfig->flags & DTK_WALK_DIRECTORY_EXCLUDE_DIRECTORIES) != 0) {
+            return DTK_TRUE;
+        }
+    } else {
+        if ((pConfig->flags & DTK_WALK_DIRECTORY_EXCLUDE_FILES) != 0) {
+            return DTK_TRUE;
+        }
+        if (pConfig->includePatternCount > 0 && !dtk_walk_directory__matches_any(pEntry->name, pConfig->ppIncludePatterns, pConfig->includePatternCount)) {
+            return DTK_TRUE;
+        }
+    }
+
+    if (!pContext->proc(pEntry, pContext->pUserData)) {
+        pContext->isCancelled = DTK_TRUE;
+        return DTK_FALSE;
+    }
+
+    return DTK_TRUE;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -53,6 +115,191 @@ dtk_result dtk_set_current_directory__win32(const char* path)
 
     return DTK_SUCCESS;
 }
+
+size_t dtk_get_mapping_granularity__win32()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwAllocationGranularity;
+}
+
+dtk_result dtk_mapped_file_open__win32(const char* filePath, dtk_bool32 writable, dtk_mapped_file* pFile)
+{
+    HANDLE hFile = CreateFileA(filePath, GENERIC_READ | (writable ? GENERIC_WRITE : 0), FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE) {
+        return (GetLastError() == ERROR_FILE_NOT_FOUND) ? DTK_DOES_NOT_EXIST : DTK_FAILED_TO_OPEN_FILE;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize)) {
+        CloseHandle(hFile);
+        return DTK_ERROR;
+    }
+
+    // CreateFileMapping() fails on empty files so in that case we just leave the mapping handle as NULL. Attempting
+    // to map a view of an empty file will return DTK_END_OF_FILE anyway.
+    HANDLE hMapping = NULL;
+    if (fileSize.QuadPart > 0) {
+        hMapping = CreateFileMappingA(hFile, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+        if (hMapping == NULL) {
+            CloseHandle(hFile);
+            return DTK_ERROR;
+        }
+    }
+
+    pFile->fileSize = (dtk_uint64)fileSize.QuadPart;
+    pFile->hFile = (dtk_handle)hFile;
+    pFile->hMapping = (dtk_handle)hMapping;
+    return DTK_SUCCESS;
+}
+
+void dtk_mapped_file_close__win32(dtk_mapped_file* pFile)
+{
+    if (pFile->hMapping != NULL) {
+        CloseHandle((HANDLE)pFile->hMapping);
+    }
+    CloseHandle((HANDLE)pFile->hFile);
+}
+
+void* dtk_mapped_file_map__win32(dtk_mapped_file* pFile, dtk_uint64 alignedOffset, size_t size)
+{
+    return MapViewOfFile((HANDLE)pFile->hMapping, pFile->isWritable ? (FILE_MAP_READ | FILE_MAP_WRITE) : FILE_MAP_READ, (DWORD)(alignedOffset >> 32), (DWORD)(alignedOffset & 0xFFFFFFFF), size);
+}
+
+void dtk_mapped_file_unmap__win32(dtk_mapped_view* pView)
+{
+    UnmapViewOfFile(pView->pMappedData);
+}
+
+dtk_result dtk_mapped_file_flush__win32(dtk_mapped_view* pView)
+{
+    if (!FlushViewOfFile(pView->pMappedData, pView->mappedSize)) {
+        return DTK_FAILED_TO_WRITE_FILE;
+    }
+
+    return DTK_SUCCESS;
+}
+
+typedef struct
+{
+    HANDLE hFind;
+    WIN32_FIND_DATAA ffd;
+    dtk_bool32 hasPendingEntry;     // FindFirstFileA() returns the first entry, which needs to be processed before calling FindNextFileA().
+    size_t pathLength;
+} dtk_walk_directory_frame__win32;
+
+static dtk_bool32 dtk_walk_directory__push_frame__win32(dtk_walk_directory_frame__win32* pFrame, char* path, size_t pathLength, size_t pathCap)
+{
+    if (pathLength + 3 > pathCap) {
+        return DTK_FALSE;
+    }
+
+    path[pathLength + 0] = '\\';
+    path[pathLength + 1] = '*';
+    path[pathLength + 2] = '\0';
+    pFrame->hFind = FindFirstFileA(path, &pFrame->ffd);
+    path[pathLength] = '\0';
+
+    if (pFrame->hFind == INVALID_HANDLE_VALUE) {
+        return DTK_FALSE;
+    }
+
+    pFrame->hasPendingEntry = DTK_TRUE;
+    pFrame->pathLength = pathLength;
+    return DTK_TRUE;
+}
+
+dtk_result dtk_walk_directory__sequential__win32(dtk_walk_directory_context* pContext, const char* directory, dtk_uint32 baseDepth, dtk_uint32 maxDepth)
+{
+    if (baseDepth >= maxDepth) {
+        return DTK_SUCCESS;
+    }
+
+    char path[MAX_PATH];
+    size_t directoryLength = strlen(directory);
+    if (directoryLength >= sizeof(path)) {
+        return DTK_PATH_TOO_LONG;
+    }
+
+    memcpy(path, directory, directoryLength+1);
+    while (directoryLength > 1 && (path[directoryLength-1] == '/' || path[directoryLength-1] == '\\')) {
+        path[--directoryLength] = '\0';
+    }
+
+    // The frames are too big for the stack on Windows.
+    dtk_walk_directory_frame__win32* pFrames = (dtk_walk_directory_frame__win32*)dtk_malloc(sizeof(*pFrames) * (maxDepth - baseDepth));
+    if (pFrames == NULL) {
+        return DTK_OUT_OF_MEMORY;
+    }
+
+    if (!dtk_walk_directory__push_frame__win32(&pFrames[0], path, directoryLength, sizeof(path))) {
+        dtk_free(pFrames);
+        return DTK_DOES_NOT_EXIST;
+    }
+
+    dtk_result result = DTK_SUCCESS;
+    dtk_uint32 frameCount = 1;
+    while (frameCount > 0) {
+        if (pContext->isCancelled) {
+            result = DTK_CANCELLED;
+            break;
+        }
+
+        dtk_walk_directory_frame__win32* pFrame = &pFrames[frameCount-1];
+        if (pFrame->hasPendingEntry) {
+            pFrame->hasPendingEntry = DTK_FALSE;
+        } else if (!FindNextFileA(pFrame->hFind, &pFrame->ffd)) {
+            FindClose(pFrame->hFind);
+            frameCount -= 1;
+            continue;
+        }
+
+        const char* name = pFrame->ffd.cFileName;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            continue;
+        }
+
+        size_t nameLength = strlen(name);
+        if (pFrame->pathLength + 1 + nameLength >= sizeof(path)) {
+            continue;   // Path is too long.
+        }
+
+        if (dtk_walk_directory__is_excluded(pContext, name)) {
+            continue;
+        }
+
+        path[pFrame->pathLength] = '/';
+        memcpy(path + pFrame->pathLength + 1, name, nameLength+1);
+
+        dtk_walk_directory_entry entry;
+        entry.path           = path;
+        entry.name           = path + pFrame->pathLength + 1;
+        entry.depth          = baseDepth + frameCount - 1;
+        entry.isDirectory    = (pFrame->ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        entry.isSymbolicLink = (pFrame->ffd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+        if (entry.isDirectory && dtk_walk_directory__is_excluded_directory(pContext, path)) {
+            continue;
+        }
+
+        if (!dtk_walk_directory__report(pContext, &entry)) {
+            result = DTK_CANCELLED;
+            break;
+        }
+
+        if (entry.isDirectory && !entry.isSymbolicLink && entry.depth+1 < maxDepth) {
+            if (dtk_walk_directory__push_frame__win32(&pFrames[frameCount], path, pFrame->pathLength + 1 + nameLength, sizeof(path))) {
+                frameCount += 1;
+            }
+        }
+    }
+
+    while (frameCount > 0) {
+        FindClose(pFrames[--frameCount].hFind);
+    }
+
+    dtk_free(pFrames);
+    return result;
+}
 #endif
 
 
@@ -117,6 +364,203 @@ dtk_result dtk_set_current_directory__posix(const char* path)
 
     return DTK_SUCCESS;
 }
+
+size_t dtk_get_mapping_granularity__posix()
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0) {
+        pageSize = 4096;
+    }
+
+    return (size_t)pageSize;
+}
+
+dtk_result dtk_mapped_file_open__posix(const char* filePath, dtk_bool32 writable, dtk_mapped_file* pFile)
+{
+    int fd = open(filePath, writable ? O_RDWR : O_RDONLY);
+    if (fd == -1) {
+        return (errno == ENOENT) ? DTK_DOES_NOT_EXIST : DTK_FAILED_TO_OPEN_FILE;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || S_ISDIR(info.st_mode)) {
+        close(fd);
+        return DTK_FAILED_TO_OPEN_FILE;
+    }
+
+    pFile->fileSize = (dtk_uint64)info.st_size;
+    pFile->fd = fd;
+    return DTK_SUCCESS;
+}
+
+void dtk_mapped_file_close__posix(dtk_mapped_file* pFile)
+{
+    close(pFile->fd);
+}
+
+void* dtk_mapped_file_map__posix(dtk_mapped_file* pFile, dtk_uint64 alignedOffset, size_t size)
+{
+    void* pMappedData = mmap(NULL, size, pFile->isWritable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, pFile->fd, (off_t)alignedOffset);
+    if (pMappedData == MAP_FAILED) {
+        return NULL;
+    }
+
+    return pMappedData;
+}
+
+void dtk_mapped_file_unmap__posix(dtk_mapped_view* pView)
+{
+    munmap(pView->pMappedData, pView->mappedSize);
+}
+
+dtk_result dtk_mapped_file_flush__posix(dtk_mapped_view* pView)
+{
+    if (msync(pView->pMappedData, pView->mappedSize, MS_SYNC) != 0) {
+        return DTK_FAILED_TO_WRITE_FILE;
+    }
+
+    return DTK_SUCCESS;
+}
+
+typedef struct
+{
+    DIR* pDir;
+    size_t pathLength;
+} dtk_walk_directory_frame__posix;
+
+static DIR* dtk_walk_directory__open__posix(int parentFD, const char* path)
+{
+    int fd = openat(parentFD, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW);
+    if (fd == -1) {
+        return NULL;
+    }
+
+    DIR* pDir = fdopendir(fd);
+    if (pDir == NULL) {
+        close(fd);
+        return NULL;
+    }
+
+    return pDir;
+}
+
+dtk_result dtk_walk_directory__sequential__posix(dtk_walk_directory_context* pContext, const char* directory, dtk_uint32 baseDepth, dtk_uint32 maxDepth)
+{
+    if (baseDepth >= maxDepth) {
+        return DTK_SUCCESS;
+    }
+
+    char path[4096];
+    size_t directoryLength = strlen(directory);
+    if (directoryLength >= sizeof(path)) {
+        return DTK_PATH_TOO_LONG;
+    }
+
+    memcpy(path, directory, directoryLength+1);
+    while (directoryLength > 1 && path[directoryLength-1] == '/') {
+        path[--directoryLength] = '\0';
+    }
+
+    // The root directory itself is allowed to be a symbolic link, so O_NOFOLLOW can't be used here.
+    int rootFD = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (rootFD == -1) {
+        return DTK_DOES_NOT_EXIST;
+    }
+
+    dtk_walk_directory_frame__posix frames[DTK_WALK_DIRECTORY_MAX_DEPTH];
+    frames[0].pDir = fdopendir(rootFD);
+    if (frames[0].pDir == NULL) {
+        close(rootFD);
+        return DTK_ERROR;
+    }
+
+    // For "/" we don't want to end up with "//name".
+    frames[0].pathLength = (directoryLength == 1 && path[0] == '/') ? 0 : directoryLength;
+
+    dtk_result result = DTK_SUCCESS;
+    dtk_uint32 frameCount = 1;
+    while (frameCount > 0) {
+        if (pContext->isCancelled) {
+            result = DTK_CANCELLED;
+            break;
+        }
+
+        dtk_walk_directory_frame__posix* pFrame = &frames[frameCount-1];
+        struct dirent* pInfo = readdir(pFrame->pDir);
+        if (pInfo == NULL) {
+            closedir(pFrame->pDir);
+            frameCount -= 1;
+            continue;
+        }
+
+        const char* name = pInfo->d_name;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            continue;
+        }
+
+        size_t nameLength = strlen(name);
+        if (pFrame->pathLength + 1 + nameLength >= sizeof(path)) {
+            continue;   // Path is too long.
+        }
+
+        if (dtk_walk_directory__is_excluded(pContext, name)) {
+            continue;
+        }
+
+        // The type is taken from the directory listing where possible. Only symbolic links, and entries on file systems that
+        // don't fill out d_type, need to be stat'd.
+        dtk_bool32 isDirectory = DTK_FALSE;
+        dtk_bool32 isSymbolicLink = DTK_FALSE;
+        if (pInfo->d_type == DT_DIR) {
+            isDirectory = DTK_TRUE;
+        } else if (pInfo->d_type == DT_LNK || pInfo->d_type == DT_UNKNOWN) {
+            struct stat info;
+            if (pInfo->d_type == DT_LNK) {
+                isSymbolicLink = DTK_TRUE;
+            } else if (fstatat(dirfd(pFrame->pDir), name, &info, AT_SYMLINK_NOFOLLOW) == 0) {
+                isSymbolicLink = S_ISLNK(info.st_mode);
+                isDirectory    = S_ISDIR(info.st_mode);
+            }
+
+            if (isSymbolicLink && fstatat(dirfd(pFrame->pDir), name, &info, 0) == 0) {
+                isDirectory = S_ISDIR(info.st_mode);
+            }
+        }
+
+        path[pFrame->pathLength] = '/';
+        memcpy(path + pFrame->pathLength + 1, name, nameLength+1);
+
+        if (isDirectory && dtk_walk_directory__is_excluded_directory(pContext, path)) {
+            continue;
+        }
+
+        dtk_walk_directory_entry entry;
+        entry.path           = path;
+        entry.name           = path + pFrame->pathLength + 1;
+        entry.depth          = baseDepth + frameCount - 1;
+        entry.isDirectory    = isDirectory;
+        entry.isSymbolicLink = isSymbolicLink;
+        if (!dtk_walk_directory__report(pContext, &entry)) {
+            result = DTK_CANCELLED;
+            break;
+        }
+
+        if (isDirectory && !isSymbolicLink && entry.depth+1 < maxDepth) {
+            DIR* pChildDir = dtk_walk_directory__open__posix(dirfd(pFrame->pDir), name);
+            if (pChildDir != NULL) {
+                frames[frameCount].pDir = pChildDir;
+                frames[frameCount].pathLength = pFrame->pathLength + 1 + nameLength;
+                frameCount += 1;
+            }
+        }
+    }
+
+    while (frameCount > 0) {
+        closedir(frames[--frameCount].pDir);
+    }
+
+    return result;
+}
 #endif
 
 
@@ -558,95 +1002,207 @@ dtk_result dtk_mkdir_for_file(const char* filePath)
     return result;
 }
 
-dtk_bool32 dtk_iterate_files(const char* directory, dtk_bool32 recursive, dtk_iterate_files_proc proc, void* pUserData)
+dtk_result dtk_walk_directory__sequential(dtk_walk_directory_context* pContext, const char* directory, dtk_uint32 baseDepth, dtk_uint32 maxDepth)
 {
-#ifdef _WIN32
-    char searchQuery[MAX_PATH];
-    dtk_strcpy_s(searchQuery, sizeof(searchQuery), directory);
-
-    unsigned int searchQueryLength = (unsigned int)strlen(searchQuery);
-    if (searchQueryLength >= MAX_PATH - 3) {
-        return DTK_FALSE;    // Path is too long.
-    }
-
-    searchQuery[searchQueryLength + 0] = '\\';
-    searchQuery[searchQueryLength + 1] = '*';
-    searchQuery[searchQueryLength + 2] = '\0';
+#ifdef DTK_WIN32
+    return dtk_walk_directory__sequential__win32(pContext, directory, baseDepth, maxDepth);
+#endif
+#ifdef DTK_POSIX
+    return dtk_walk_directory__sequential__posix(pContext, directory, baseDepth, maxDepth);
+#endif
+}
 
-    WIN32_FIND_DATAA ffd;
-    HANDLE hFind = FindFirstFileA(searchQuery, &ffd);
-    if (hFind == INVALID_HANDLE_VALUE) {
-        return DTK_FALSE; // Failed to begin search.
-    }
+// State for walking the sub-directories of the root on multiple threads.
+typedef struct
+{
+    dtk_walk_directory_context* pContext;   // The context of the user's callback.
+    dtk_uint32 userFlags;                   // The flags from the user's config.
+    dtk_uint32 maxDepth;
+    char** ppDirectories;                   // The sub-directories of the root, to be walked by the worker threads.
+    dtk_uint32 directoryCount;
+    dtk_uint32 directoryCapacity;
+    dtk_uint32 nextDirectory;               // Atomic.
+    dtk_bool32 outOfMemory;
+} dtk_walk_directory_fanout;
+
+static dtk_bool32 dtk_walk_directory__fanout_root_proc(const dtk_walk_directory_entry* pEntry, void* pUserData)
+{
+    dtk_walk_directory_fanout* pFanout = (dtk_walk_directory_fanout*)pUserData;
+    dtk_assert(pFanout != NULL);
+
+    if (pEntry->isDirectory && !pEntry->isSymbolicLink) {
+        if (pFanout->directoryCount == pFanout->directoryCapacity) {
+            dtk_uint32 newCapacity = (pFanout->directoryCapacity == 0) ? 64 : pFanout->directoryCapacity*2;
+            char** ppNewDirectories = (char**)dtk_realloc(pFanout->ppDirectories, newCapacity * sizeof(*ppNewDirectories));
+            if (ppNewDirectories == NULL) {
+                pFanout->outOfMemory = DTK_TRUE;
+                return DTK_FALSE;
+            }
 
-    do
-    {
-        // Skip past "." and ".." directories.
-        if (strcmp(ffd.cFileName, ".") == 0 || strcmp(ffd.cFileName, "..") == 0) {
-            continue;
+            pFanout->ppDirectories = ppNewDirectories;
+            pFanout->directoryCapacity = newCapacity;
         }
 
-        char filePath[MAX_PATH];
-        dtk_strcpy_s(filePath, sizeof(filePath), directory);
-        dtk_strcat_s(filePath, sizeof(filePath), "/");
-        dtk_strcat_s(filePath, sizeof(filePath), ffd.cFileName);
-
-        if (!proc(filePath, pUserData)) {
+        pFanout->ppDirectories[pFanout->directoryCount] = dtk_make_string(pEntry->path);
+        if (pFanout->ppDirectories[pFanout->directoryCount] == NULL) {
+            pFanout->outOfMemory = DTK_TRUE;
             return DTK_FALSE;
         }
 
-        if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
-            if (recursive) {
-                if (!dtk_iterate_files(filePath, recursive, proc, pUserData)) {
-                    return DTK_FALSE;
-                }
-            }
-        }
+        pFanout->directoryCount += 1;
 
-    } while (FindNextFileA(hFind, &ffd));
+        // The root pass always sees directories so they can be collected, but the user may not want them.
+        if ((pFanout->userFlags & DTK_WALK_DIRECTORY_EXCLUDE_DIRECTORIES) != 0) {
+            return DTK_TRUE;
+        }
+    }
 
-    FindClose(hFind);
-#else
-    DIR* dir = opendir(directory);
-    if (dir == NULL) {
+    if (!pFanout->pContext->proc(pEntry, pFanout->pContext->pUserData)) {
+        pFanout->pContext->isCancelled = DTK_TRUE;
         return DTK_FALSE;
     }
 
-    struct dirent* info = NULL;
-    while ((info = readdir(dir)) != NULL)
-    {
-        // Skip past "." and ".." directories.
-        if (strcmp(info->d_name, ".") == 0 || strcmp(info->d_name, "..") == 0) {
-            continue;
-        }
+    return DTK_TRUE;
+}
 
-        char filePath[4096];
-        dtk_strcpy_s(filePath, sizeof(filePath), directory);
-        dtk_strcat_s(filePath, sizeof(filePath), "/");
-        dtk_strcat_s(filePath, sizeof(filePath), info->d_name);
+static dtk_thread_result DTK_THREADCALL dtk_walk_directory__fanout_thread_proc(void* pData)
+{
+    dtk_walk_directory_fanout* pFanout = (dtk_walk_directory_fanout*)pData;
+    dtk_assert(pFanout != NULL);
 
-        struct stat fileinfo;
-        if (stat(filePath, &fileinfo) != 0) {
-            continue;
+    for (;;) {
+        dtk_uint32 iDirectory = dtk_atomic_increment_32(&pFanout->nextDirectory) - 1;
+        if (iDirectory >= pFanout->directoryCount || pFanout->pContext->isCancelled) {
+            break;
         }
 
-        if (!proc(filePath, pUserData)) {
-            return DTK_FALSE;
+        dtk_walk_directory__sequential(pFanout->pContext, pFanout->ppDirectories[iDirectory], 1, pFanout->maxDepth);
+    }
+
+    return 0;
+}
+
+dtk_result dtk_walk_directory__parallel(dtk_walk_directory_context* pContext, const char* directory, dtk_uint32 maxDepth)
+{
+    dtk_assert(pContext != NULL);
+
+    // The entries directly inside the root are walked on this thread, and the sub-directories are collected for the workers.
+    dtk_walk_directory_fanout fanout;
+    dtk_zero_object(&fanout);
+    fanout.pContext = pContext;
+    fanout.userFlags = pContext->pConfig->flags;
+    fanout.maxDepth = maxDepth;
+
+    dtk_walk_directory_config rootConfig = *pContext->pConfig;
+    rootConfig.flags &= ~DTK_WALK_DIRECTORY_EXCLUDE_DIRECTORIES;
+
+    dtk_walk_directory_context rootContext;
+    dtk_zero_object(&rootContext);
+    rootContext.pConfig = &rootConfig;
+    rootContext.proc = dtk_walk_directory__fanout_root_proc;
+    rootContext.pUserData = &fanout;
+
+    dtk_result result = dtk_walk_directory__sequential(&rootContext, directory, 0, 1);
+    if (result == DTK_SUCCESS && fanout.directoryCount > 0) {
+        // The calling thread is one of the workers.
+        dtk_uint32 threadCount = dtk_min(pContext->pConfig->threadCount, fanout.directoryCount) - 1;
+        dtk_thread* pThreads = (dtk_thread*)dtk_malloc(sizeof(*pThreads) * (threadCount + 1));
+        if (pThreads == NULL) {
+            threadCount = 0;
         }
 
-        if (fileinfo.st_mode & S_IFDIR) {
-            if (recursive) {
-                if (!dtk_iterate_files(filePath, recursive, proc, pUserData)) {
-                    return DTK_FALSE;
-                }
+        dtk_uint32 createdThreadCount = 0;
+        for (dtk_uint32 iThread = 0; iThread < threadCount; ++iThread) {
+            if (dtk_thread_create(&pThreads[createdThreadCount], dtk_walk_directory__fanout_thread_proc, &fanout) != DTK_SUCCESS) {
+                break;
             }
+            createdThreadCount += 1;
+        }
+
+        dtk_walk_directory__fanout_thread_proc(&fanout);
+
+        for (dtk_uint32 iThread = 0; iThread < createdThreadCount; ++iThread) {
+            dtk_thread_wait(&pThreads[iThread]);
         }
+
+        dtk_free(pThreads);
     }
 
-    closedir(dir);
-#endif
+    for (dtk_uint32 iDirectory = 0; iDirectory < fanout.directoryCount; ++iDirectory) {
+        dtk_free_string(fanout.ppDirectories[iDirectory]);
+    }
+    dtk_free(fanout.ppDirectories);
 
-    return DTK_TRUE;
+    if (fanout.outOfMemory) {
+        return DTK_OUT_OF_MEMORY;
+    }
+    if (pContext->isCancelled) {
+        return DTK_CANCELLED;
+    }
+
+    return result;
+}
+
+dtk_result dtk_walk_directory(const char* directory, const dtk_walk_directory_config* pConfig, dtk_walk_directory_proc proc, void* pUserData)
+{
+    if (directory == NULL || proc == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    dtk_walk_directory_config defaultConfig;
+    if (pConfig == NULL) {
+        dtk_zero_object(&defaultConfig);
+        pConfig = &defaultConfig;
+    }
+
+    dtk_walk_directory_context context;
+    dtk_zero_object(&context);
+    context.pConfig = pConfig;
+    context.proc = proc;
+    context.pUserData = pUserData;
+
+    dtk_uint32 maxDepth = pConfig->maxDepth;
+    if (maxDepth == 0 || maxDepth > DTK_WALK_DIRECTORY_MAX_DEPTH) {
+        maxDepth = DTK_WALK_DIRECTORY_MAX_DEPTH;
+    }
+
+    if (pConfig->threadCount > 1 && maxDepth > 1) {
+        return dtk_walk_directory__parallel(&context, directory, maxDepth);
+    } else {
+        return dtk_walk_directory__sequential(&context, directory, 0, maxDepth);
+    }
+}
+
+
+typedef struct
+{
+    dtk_iterate_files_proc proc;
+    void* pUserData;
+} dtk_iterate_files_data;
+
+static dtk_bool32 dtk_iterate_files__walk_proc(const dtk_walk_directory_entry* pEntry, void* pUserData)
+{
+    dtk_iterate_files_data* pData = (dtk_iterate_files_data*)pUserData;
+    dtk_assert(pData != NULL);
+
+    return pData->proc(pEntry->path, pData->pUserData);
+}
+
+dtk_bool32 dtk_iterate_files(const char* directory, dtk_bool32 recursive, dtk_iterate_files_proc proc, void* pUserData)
+{
+    if (directory == NULL || proc == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_iterate_files_data data;
+    data.proc = proc;
+    data.pUserData = pUserData;
+
+    dtk_walk_directory_config config;
+    dtk_zero_object(&config);
+    config.maxDepth = (recursive) ? 0 : 1;
+
+    return dtk_walk_directory(directory, &config, dtk_iterate_files__walk_proc, &data) == DTK_SUCCESS;
 }
 
 
@@ -727,3 +1283,137 @@ char* dtk_make_relative_path_from_current_directory(const char* pAbsolutePath)
 
     return pRelativePath;
 }
+
+
+size_t dtk_get_mapping_granularity()
+{
+#ifdef DTK_WIN32
+    return dtk_get_mapping_granularity__win32();
+#endif
+#ifdef DTK_POSIX
+    return dtk_get_mapping_granularity__posix();
+#endif
+}
+
+dtk_result dtk_mapped_file_open(const char* filePath, dtk_bool32 writable, dtk_mapped_file* pFile)
+{
+    if (pFile == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    dtk_zero_object(pFile);
+
+    if (filePath == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    dtk_result result = DTK_ERROR;
+#ifdef DTK_WIN32
+    result = dtk_mapped_file_open__win32(filePath, writable, pFile);
+#endif
+#ifdef DTK_POSIX
+    result = dtk_mapped_file_open__posix(filePath, writable, pFile);
+#endif
+    if (result != DTK_SUCCESS) {
+        return result;
+    }
+
+    pFile->isWritable = writable;
+    return DTK_SUCCESS;
+}
+
+void dtk_mapped_file_close(dtk_mapped_file* pFile)
+{
+    if (pFile == NULL) {
+        return;
+    }
+
+#ifdef DTK_WIN32
+    dtk_mapped_file_close__win32(pFile);
+#endif
+#ifdef DTK_POSIX
+    dtk_mapped_file_close__posix(pFile);
+#endif
+
+    dtk_zero_object(pFile);
+}
+
+dtk_result dtk_mapped_file_map(dtk_mapped_file* pFile, dtk_uint64 offset, size_t size, dtk_mapped_view* pView)
+{
+    if (pView == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    dtk_zero_object(pView);
+
+    if (pFile == NULL || size == 0) {
+        return DTK_INVALID_ARGS;
+    }
+
+    if (offset >= pFile->fileSize) {
+        return DTK_END_OF_FILE;
+    }
+
+    if (size > pFile->fileSize - offset) {
+        size = (size_t)(pFile->fileSize - offset);
+    }
+
+    // The offset passed to the mapping APIs must be aligned to the mapping granularity.
+    dtk_uint64 granularity = (dtk_uint64)dtk_get_mapping_granularity();
+    dtk_uint64 alignedOffset = offset - (offset % granularity);
+    size_t mappedSize = (size_t)(offset - alignedOffset) + size;
+
+    void* pMappedData = NULL;
+#ifdef DTK_WIN32
+    pMappedData = dtk_mapped_file_map__win32(pFile, alignedOffset, mappedSize);
+#endif
+#ifdef DTK_POSIX
+    pMappedData = dtk_mapped_file_map__posix(pFile, alignedOffset, mappedSize);
+#endif
+    if (pMappedData == NULL) {
+        return DTK_OUT_OF_MEMORY;
+    }
+
+    pView->pMappedData = pMappedData;
+    pView->mappedSize = mappedSize;
+    pView->offset = offset;
+    pView->pData = (dtk_uint8*)pMappedData + (offset - alignedOffset);
+    pView->dataSize = size;
+    return DTK_SUCCESS;
+}
+
+void dtk_mapped_file_unmap(dtk_mapped_file* pFile, dtk_mapped_view* pView)
+{
+    (void)pFile;
+
+    if (pView == NULL || pView->pMappedData == NULL) {
+        return;
+    }
+
+#ifdef DTK_WIN32
+    dtk_mapped_file_unmap__win32(pView);
+#endif
+#ifdef DTK_POSIX
+    dtk_mapped_file_unmap__posix(pView);
+#endif
+
+    dtk_zero_object(pView);
+}
+
+dtk_result dtk_mapped_file_flush(dtk_mapped_file* pFile, dtk_mapped_view* pView)
+{
+    if (pFile == NULL || pView == NULL || pView->pMappedData == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    if (!pFile->isWritable) {
+        return DTK_INVALID_OPERATION;
+    }
+
+#ifdef DTK_WIN32
+    return dtk_mapped_file_flush__win32(pView);
+#endif
+#ifdef DTK_POSIX
+    return dtk_mapped_file_flush__posix(pView);
+#endif
+}
@@ -71,6 +71,67 @@ typedef dtk_bool32 (* dtk_iterate_files_proc)(const char* filePath, void* pUserD
 dtk_bool32 dtk_iterate_files(const char* directory, dtk_bool32 recursive, dtk_iterate_files_proc proc, void* pUserData);
 
 
+// Directory walking.
+//
+// dtk_walk_directory() is a faster and more flexible alternative to dtk_iterate_files(). The tree is walked iteratively
+// rather than recursively, entries are opened relative to their parent directory and the type of each entry is taken from
+// the directory listing where possible so that most entries never need to be stat'd.
+//
+// Symbolic links to directories are reported as directories, but are never descended into so that cycles are impossible.
+#define DTK_WALK_DIRECTORY_MAX_DEPTH            256
+
+#define DTK_WALK_DIRECTORY_EXCLUDE_FILES        (1 << 0)    // Files are not passed to the callback.
+#define DTK_WALK_DIRECTORY_EXCLUDE_DIRECTORIES  (1 << 1)    // Directories are not passed to the callback, but are still descended into.
+
+typedef struct
+{
+    const char* path;           // The full path of the entry, including the directory that was passed to dtk_walk_directory().
+    const char* name;           // The file name part of the path.
+    dtk_uint32 depth;           // The depth of the entry relative to the root directory. Entries directly inside the root are at depth 0.
+    dtk_bool32 isDirectory;
+    dtk_bool32 isSymbolicLink;
+} dtk_walk_directory_entry;
+
+// Callback function for directory walking. Return DTK_FALSE to stop walking.
+typedef dtk_bool32 (* dtk_walk_directory_proc)(const dtk_walk_directory_entry* pEntry, void* pUserData);
+
+typedef struct
+{
+    // The maximum number of levels to walk. 1 will only visit the entries directly inside the root directory. 0 is the same as
+    // DTK_WALK_DIRECTORY_MAX_DEPTH.
+    dtk_uint32 maxDepth;
+
+    // Wildcard patterns (see dtk_wildcard_match()) that are matched against the name of each file. When there is at least one
+    // include pattern, only files matching one of them are passed to the callback. Directories are not affected.
+    const char** ppIncludePatterns;
+    dtk_uint32 includePatternCount;
+
+    // Wildcard patterns that are matched against the name of each file and directory. Matching entries are skipped, and matching
+    // directories are not descended into.
+    const char** ppExcludePatterns;
+    dtk_uint32 excludePatternCount;
+
+    // Directories that are skipped and not descended into. Unlike the exclude patterns these are compared against the whole
+    // path of the directory rather than it's name, so they can exclude one specific directory, such as an application's own
+    // data folder. They must be in the same form as the directory passed to dtk_walk_directory().
+    const char** ppExcludeDirectories;
+    dtk_uint32 excludeDirectoryCount;
+
+    // A combination of DTK_WALK_DIRECTORY_* flags.
+    dtk_uint32 flags;
+
+    // When larger than 1, each sub-directory of the root is walked on one of this many threads. In this case the callback will
+    // be called from multiple threads at the same time and must be thread-safe.
+    dtk_uint32 threadCount;
+} dtk_walk_directory_config;
+
+// Walks the given directory, calling the callback for each entry. pConfig can be NULL, in which case the whole tree is walked
+// on the calling thread.
+//
+// Returns DTK_CANCELLED if the callback returned DTK_FALSE.
+dtk_result dtk_walk_directory(const char* directory, const dtk_walk_directory_config* pConfig, dtk_walk_directory_proc proc, void* pUserData);
+
+
 // Retrieves the current directory. Free the returned string with dtk_free(). Returns NULL on error.
 char* dtk_get_current_directory();
 
@@ -85,4 +146,52 @@ char* dtk_make_absolute_path_from_current_directory(const char* pRelativePath);
 // Converts an absolute path to relative based on the current directory.
 //
 // Free the returned string with dtk_free(). Returns NULL on error.
-char* dtk_make_relative_path_from_current_directory(const char* pAbsolutePath);
\ No newline at end of file
+char* dtk_make_relative_path_from_current_directory(const char* pAbsolutePath);
+
+// Memory mapped file access.
+//
+// This is used for accessing files that are too big to be loaded into memory in one go. Rather than mapping the entire
+// file, sections of the file are mapped as "views" which can be mapped and unmapped as required which keeps the amount
+// of resident memory bounded regardless of the size of the file.
+typedef struct
+{
+    dtk_uint64 fileSize;
+    dtk_bool32 isWritable;
+#ifdef DTK_WIN32
+    /*HANDLE*/ dtk_handle hFile;
+    /*HANDLE*/ dtk_handle hMapping;
+#endif
+#ifdef DTK_POSIX
+    int fd;
+#endif
+} dtk_mapped_file;
+
+typedef struct
+{
+    void* pMappedData;          // The pointer returned by the mapping API. This is aligned to the mapping granularity.
+    size_t mappedSize;
+    dtk_uint64 offset;          // The offset in the file of pData.
+    dtk_uint8* pData;           // Points to the byte at "offset". This is what applications should be reading from.
+    size_t dataSize;            // The number of bytes that can be read from pData.
+} dtk_mapped_view;
+
+// Retrieves the granularity of mapped views. The offset of the mapped data will always be a multiple of this.
+size_t dtk_get_mapping_granularity();
+
+// Opens a file for memory mapping. Returns DTK_DOES_NOT_EXIST if the file does not exist.
+dtk_result dtk_mapped_file_open(const char* filePath, dtk_bool32 writable, dtk_mapped_file* pFile);
+
+// Closes a file that was opened with dtk_mapped_file_open(). All views must be unmapped before calling this.
+void dtk_mapped_file_close(dtk_mapped_file* pFile);
+
+// Maps a section of the file into memory.
+//
+// The offset does not need to be aligned. If offset + size goes past the end of the file, the view will be clamped.
+// Returns DTK_END_OF_FILE if offset is at or beyond the end of the file.
+dtk_result dtk_mapped_file_map(dtk_mapped_file* pFile, dtk_uint64 offset, size_t size, dtk_mapped_view* pView);
+
+// Unmaps a view that was mapped with dtk_mapped_file_map().
+void dtk_mapped_file_unmap(dtk_mapped_file* pFile, dtk_mapped_view* pView);
+
+// Flushes the changes made to a writable view back to the file.
+dtk_result dtk_mapped_file_flush(dtk_mapped_file* pFile, dtk_mapped_view* pView);
@@ -195,12 +195,21 @@ void dtk_pipe_close__win32(dtk_pipe pipe)
 dtk_result dtk_pipe_connect__win32(dtk_pipe pipe)
 {
     if (!ConnectNamedPipe(pipe, NULL)) {
-        return dtk_win32_error_to_result(GetLastError());
+        DWORD dwError = GetLastError();
+        if (dwError != ERROR_PIPE_CONNECTED) {   // <-- A client connected between the disconnect and the call to ConnectNamedPipe().
+            return dtk_win32_error_to_result(dwError);
+        }
     }
 
     return DTK_SUCCESS;
 }
 
+dtk_result dtk_pipe_wait_for_next_client__win32(dtk_pipe pipe)
+{
+    DisconnectNamedPipe(DTK_IPC_PIPE_TO_WIN32_HANDLE(pipe));
+    return dtk_pipe_connect__win32(pipe);
+}
+
 
 dtk_result dtk_pipe_read__win32(dtk_pipe pipe, void* pDataOut, size_t bytesToRead, size_t* pBytesRead)
 {
@@ -517,6 +526,24 @@ void dtk_pipe_close(dtk_pipe pipe)
 }
 
 
+dtk_result dtk_pipe_wait_for_next_client(dtk_pipe pipe)
+{
+    if (pipe == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+#ifdef DTK_WIN32
+    return dtk_pipe_wait_for_next_client__win32(pipe);
+#endif
+
+#ifdef DTK_POSIX
+    // A FIFO that is open for both reading and writing never sees the end of the stream when a client disconnects, so
+    // the next client's data can just be read from the same file descriptor.
+    return DTK_SUCCESS;
+#endif
+}
+
+
 dtk_result dtk_pipe_read(dtk_pipe pipe, void* pDataOut, size_t bytesToRead, size_t* pBytesRead)
 {
     if (pBytesRead) *pBytesRead = 0;
@@ -551,6 +578,10 @@ dtk_result dtk_pipe_read_exact(dtk_pipe pipe, void* pDataOut, size_t bytesToRead
             return result;
         }
 
+        if (bytesRead == 0) {
+            return DTK_END_OF_FILE;     // The other end of the pipe has been closed.
+        }
+
         pDataOut = (void*)((char*)pDataOut + bytesRead);
 
         bytesToRead -= bytesRead;
@@ -29,6 +29,12 @@ dtk_result dtk_pipe_open_anonymous(dtk_pipe* pPipeRead, dtk_pipe* pPipeWrite);
 // Closes a pipe opened with dtk_pipe_open_named_server(), dtk_pipe_open_named_client() or dtk_pipe_open_anonymous().
 void dtk_pipe_close(dtk_pipe pipe);
 
+// Waits for the next client to connect to a server-side pipe after the current client has finished. This allows a server to
+// keep using the same pipe for every client rather than closing and re-opening it.
+//
+// On *nix platforms the server-side pipe must have been opened with both DTK_IPC_READ and DTK_IPC_WRITE.
+dtk_result dtk_pipe_wait_for_next_client(dtk_pipe serverPipe);
+
 
 // Reads data from a pipe.
 //
@@ -38,7 +44,7 @@ dtk_result dtk_pipe_read(dtk_pipe pipe, void* pDataOut, size_t bytesToRead, size
 
 // Reads data from a pipe and does not return until either an error occurs or exactly the number of requested bytes have been read.
 //
-// This is a blocking call.
+// This is a blocking call. Returns DTK_END_OF_FILE if the other end of the pipe is closed before everything has been read.
 dtk_result dtk_pipe_read_exact(dtk_pipe pipe, void* pDataOut, size_t bytesToRead, size_t* pBytesRead);
 
 
@@ -45,6 +45,8 @@ dtk_result dtk_paint_queue_enqueue(dtk_paint_queue* pQueue, dtk_window* pWindow,
 {
     if (pQueue == NULL || pWindow == NULL) return DTK_INVALID_ARGS;
 
+    dtk_uint64 perfBegTime = DTK_PERF_BEGIN();
+
     dtk_mutex_lock(&pQueue->lock);
     {
         if (!dtk_paint_queue__try_merge(pQueue, pWindow, rect)) {   // <-- This will try merging the new paint request with a previous one if possible. If it fails, we need to enqueue a new one.
@@ -55,6 +57,7 @@ dtk_result dtk_paint_queue_enqueue(dtk_paint_queue* pQueue, dtk_window* pWindow,
                 dtk_paint_queue_item* pNewItems = (dtk_paint_queue_item*)dtk_malloc(sizeof(*pNewItems) * newCapacity);
                 if (pNewItems == NULL) {
                     dtk_mutex_unlock(&pQueue->lock);
+                    DTK_PERF_END(PAINT_QUEUE_ENQUEUE, perfBegTime);
                     return DTK_OUT_OF_MEMORY;   // Ran out of memory :(
                 }
 
@@ -80,6 +83,7 @@ dtk_result dtk_paint_queue_enqueue(dtk_paint_queue* pQueue, dtk_window* pWindow,
     }
     dtk_mutex_unlock(&pQueue->lock);
 
+    DTK_PERF_END(PAINT_QUEUE_ENQUEUE, perfBegTime);
     return DTK_SUCCESS;
 }
 
@@ -51,6 +51,13 @@ DTK_INLINE dtk_rect dtk_rect_union(dtk_rect rect0, dtk_rect rect1)
         (rect0.bottom > rect1.bottom) ? rect0.bottom : rect1.bottom);
 }
 
+DTK_INLINE dtk_bool32 dtk_rect_intersects(dtk_rect rect0, dtk_rect rect1)
+{
+    return
+        rect0.left < rect1.right  && rect0.right  > rect1.left &&
+        rect0.top  < rect1.bottom && rect0.bottom > rect1.top;
+}
+
 DTK_INLINE dtk_rect dtk_rect_move_to_center(dtk_rect rect, dtk_rect bounds)
 {
     dtk_int32 rectSizeX = rect.right - rect.left;
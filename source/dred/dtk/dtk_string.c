@@ -95,6 +95,64 @@ const char* dtk_next_token(const char* tokens, char* tokenOut, size_t tokenOutSi
     return strEnd;
 }
 
+dtk_bool32 dtk_wildcard_match(const char* pattern, const char* str)
+{
+    if (pattern == NULL || str == NULL) {
+        return DTK_FALSE;
+    }
+
+    // This is the standard greedy algorithm with single-star backtracking which runs in linear time for most patterns.
+    const char* pStar = NULL;
+    const char* pStarStr = NULL;
+    while (*str != '\0') {
+        if (*pattern == '*') {
+            pStar = pattern++;
+            pStarStr = str;
+        } else if (*pattern == '?' || *pattern == *str) {
+            pattern += 1;
+            str += 1;
+        } else if (pStar != NULL) {
+            pattern = pStar + 1;
+            str = ++pStarStr;
+        } else {
+            return DTK_FALSE;
+        }
+    }
+
+    while (*pattern == '*') {
+        pattern += 1;
+    }
+
+    return *pattern == '\0';
+}
+
+dtk_uint32 dtk_hash_string(const char* str, dtk_uint32 seed)
+{
+    if (str == NULL) {
+        return 0;
+    }
+
+    // FNV-1a with the seed mixed into the offset basis, followed by the MurmurHash3 finalizer to spread the bits.
+    dtk_uint32 hash = 2166136261U ^ (seed * 0x9E3779B9U);
+    while (*str != '\0') {
+        hash ^= (dtk_uint8)*str++;
+        hash *= 16777619U;
+    }
+
+    return dtk_hash_uint32(hash);
+}
+
+dtk_uint32 dtk_hash_uint32(dtk_uint32 x)
+{
+    // MurmurHash3 finalizer.
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
+}
+
 
 void dtk_parse_key_value_pairs(dtk_key_value_read_proc onRead, dtk_key_value_pair_proc onPair, dtk_key_value_error_proc onError, void* pUserData)
 {
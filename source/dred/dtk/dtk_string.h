@@ -504,6 +504,17 @@ dtk_bool32 dtk_hex_char_to_uint(char ascii, unsigned int* out);
 // This function has no dependencies.
 const char* dtk_next_token(const char* tokens, char* tokenOut, size_t tokenOutSize);
 
+// Determines whether or not the given string matches a wildcard pattern. "*" matches any sequence of characters (including
+// an empty sequence) and "?" matches any single character. Matching is case sensitive.
+dtk_bool32 dtk_wildcard_match(const char* pattern, const char* str);
+
+// Hashes a null terminated string. Different seeds produce independent hashes of the same string, which is what perfect
+// hashing relies on. The result is well mixed in the low bits so it can be masked to a power of two table size.
+dtk_uint32 dtk_hash_string(const char* str, dtk_uint32 seed);
+
+// Hashes a 32-bit integer. This is the finalizer used by dtk_hash_string().
+dtk_uint32 dtk_hash_uint32(dtk_uint32 x);
+
 // Callbacks for dtk_parse_key_value_pairs().
 typedef size_t (* dtk_key_value_read_proc) (void* pUserData, void* pDataOut, size_t bytesToRead);
 typedef void   (* dtk_key_value_pair_proc) (void* pUserData, const char* key, const char* value);
@@ -1,11 +1,11 @@
 // Copyright (C) 2018 David Reid. See included LICENSE file.
 
-dtk_result dtk_svg_init__internal(dtk_context* pTK, char* pSVGData, dtk_svg* pSVG)
+dtk_result dtk_svg_init__internal(char* pSVGData, float dpiScale, dtk_svg* pSVG)
 {
     dtk_assert(pSVGData != NULL);
     dtk_assert(pSVG != NULL);
 
-    pSVG->pNanoSVGImage = nsvgParse(pSVGData, "px", dtk_get_system_dpi_scale(pTK));
+    pSVG->pNanoSVGImage = nsvgParse(pSVGData, "px", dpiScale);
     if (pSVG->pNanoSVGImage == NULL) {
         return DTK_ERROR;
     }
@@ -14,6 +14,11 @@ dtk_result dtk_svg_init__internal(dtk_context* pTK, char* pSVGData, dtk_svg* pSV
 }
 
 dtk_result dtk_svg_init(dtk_context* pTK, const char* pSVGData, dtk_svg* pSVG)
+{
+    return dtk_svg_init_with_dpi_scale(pSVGData, dtk_get_system_dpi_scale(pTK), pSVG);
+}
+
+dtk_result dtk_svg_init_with_dpi_scale(const char* pSVGData, float dpiScale, dtk_svg* pSVG)
 {
     if (pSVG == NULL) return DTK_INVALID_ARGS;
     dtk_zero_object(pSVG);
@@ -32,7 +37,7 @@ dtk_result dtk_svg_init(dtk_context* pTK, const char* pSVGData, dtk_svg* pSVG)
     strcpy_s(pTempSVGData, svgDataLen+1, pSVGData);
 
 
-    dtk_result result = dtk_svg_init__internal(pTK, pTempSVGData, pSVG);
+    dtk_result result = dtk_svg_init__internal(pTempSVGData, dpiScale, pSVG);
     if (result != DTK_SUCCESS) {
         return result;
     }
@@ -56,7 +61,7 @@ dtk_result dtk_svg_init_file(dtk_context* pTK, const char* pFilePath, dtk_svg* p
         return result;
     }
 
-    result = dtk_svg_init__internal(pTK, pSVGData, pSVG);
+    result = dtk_svg_init__internal(pSVGData, dtk_get_system_dpi_scale(pTK), pSVG);
     
     dtk_free(pSVGData);
     return result;
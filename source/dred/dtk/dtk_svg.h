@@ -6,6 +6,10 @@ typedef struct
 } dtk_svg;
 
 dtk_result dtk_svg_init(dtk_context* pTK, const char* pSVGData, dtk_svg* pSVG);
+
+// Same as dtk_svg_init(), except the DPI scale is passed in explicitly. This does not touch the toolkit context which means
+// it's safe to call from a worker thread.
+dtk_result dtk_svg_init_with_dpi_scale(const char* pSVGData, float dpiScale, dtk_svg* pSVG);
 dtk_result dtk_svg_init_file(dtk_context* pTK, const char* pFilePath, dtk_svg* pSVG);
 dtk_result dtk_svg_uninit(dtk_svg* pSVG);
 
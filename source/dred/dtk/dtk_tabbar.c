@@ -38,27 +38,47 @@ typedef struct
     dtk_int32 _longestTextWidth;    // Internal use only.
 } dtk_tabbar__iterator;
 
+void dtk_tabbar__measure_tab_text(const dtk_tabbar* pTabBar, dtk_tabbar_tab* pTab, float uiScale)
+{
+    dtk_assert(pTabBar != NULL);
+    dtk_assert(pTab != NULL);
+
+    if (pTab->isTextMeasured) {
+        return;
+    }
+
+    if (pTab->pText != NULL) {
+        dtk_font_measure_string(dtk_tabbar_get_font(pTabBar), uiScale, pTab->pText, strlen(pTab->pText), &pTab->textWidth, &pTab->textHeight);
+    } else {
+        pTab->textWidth = 0;
+        pTab->textHeight = 0;
+
+        dtk_font_metrics metrics;
+        dtk_result result = dtk_font_get_metrics(dtk_tabbar_get_font(pTabBar), uiScale, &metrics);
+        if (result == DTK_SUCCESS) {
+            pTab->textHeight = metrics.lineHeight;
+        }
+    }
+
+    pTab->isTextMeasured = DTK_TRUE;
+}
+
 dtk_int32 dtk_tabbar__find_longest_tab_text(const dtk_tabbar* pTabBar)
 {
-    float uiScale = dtk_control_get_scaling_factor(DTK_CONTROL(pTabBar));
     dtk_int32 longestWidth = 0;
 
     for (dtk_uint32 iTab = 0; iTab < pTabBar->tabCount; ++iTab) {
-        dtk_tabbar_tab* pTab = &pTabBar->pTabs[iTab];
+        dtk_assert(pTabBar->pTabs[iTab].isTextMeasured);
 
-        dtk_int32 textWidth;
-        dtk_int32 textHeight;
-        dtk_font_measure_string(dtk_tabbar_get_font(pTabBar), uiScale, pTab->pText, strlen(pTab->pText), &textWidth, &textHeight);
-
-        if (longestWidth < textWidth) {
-            longestWidth = textWidth;
+        if (longestWidth < pTabBar->pTabs[iTab].textWidth) {
+            longestWidth = pTabBar->pTabs[iTab].textWidth;
         }
     }
 
     return longestWidth;
 }
 
-dtk_bool32 dtk_tabbar__next_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
+dtk_bool32 dtk_tabbar__layout_next_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
 {
     dtk_assert(pTabBar != NULL);
     dtk_assert(pIterator != NULL);
@@ -96,21 +116,11 @@ dtk_bool32 dtk_tabbar__next_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator*
     dtk_uint32 prevTabWidth  = pIterator->width;
     dtk_uint32 prevTabHeight = pIterator->height;
 
-    // The size and position of each tab depends on the flow and text direction of the tabbar.
-    dtk_int32 actualTextWidth;
-    dtk_int32 actualTextHeight;
-    if (pIterator->pTab->pText != NULL) {
-        dtk_font_measure_string(dtk_tabbar_get_font(pTabBar), uiScale, pIterator->pTab->pText, strlen(pIterator->pTab->pText), &actualTextWidth, &actualTextHeight);
-    } else {
-        actualTextWidth = 0;
-        actualTextHeight = 0;
-
-        dtk_font_metrics metrics;
-        dtk_result result = dtk_font_get_metrics(dtk_tabbar_get_font(pTabBar), uiScale, &metrics);
-        if (result == DTK_SUCCESS) {
-            actualTextHeight = metrics.lineHeight;
-        }
-    }
+    // The size and position of each tab depends on the flow and text direction of the tabbar. The text is measured ahead of
+    // time by dtk_tabbar__update_layout().
+    dtk_assert(pIterator->pTab->isTextMeasured);
+    dtk_int32 actualTextWidth  = pIterator->pTab->textWidth;
+    dtk_int32 actualTextHeight = pIterator->pTab->textHeight;
 
     
 
@@ -229,7 +239,7 @@ dtk_bool32 dtk_tabbar__next_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator*
     return DTK_TRUE;
 }
 
-dtk_bool32 dtk_tabbar__first_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
+dtk_bool32 dtk_tabbar__layout_first_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
 {
     dtk_assert(pTabBar != NULL);
     dtk_assert(pIterator != NULL);
@@ -253,7 +263,114 @@ dtk_bool32 dtk_tabbar__first_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator
         pIterator->_longestTextWidth = dtk_tabbar__find_longest_tab_text(pTabBar);
     }
 
-    return dtk_tabbar__next_tab(pTabBar, pIterator);
+    return dtk_tabbar__layout_next_tab(pTabBar, pIterator);
+}
+
+void dtk_tabbar__invalidate_layout(dtk_tabbar* pTabBar)
+{
+    dtk_assert(pTabBar != NULL);
+    pTabBar->isLayoutValid = DTK_FALSE;
+}
+
+void dtk_tabbar__invalidate_text_metrics(dtk_tabbar* pTabBar)
+{
+    dtk_assert(pTabBar != NULL);
+
+    for (dtk_uint32 iTab = 0; iTab < pTabBar->tabCount; ++iTab) {
+        pTabBar->pTabs[iTab].isTextMeasured = DTK_FALSE;
+    }
+
+    dtk_tabbar__invalidate_layout(pTabBar);
+}
+
+// The layout is a cache so it's updated lazily, which means it may be updated through a const pointer.
+void dtk_tabbar__update_layout(const dtk_tabbar* pTabBarConst)
+{
+    dtk_assert(pTabBarConst != NULL);
+
+    dtk_tabbar* pTabBar = (dtk_tabbar*)pTabBarConst;
+
+    float uiScale = dtk_control_get_scaling_factor(DTK_CONTROL(pTabBar));
+    dtk_int32 controlWidth  = dtk_control_get_width(DTK_CONTROL(pTabBar));
+    dtk_int32 controlHeight = dtk_control_get_height(DTK_CONTROL(pTabBar));
+
+    // The size of the control only affects the layout when tabs flow from the right or the bottom, but it's cheap to check
+    // so it's always done.
+    if (pTabBar->isLayoutValid && pTabBar->layoutScale == uiScale && pTabBar->layoutWidth == controlWidth && pTabBar->layoutHeight == controlHeight) {
+        return;
+    }
+
+    if (pTabBar->layoutScale != uiScale) {
+        dtk_tabbar__invalidate_text_metrics(pTabBar);
+    }
+
+    // Only tabs whose text or font has changed need to be measured.
+    for (dtk_uint32 iTab = 0; iTab < pTabBar->tabCount; ++iTab) {
+        dtk_tabbar__measure_tab_text(pTabBar, &pTabBar->pTabs[iTab], uiScale);
+    }
+
+    dtk_tabbar__iterator iterator;
+    if (dtk_tabbar__layout_first_tab(pTabBar, &iterator)) {
+        do
+        {
+            iterator.pTab->layoutRect = dtk_rect_init(iterator.posX, iterator.posY, iterator.posX + iterator.width, iterator.posY + iterator.height);
+            iterator.pTab->layoutTextRect = iterator.textRect;
+            iterator.pTab->layoutCloseButtonRect = iterator.closeButtonRect;
+        } while (dtk_tabbar__layout_next_tab(pTabBar, &iterator));
+    }
+
+    pTabBar->isLayoutValid = DTK_TRUE;
+    pTabBar->layoutScale   = uiScale;
+    pTabBar->layoutWidth   = controlWidth;
+    pTabBar->layoutHeight  = controlHeight;
+}
+
+void dtk_tabbar__load_iterator(const dtk_tabbar* pTabBar, dtk_int32 tabIndex, dtk_tabbar__iterator* pIterator)
+{
+    dtk_assert(pTabBar != NULL);
+    dtk_assert(pTabBar->isLayoutValid);
+    dtk_assert(tabIndex >= 0 && tabIndex < (dtk_int32)pTabBar->tabCount);
+    dtk_assert(pIterator != NULL);
+
+    dtk_tabbar_tab* pTab = &pTabBar->pTabs[tabIndex];
+
+    dtk_zero_object(pIterator);
+    pIterator->posX            = pTab->layoutRect.left;
+    pIterator->posY            = pTab->layoutRect.top;
+    pIterator->width           = (dtk_uint32)dtk_rect_width(pTab->layoutRect);
+    pIterator->height          = (dtk_uint32)dtk_rect_height(pTab->layoutRect);
+    pIterator->textRect        = pTab->layoutTextRect;
+    pIterator->closeButtonRect = pTab->layoutCloseButtonRect;
+    pIterator->pTab            = pTab;
+    pIterator->_nextIndex      = tabIndex;
+    pIterator->_isLast         = (dtk_uint32)tabIndex+1 == pTabBar->tabCount;
+}
+
+dtk_bool32 dtk_tabbar__next_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
+{
+    dtk_assert(pTabBar != NULL);
+    dtk_assert(pIterator != NULL);
+
+    if (pIterator->_isLast) {
+        return DTK_FALSE;   // Reached the end of iteration.
+    }
+
+    dtk_tabbar__load_iterator(pTabBar, pIterator->_nextIndex + 1, pIterator);
+    return DTK_TRUE;
+}
+
+dtk_bool32 dtk_tabbar__first_tab(const dtk_tabbar* pTabBar, dtk_tabbar__iterator* pIterator)
+{
+    dtk_assert(pTabBar != NULL);
+    dtk_assert(pIterator != NULL);
+
+    if (pTabBar->tabCount == 0) {
+        return DTK_FALSE;   // No tabs.
+    }
+
+    dtk_tabbar__update_layout(pTabBar);
+    dtk_tabbar__load_iterator(pTabBar, 0, pIterator);
+    return DTK_TRUE;
 }
 
 dtk_bool32 dtk_tabbar__first_tab_at(const dtk_tabbar* pTabBar, dtk_int32 tabIndex, dtk_tabbar__iterator* pIterator)
@@ -262,23 +379,50 @@ dtk_bool32 dtk_tabbar__first_tab_at(const dtk_tabbar* pTabBar, dtk_int32 tabInde
     dtk_assert(tabIndex < (dtk_int32)pTabBar->tabCount);
     dtk_assert(pIterator != NULL);
 
-    dtk_int32 i = 0;
-    if (dtk_tabbar__first_tab(pTabBar, pIterator)) {
-        for (;;) {
-            if (i == tabIndex) {
-                return DTK_TRUE;
-            }
+    if (tabIndex < 0 || tabIndex >= (dtk_int32)pTabBar->tabCount) {
+        return DTK_FALSE;
+    }
 
-            if (!dtk_tabbar__next_tab(pTabBar, pIterator)) {
-                return DTK_FALSE;
-            }
+    dtk_tabbar__update_layout(pTabBar);
+    dtk_tabbar__load_iterator(pTabBar, tabIndex, pIterator);
+    return DTK_TRUE;
+}
+
+// Finds the tab at the given position along the direction of flow. The tabs are laid out contiguously so their positions
+// are sorted, which means a binary search can be used. Returns -1 if the position is not over any tab. This does not
+// check the position on the other axis.
+dtk_int32 dtk_tabbar__find_tab_along_flow(const dtk_tabbar* pTabBar, dtk_int32 x, dtk_int32 y)
+{
+    dtk_assert(pTabBar != NULL);
+    dtk_assert(pTabBar->isLayoutValid);
 
-            i += 1;
+    dtk_int32 lo = 0;
+    dtk_int32 hi = (dtk_int32)pTabBar->tabCount;
+    while (lo < hi) {
+        dtk_int32 mid = lo + (hi - lo)/2;
+        dtk_rect rect = pTabBar->pTabs[mid].layoutRect;
+
+        // Negative means the position is before this tab in flow order, positive means after.
+        dtk_int32 side = 0;
+        switch (pTabBar->flow)
+        {
+            case dtk_tabbar_flow_left_to_right: side = (x <  rect.left) ? -1 : (x >= rect.right)  ? 1 : 0; break;
+            case dtk_tabbar_flow_right_to_left: side = (x >= rect.right) ? -1 : (x <  rect.left)  ? 1 : 0; break;
+            case dtk_tabbar_flow_top_to_bottom: side = (y <  rect.top)  ? -1 : (y >= rect.bottom) ? 1 : 0; break;
+            case dtk_tabbar_flow_bottom_to_top: side = (y >= rect.bottom) ? -1 : (y <  rect.top)  ? 1 : 0; break;
+            default: break; // Will never hit this.
+        }
+
+        if (side < 0) {
+            hi = mid;
+        } else if (side > 0) {
+            lo = mid + 1;
+        } else {
+            return mid;
         }
     }
 
-    // Getting here means we never found the tab, or some kind of error occurred.
-    return DTK_FALSE;
+    return -1;
 }
 
 
@@ -525,6 +669,12 @@ dtk_bool32 dtk_tabbar_default_event_handler(dtk_event* pEvent)
                     dtk_rect tabRect = dtk_rect_init(iterator.posX, iterator.posY, iterator.posX + iterator.width, iterator.posY + iterator.height);
                     tabGroupRect = dtk_rect_union(tabGroupRect, tabRect);
 
+                    // Only tabs that overlap the area being painted need to be drawn. The layout is cached so this is cheap.
+                    if (!dtk_rect_intersects(tabRect, pEvent->paint.rect)) {
+                        tabIndex += 1;
+                        continue;
+                    }
+
 
                     // Padding area.
                     dtk_rect paddingRectLeft   = dtk_rect_init(tabRect.left,                       tabRect.top,                          tabRect.left  + paddingLeftScaled,  tabRect.bottom);
@@ -936,6 +1086,8 @@ dtk_bool32 dtk_tabbar_default_event_handler(dtk_event* pEvent)
             pTabBar->tabCount -= 1;
 
 
+            dtk_tabbar__invalidate_layout(pTabBar);
+
             // Resize.
             dtk_tabbar_try_auto_resize(pTabBar);
 
@@ -966,6 +1118,8 @@ dtk_result dtk_tabbar_set_font(dtk_tabbar* pTabBar, dtk_font* pFont)
 
     pTabBar->pFont = pFont;
 
+    dtk_tabbar__invalidate_text_metrics(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
     return DTK_SUCCESS;
@@ -983,6 +1137,8 @@ dtk_result dtk_tabbar_set_close_button_image(dtk_tabbar* pTabBar, dtk_image* pIm
 
     pTabBar->pCloseButtonImage = pImage;
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
     return DTK_SUCCESS;
@@ -1113,6 +1269,8 @@ dtk_result dtk_tabbar_set_tab_padding(dtk_tabbar* pTabBar, dtk_uint32 paddingLef
     pTabBar->paddingRight  = paddingRight;
     pTabBar->paddingBottom = paddingBottom;
     
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
     return DTK_SUCCESS;
@@ -1127,6 +1285,8 @@ dtk_result dtk_tabbar_set_close_button_padding(dtk_tabbar* pTabBar, dtk_uint32 p
     pTabBar->closeButtonPaddingRight  = paddingRight;
     pTabBar->closeButtonPaddingBottom = paddingBottom;
     
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
     return DTK_SUCCESS;
@@ -1156,6 +1316,8 @@ dtk_result dtk_tabbar_show_close_button(dtk_tabbar* pTabBar)
 
     pTabBar->isShowingCloseButton = DTK_TRUE;
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     if ((pTabBar->textDirection == dtk_tabbar_text_direction_horizontal && !dtk_tabbar__is_flow_horizontal(pTabBar)) ||
         (pTabBar->textDirection == dtk_tabbar_text_direction_vertical   && !dtk_tabbar__is_flow_vertical(pTabBar))) {
         dtk_tabbar_try_auto_resize(pTabBar);
@@ -1175,6 +1337,8 @@ dtk_result dtk_tabbar_hide_close_button(dtk_tabbar* pTabBar)
 
     pTabBar->isShowingCloseButton = DTK_FALSE;
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     if ((pTabBar->textDirection == dtk_tabbar_text_direction_horizontal && !dtk_tabbar__is_flow_horizontal(pTabBar)) ||
         (pTabBar->textDirection == dtk_tabbar_text_direction_vertical   && !dtk_tabbar__is_flow_vertical(pTabBar))) {
         dtk_tabbar_try_auto_resize(pTabBar);
@@ -1198,6 +1362,8 @@ dtk_result dtk_tabbar_set_close_button_size(dtk_tabbar* pTabBar, dtk_uint32 widt
     pTabBar->closeButtonWidth = width;
     pTabBar->closeButtonHeight = height;
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     if ((pTabBar->textDirection == dtk_tabbar_text_direction_horizontal && !dtk_tabbar__is_flow_horizontal(pTabBar)) ||
         (pTabBar->textDirection == dtk_tabbar_text_direction_vertical   && !dtk_tabbar__is_flow_vertical(pTabBar))) {
         dtk_tabbar_try_auto_resize(pTabBar);
@@ -1277,6 +1443,8 @@ dtk_result dtk_tabbar_append_tab(dtk_tabbar* pTabBar, const char* text, dtk_cont
     dtk_tabbar_tab_init(pTabBar, text, pTabPage, &pTabBar->pTabs[tabIndex]);
     pTabBar->tabCount += 1;
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
 	return DTK_SUCCESS;
@@ -1321,6 +1489,8 @@ dtk_result dtk_tabbar_prepend_tab(dtk_tabbar* pTabBar, const char* text, dtk_con
         pTabBar->pinButtonHeldTabIndex += 1;
     }
 
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
 	return DTK_SUCCESS;
@@ -1353,6 +1523,14 @@ dtk_control* dtk_tabbar_get_tab_page(dtk_tabbar* pTabBar, dtk_uint32 tabIndex)
     return pTabBar->pTabs[tabIndex].pPage;
 }
 
+dtk_result dtk_tabbar_set_tab_page(dtk_tabbar* pTabBar, dtk_uint32 tabIndex, dtk_control* pTabPage)
+{
+    if (pTabBar == NULL || pTabBar->tabCount <= tabIndex) return DTK_INVALID_ARGS;
+
+    pTabBar->pTabs[tabIndex].pPage = pTabPage;
+    return DTK_SUCCESS;
+}
+
 dtk_uint32 dtk_tabbar_get_active_tab_index(dtk_tabbar* pTabBar)
 {
     if (pTabBar == NULL || pTabBar->tabCount == 0) {
@@ -1414,6 +1592,9 @@ dtk_result dtk_tabbar_set_tab_text(dtk_tabbar* pTabBar, dtk_uint32 tabIndex, con
 
     pTabBar->pTabs[tabIndex].pText = dtk_set_string(pTabBar->pTabs[tabIndex].pText, pTabText);
 
+    pTabBar->pTabs[tabIndex].isTextMeasured = DTK_FALSE;
+    dtk_tabbar__invalidate_layout(pTabBar);
+
     dtk_tabbar_try_auto_resize(pTabBar);
     dtk_control_scheduled_redraw(DTK_CONTROL(pTabBar), dtk_control_get_local_rect(DTK_CONTROL(pTabBar)));
     return DTK_SUCCESS;
@@ -1464,40 +1645,45 @@ dtk_bool32 dtk_tabbar_hit_test(dtk_tabbar* pTabBar, dtk_int32 x, dtk_int32 y, dt
     pResult->relativePosY = 0;
     pResult->isOverCloseButton = DTK_FALSE;
 
-    dtk_int32 tabIndex = 0;
+    if (pTabBar->tabCount == 0) {
+        return DTK_FALSE;
+    }
+
+    dtk_tabbar__update_layout(pTabBar);
+
+    dtk_int32 tabIndex = dtk_tabbar__find_tab_along_flow(pTabBar, x, y);
+    if (tabIndex == -1) {
+        return DTK_FALSE;
+    }
+
     dtk_tabbar__iterator iterator;
-    if (dtk_tabbar__first_tab(pTabBar, &iterator)) {
-        do
-        {
-            dtk_rect tabRect = dtk_rect_init(iterator.posX, iterator.posY, iterator.posX + iterator.width, iterator.posY + iterator.height);
-            if (dtk_rect_contains_point(tabRect, x, y)) {
-                pResult->tabIndex = tabIndex;
-                pResult->relativePosX = x - iterator.posX;
-                pResult->relativePosY = y - iterator.posY;
-                pResult->tabRect = tabRect;
-
-                // Check if the point is over the close button.
-                pResult->isOverCloseButton = DTK_FALSE;
-                if (pResult->relativePosX >= iterator.closeButtonRect.left && pResult->relativePosX < iterator.closeButtonRect.right &&
-                    pResult->relativePosY >= iterator.closeButtonRect.top  && pResult->relativePosY < iterator.closeButtonRect.bottom) {
-                    pResult->isOverCloseButton = DTK_TRUE;
-                }
+    dtk_tabbar__load_iterator(pTabBar, tabIndex, &iterator);
 
-                // Check if the point is over the pin button.
-                pResult->isOverPinButton = DTK_FALSE;
-                if (pResult->relativePosX >= iterator.pinButtonRect.left && pResult->relativePosX < iterator.pinButtonRect.right &&
-                    pResult->relativePosY >= iterator.pinButtonRect.top  && pResult->relativePosY < iterator.pinButtonRect.bottom) {
-                    pResult->isOverPinButton = DTK_TRUE;
-                }
+    dtk_rect tabRect = dtk_rect_init(iterator.posX, iterator.posY, iterator.posX + iterator.width, iterator.posY + iterator.height);
+    if (!dtk_rect_contains_point(tabRect, x, y)) {
+        return DTK_FALSE;
+    }
 
-                return DTK_TRUE;
-            }
+    pResult->tabIndex = tabIndex;
+    pResult->relativePosX = x - iterator.posX;
+    pResult->relativePosY = y - iterator.posY;
+    pResult->tabRect = tabRect;
 
-            tabIndex += 1;
-        } while (dtk_tabbar__next_tab(pTabBar, &iterator));
+    // Check if the point is over the close button.
+    pResult->isOverCloseButton = DTK_FALSE;
+    if (pResult->relativePosX >= iterator.closeButtonRect.left && pResult->relativePosX < iterator.closeButtonRect.right &&
+        pResult->relativePosY >= iterator.closeButtonRect.top  && pResult->relativePosY < iterator.closeButtonRect.bottom) {
+        pResult->isOverCloseButton = DTK_TRUE;
+    }
+
+    // Check if the point is over the pin button.
+    pResult->isOverPinButton = DTK_FALSE;
+    if (pResult->relativePosX >= iterator.pinButtonRect.left && pResult->relativePosX < iterator.pinButtonRect.right &&
+        pResult->relativePosY >= iterator.pinButtonRect.top  && pResult->relativePosY < iterator.pinButtonRect.bottom) {
+        pResult->isOverPinButton = DTK_TRUE;
     }
 
-    return DTK_FALSE;
+    return DTK_TRUE;
 }
 
 
@@ -56,6 +56,15 @@ typedef struct
     dtk_control* pPage;
     dtk_string pTooltipText;
     dtk_bool32 isPinned : 1;
+
+    // Internal use only. The measured size of the text and the tab's cached layout. The text is only measured again when the
+    // text, font or scale changes.
+    dtk_bool32 isTextMeasured : 1;
+    dtk_int32 textWidth;
+    dtk_int32 textHeight;
+    dtk_rect layoutRect;                // Relative to the tab bar.
+    dtk_rect layoutTextRect;            // Relative to the tab.
+    dtk_rect layoutCloseButtonRect;     // Relative to the tab.
 } dtk_tabbar_tab;
 
 #define DTK_TABBAR(p) ((dtk_tabbar*)(p))
@@ -76,6 +85,10 @@ struct dtk_tabbar
     dtk_bool32 isCloseButtonPressed         : 1;
     dtk_bool32 isPinButtonPressed           : 1;
     dtk_bool32 isCloseOnMiddleClientEnabled : 1;
+    dtk_bool32 isLayoutValid                : 1;    // Internal use only. Whether or not the cached layout of each tab is up to date.
+    float layoutScale;                  // Internal use only. The scaling factor the cached layout was calculated with.
+    dtk_int32 layoutWidth;              // Internal use only. The size of the control when the cached layout was calculated.
+    dtk_int32 layoutHeight;
     dtk_int32 hoveredTabIndex;          // Set to -1 if no tab is hovered.
     dtk_int32 activeTabIndex;           // Set to -1 when no tab is active.
     dtk_int32 closeButtonHeldTabIndex;  // Set to the index of the tab whose close button is being held. Set to -1 if none.
@@ -155,6 +168,7 @@ dtk_result dtk_tabbar_remove_tab_by_index(dtk_tabbar* pTabBar, dtk_uint32 tabInd
 dtk_uint32 dtk_tabbar_get_tab_count(dtk_tabbar* pTabBar);
 
 dtk_control* dtk_tabbar_get_tab_page(dtk_tabbar* pTabBar, dtk_uint32 tabIndex);
+dtk_result dtk_tabbar_set_tab_page(dtk_tabbar* pTabBar, dtk_uint32 tabIndex, dtk_control* pTabPage);   // Does not change the visibility of either page.
 dtk_uint32 dtk_tabbar_get_active_tab_index(dtk_tabbar* pTabBar);
 dtk_result dtk_tabbar_activate_tab(dtk_tabbar* pTabBar, dtk_uint32 tabIndex);
 dtk_result dtk_tabbar_activate_next_tab(dtk_tabbar* pTabBar);   // Loops
@@ -388,6 +388,15 @@ dtk_control* dtk_tabgroup_get_tab_page(dtk_tabgroup* pTabGroup, dtk_uint32 tabIn
     return dtk_tabbar_get_tab_page(&pTabGroup->tabbar, tabIndex);
 }
 
+dtk_result dtk_tabgroup_set_tab_page(dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex, dtk_control* pTabPage)
+{
+    if (pTabGroup == NULL) {
+        return DTK_INVALID_ARGS;
+    }
+
+    return dtk_tabbar_set_tab_page(&pTabGroup->tabbar, tabIndex, pTabPage);
+}
+
 dtk_uint32 dtk_tabgroup_get_active_tab_index(dtk_tabgroup* pTabGroup)
 {
     if (pTabGroup == NULL) {
@@ -29,6 +29,7 @@ dtk_result dtk_tabgroup_remove_tab_by_index(dtk_tabgroup* pTabGroup, dtk_uint32
 dtk_uint32 dtk_tabgroup_get_tab_count(dtk_tabgroup* pTabGroup);
 
 dtk_control* dtk_tabgroup_get_tab_page(dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex);
+dtk_result dtk_tabgroup_set_tab_page(dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex, dtk_control* pTabPage);   // Does not change the visibility of either page.
 dtk_uint32 dtk_tabgroup_get_active_tab_index(dtk_tabgroup* pTabGroup);
 dtk_result dtk_tabgroup_activate_tab(dtk_tabgroup* pTabGroup, dtk_uint32 tabIndex);
 dtk_result dtk_tabgroup_activate_next_tab(dtk_tabgroup* pTabGroup);
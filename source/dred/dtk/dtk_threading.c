@@ -23,11 +23,23 @@ dtk_result dtk_thread_create__win32(dtk_thread* pThread, dtk_thread_entry_proc e
     return DTK_SUCCESS;
 }
 
+dtk_uint32 dtk_get_logical_processor_count__win32()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (dtk_uint32)info.dwNumberOfProcessors;
+}
+
 void dtk_thread_wait__win32(dtk_thread* pThread)
 {
     WaitForSingleObject(*pThread, INFINITE);
 }
 
+void dtk_sleep__win32(dtk_uint32 milliseconds)
+{
+    Sleep((DWORD)milliseconds);
+}
+
 
 
 dtk_result dtk_mutex_init__win32(dtk_mutex* pMutex)
@@ -112,6 +124,26 @@ void dtk_thread_wait__posix(dtk_thread* pThread)
     pthread_join(*pThread, NULL);
 }
 
+void dtk_sleep__posix(dtk_uint32 milliseconds)
+{
+    struct timespec ts;
+    ts.tv_sec  = milliseconds / 1000;
+    ts.tv_nsec = (milliseconds % 1000) * 1000000;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+        // Interrupted by a signal. Keep sleeping for the remaining time.
+    }
+}
+
+dtk_uint32 dtk_get_logical_processor_count__posix()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count <= 0) {
+        return 1;
+    }
+
+    return (dtk_uint32)count;
+}
+
 
 
 dtk_result dtk_mutex_init__posix(dtk_mutex* pMutex)
@@ -206,6 +238,26 @@ void dtk_thread_wait(dtk_thread* pThread)
 #endif
 }
 
+void dtk_sleep(dtk_uint32 milliseconds)
+{
+#ifdef DTK_THREADING_WIN32
+    dtk_sleep__win32(milliseconds);
+#endif
+#ifdef DTK_THREADING_POSIX
+    dtk_sleep__posix(milliseconds);
+#endif
+}
+
+dtk_uint32 dtk_get_logical_processor_count()
+{
+#ifdef DTK_THREADING_WIN32
+    return dtk_get_logical_processor_count__win32();
+#endif
+#ifdef DTK_THREADING_POSIX
+    return dtk_get_logical_processor_count__posix();
+#endif
+}
+
 
 //// Mutex ////
 
@@ -35,6 +35,12 @@ dtk_result dtk_thread_create(dtk_thread* pThread, dtk_thread_entry_proc entryPro
 // Waits for a thread to return.
 void dtk_thread_wait(dtk_thread* pThread);
 
+// Retrieves the number of logical processors on the system. This is useful for deciding how many worker threads to create.
+dtk_uint32 dtk_get_logical_processor_count();
+
+// Puts the calling thread to sleep for the given number of milliseconds.
+void dtk_sleep(dtk_uint32 milliseconds);
+
 
 //// Mutex ////
 
@@ -5,6 +5,34 @@ time_t dtk_now()
     return time(NULL);
 }
 
+#ifdef DTK_WIN32
+dtk_uint64 dtk_now_nanoseconds()
+{
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (!QueryPerformanceFrequency(&frequency) || !QueryPerformanceCounter(&counter)) {
+        return 0;
+    }
+
+    // Split into whole seconds and the remainder to avoid overflowing when converting to nanoseconds.
+    dtk_uint64 seconds   = (dtk_uint64)counter.QuadPart / (dtk_uint64)frequency.QuadPart;
+    dtk_uint64 remainder = (dtk_uint64)counter.QuadPart % (dtk_uint64)frequency.QuadPart;
+    return (seconds * 1000000000) + ((remainder * 1000000000) / (dtk_uint64)frequency.QuadPart);
+}
+#endif
+
+#ifdef DTK_POSIX
+dtk_uint64 dtk_now_nanoseconds()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+
+    return ((dtk_uint64)ts.tv_sec * 1000000000) + (dtk_uint64)ts.tv_nsec;
+}
+#endif
+
 size_t dtk_datetime_short(time_t t, char* strOut, size_t strOutSize)
 {
 #if defined(_MSC_VER)
@@ -3,6 +3,10 @@
 // Retrieves a time_t as of the time the function was called.
 time_t dtk_now();
 
+// Retrieves a high resolution timestamp in nanoseconds. This is monotonic and is only useful for measuring intervals. It
+// is not related to the wall clock.
+dtk_uint64 dtk_now_nanoseconds();
+
 // Formats a data/time string.
 size_t dtk_datetime_short(time_t t, char* strOut, size_t strOutSize);
 
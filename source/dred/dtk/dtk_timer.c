@@ -40,6 +40,16 @@ dtk_result dtk_timer_uninit__win32(dtk_timer* pTimer)
     KillTimer((HWND)pTimer->pTK->win32.hMessagingWindow, pTimer->win32.tag);
     return DTK_SUCCESS;
 }
+
+dtk_result dtk_timer_set_timeout__win32(dtk_timer* pTimer, dtk_uint32 timeoutInMilliseconds)
+{
+    // Calling SetTimer() with the ID of an existing timer replaces it and resets the elapsed time.
+    if (SetTimer((HWND)pTimer->pTK->win32.hMessagingWindow, (UINT_PTR)pTimer, timeoutInMilliseconds, dtk_timer_proc_win32) == 0) {
+        return DTK_ERROR;
+    }
+
+    return DTK_SUCCESS;
+}
 #endif  // DTK_WIN32
 
 
@@ -78,6 +88,14 @@ dtk_result dtk_timer_uninit__gtk(dtk_timer* pTimer)
     g_source_remove(pTimer->gtk.timerID);
     return DTK_SUCCESS;
 }
+
+dtk_result dtk_timer_set_timeout__gtk(dtk_timer* pTimer, dtk_uint32 timeoutInMilliseconds)
+{
+    // GLib timeout sources can't be rescheduled so the old one is replaced. This is safe to do from inside the callback.
+    g_source_remove(pTimer->gtk.timerID);
+    pTimer->gtk.timerID = g_timeout_add(timeoutInMilliseconds, dtk_timer_proc_gtk, pTimer);
+    return DTK_SUCCESS;
+}
 #endif  // DTK_GTK
 
 dtk_result dtk_timer_init(dtk_context* pTK, dtk_uint32 timeoutInMilliseconds, dtk_timer_proc callback, void* pUserData, dtk_timer* pTimer)
@@ -121,4 +139,27 @@ dtk_result dtk_timer_uninit(dtk_timer* pTimer)
 #endif
 
     return result;
-}
\ No newline at end of file
+}
+
+dtk_result dtk_timer_set_timeout(dtk_timer* pTimer, dtk_uint32 timeoutInMilliseconds)
+{
+    if (pTimer == NULL) return DTK_INVALID_ARGS;
+
+    dtk_result result = DTK_NO_BACKEND;
+#ifdef DTK_WIN32
+    if (pTimer->pTK->platform == dtk_platform_win32) {
+        result = dtk_timer_set_timeout__win32(pTimer, timeoutInMilliseconds);
+    }
+#endif
+#ifdef DTK_GTK
+    if (pTimer->pTK->platform == dtk_platform_gtk) {
+        result = dtk_timer_set_timeout__gtk(pTimer, timeoutInMilliseconds);
+    }
+#endif
+
+    if (result == DTK_SUCCESS) {
+        pTimer->timeoutInMilliseconds = timeoutInMilliseconds;
+    }
+
+    return result;
+}
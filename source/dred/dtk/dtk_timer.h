@@ -35,4 +35,10 @@ struct dtk_timer
 dtk_result dtk_timer_init(dtk_context* pTK, dtk_uint32 timeoutInMilliseconds, dtk_timer_proc callback, void* pUserData, dtk_timer* pTimer);
 
 // Uninitializes a timer.
-dtk_result dtk_timer_uninit(dtk_timer* pTimer);
\ No newline at end of file
+dtk_result dtk_timer_uninit(dtk_timer* pTimer);
+
+// Changes the timeout of a timer and restarts it. The next callback will be fired after timeoutInMilliseconds from now.
+//
+// Timers are periodic, but this can be called from inside the callback to emulate one-shot timers that are re-armed with
+// a different timeout each time.
+dtk_result dtk_timer_set_timeout(dtk_timer* pTimer, dtk_uint32 timeoutInMilliseconds);
@@ -115,6 +115,33 @@ void dred_cmdbar__update_text_based_on_autocomplete(dred_cmdbar* pCmdBar)
     }
 }
 
+void dred_cmdbar__update_text_based_on_file_autocomplete(dred_cmdbar* pCmdBar)
+{
+    dred_context* pDred = dred_get_context_from_control(DTK_CONTROL(pCmdBar));
+    dtk_assert(pDred != NULL);
+
+    dred_cmdbox_cmdlist* pCmdList = &pDred->cmdbarPopup.cmdlist;
+
+    const char* filePath = dred_cmdbox_cmdlist_get_highlighted_file_path(pCmdList);
+    if (filePath == NULL) {
+        return;
+    }
+
+    char* newText = dtk_make_stringf("%s \"%s\"", pCmdList->pFileCommandName, filePath);
+    if (newText == NULL) {
+        return;
+    }
+
+    // Like with commands, the manual text entry needs to be restored so the list continues to be based on what was typed.
+    char* manualTextEntryCopy = dtk_make_string((pCmdBar->manualTextEntry != NULL) ? pCmdBar->manualTextEntry : "");
+    dred_cmdbar_set_text(pCmdBar, newText);
+    if (manualTextEntryCopy != NULL) {
+        pCmdBar->manualTextEntry = manualTextEntryCopy;
+    }
+
+    dtk_free_string(newText);
+}
+
 
 void dred_cmdbar__on_size(dred_control* pControl, float newWidth, float newHeight)
 {
@@ -324,6 +351,16 @@ void dred_cmdbar_tb__on_key_down(dred_control* pControl, dtk_key key, int stateF
 
                 dred_cmdbar__update_text_based_on_autocomplete(pCmdBar);
                 dred_cmdbar_popup_refresh_autocomplete(&pDred->cmdbarPopup, pCmdBar->manualTextEntry);
+            } else if (pCmdBar->manualTextEntry != NULL && dred_cmdbox_cmdlist_is_completing_file(&pDred->cmdbarPopup.cmdlist)) {
+                // Cycle through files.
+                if (stateFlags & DTK_MODIFIER_SHIFT) {
+                    dred_cmdbox_cmdlist_highlight_prev_item(&pDred->cmdbarPopup.cmdlist);
+                } else {
+                    dred_cmdbox_cmdlist_highlight_next_item(&pDred->cmdbarPopup.cmdlist);
+                }
+
+                dred_cmdbar__update_text_based_on_file_autocomplete(pCmdBar);
+                dred_cmdbar_popup_refresh_autocomplete(&pDred->cmdbarPopup, pCmdBar->manualTextEntry);
             } else {
                 // Cycle through parameters.
                 if (stateFlags & DTK_MODIFIER_SHIFT) {
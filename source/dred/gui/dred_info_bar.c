@@ -83,7 +83,7 @@ void dred_info_bar__on_paint(dred_control* pControl, dred_rect rect, dtk_surface
 
     if (pInfoBar->type == DRED_INFO_BAR_TYPE_NONE) {
         dred_info_bar__on_paint__none(pInfoBar, pSurface);
-    } else if (pInfoBar->type == DRED_INFO_BAR_TYPE_TEXT_EDITOR) {
+    } else if (pInfoBar->type == DRED_INFO_BAR_TYPE_TEXT_EDITOR || pInfoBar->type == DRED_INFO_BAR_TYPE_HEX_EDITOR) {
         dred_info_bar__on_paint__text_editor(pInfoBar, pSurface);
     }
 }
@@ -145,6 +145,16 @@ void dred_info_bar_update(dred_info_bar* pInfoBar, dred_control* pControl)
             snprintf(pInfoBar->lineStr, sizeof(pInfoBar->lineStr), "Ln %d", (int)dred_text_editor_get_cursor_line(DRED_TEXT_EDITOR(pControl)) + 1);
             snprintf(pInfoBar->colStr,  sizeof(pInfoBar->colStr),  "Col %d", (int)dred_text_editor_get_cursor_column(DRED_TEXT_EDITOR(pControl)) + 1);
         }
+
+        if (dred_control_is_of_type(pControl, DRED_CONTROL_TYPE_HEX_EDITOR))
+        {
+            dtk_uint64 cursorOffset = dred_hex_editor_get_cursor_offset(DRED_HEX_EDITOR(pControl));
+            dtk_uint64 fileSize = dred_hex_editor_get_file_size(DRED_HEX_EDITOR(pControl));
+
+            pInfoBar->type = DRED_INFO_BAR_TYPE_HEX_EDITOR;
+            snprintf(pInfoBar->lineStr, sizeof(pInfoBar->lineStr), "Offset 0x%llX", (unsigned long long)cursorOffset);
+            snprintf(pInfoBar->colStr,  sizeof(pInfoBar->colStr),  "%d%%", (fileSize > 0) ? (int)((cursorOffset * 100) / fileSize) : 0);
+        }
     }
 
 
@@ -191,16 +191,9 @@ void dred_textview__insert_cursor(dred_textview* pTextView, size_t iChar, size_t
 
     // If we are trying to insert a cursor on top of an existing cursor we need to just move the existing one to the end of the list,
     // thus making it the current cursor. We don't want cursors to be sitting on top of each other.
-    size_t iExistingCursor = (size_t)-1;
-    for (size_t iCursor = 0; iCursor < pTextView->pView->cursorCount; ++iCursor) {
-        if (pTextView->pView->pCursors[iCursor].iCharAbs == iChar) {
-            iExistingCursor = iCursor;
-            break;
-        }
-    }
-
+    size_t iExistingCursor;
     size_t iEngineSelection = (size_t)-1;
-    if (iExistingCursor != (size_t)-1) {
+    if (drte_view_find_cursor_at_character(pTextView->pView, iChar, &iExistingCursor)) {
         iEngineSelection = pTextView->pCursors[iExistingCursor].iEngineSelection;
         dred_textview__remove_cursor(pTextView, iExistingCursor);
     }
@@ -318,24 +311,65 @@ dtk_bool32 dred_textview__insert_tab_at_cursor(dred_textview* pTextView, size_t
 }
 
 
+void dred_textview__delete_timer(dred_textview* pTextView);
+
 void dred_textview__on_timer(dtk_timer* pTimer, void* pUserData)
 {
-    (void)pTimer;
-
     dred_textview* pTextView = (dred_textview*)pUserData;
     assert(pTextView != NULL);
 
-    dred_textview_step(pTextView, 100);
+    // The timer is armed for the exact time of the next blink transition so we step by however long it actually took. This
+    // is rounded up so that a timer that fires a fraction of a millisecond early still lands on the transition.
+    dtk_uint64 now = dtk_now_nanoseconds();
+    dtk_uint64 elapsedInMilliseconds = (now - pTextView->timerArmTime + 999999) / 1000000;
+    pTextView->timerArmTime = now;
+
+    dred_textview_step(pTextView, (unsigned int)elapsedInMilliseconds);
+
+    // Once the user has been idle for long enough we stop blinking altogether, but only while the cursor is visible so that
+    // it's not left hidden. The timer is restarted the next time the cursor moves.
+    if (pTextView->cursorBlinkTimeout > 0 && drte_engine_is_cursor_blink_on(pTextView->pTextEngine)) {
+        if (now - pTextView->lastActivityTime >= (dtk_uint64)pTextView->cursorBlinkTimeout * 1000000) {
+            dred_textview__delete_timer(pTextView);
+            return;
+        }
+    }
+
+    unsigned int timeToNextBlink = drte_engine_get_time_to_next_cursor_blink(pTextView->pTextEngine);
+    if (timeToNextBlink == 0) {
+        timeToNextBlink = 1;
+    }
+
+    dtk_timer_set_timeout(pTimer, timeToNextBlink);
 }
 
 void dred_textview__create_timer(dred_textview* pTextView)
 {
     dtk_assert(pTextView != NULL);
 
+    pTextView->lastActivityTime = dtk_now_nanoseconds();
+
+    unsigned int timeToNextBlink = drte_engine_get_time_to_next_cursor_blink(pTextView->pTextEngine);
+    if (timeToNextBlink == 0) {
+        timeToNextBlink = 1;
+    }
+
     if (pTextView->pTimer == NULL) {
         pTextView->pTimer = (dtk_timer*)malloc(sizeof(*pTextView->pTimer));
-        dtk_timer_init(DTK_CONTROL(pTextView)->pTK, 100, dred_textview__on_timer, pTextView, pTextView->pTimer);
+        if (pTextView->pTimer == NULL) {
+            return;
+        }
+
+        if (dtk_timer_init(DTK_CONTROL(pTextView)->pTK, timeToNextBlink, dred_textview__on_timer, pTextView, pTextView->pTimer) != DTK_SUCCESS) {
+            free(pTextView->pTimer);
+            pTextView->pTimer = NULL;
+            return;
+        }
+    } else {
+        dtk_timer_set_timeout(pTextView->pTimer, timeToNextBlink);
     }
+
+    pTextView->timerArmTime = pTextView->lastActivityTime;
 }
 
 void dred_textview__delete_timer(dred_textview* pTextView)
@@ -478,6 +512,7 @@ dtk_bool32 dred_textview_init(dred_textview* pTextView, dred_context* pDred, dre
     pTextView->isHorzScrollbarEnabled = DTK_TRUE;
     pTextView->isExcessScrollingEnabled = pDred->config.textEditorEnableExcessScrolling;
     pTextView->isDragAndDropEnabled = pDred->config.textEditorEnableDragAndDrop;
+    pTextView->cursorBlinkTimeout = (pDred->config.textEditorCursorBlinkTimeout > 0) ? (unsigned int)pDred->config.textEditorCursorBlinkTimeout : 0;
     pTextView->isWantingToDragAndDrop = DTK_FALSE;
     pTextView->iLineSelectAnchor = 0;
     pTextView->onCursorMove = NULL;
@@ -943,6 +978,21 @@ void dred_textview_set_cursor_blink_rate(dred_textview* pTextView, unsigned int
     }
 
     drte_engine_set_cursor_blink_rate(pTextView->pTextEngine, blinkRateInMilliseconds);
+
+    // The timer is scheduled against the old rate so it needs to be re-armed.
+    if (pTextView->pTimer != NULL) {
+        drte_engine_reset_cursor_blinks(pTextView->pTextEngine);
+        dred_textview__create_timer(pTextView);
+    }
+}
+
+void dred_textview_set_cursor_blink_timeout(dred_textview* pTextView, unsigned int timeoutInMilliseconds)
+{
+    if (pTextView == NULL) {
+        return;
+    }
+
+    pTextView->cursorBlinkTimeout = timeoutInMilliseconds;
 }
 
 void dred_textview_move_cursor_to_end_of_text(dred_textview* pTextView)
@@ -972,6 +1022,15 @@ void dred_textview_move_cursor_to_start_of_unwrapped_line_by_index(dred_textview
     drte_view_move_cursor_to_start_of_unwrapped_line_by_index(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), iLine);
 }
 
+void dred_textview_move_cursor_to_character(dred_textview* pTextView, size_t characterIndex)
+{
+    if (pTextView == NULL) {
+        return;
+    }
+
+    drte_view_move_cursor_to_character(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), characterIndex);
+}
+
 
 dtk_bool32 dred_textview_get_word_under_cursor(dred_textview* pTextView, size_t cursorIndex, size_t* pWordBegOut, size_t* pWordEndOut)
 {
@@ -1161,12 +1220,7 @@ dtk_bool32 dred_textview_insert_text_at_cursors_no_undo(dred_textview* pTextView
         return DTK_FALSE;
     }
 
-    dtk_bool32 wasTextChanged = DTK_FALSE;
-    for (size_t iCursor = 0; iCursor < pTextView->cursorCount; ++iCursor) {
-        wasTextChanged = drte_view_insert_text_at_cursor(pTextView->pView, iCursor, text) || wasTextChanged;
-    }
-
-    return wasTextChanged;
+    return drte_view_insert_text_at_cursors(pTextView->pView, text);
 }
 
 dtk_bool32 dred_textview_insert_text_at_cursors(dred_textview* pTextView, const char* text)
@@ -1185,59 +1239,71 @@ dtk_bool32 dred_textview_insert_text_at_cursors(dred_textview* pTextView, const
     return wasTextChanged;
 }
 
-dtk_bool32 dred_textview_unindent_selected_blocks(dred_textview* pTextView)
+dtk_bool32 dred_textview__unindent_selected_blocks_in_view(drte_view* pView)
 {
-    if (pTextView == NULL) {
+    if (pView == NULL) {
         return DTK_FALSE;
     }
 
-    drte_view_begin_dirty(pTextView->pView);
-
     dtk_bool32 wasTextChanged = DTK_FALSE;
-    drte_engine_prepare_undo_point(pTextView->pTextEngine);
-    {
-        for (size_t iSelection = 0; iSelection < pTextView->pView->selectionCount; ++iSelection) {
-            size_t iLineBeg = drte_view_get_selection_first_line(pTextView->pView, iSelection);
-            size_t iLineEnd = drte_view_get_selection_last_line(pTextView->pView, iSelection);
-
-            for (size_t iLine = iLineBeg; iLine <= iLineEnd; ++iLine) {
-                size_t iLineChar = drte_view_get_line_first_character(pTextView->pView, NULL, iLine);
-                size_t iLineCharNonWS = iLineChar;
-                for (;;) {
-                    uint32_t c = drte_engine_get_utf32(pTextView->pTextEngine, iLineCharNonWS);
-                    if (c == '\0' || c == '\r' || c == '\n' || !dtk_is_whitespace(c)) {
-                        break;
-                    }
-
-                    iLineCharNonWS += 1;
+    for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
+        size_t iLineBeg = drte_view_get_selection_first_line(pView, iSelection);
+        size_t iLineEnd = drte_view_get_selection_last_line(pView, iSelection);
+
+        for (size_t iLine = iLineBeg; iLine <= iLineEnd; ++iLine) {
+            size_t iLineChar = drte_view_get_line_first_character(pView, NULL, iLine);
+            size_t iLineCharNonWS = iLineChar;
+            for (;;) {
+                uint32_t c = drte_engine_get_utf32(pView->pEngine, iLineCharNonWS);
+                if (c == '\0' || c == '\r' || c == '\n' || !dtk_is_whitespace(c)) {
+                    break;
                 }
 
-                if (iLineCharNonWS > iLineChar) {
-                    size_t charactersRemovedCount = 0;
-                    uint32_t c = drte_engine_get_utf32(pTextView->pTextEngine, iLineChar);
-                    if (c == '\t') {
-                        charactersRemovedCount = 1;
-                    } else {
-                        charactersRemovedCount = 0; //(iLineCharNonWS - iLineChar);
-                        for (size_t iChar = iLineChar; iChar < iLineCharNonWS; ++iChar) {
-                            if (charactersRemovedCount >= drte_view_get_tab_size(pTextView->pView)) {
-                                break;
-                            }
+                iLineCharNonWS += 1;
+            }
 
-                            c = drte_engine_get_utf32(pTextView->pTextEngine, iChar);
-                            if (c == '\t') {
-                                break;
-                            }
+            if (iLineCharNonWS > iLineChar) {
+                size_t charactersRemovedCount = 0;
+                uint32_t c = drte_engine_get_utf32(pView->pEngine, iLineChar);
+                if (c == '\t') {
+                    charactersRemovedCount = 1;
+                } else {
+                    charactersRemovedCount = 0; //(iLineCharNonWS - iLineChar);
+                    for (size_t iChar = iLineChar; iChar < iLineCharNonWS; ++iChar) {
+                        if (charactersRemovedCount >= drte_view_get_tab_size(pView)) {
+                            break;
+                        }
 
-                            charactersRemovedCount += 1;
+                        c = drte_engine_get_utf32(pView->pEngine, iChar);
+                        if (c == '\t') {
+                            break;
                         }
-                    }
 
-                    wasTextChanged = drte_engine_delete_text(pTextView->pTextEngine, iLineChar, iLineChar + charactersRemovedCount) || wasTextChanged;
+                        charactersRemovedCount += 1;
+                    }
                 }
+
+                wasTextChanged = drte_engine_delete_text(pView->pEngine, iLineChar, iLineChar + charactersRemovedCount) || wasTextChanged;
             }
         }
     }
+
+    return wasTextChanged;
+}
+
+dtk_bool32 dred_textview_unindent_selected_blocks(dred_textview* pTextView)
+{
+    if (pTextView == NULL) {
+        return DTK_FALSE;
+    }
+
+    drte_view_begin_dirty(pTextView->pView);
+
+    dtk_bool32 wasTextChanged = DTK_FALSE;
+    drte_engine_prepare_undo_point(pTextView->pTextEngine);
+    {
+        wasTextChanged = dred_textview__unindent_selected_blocks_in_view(pTextView->pView);
+    }
     if (wasTextChanged) { drte_engine_commit_undo_point(pTextView->pTextEngine); }
 
     drte_view_end_dirty(pTextView->pView);
@@ -1350,18 +1416,18 @@ size_t dred_textview_get_line_count(dred_textview* pTextView)
 }
 
 
-dtk_bool32 dred_textview_find_and_select_next(dred_textview* pTextView, const char* text)
+dtk_bool32 dred_textview__find_and_select_next_in_view(drte_view* pView, const char* text)
 {
-    if (pTextView == NULL) {
-        return 0;
+    if (pView == NULL) {
+        return DTK_FALSE;
     }
 
     size_t selectionStart;
     size_t selectionEnd;
-    if (drte_view_find_next(pTextView->pView, text, &selectionStart, &selectionEnd))
+    if (drte_view_find_next(pView, text, &selectionStart, &selectionEnd))
     {
-        drte_view_select(pTextView->pView, selectionStart, selectionEnd);
-        drte_view_move_cursor_to_end_of_selection(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
+        drte_view_select(pView, selectionStart, selectionEnd);
+        drte_view_move_cursor_to_end_of_selection(pView, drte_view_get_last_cursor(pView));
 
         return DTK_TRUE;
     }
@@ -1369,6 +1435,88 @@ dtk_bool32 dred_textview_find_and_select_next(dred_textview* pTextView, const ch
     return DTK_FALSE;
 }
 
+dtk_bool32 dred_textview__find_and_replace_next_in_view(drte_view* pView, const char* text, const char* replacement)
+{
+    if (pView == NULL) {
+        return DTK_FALSE;
+    }
+
+    dtk_bool32 wasTextChanged = DTK_FALSE;
+    drte_view_deselect_all(pView);
+
+    size_t selectionStart;
+    size_t selectionEnd;
+    if (drte_view_find_next(pView, text, &selectionStart, &selectionEnd))
+    {
+        drte_view_select(pView, selectionStart, selectionEnd);
+        drte_view_move_cursor_to_end_of_selection(pView, drte_view_get_last_cursor(pView));
+
+        wasTextChanged = drte_view_delete_selected_text(pView) || wasTextChanged;
+        drte_view_deselect_all(pView);
+
+        wasTextChanged = drte_view_insert_text_at_cursor(pView, drte_view_get_last_cursor(pView), replacement) || wasTextChanged;
+    }
+
+    return wasTextChanged;
+}
+
+dtk_bool32 dred_textview__find_and_replace_all_in_view(drte_view* pView, const char* text, const char* replacement)
+{
+    if (pView == NULL || pView->pEngine->text == NULL || text == NULL || text[0] == '\0') {
+        return DTK_FALSE;
+    }
+
+    size_t originalCursorLine = drte_view_get_cursor_line(pView, drte_view_get_last_cursor(pView));
+    size_t originalCursorPos = drte_view_get_cursor_character(pView, drte_view_get_last_cursor(pView)) - drte_view_get_line_first_character(pView, NULL, originalCursorLine);
+
+    drte_view_deselect_all(pView);
+
+    // It's important that we don't replace the replacement text. To handle this, every occurance is found in the original text
+    // first, from the top and without looping, and then they're all replaced with a single batched edit.
+    drte_edit* pEdits = NULL;   // <-- stb_stretchy_buffer
+    size_t textLength = strlen(text);
+
+    const char* pTextBeg = pView->pEngine->text;
+    const char* pNextOccurance = pTextBeg;
+    while ((pNextOccurance = strstr(pNextOccurance, text)) != NULL) {
+        drte_edit edit;
+        edit.iCharBeg = (size_t)(pNextOccurance - pTextBeg);
+        edit.iCharEnd = edit.iCharBeg + textLength;
+        edit.text = replacement;
+        stb_sb_push(pEdits, edit);
+
+        pNextOccurance += textLength;
+    }
+
+    dtk_bool32 wasTextChanged = DTK_FALSE;
+    if (stb_sb_count(pEdits) > 0) {
+        wasTextChanged = drte_engine_apply_edits(pView->pEngine, stb_sb_count(pEdits), pEdits);
+    }
+    stb_sb_free(pEdits);
+
+    // The cursor may have moved so we'll need to restore it.
+    size_t lineCharStart;
+    size_t lineCharEnd;
+    drte_view_get_line_character_range(pView, NULL, originalCursorLine, &lineCharStart, &lineCharEnd);
+
+    size_t newCursorPos = lineCharStart + originalCursorPos;
+    if (newCursorPos > lineCharEnd) {
+        newCursorPos = lineCharEnd;
+    }
+    drte_view_move_cursor_to_character(pView, drte_view_get_last_cursor(pView), newCursorPos);
+
+    return wasTextChanged;
+}
+
+dtk_bool32 dred_textview_find_and_select_next(dred_textview* pTextView, const char* text)
+{
+    if (pTextView == NULL) {
+        return 0;
+    }
+
+    return dred_textview__find_and_select_next_in_view(pTextView->pView, text);
+}
+
 dtk_bool32 dred_textview_find_and_replace_next(dred_textview* pTextView, const char* text, const char* replacement)
 {
     if (pTextView == NULL) {
@@ -1380,18 +1528,7 @@ dtk_bool32 dred_textview_find_and_replace_next(dred_textview* pTextView, const c
     {
         drte_view_begin_dirty(pTextView->pView);
         {
-            drte_view_deselect_all(pTextView->pView);
-
-            size_t selectionStart;
-            size_t selectionEnd;
-            if (drte_view_find_next(pTextView->pView, text, &selectionStart, &selectionEnd))
-            {
-                drte_view_select(pTextView->pView, selectionStart, selectionEnd);
-                drte_view_move_cursor_to_end_of_selection(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
-
-                wasTextChanged = dred_textview_delete_selected_text_no_undo(pTextView) || wasTextChanged;
-                wasTextChanged = drte_view_insert_text_at_cursor(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), replacement) || wasTextChanged;
-            }
+            wasTextChanged = dred_textview__find_and_replace_next_in_view(pTextView->pView, text, replacement);
         }
         drte_view_end_dirty(pTextView->pView);
     }
@@ -1407,8 +1544,6 @@ dtk_bool32 dred_textview_find_and_replace_all(dred_textview* pTextView, const ch
         return 0;
     }
 
-    size_t originalCursorLine = drte_view_get_cursor_line(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
-    size_t originalCursorPos = drte_view_get_cursor_character(pTextView->pView, drte_view_get_last_cursor(pTextView->pView)) - drte_view_get_line_first_character(pTextView->pView, NULL, originalCursorLine);
     int originalScrollPosX = dtk_scrollbar_get_scroll_position(pTextView->pHorzScrollbar);
     int originalScrollPosY = dtk_scrollbar_get_scroll_position(pTextView->pVertScrollbar);
 
@@ -1417,33 +1552,7 @@ dtk_bool32 dred_textview_find_and_replace_all(dred_textview* pTextView, const ch
     {
         drte_view_begin_dirty(pTextView->pView);
         {
-            drte_view_deselect_all(pTextView->pView);
-
-            // It's important that we don't replace the replacement text. To handle this, we just move the cursor to the top of the text and find
-            // and replace every occurance without looping.
-            drte_view_move_cursor_to_start_of_text(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
-
-            size_t selectionStart;
-            size_t selectionEnd;
-            while (drte_view_find_next_no_loop(pTextView->pView, text, &selectionStart, &selectionEnd))
-            {
-                drte_view_select(pTextView->pView, selectionStart, selectionEnd);
-                drte_view_move_cursor_to_end_of_selection(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
-
-                wasTextChanged = dred_textview_delete_selected_text_no_undo(pTextView) || wasTextChanged;
-                wasTextChanged = drte_view_insert_text_at_cursor(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), replacement) || wasTextChanged;
-            }
-
-            // The cursor may have moved so we'll need to restore it.
-            size_t lineCharStart;
-            size_t lineCharEnd;
-            drte_view_get_line_character_range(pTextView->pView, NULL, originalCursorLine, &lineCharStart, &lineCharEnd);
-
-            size_t newCursorPos = lineCharStart + originalCursorPos;
-            if (newCursorPos > lineCharEnd) {
-                newCursorPos = lineCharEnd;
-            }
-            drte_view_move_cursor_to_character(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), newCursorPos);
+            wasTextChanged = dred_textview__find_and_replace_all_in_view(pTextView->pView, text, replacement);
         }
         drte_view_end_dirty(pTextView->pView);
     }
@@ -1625,6 +1734,29 @@ void dred_textview_center_on_cursor(dred_textview* pTextView)
     dtk_scrollbar_scroll_to(pTextView->pVertScrollbar, (int)(dred_textview_get_cursor_line(pTextView) - (dtk_scrollbar_get_page_size(pTextView->pVertScrollbar)/2)));
 }
 
+void dred_textview_get_scroll_position(dred_textview* pTextView, dtk_int32* pScrollX, dtk_int32* pScrollY)
+{
+    dtk_int32 scrollX = 0;
+    dtk_int32 scrollY = 0;
+    if (pTextView != NULL) {
+        scrollX = dtk_scrollbar_get_scroll_position(pTextView->pHorzScrollbar);
+        scrollY = dtk_scrollbar_get_scroll_position(pTextView->pVertScrollbar);
+    }
+
+    if (pScrollX) *pScrollX = scrollX;
+    if (pScrollY) *pScrollY = scrollY;
+}
+
+void dred_textview_set_scroll_position(dred_textview* pTextView, dtk_int32 scrollX, dtk_int32 scrollY)
+{
+    if (pTextView == NULL) {
+        return;
+    }
+
+    dtk_scrollbar_scroll_to(pTextView->pHorzScrollbar, scrollX);
+    dtk_scrollbar_scroll_to(pTextView->pVertScrollbar, scrollY);
+}
+
 
 void dred_textview_set_tab_size_in_spaces(dred_textview* pTextView, unsigned int tabSizeInSpaces)
 {
@@ -1737,36 +1869,69 @@ void dred_textview_on_size(dred_control* pControl, float newWidth, float newHeig
     dtk_control_scheduled_redraw(DTK_CONTROL(pControl), dtk_control_get_local_rect(DTK_CONTROL(pControl)));
 }
 
+// Selects a rectangle of text. This is done with the view's native rectangle selection, which doesn't depend on the number of
+// lines in the rectangle, so it can be updated on every mouse move. Only the last line gets a real cursor. The rectangle is
+// converted to a selection and cursor per line by dred_textview__expand_rect_selection() when it's finished.
 void dred_textview__select_rectangle(dred_textview* pTextView, drte_rect rect)
 {
     if (pTextView == NULL) return;
 
+    size_t iLineBeg = drte_view_get_line_at_pos_y(pTextView->pView, pTextView->pView->pWrappedLines, rect.top);
+    size_t iLineEnd = drte_view_get_line_at_pos_y(pTextView->pView, pTextView->pView->pWrappedLines, rect.bottom);  // <-- Inclusive.
+    drte_view_set_rect_selection(pTextView->pView, iLineBeg, iLineEnd, rect.left, rect.right);
+
+    size_t iCharEnd;
+    drte_view_get_rect_selection_on_line(pTextView->pView, iLineEnd, NULL, &iCharEnd);
+    dred_textview__insert_cursor(pTextView, iCharEnd, iLineEnd);
+}
+
+// Converts the view's rectangle selection, if any, into a selection and a cursor for each line it covers so that it can be
+// edited like any other multi-cursor selection. This is proportional to the number of lines in the rectangle so it's only
+// done once the rectangle is finished, or when something needs to act on it.
+void dred_textview__expand_rect_selection(dred_textview* pTextView)
+{
+    assert(pTextView != NULL);
+
+    drte_view* pView = pTextView->pView;
+    if (!drte_view_has_rect_selection(pView)) {
+        return;
+    }
+
+    size_t iLineBeg = pView->rectSelectionLineBeg;
+    size_t iLineEnd = pView->rectSelectionLineEnd;
+
     // Disable the onCursorMove callback while we're constructing the sub-selections. It's restored at the end.
     drte_engine_on_cursor_move_proc prevOnCursorMoveProc = pTextView->pTextEngine->onCursorMove;
     pTextView->pTextEngine->onCursorMove = NULL;
 
-    size_t iLineBeg = drte_view_get_line_at_pos_y(pTextView->pView, pTextView->pView->pWrappedLines, rect.top);
-    size_t iLineEnd = drte_view_get_line_at_pos_y(pTextView->pView, pTextView->pView->pWrappedLines, rect.bottom);  // <-- Inclusive.
-    for (size_t iLine = iLineBeg; iLine <= iLineEnd; ++iLine) {
-        // Restore the onCursorMove callback for the last cursor.
-        if (iLine == iLineEnd) {
-            pTextView->pTextEngine->onCursorMove = prevOnCursorMoveProc;
-        }
+    // Each line is added in order which means the engine can keep it's cursor and selection indices up to date as we go rather
+    // than needing to rebuild them for each line. The whole rectangle is repainted once at the end.
+    drte_view_begin_dirty(pView);
+    {
+        dred_textview__clear_all_cursors(pTextView);
+
+        for (size_t iLine = iLineBeg; iLine <= iLineEnd; ++iLine) {
+            size_t iCharBeg;
+            size_t iCharEnd;
+            if (!drte_view_get_rect_selection_on_line(pView, iLine, &iCharBeg, &iCharEnd)) {
+                continue;
+            }
 
-        float linePosY = iLine * drte_engine_get_line_height(pTextView->pTextEngine);
-        
-        size_t iCharBeg;
-        drte_view_get_character_under_point_relative_to_text(pTextView->pView, pTextView->pView->pWrappedLines, rect.left,  linePosY, &iCharBeg, NULL);
+            // Restore the onCursorMove callback for the last cursor.
+            if (iLine == iLineEnd) {
+                pTextView->pTextEngine->onCursorMove = prevOnCursorMoveProc;
+            }
 
-        size_t iCharEnd;
-        drte_view_get_character_under_point_relative_to_text(pTextView->pView, pTextView->pView->pWrappedLines, rect.right, linePosY, &iCharEnd, NULL);
+            drte_view_begin_selection(pView, iCharBeg);
+            drte_view_set_selection_end_point(pView, iCharEnd);
 
-        drte_view_begin_selection(pTextView->pView, iCharBeg);
-        drte_view_set_selection_end_point(pTextView->pView, iCharEnd);
+            // Place a cursor at the end of the selection.
+            dred_textview__insert_cursor(pTextView, iCharEnd, iLine);
+        }
 
-        // Place a cursor at the end of the selection.
-        dred_textview__insert_cursor(pTextView, iCharEnd, iLine);
+        drte_view_clear_rect_selection(pView);
     }
+    drte_view_end_dirty(pView);
 
     pTextView->pTextEngine->onCursorMove = prevOnCursorMoveProc;
 }
@@ -1799,11 +1964,11 @@ void dred_textview_on_mouse_move(dred_control* pControl, int relativeMousePosX,
                 drte_view_get_word_under_point(pTextView->pView, relativeMousePosX - offsetX, relativeMousePosY - offsetY, &iWordCharBeg, &iWordCharEnd);
 
                 if (iWordCharEnd < pTextView->wordSelectionAnchor.iCharEnd) {
-                    pTextView->pView->pSelections[pTextView->pView->selectionCount-1].iCharBeg = pTextView->wordSelectionAnchor.iCharEnd;
-                    pTextView->pView->pSelections[pTextView->pView->selectionCount-1].iCharEnd = iWordCharBeg;
+                    drte_view_set_selection_anchor(pTextView->pView, pTextView->wordSelectionAnchor.iCharEnd);
+                    drte_view_set_selection_end_point(pTextView->pView, iWordCharBeg);
                 } else {
-                    pTextView->pView->pSelections[pTextView->pView->selectionCount-1].iCharBeg = pTextView->wordSelectionAnchor.iCharBeg;
-                    pTextView->pView->pSelections[pTextView->pView->selectionCount-1].iCharEnd = iWordCharEnd;
+                    drte_view_set_selection_anchor(pTextView->pView, pTextView->wordSelectionAnchor.iCharBeg);
+                    drte_view_set_selection_end_point(pTextView->pView, iWordCharEnd);
                 }
 
                 drte_view_move_cursor_to_character(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), pTextView->pView->pSelections[pTextView->pView->selectionCount-1].iCharEnd);
@@ -1819,6 +1984,7 @@ void dred_textview_on_mouse_move(dred_control* pControl, int relativeMousePosX,
                         dred_textview__select_rectangle(pTextView, drte_rect_make_right_way_out(pTextView->selectionRect));
                     } else {
                         pTextView->isDoingRectangleSelect = DTK_FALSE;  // Mouse movement was detected while the Alt key was not held down. Cancel the rectangle selection.
+                        dred_textview__expand_rect_selection(pTextView);
                     }
                 } else {
                     drte_view_move_cursor_to_point(pTextView->pView, drte_view_get_last_cursor(pTextView->pView), mousePosXRelativeToTextArea, mousePosYRelativeToTextArea);
@@ -1945,6 +2111,7 @@ void dred_textview_on_mouse_button_up(dred_control* pControl, int mouseButton, i
     if (mouseButton == DTK_MOUSE_BUTTON_LEFT)
     {
         pTextView->isDoingRectangleSelect = DTK_FALSE;
+        dred_textview__expand_rect_selection(pTextView);
 
         if (dtk_control_has_mouse_capture(DTK_CONTROL(pControl)))
         {
@@ -2069,6 +2236,9 @@ void dred_textview_on_key_down(dred_control* pControl, dtk_key key, int stateFla
         return;
     }
 
+    // Keys act on the selection and cursors of each line so a rectangle selection that's still being made is finished first.
+    dred_textview__expand_rect_selection(pTextView);
+
     drte_view_begin_dirty(pTextView->pView);
 
     dtk_bool32 isShiftDown = (stateFlags & DTK_MODIFIER_SHIFT) != 0;
@@ -2350,6 +2520,8 @@ void dred_textview_on_printable_key_down(dred_control* pControl, unsigned int ut
         return;
     }
 
+    dred_textview__expand_rect_selection(pTextView);
+
     //dred_control_begin_dirty(pControl);
     drte_engine_prepare_undo_point(pTextView->pTextEngine);
     {
@@ -2523,17 +2695,24 @@ void dred_textview_engine__on_cursor_move(drte_engine* pTextEngine, drte_view* p
 {
     (void)pTextEngine;
 
+    dred_textview* pTextView = (dred_textview*)pView->pUserData;
+    if (pTextView == NULL) {
+        return;
+    }
+
     // We only care about the last cursor.
     if (iCursor != pView->cursorCount-1) {
         return;
     }
 
-    // If the cursor is off the edge of the container we want to scroll it into position.
-    dred_textview* pTextView = (dred_textview*)pView->pUserData;
-    if (pTextView == NULL) {
-        return;
+    // The engine has reset the blink state so the blink timer needs to be rescheduled, or restarted if it was stopped due
+    // to inactivity. It only runs while we have the keyboard focus.
+    if (pTextView->pTimer != NULL || dtk_control_has_keyboard_capture(DTK_CONTROL(pTextView))) {
+        dred_textview__create_timer(pTextView);
     }
 
+    // If the cursor is off the edge of the container we want to scroll it into position.
+
     // If the cursor is above or below the container, we need to scroll vertically.
     int iLine = (int)drte_view_get_cursor_line(pTextView->pView, drte_view_get_last_cursor(pTextView->pView));
     if (iLine < dtk_scrollbar_get_scroll_position(pTextView->pVertScrollbar)) {
@@ -2686,6 +2865,11 @@ void dred_textview_on_release_mouse(dred_control* pControl)
         return;
     }
 
+    // The mouse may have been released without a button up event, such as when focus is lost part way through a rectangle
+    // selection, in which case the rectangle needs to be finished here.
+    dred_textview* pTextView = DRED_TEXTVIEW(pControl);
+    pTextView->isDoingRectangleSelect = DTK_FALSE;
+    dred_textview__expand_rect_selection(pTextView);
 
 }
 
@@ -134,8 +134,18 @@ struct dred_textview
     dred_textview_on_undo_point_changed_proc onUndoPointChanged;
 
 
-    // The timer for stepping the cursor.
+    // The timer for stepping the cursor. This is armed for the exact time of the next blink transition rather than ticking at
+    // a fixed interval, and is deleted once the cursor has been idle for cursorBlinkTimeout milliseconds.
     dtk_timer* pTimer;
+
+    // The time the timer was last armed, in nanoseconds. Used for working out how far to step the cursor.
+    dtk_uint64 timerArmTime;
+
+    // The time the cursor last moved, in nanoseconds.
+    dtk_uint64 lastActivityTime;
+
+    // The number of milliseconds of inactivity before the cursor stops blinking. 0 means it never stops.
+    unsigned int cursorBlinkTimeout;
 };
 
 
@@ -271,6 +281,9 @@ void dred_textview_step(dred_textview* pTextView, unsigned int milliseconds);
 // Sets the blink rate of the cursor in milliseconds.
 void dred_textview_set_cursor_blink_rate(dred_textview* pTextView, unsigned int blinkRateInMilliseconds);
 
+// Sets the number of milliseconds of inactivity after which the cursor stops blinking. Set to 0 to blink forever.
+void dred_textview_set_cursor_blink_timeout(dred_textview* pTextView, unsigned int timeoutInMilliseconds);
+
 // Moves the caret to the end of the text.
 void dred_textview_move_cursor_to_end_of_text(dred_textview* pTextView);
 
@@ -280,6 +293,9 @@ void dred_textview_move_cursor_to_start_of_line_by_index(dred_textview* pTextVie
 // Moves the caret to the beginnning of the unwrapped line at the given index.
 void dred_textview_move_cursor_to_start_of_unwrapped_line_by_index(dred_textview* pTextView, size_t iLine);
 
+// Moves the caret to the character at the given index. The index is clamped to the end of the text.
+void dred_textview_move_cursor_to_character(dred_textview* pTextView, size_t characterIndex);
+
 // Retrieves the word under the cursor at the given index.
 dtk_bool32 dred_textview_get_word_under_cursor(dred_textview* pTextView, size_t cursorIndex, size_t* pWordBegOut, size_t* pWordEndOut);
 
@@ -370,6 +386,13 @@ dtk_bool32 dred_textview_find_and_replace_next(dred_textview* pTextView, const c
 // Finds every occurance of the given string and replaces it with another.
 dtk_bool32 dred_textview_find_and_replace_all(dred_textview* pTextView, const char* text, const char* replacement);
 
+// The following work directly on a drte_view rather than a text view control so they can be used where there is no GUI, such as
+// batch mode. They do not create undo points.
+dtk_bool32 dred_textview__find_and_select_next_in_view(drte_view* pView, const char* text);
+dtk_bool32 dred_textview__find_and_replace_next_in_view(drte_view* pView, const char* text, const char* replacement);
+dtk_bool32 dred_textview__find_and_replace_all_in_view(drte_view* pView, const char* text, const char* replacement);
+dtk_bool32 dred_textview__unindent_selected_blocks_in_view(drte_view* pView);
+
 
 // Shows the line numbers.
 void dred_textview_show_line_numbers(dred_textview* pTextView);
@@ -418,6 +441,12 @@ dtk_bool32 dred_textview_is_cursor_in_view(dred_textview* pTextView);
 // Centers the view onto the active cursor.
 void dred_textview_center_on_cursor(dred_textview* pTextView);
 
+// Retrieves the positions of the scrollbars. The vertical position is in lines and the horizontal position is in pixels.
+void dred_textview_get_scroll_position(dred_textview* pTextView, dtk_int32* pScrollX, dtk_int32* pScrollY);
+
+// Scrolls the view to the given scrollbar positions. See dred_textview_get_scroll_position().
+void dred_textview_set_scroll_position(dred_textview* pTextView, dtk_int32 scrollX, dtk_int32 scrollY);
+
 
 // Sets the size of tabs in spaces.
 void dred_textview_set_tab_size_in_spaces(dred_textview* pTextView, unsigned int tabSizeInSpaces);
@@ -18,6 +18,8 @@
 #include "../dred/dred_build_config.h"
 
 #include "../dred/dtk/dtk.c"
+#include "../dred/dred_hash_index.h"
+#include "../dred/dred_hash_index.c"
 #include "../dred/dred_string_pool.h"
 #include "../dred/dred_string_pool.c"
 
@@ -339,6 +341,154 @@ char* stringify_string_pool_data(dred_string_pool* pStringPool)
 }
 
 
+// Perfect hashing.
+//
+// The tables are built with hash-and-displace. Each key is hashed with a seed of 0 to put it into a bucket, and then a
+// seed is searched for each bucket such that every key in that bucket hashes to an empty slot. Buckets are placed from
+// largest to smallest because the big ones are the hardest to place. The lookup side is dred_perfect_hash_find().
+//
+// The table size is the smallest power of 2 that can hold every key. Empty slots are set to 0xFFFF, which must match
+// DRED_PERFECT_HASH_EMPTY_SLOT.
+typedef struct
+{
+    dtk_uint32 bucket;
+    dtk_uint32 keyCount;
+} perfect_hash_bucket;
+
+int perfect_hash_bucket_qsort_comp(const void* a, const void* b)
+{
+    const perfect_hash_bucket* pA = (const perfect_hash_bucket*)a;
+    const perfect_hash_bucket* pB = (const perfect_hash_bucket*)b;
+
+    if (pA->keyCount != pB->keyCount) {
+        return (pA->keyCount > pB->keyCount) ? -1 : 1;
+    }
+
+    return (pA->bucket < pB->bucket) ? -1 : ((pA->bucket > pB->bucket) ? 1 : 0);
+}
+
+dtk_bool32 build_perfect_hash_table(const char** ppKeys, dtk_uint32 keyCount, dtk_uint32* pTableSizeOut, dtk_uint32** ppSeedsOut, dtk_uint16** ppIndicesOut)
+{
+    assert(ppKeys != NULL);
+    assert(keyCount < 0xFFFF);
+
+    dtk_uint32 tableSize = 1;
+    while (tableSize < keyCount) {
+        tableSize <<= 1;
+    }
+
+    dtk_uint32* pSeeds = (dtk_uint32*)calloc(tableSize, sizeof(*pSeeds));
+    dtk_uint16* pIndices = (dtk_uint16*)malloc(tableSize * sizeof(*pIndices));
+    perfect_hash_bucket* pBuckets = (perfect_hash_bucket*)calloc(tableSize, sizeof(*pBuckets));
+    dtk_uint32* pBucketSlots = (dtk_uint32*)malloc(keyCount * 2 * sizeof(*pBucketSlots));
+    if (pSeeds == NULL || pIndices == NULL || pBuckets == NULL || pBucketSlots == NULL) {
+        free(pSeeds); free(pIndices); free(pBuckets); free(pBucketSlots);
+        return DTK_FALSE;
+    }
+
+    for (dtk_uint32 iSlot = 0; iSlot < tableSize; ++iSlot) {
+        pIndices[iSlot] = 0xFFFF;
+        pBuckets[iSlot].bucket = iSlot;
+    }
+
+    for (dtk_uint32 iKey = 0; iKey < keyCount; ++iKey) {
+        pBuckets[dtk_hash_string(ppKeys[iKey], 0) & (tableSize-1)].keyCount += 1;
+    }
+
+    qsort(pBuckets, tableSize, sizeof(*pBuckets), perfect_hash_bucket_qsort_comp);
+
+    dtk_bool32 result = DTK_TRUE;
+    for (dtk_uint32 iBucket = 0; iBucket < tableSize && pBuckets[iBucket].keyCount > 0; ++iBucket) {
+        dtk_uint32 bucket = pBuckets[iBucket].bucket;
+
+        dtk_uint32 seed;
+        for (seed = 1; seed < 0x10000000; ++seed) {
+            // Every key in the bucket must land in an empty slot, and none of them can land in the same slot.
+            dtk_uint32 placedCount = 0;
+            for (dtk_uint32 iKey = 0; iKey < keyCount; ++iKey) {
+                if ((dtk_hash_string(ppKeys[iKey], 0) & (tableSize-1)) != bucket) {
+                    continue;
+                }
+
+                dtk_uint32 slot = dtk_hash_string(ppKeys[iKey], seed) & (tableSize-1);
+                if (pIndices[slot] != 0xFFFF) {
+                    break;
+                }
+
+                dtk_bool32 isSlotTaken = DTK_FALSE;
+                for (dtk_uint32 iPlaced = 0; iPlaced < placedCount; ++iPlaced) {
+                    if (pBucketSlots[iPlaced*2 + 0] == slot) {
+                        isSlotTaken = DTK_TRUE;
+                        break;
+                    }
+                }
+                if (isSlotTaken) {
+                    break;
+                }
+
+                pBucketSlots[placedCount*2 + 0] = slot;
+                pBucketSlots[placedCount*2 + 1] = iKey;
+                placedCount += 1;
+            }
+
+            if (placedCount == pBuckets[iBucket].keyCount) {
+                break;
+            }
+        }
+
+        if (seed == 0x10000000) {
+            printf("ERROR: Failed to build perfect hash table.\n");
+            result = DTK_FALSE;
+            break;
+        }
+
+        pSeeds[bucket] = seed;
+        for (dtk_uint32 iPlaced = 0; iPlaced < pBuckets[iBucket].keyCount; ++iPlaced) {
+            pIndices[pBucketSlots[iPlaced*2 + 0]] = (dtk_uint16)pBucketSlots[iPlaced*2 + 1];
+        }
+    }
+
+    free(pBuckets);
+    free(pBucketSlots);
+
+    if (!result) {
+        free(pSeeds);
+        free(pIndices);
+        return DTK_FALSE;
+    }
+
+    *pTableSizeOut = tableSize;
+    *ppSeedsOut = pSeeds;
+    *ppIndicesOut = pIndices;
+    return DTK_TRUE;
+}
+
+char* stringify_perfect_hash_table(const char* tableSizeName, const char* seedsName, const char* indicesName, dtk_uint32 tableSize, const dtk_uint32* pSeeds, const dtk_uint16* pIndices)
+{
+    char line[256];
+    snprintf(line, sizeof(line), "#define %s %u\n\n", tableSizeName, tableSize);
+    char* output = dtk_make_string(line);
+
+    snprintf(line, sizeof(line), "const dtk_uint32 %s[%s] = {", seedsName, tableSizeName);
+    output = dtk_append_string(output, line);
+    for (dtk_uint32 i = 0; i < tableSize; ++i) {
+        snprintf(line, sizeof(line), "%s%u", (i == 0) ? "\n    " : (((i % BYTES_PER_ROW) == 0) ? ",\n    " : ", "), pSeeds[i]);
+        output = dtk_append_string(output, line);
+    }
+    output = dtk_append_string(output, "\n};\n\n");
+
+    snprintf(line, sizeof(line), "const dtk_uint16 %s[%s] = {", indicesName, tableSizeName);
+    output = dtk_append_string(output, line);
+    for (dtk_uint32 i = 0; i < tableSize; ++i) {
+        snprintf(line, sizeof(line), "%s0x%04X", (i == 0) ? "\n    " : (((i % BYTES_PER_ROW) == 0) ? ",\n    " : ", "), pIndices[i]);
+        output = dtk_append_string(output, line);
+    }
+    output = dtk_append_string(output, "\n};\n\n");
+
+    return output;
+}
+
+
 
 void generate_commands_list(FILE* pFileOut)
 {
@@ -436,6 +586,27 @@ void generate_commands_list(FILE* pFileOut)
     fwrite_string(pFileOut, CommandNamePool);
     fwrite_string(pFileOut, CommandNames);
     fwrite_string(pFileOut, Commands);
+
+
+    // Commands are looked up by name with a perfect hash table.
+    const char** ppCommandNames = (const char**)malloc(commandCount * sizeof(*ppCommandNames));
+    for (int iCommand = 0; iCommand < commandCount; ++iCommand) {
+        ppCommandNames[iCommand] = g_CommandVars[iCommand].name;
+    }
+
+    dtk_uint32 tableSize;
+    dtk_uint32* pSeeds;
+    dtk_uint16* pIndices;
+    if (build_perfect_hash_table(ppCommandNames, (dtk_uint32)commandCount, &tableSize, &pSeeds, &pIndices)) {
+        char* CommandHashTable = stringify_perfect_hash_table("DRED_COMMAND_HASH_TABLE_SIZE", "g_CommandHashSeeds", "g_CommandHashIndices", tableSize, pSeeds, pIndices);
+        fwrite_string(pFileOut, CommandHashTable);
+        dtk_free_string(CommandHashTable);
+
+        free(pSeeds);
+        free(pIndices);
+    }
+
+    free(ppCommandNames);
 }
 
 void generate_stock_images(FILE* pFileOut, FILE* pFileOutH)
@@ -871,58 +1042,94 @@ void generate_config_vars(FILE* pFileOut, FILE* pFileOutH)
 
 
 
-    funcOutput = dtk_make_string("\n\nvoid dred_config_set__autogenerated(dred_config* pConfig, const char* key, const char* value)\n{\n");
+    // Variables are looked up by name with a perfect hash table. Setting a variable by index is a switch rather than a chain
+    // of string comparisons.
+    const char** ppVarNames = (const char**)malloc(stb_sb_count(g_ConfigVars) * sizeof(*ppVarNames));
+    for (int iVar = 0; iVar < stb_sb_count(g_ConfigVars); ++iVar) {
+        ppVarNames[iVar] = g_ConfigVars[iVar].name;
+    }
+
+    snprintf(line, sizeof(line), "\n#define DRED_CONFIG_VAR_COUNT %d\n\n", stb_sb_count(g_ConfigVars));
+    funcOutput = dtk_make_string(line);
+    funcOutput = dtk_append_string(funcOutput, "const char* const g_ConfigVarNames[DRED_CONFIG_VAR_COUNT] = {\n");
+    for (int iVar = 0; iVar < stb_sb_count(g_ConfigVars); ++iVar) {
+        funcOutput = dtk_append_string(funcOutput, "    \"");
+        funcOutput = dtk_append_string(funcOutput, g_ConfigVars[iVar].name);
+        funcOutput = dtk_append_string(funcOutput, "\",\n");
+    }
+    funcOutput = dtk_append_string(funcOutput, "};\n\n");
+
+    dtk_uint32 tableSize;
+    dtk_uint32* pSeeds;
+    dtk_uint16* pIndices;
+    if (build_perfect_hash_table(ppVarNames, (dtk_uint32)stb_sb_count(g_ConfigVars), &tableSize, &pSeeds, &pIndices)) {
+        char* hashTable = stringify_perfect_hash_table("DRED_CONFIG_VAR_HASH_TABLE_SIZE", "g_ConfigVarHashSeeds", "g_ConfigVarHashIndices", tableSize, pSeeds, pIndices);
+        funcOutput = dtk_append_string(funcOutput, hashTable);
+        dtk_free_string(hashTable);
+
+        free(pSeeds);
+        free(pIndices);
+    }
+    free(ppVarNames);
+
+    funcOutput = dtk_append_string(funcOutput, "dtk_uint32 dred_config_find_variable_index__autogenerated(const char* key)\n{\n");
+    funcOutput = dtk_append_string(funcOutput, "    return dred_perfect_hash_find(key, g_ConfigVarHashSeeds, g_ConfigVarHashIndices, DRED_CONFIG_VAR_HASH_TABLE_SIZE, g_ConfigVarNames, DRED_CONFIG_VAR_COUNT);\n");
+    funcOutput = dtk_append_string(funcOutput, "}\n");
+    fwrite_string(pFileOut, funcOutput);
+    dtk_free_string(funcOutput);
+
+
+    funcOutput = dtk_make_string("\n\nvoid dred_config_set_by_index__autogenerated(dred_config* pConfig, dtk_uint32 index, const char* value)\n{\n    switch (index)\n    {\n");
     for (int iVar = 0; iVar < stb_sb_count(g_ConfigVars); ++iVar) {
         config_var* pVar = &g_ConfigVars[iVar];
 
-        funcOutput = dtk_append_string(funcOutput, "    if (strcmp(key, \"");
-        funcOutput = dtk_append_string(funcOutput, pVar->name);
-        funcOutput = dtk_append_string(funcOutput, "\") == 0) {\n");
+        snprintf(line, sizeof(line), "        case %d:\n        {\n", iVar);
+        funcOutput = dtk_append_string(funcOutput, line);
 
         switch (pVar->type)
         {
             case CONFIG_VAR_TYPE_INTEGER:
             {
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = atoi(value);\n");
             } break;
 
             case CONFIG_VAR_TYPE_FLOAT:
             {
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = (float)atof(value);\n");
             } break;
 
             case CONFIG_VAR_TYPE_BOOL:
             {
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = dred_parse_bool(value);\n");
             } break;
 
             case CONFIG_VAR_TYPE_STRING:
             {
-                funcOutput = dtk_append_string(funcOutput, "        dtk_free_string(pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            dtk_free_string(pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, ");\n");
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = dtk_make_string(value);\n");
             } break;
 
             case CONFIG_VAR_TYPE_FONT:
             {
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = dred_parse_and_load_font(pConfig->pDred, value);\n");
             } break;
 
             case CONFIG_VAR_TYPE_IMAGE:
             {
                 // TODO: Implement this properly once a proper imaging system is ready.
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = NULL;\n");
             } break;
 
             case CONFIG_VAR_TYPE_COLOR:
             {
-                funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+                funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
                 funcOutput = dtk_append_string(funcOutput, " = dred_parse_color(value);\n");
             } break;
 
@@ -930,45 +1137,55 @@ void generate_config_vars(FILE* pFileOut, FILE* pFileOutH)
         }
 
         if (pVar->setCallback[0] != '\0' && strcmp(pVar->setCallback, "none") != 0) {
-            funcOutput = dtk_append_string(funcOutput, "        if (pConfig->pDred->isInitialized) ");
+            funcOutput = dtk_append_string(funcOutput, "            if (pConfig->pDred->isInitialized) ");
             funcOutput = dtk_append_string(funcOutput, pVar->setCallback);
             funcOutput = dtk_append_string(funcOutput, "(pConfig->pDred);\n");
         }
 
-        funcOutput = dtk_append_string(funcOutput, "        return;\n    }\n");
+        funcOutput = dtk_append_string(funcOutput, "        } break;\n\n");
     }
-    funcOutput = dtk_append_string(funcOutput, "\n    dred_warningf(pConfig->pDred, \"Unknown config variable: %s\\n\", key);\n");
+    funcOutput = dtk_append_string(funcOutput, "        default: break;\n    }\n}\n\n");
+    fwrite_string(pFileOut, funcOutput);
+    dtk_free_string(funcOutput);
+
+
+    funcOutput = dtk_make_string("\n\nvoid dred_config_set__autogenerated(dred_config* pConfig, const char* key, const char* value)\n{\n");
+    funcOutput = dtk_append_string(funcOutput, "    dtk_uint32 index = dred_config_find_variable_index__autogenerated(key);\n");
+    funcOutput = dtk_append_string(funcOutput, "    if (index == (dtk_uint32)-1) {\n");
+    funcOutput = dtk_append_string(funcOutput, "        dred_warningf(pConfig->pDred, \"Unknown config variable: %s\\n\", key);\n");
+    funcOutput = dtk_append_string(funcOutput, "        return;\n    }\n\n");
+    funcOutput = dtk_append_string(funcOutput, "    dred_config_set_by_index__autogenerated(pConfig, index, value);\n");
     funcOutput = dtk_append_string(funcOutput, "}\n\n");
     fwrite_string(pFileOut, funcOutput);
+    dtk_free_string(funcOutput);
 
 
-    funcOutput = dtk_make_string("\n\nvoid dred_config_set_default__autogenerated(dred_config* pConfig, const char* key)\n{\n");
+    funcOutput = dtk_make_string("\n\nvoid dred_config_set_default__autogenerated(dred_config* pConfig, const char* key)\n{\n    switch (dred_config_find_variable_index__autogenerated(key))\n    {\n");
     for (int iVar = 0; iVar < stb_sb_count(g_ConfigVars); ++iVar) {
         config_var* pVar = &g_ConfigVars[iVar];
 
-        funcOutput = dtk_append_string(funcOutput, "    if (strcmp(key, \"");
-        funcOutput = dtk_append_string(funcOutput, pVar->name);
-        funcOutput = dtk_append_string(funcOutput, "\") == 0) {\n");
+        snprintf(line, sizeof(line), "        case %d:\n        {\n", iVar);
+        funcOutput = dtk_append_string(funcOutput, line);
 
         // For strings, the previous string needs to be free'd first.
         if (pVar->type == CONFIG_VAR_TYPE_STRING) {
-            funcOutput = dtk_append_string(funcOutput, "        dtk_free_string(pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
+            funcOutput = dtk_append_string(funcOutput, "            dtk_free_string(pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname);
             funcOutput = dtk_append_string(funcOutput, ");\n");
         }
 
-        funcOutput = dtk_append_string(funcOutput, "        pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname); funcOutput = dtk_append_string(funcOutput, " = ");
+        funcOutput = dtk_append_string(funcOutput, "            pConfig->"); funcOutput = dtk_append_string(funcOutput, pVar->varname); funcOutput = dtk_append_string(funcOutput, " = ");
         funcOutput = dtk_append_string(funcOutput, pVar->defaultValue);
         funcOutput = dtk_append_string(funcOutput, ";\n");
 
         if (pVar->setCallback[0] != '\0' && strcmp(pVar->setCallback, "none") != 0) {
-            funcOutput = dtk_append_string(funcOutput, "        if (pConfig->pDred->isInitialized) ");
+            funcOutput = dtk_append_string(funcOutput, "            if (pConfig->pDred->isInitialized) ");
             funcOutput = dtk_append_string(funcOutput, pVar->setCallback);
             funcOutput = dtk_append_string(funcOutput, "(pConfig->pDred);\n");
         }
 
-        funcOutput = dtk_append_string(funcOutput, "        return;\n    }\n");
+        funcOutput = dtk_append_string(funcOutput, "        } break;\n\n");
     }
-    funcOutput = dtk_append_string(funcOutput, "}\n\n");
+    funcOutput = dtk_append_string(funcOutput, "        default: break;\n    }\n}\n\n");
     fwrite_string(pFileOut, funcOutput);
 }
 
@@ -141,6 +141,50 @@ typedef struct
     size_t iCharEnd;
 } drte_region;
 
+// An entry in the sorted index of a view's cursors or selections.
+typedef struct
+{
+    // The character the entry is sorted by. For cursors this is the position of the cursor. For selections this is the first
+    // character of the normalized selection.
+    size_t iChar;
+
+    // For selections, the furthest end character of this and every entry before it in the index. This is what allows us to
+    // quickly determine whether or not a character is inside any selection even when selections overlap.
+    size_t iCharMaxEnd;
+
+    // The index of the cursor or selection.
+    size_t index;
+} drte_index_entry;
+
+// A single edit within a batch of edits. The range [iCharBeg, iCharEnd) is replaced with text. An insertion has an empty range
+// and a deletion has an empty (or NULL) string.
+typedef struct
+{
+    size_t iCharBeg;
+    size_t iCharEnd;
+    const char* text;
+} drte_edit;
+
+// The column index of a single unwrapped line. Lines are indexed lazily when a column is requested, and only a handful are
+// kept at a time. A checkpoint is stored every DRTE_COLUMN_CHECKPOINT_INTERVAL code points as a byte offset relative to the
+// start of the line, which means it stays valid when text is inserted or deleted on other lines.
+typedef struct
+{
+    // The index of the line, or (size_t)-1 if the slot is empty.
+    size_t iLine;
+
+    // The length of the line in bytes, not including the new line character.
+    size_t lineLength;
+
+    // The number of code points on the line.
+    size_t columnCount;
+
+    // pCheckpoints[i] is the byte offset of code point i*DRTE_COLUMN_CHECKPOINT_INTERVAL.
+    size_t* pCheckpoints;
+    size_t checkpointCount;
+    size_t checkpointCapacity;
+} drte_column_index_slot;
+
 typedef struct
 {
     // The index of the first character in the segment.
@@ -166,7 +210,8 @@ typedef struct
 typedef enum
 {
 	drte_undo_change_type_insert,
-	drte_undo_change_type_delete
+	drte_undo_change_type_delete,
+	drte_undo_change_type_batch     // A whole drte_engine_apply_edits() call, replayed with a single call in both directions.
 } drte_undo_change_type;
 
 typedef struct
@@ -222,6 +267,15 @@ struct drte_view
     // The number of active selection regions. When this is 0, nothing is selected.
     size_t selectionCount;
 
+    // The rectangle (block) selection, if any. This is separate to the selection regions above. It's stored as a range of
+    // lines and a horizontal range in pixels, relative to the text, and the part of each line that it covers is only worked
+    // out when that line is needed. See drte_view_set_rect_selection().
+    drte_bool32 hasRectSelection;
+    size_t rectSelectionLineBeg;    // Inclusive. This is a line index in pWrappedLines.
+    size_t rectSelectionLineEnd;    // Inclusive.
+    float rectSelectionPosXBeg;
+    float rectSelectionPosXEnd;
+
 
     // The text scale.
     float scale;
@@ -241,6 +295,30 @@ struct drte_view
     drte_rect _accumulatedDirtyRect;
     drte_line_cache _wrappedLines;
     drte_line_cache* pWrappedLines;     // Points to _wrappedLines if word wrap is enabled; points to pEngine->_unwrappedLines when word wrap is disabled.
+
+    // The capacity of pCursors and pSelections, and of their sorted indices. These are grown geometrically so that adding
+    // cursors and selections one at a time, such as when doing a rectangle selection, is not quadratic.
+    size_t _cursorBufferSize;
+    size_t _selectionBufferSize;
+
+    // Cursors and selections are stored in the order they were added, but things like painting and hit testing need to find
+    // them by character position. These indices are sorted by character position and are rebuilt lazily the next time they
+    // are needed after being invalidated. Adding to, or changing, the last cursor or selection updates the index in place
+    // when it's order is not affected, which is by far the most common case.
+    drte_index_entry* _pCursorIndex;
+    drte_index_entry* _pSelectionIndex;
+    drte_bool32 _isCursorIndexValid;
+    drte_bool32 _isSelectionIndexValid;
+
+    // The range of the line of the rectangle selection that was most recently worked out. Segments are iterated one line at
+    // a time so this saves working it out again for every segment on the line. _isCalculatingRectSelection is used to ignore
+    // the rectangle selection while working out a line's range, since that is done by iterating over the segments of the line.
+    drte_bool32 _isRectSelectionCacheValid;
+    size_t _rectSelectionCachedLine;
+    size_t _rectSelectionCachedLineCharBeg;
+    size_t _rectSelectionCachedLineCharEnd;
+    drte_region _rectSelectionCachedRegion;
+    drte_bool32 _isCalculatingRectSelection;
 };
 
 struct drte_engine
@@ -311,6 +389,19 @@ struct drte_engine
     /// The length of the text.
     size_t textLength;
 
+    // The number of code points in the text. Bytes that are not part of a valid UTF-8 sequence count as one code point each.
+    size_t codePointCount;
+
+    // Whether or not the text is entirely 7-bit ASCII, in which case code points and bytes map 1:1 and the column index is
+    // bypassed. This is cleared when non-ASCII text is inserted and is only set again when the text becomes empty.
+    drte_bool32 isTextASCII;
+
+    // Whether or not every piece of text that has been inserted was valid UTF-8. This is reset when the text becomes empty.
+    drte_bool32 isTextValidUTF8;
+
+    // The column index. This is an array of DRTE_COLUMN_INDEX_SLOT_COUNT slots which is allocated the first time it's needed.
+    drte_column_index_slot* _pColumnIndex;
+
 
     /// The function to call when the text engine needs to be redrawn.
     drte_engine_on_dirty_proc onDirty;
@@ -409,6 +500,10 @@ DRTE_INLINE drte_view* drte_engine_prev_view(drte_engine* pEngine, drte_view* pV
 // Counts the number of views. This runs in linear time.
 size_t drte_engine_get_view_count(drte_engine* pEngine);
 
+// Retrieves an estimate of the amount of memory used by the engine and it's views, in bytes. This includes the text, line
+// caches, undo buffer and cursor and selection storage, but not anything allocated by the application.
+size_t drte_engine_get_memory_usage(drte_engine* pEngine);
+
 
 // Registers a style token.
 //
@@ -462,8 +557,33 @@ float drte_engine_get_line_height(drte_engine* pEngine);
 
 
 // Gets the character at the given index as a UTF-32 code point.
+//
+// Character indices are byte offsets into the UTF-8 text. Bytes that are not part of a valid UTF-8 sequence are treated as
+// characters of their own and are returned as U+FFFD.
 uint32_t drte_engine_get_utf32(drte_engine* pEngine, size_t characterIndex);
 
+// Retrieves the index of the character after the one at the given index. This is constant time.
+size_t drte_engine_get_next_character(drte_engine* pEngine, size_t characterIndex);
+
+// Retrieves the index of the character before the one at the given index. This is constant time. It looks at no more than
+// four bytes regardless of the length of the line.
+size_t drte_engine_get_prev_character(drte_engine* pEngine, size_t characterIndex);
+
+// Retrieves the number of code points in the text.
+size_t drte_engine_get_code_point_count(drte_engine* pEngine);
+
+// Determines whether or not the text is valid UTF-8. See the notes on drte_engine::isTextValidUTF8.
+drte_bool32 drte_engine_is_text_valid_utf8(drte_engine* pEngine);
+
+// Retrieves the column of the given character, in code points from the start of it's unwrapped line.
+//
+// Lines are indexed the first time this is called for them, after which this only needs to walk a small, fixed number of code
+// points. Text that is entirely ASCII does not need an index at all.
+size_t drte_engine_get_character_column(drte_engine* pEngine, size_t characterIndex);
+
+// Retrieves the index of the character at the given column of the given unwrapped line. This is clamped to the end of the line.
+size_t drte_engine_get_character_at_column(drte_engine* pEngine, size_t iLine, size_t column);
+
 
 /// Sets the given text engine's text.
 void drte_engine_set_text(drte_engine* pEngine, const char* text);
@@ -502,6 +622,13 @@ unsigned int drte_engine_get_cursor_blink_rate(drte_engine* pEngine);
 // Resets the cursors blink state.
 void drte_engine_reset_cursor_blinks(drte_engine* pEngine);
 
+// Retrieves the number of milliseconds until the cursor next switches it's blink state. This is used for scheduling a timer
+// for the exact time of the next blink rather than stepping at a fixed interval.
+unsigned int drte_engine_get_time_to_next_cursor_blink(drte_engine* pEngine);
+
+// Determines whether or not the cursor is currently in the visible part of it's blink cycle.
+drte_bool32 drte_engine_is_cursor_blink_on(drte_engine* pEngine);
+
 
 
 /// Inserts a character into the given text engine.
@@ -522,6 +649,18 @@ drte_bool32 drte_engine_insert_text(drte_engine* pEngine, const char* text, size
 /// @return True if the text within the text engine has changed.
 drte_bool32 drte_engine_delete_text(drte_engine* pEngine, size_t iFirstCh, size_t iLastChPlus1);
 
+// Applies a batch of edits in a single pass.
+//
+// The edits must be sorted by position and must not overlap. All positions are relative to the text _before_ any of the edits
+// are applied. Multiple insertions at the same position are allowed and are inserted in the order they appear in the list.
+//
+// This is much faster than calling drte_engine_insert_text() and drte_engine_delete_text() for each edit because the text is
+// only rebuilt once, the line cache is only refreshed once and each cursor and selection is only updated once. All of the
+// edits are added to the prepared undo state as a single change, so undoing and redoing them is also a single pass.
+//
+// Returns DRTE_TRUE if the text within the text engine has changed.
+drte_bool32 drte_engine_apply_edits(drte_engine* pEngine, size_t editCount, const drte_edit* pEdits);
+
 
 // Retrieves the start of the next word starting from the given character.
 drte_bool32 drte_engine_get_start_of_next_word_from_character(drte_engine* pEngine, size_t iChar, size_t* pWordBegOut);
@@ -749,6 +888,10 @@ size_t drte_view_insert_cursor_at_character_and_line(drte_view* pView, size_t iC
 // Removes a cursor by it's index.
 void drte_view_remove_cursor(drte_view* pView, size_t cursorIndex);
 
+// Finds the cursor sitting on the given character. If more than one cursor is on the character, the one with the lowest index
+// is returned.
+drte_bool32 drte_view_find_cursor_at_character(drte_view* pView, size_t iChar, size_t* pCursorIndexOut);
+
 // Removes any overlapping cursors, leaving only one of the overlapping cursors remaining.
 void drte_view_remove_overlapping_cursors(drte_view* pView);
 
@@ -918,6 +1061,29 @@ drte_bool32 drte_view_get_last_selection(drte_view* pView, size_t* iCharBegOut,
 // Retrieves the selection region under the given point, if any.
 drte_bool32 drte_view_get_selection_under_point(drte_view* pView, float posX, float posY, size_t* piSelectionOut);
 
+// Sets the rectangle (block) selection. This covers the given lines, inclusive, and on each of them the characters between
+// the two horizontal positions, which are relative to the text. A view has at most one rectangle selection, and it's shown
+// alongside the normal selection regions.
+//
+// Setting a rectangle selection does not depend on the number of lines it covers - the part of each line that's selected is
+// only worked out when that line is painted, or when it's requested with drte_view_get_rect_selection_on_line(). A cursor is
+// painted at the end of the selected part of each visible line, but these are not real cursors. To edit the selection like
+// any other multi-cursor selection, it needs to be converted to a selection region and a cursor for each line.
+//
+// The rectangle selection is cleared by drte_view_deselect_all() and drte_view_clear_rect_selection().
+void drte_view_set_rect_selection(drte_view* pView, size_t iLineBeg, size_t iLineEnd, float posXBeg, float posXEnd);
+
+// Clears the rectangle selection.
+void drte_view_clear_rect_selection(drte_view* pView);
+
+// Determines whether or not the view has a rectangle selection.
+drte_bool32 drte_view_has_rect_selection(drte_view* pView);
+
+// Retrieves the range of characters selected by the rectangle selection on the given line. Returns false if there is no
+// rectangle selection or if it does not cover the line. The range will be empty if the line is too short to reach the
+// rectangle, in which case the range is at the end of the line.
+drte_bool32 drte_view_get_rect_selection_on_line(drte_view* pView, size_t iLine, size_t* piCharBegOut, size_t* piCharEndOut);
+
 
 /// Inserts a character at the position of the cursor.
 ///
@@ -930,6 +1096,9 @@ drte_bool32 drte_view_insert_character_at_cursors(drte_view* pView, unsigned int
 /// @return True if the text within the text engine has changed.
 drte_bool32 drte_view_insert_text_at_cursor(drte_view* pView, size_t cursorIndex, const char* text);
 
+// Inserts the given text at the position of every cursor as a single batch. See drte_engine_apply_edits().
+drte_bool32 drte_view_insert_text_at_cursors(drte_view* pView, const char* text);
+
 /// Deletes the character to the left of the cursor.
 ///
 /// @return True if the text within the text engine has changed.
@@ -1032,6 +1201,11 @@ DRTE_INLINE drte_rect drte_rect_make_right_way_out(drte_rect rect)
 #include <stdlib.h>
 #include <math.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DRTE_SUPPORT_SSE2
+#include <emmintrin.h>
+#endif
+
 #ifndef DRTE_STACK_BUFFER_ALIGNMENT
 #define DRTE_STACK_BUFFER_ALIGNMENT sizeof(size_t)
 #endif
@@ -1044,6 +1218,24 @@ DRTE_INLINE drte_rect drte_rect_make_right_way_out(drte_rect rect)
 #define DRTE_PAGE_LINE_COUNT    256
 #endif
 
+#ifndef DRTE_COLUMN_CHECKPOINT_INTERVAL
+#define DRTE_COLUMN_CHECKPOINT_INTERVAL 32
+#endif
+
+#ifndef DRTE_COLUMN_INDEX_SLOT_COUNT
+#define DRTE_COLUMN_INDEX_SLOT_COUNT    16
+#endif
+
+// Performance instrumentation hooks. These are placed around painting, word wrapping and committing undo points, and do nothing
+// by default. The application can define them to feed it's own counters. The counter is an identifier naming the operation,
+// such as VIEW_PAINT.
+#ifndef DRTE_PERF_BEGIN
+#define DRTE_PERF_BEGIN()                   0
+#endif
+#ifndef DRTE_PERF_END
+#define DRTE_PERF_END(counter, begTime)     (void)(begTime)
+#endif
+
 #define DRTE_INVALID_STYLE_SLOT 255
 
 // Flags for the drte_engine::flags and drte_view::flags properties.
@@ -1055,6 +1247,7 @@ DRTE_INLINE drte_rect drte_rect_make_right_way_out(drte_rect rect)
 
 // min
 #define drte_min(a, b) (((a) < (b)) ? (a) : (b))
+#define drte_max(a, b) (((a) > (b)) ? (a) : (b))
 #define drte_round_up(x, multiple) ((((x) + ((multiple) - 1)) / (multiple)) * (multiple))
 
 // Determines if the given character is whitespace.
@@ -1071,7 +1264,158 @@ drte_bool32 drte_is_symbol_or_whitespace(uint32_t utf32)
         return DRTE_FALSE;
     }
 
-    return (utf32 < '0') || (utf32 >= ':' && utf32 < 'A') || (utf32 >= '[' && utf32 < 'a') || (utf32 > '{');
+    // Anything outside of ASCII is treated as part of a word. This is also what makes it safe to scan for word boundaries one
+    // byte at a time since it means a boundary can never land in the middle of a multi-byte sequence.
+    return (utf32 < '0') || (utf32 >= ':' && utf32 < 'A') || (utf32 >= '[' && utf32 < 'a') || (utf32 > '{' && utf32 < 0x80);
+}
+
+
+// Decodes the UTF-8 sequence at the start of the given text and returns the number of bytes making it up. Bytes that are not
+// part of a valid sequence, including overlong encodings and surrogates, are decoded as U+FFFD one byte at a time.
+size_t drte_utf8_decode(const char* pText, size_t textLength, uint32_t* pUTF32Out)
+{
+    const unsigned char* pBytes = (const unsigned char*)pText;
+
+    if (textLength == 0) {
+        *pUTF32Out = 0;
+        return 0;
+    }
+
+    uint32_t utf32 = pBytes[0];
+    if (utf32 < 0x80) {
+        *pUTF32Out = utf32;
+        return 1;
+    }
+
+    size_t length;
+    uint32_t minValue;
+    if ((utf32 & 0xE0) == 0xC0) {
+        length   = 2;
+        minValue = 0x80;
+        utf32   &= 0x1F;
+    } else if ((utf32 & 0xF0) == 0xE0) {
+        length   = 3;
+        minValue = 0x800;
+        utf32   &= 0x0F;
+    } else if ((utf32 & 0xF8) == 0xF0) {
+        length   = 4;
+        minValue = 0x10000;
+        utf32   &= 0x07;
+    } else {
+        *pUTF32Out = 0xFFFD;
+        return 1;
+    }
+
+    if (length > textLength) {
+        *pUTF32Out = 0xFFFD;
+        return 1;
+    }
+
+    for (size_t i = 1; i < length; ++i) {
+        if ((pBytes[i] & 0xC0) != 0x80) {
+            *pUTF32Out = 0xFFFD;
+            return 1;
+        }
+
+        utf32 = (utf32 << 6) | (pBytes[i] & 0x3F);
+    }
+
+    if (utf32 < minValue || utf32 > 0x10FFFF || (utf32 >= 0xD800 && utf32 <= 0xDFFF)) {
+        *pUTF32Out = 0xFFFD;
+        return 1;
+    }
+
+    *pUTF32Out = utf32;
+    return length;
+}
+
+// Encodes a UTF-32 code point as UTF-8. pUTF8Out must have room for at least 4 bytes and is not null terminated. Invalid code
+// points are encoded as U+FFFD.
+size_t drte_utf8_encode(uint32_t utf32, char* pUTF8Out)
+{
+    if (utf32 > 0x10FFFF || (utf32 >= 0xD800 && utf32 <= 0xDFFF)) {
+        utf32 = 0xFFFD;
+    }
+
+    if (utf32 < 0x80) {
+        pUTF8Out[0] = (char)utf32;
+        return 1;
+    }
+    if (utf32 < 0x800) {
+        pUTF8Out[0] = (char)(0xC0 | (utf32 >> 6));
+        pUTF8Out[1] = (char)(0x80 | (utf32 & 0x3F));
+        return 2;
+    }
+    if (utf32 < 0x10000) {
+        pUTF8Out[0] = (char)(0xE0 | (utf32 >> 12));
+        pUTF8Out[1] = (char)(0x80 | ((utf32 >> 6) & 0x3F));
+        pUTF8Out[2] = (char)(0x80 | (utf32 & 0x3F));
+        return 3;
+    }
+
+    pUTF8Out[0] = (char)(0xF0 | (utf32 >> 18));
+    pUTF8Out[1] = (char)(0x80 | ((utf32 >> 12) & 0x3F));
+    pUTF8Out[2] = (char)(0x80 | ((utf32 >> 6) & 0x3F));
+    pUTF8Out[3] = (char)(0x80 | (utf32 & 0x3F));
+    return 4;
+}
+
+// Validates the given UTF-8 text and counts the code points in it. Bytes that are not part of a valid sequence count as one
+// code point each, which is consistent with drte_utf8_decode(). Returns DRTE_TRUE if the text is valid.
+//
+// This is run over all text as it's inserted, which includes whole files when they're loaded. Most text is mostly ASCII so
+// ASCII runs are skipped 16 bytes at a time with SSE2, or 8 bytes at a time with plain 64-bit integers when SSE2 is not
+// available. Multi-byte sequences go through the scalar decoder.
+drte_bool32 drte_utf8_validate(const char* pText, size_t textLength, size_t* pCodePointCountOut, drte_bool32* pIsASCIIOut)
+{
+    size_t codePointCount = 0;
+    drte_bool32 isValid = DRTE_TRUE;
+    drte_bool32 isASCII = DRTE_TRUE;
+
+    size_t i = 0;
+    while (i < textLength) {
+#ifdef DRTE_SUPPORT_SSE2
+        if (textLength - i >= 16) {
+            __m128i block = _mm_loadu_si128((const __m128i*)(pText + i));
+            if (_mm_movemask_epi8(block) == 0) {
+                i += 16;
+                codePointCount += 16;
+                continue;
+            }
+        }
+#else
+        if (textLength - i >= 8) {
+            uint64_t block;
+            memcpy(&block, pText + i, 8);
+            if ((block & 0x8080808080808080ULL) == 0) {
+                i += 8;
+                codePointCount += 8;
+                continue;
+            }
+        }
+#endif
+
+        if ((unsigned char)pText[i] < 0x80) {
+            i += 1;
+            codePointCount += 1;
+            continue;
+        }
+
+        // Every valid multi-byte sequence is at least two bytes so a length of one means it was invalid.
+        uint32_t utf32;
+        size_t length = drte_utf8_decode(pText + i, textLength - i, &utf32);
+        if (length == 1) {
+            isValid = DRTE_FALSE;
+        }
+
+        isASCII = DRTE_FALSE;
+        i += length;
+        codePointCount += 1;
+    }
+
+    if (pCodePointCountOut) *pCodePointCountOut = codePointCount;
+    if (pIsASCIIOut) *pIsASCIIOut = isASCII;
+    return isValid;
 }
 
 // Helper for constructing a region.
@@ -1357,194 +1701,471 @@ drte_style_token drte_engine__get_style_token(drte_engine* pEngine, uint8_t styl
     return pEngine->styles[styleSlot].styleToken;
 }
 
-// Retrieves the next selection region starting from the given character, including the region the character is sitting in, if any.
-static drte_bool32 drte_view__get_next_selection_from_character(drte_view* pView, size_t iChar, drte_region* pSelectionOut)
+//// Cursor and Selection Indices ////
+
+drte_bool32 drte_view__reserve_cursors(drte_view* pView, size_t cursorCount)
 {
     assert(pView != NULL);
-    assert(pSelectionOut != NULL);
-
-    // Selections can be in any order. Need to first check every single one to determine if any are on top of the character. If so we
-    // just return the first one. Otherwise we fall through to the next loop which finds the closest selection to the character.
-    drte_bool32 foundSelectionAfterChar = DRTE_FALSE;
-    drte_region closestSelection;
-    closestSelection.iCharBeg = (size_t)-1;
-    closestSelection.iCharEnd = (size_t)-1;
 
-    for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
-        drte_region selection = drte_region_normalize(pView->pSelections[iSelection]);
-        if (iChar >= selection.iCharBeg && iChar < selection.iCharEnd) {
-            *pSelectionOut = selection;
-            return DRTE_TRUE;
-        }
+    if (cursorCount <= pView->_cursorBufferSize) {
+        return DRTE_TRUE;
+    }
 
-        if (selection.iCharBeg > iChar) {
-            foundSelectionAfterChar = DRTE_TRUE;
-            if (closestSelection.iCharBeg > selection.iCharBeg) {
-                closestSelection = selection;
-            }
-        }
+    size_t newBufferSize = (pView->_cursorBufferSize == 0) ? 16 : pView->_cursorBufferSize*2;
+    while (newBufferSize < cursorCount) {
+        newBufferSize *= 2;
     }
 
+    drte_cursor* pNewCursors = (drte_cursor*)realloc(pView->pCursors, newBufferSize * sizeof(*pNewCursors));
+    if (pNewCursors == NULL) {
+        return DRTE_FALSE;
+    }
+    pView->pCursors = pNewCursors;
 
-    if (foundSelectionAfterChar) {
-        *pSelectionOut = closestSelection;
+    drte_index_entry* pNewIndex = (drte_index_entry*)realloc(pView->_pCursorIndex, newBufferSize * sizeof(*pNewIndex));
+    if (pNewIndex == NULL) {
+        return DRTE_FALSE;
     }
+    pView->_pCursorIndex = pNewIndex;
 
-    return foundSelectionAfterChar;
+    pView->_cursorBufferSize = newBufferSize;
+    return DRTE_TRUE;
 }
 
+drte_bool32 drte_view__reserve_selections(drte_view* pView, size_t selectionCount)
+{
+    assert(pView != NULL);
 
+    if (selectionCount <= pView->_selectionBufferSize) {
+        return DRTE_TRUE;
+    }
 
-//// Line Cache ////
+    size_t newBufferSize = (pView->_selectionBufferSize == 0) ? 16 : pView->_selectionBufferSize*2;
+    while (newBufferSize < selectionCount) {
+        newBufferSize *= 2;
+    }
 
-drte_bool32 drte_line_cache_init(drte_line_cache* pLineCache)
-{
-    if (pLineCache == NULL) {
+    drte_region* pNewSelections = (drte_region*)realloc(pView->pSelections, newBufferSize * sizeof(*pNewSelections));
+    if (pNewSelections == NULL) {
         return DRTE_FALSE;
     }
+    pView->pSelections = pNewSelections;
 
-    // There's always at least one line.
-    pLineCache->bufferSize = DRTE_PAGE_LINE_COUNT;
-    pLineCache->pLines = (size_t*)calloc(pLineCache->bufferSize, sizeof(*pLineCache->pLines));   // <-- calloc() is important here. It initializes the first line to 0.
-    pLineCache->count = 1;
+    drte_index_entry* pNewIndex = (drte_index_entry*)realloc(pView->_pSelectionIndex, newBufferSize * sizeof(*pNewIndex));
+    if (pNewIndex == NULL) {
+        return DRTE_FALSE;
+    }
+    pView->_pSelectionIndex = pNewIndex;
 
+    pView->_selectionBufferSize = newBufferSize;
     return DRTE_TRUE;
 }
 
-void drte_line_cache_uninit(drte_line_cache* pLineCache)
+int drte_index_entry__compare(const void* a, const void* b)
 {
-    if (pLineCache == NULL) {
-        return;
-    }
+    const drte_index_entry* pEntryA = (const drte_index_entry*)a;
+    const drte_index_entry* pEntryB = (const drte_index_entry*)b;
 
-    free(pLineCache->pLines);
+    // Ties are broken by index so that when multiple cursors or selections share a position the earliest one comes first.
+    if (pEntryA->iChar != pEntryB->iChar) {
+        return (pEntryA->iChar < pEntryB->iChar) ? -1 : 1;
+    }
+    if (pEntryA->index != pEntryB->index) {
+        return (pEntryA->index < pEntryB->index) ? -1 : 1;
+    }
 
-    // It's important to clear everything to zero in case this is called multiple times after each other which is abolutely possible.
-    pLineCache->pLines = NULL;
-    pLineCache->bufferSize = 0;
-    pLineCache->count = 0;
+    return 0;
 }
 
-size_t drte_line_cache_get_line_count(drte_line_cache* pLineCache)
+// Retrieves the first entry positioned at or after the given character. Returns entryCount if there is no such entry.
+size_t drte_index__find_first_entry_at_or_after(const drte_index_entry* pEntries, size_t entryCount, size_t iChar)
 {
-    if (pLineCache == NULL) {
-        return 0;
+    size_t iEntryBeg = 0;
+    size_t iEntryEnd = entryCount;
+    while (iEntryBeg < iEntryEnd) {
+        size_t iEntryMid = iEntryBeg + (iEntryEnd - iEntryBeg)/2;
+        if (pEntries[iEntryMid].iChar < iChar) {
+            iEntryBeg = iEntryMid + 1;
+        } else {
+            iEntryEnd = iEntryMid;
+        }
     }
 
-    return pLineCache->count;
+    return iEntryBeg;
 }
 
-
-size_t drte_line_cache_get_line_first_character(drte_line_cache* pLineCache, size_t iLine)
+void drte_view__update_cursor_index(drte_view* pView)
 {
-    if (pLineCache == NULL || iLine >= pLineCache->count) {
-        return 0;
+    assert(pView != NULL);
+
+    if (pView->_isCursorIndexValid) {
+        return;
     }
 
-    return pLineCache->pLines[iLine];
-}
+    for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+        pView->_pCursorIndex[iCursor].iChar       = pView->pCursors[iCursor].iCharAbs;
+        pView->_pCursorIndex[iCursor].iCharMaxEnd = pView->pCursors[iCursor].iCharAbs;
+        pView->_pCursorIndex[iCursor].index       = iCursor;
+    }
 
-void drte_line_cache_set_line_first_character(drte_line_cache* pLineCache, size_t iLine, size_t iCharBeg)
-{
-    if (pLineCache == NULL || iLine >= pLineCache->count) {
-        return;
+    if (pView->cursorCount > 1) {
+        qsort(pView->_pCursorIndex, pView->cursorCount, sizeof(*pView->_pCursorIndex), drte_index_entry__compare);
     }
 
-    pLineCache->pLines[iLine] = iCharBeg;
+    pView->_isCursorIndexValid = DRTE_TRUE;
 }
 
-drte_bool32 drte_line_cache_insert_lines(drte_line_cache* pLineCache, size_t insertLineIndex, size_t lineCount, size_t characterOffset)
+void drte_view__update_selection_index(drte_view* pView)
 {
-    if (pLineCache == NULL || insertLineIndex > pLineCache->count) {
-        return DRTE_FALSE;
-    }
+    assert(pView != NULL);
 
-    size_t newLineCount = pLineCache->count + lineCount;
+    if (pView->_isSelectionIndexValid) {
+        return;
+    }
 
-    if (newLineCount >= pLineCache->bufferSize) {
-        size_t newLineBufferSize = (pLineCache->bufferSize == 0) ? DRTE_PAGE_LINE_COUNT : drte_round_up(newLineCount, DRTE_PAGE_LINE_COUNT);
-        size_t* pNewLines = (size_t*)realloc(pLineCache->pLines, newLineBufferSize * sizeof(*pNewLines));
-        if (pNewLines == NULL) {
-            return DRTE_FALSE;   // Ran out of memory?
-        }
+    for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
+        drte_region selection = drte_region_normalize(pView->pSelections[iSelection]);
+        pView->_pSelectionIndex[iSelection].iChar       = selection.iCharBeg;
+        pView->_pSelectionIndex[iSelection].iCharMaxEnd = selection.iCharEnd;
+        pView->_pSelectionIndex[iSelection].index       = iSelection;
+    }
 
-        pLineCache->bufferSize = newLineBufferSize;
-        pLineCache->pLines = pNewLines;
+    if (pView->selectionCount > 1) {
+        qsort(pView->_pSelectionIndex, pView->selectionCount, sizeof(*pView->_pSelectionIndex), drte_index_entry__compare);
     }
 
-    // All existing lines coming after the line the text was inserted at need to be moved down newLineCount slots. They also need to have their
-    // first character index updated.
-    for (size_t i = pLineCache->count; i > insertLineIndex; --i) {
-        size_t iSrc = i-1;
-        size_t iDst = iSrc + lineCount;
-        pLineCache->pLines[iDst] = pLineCache->pLines[iSrc] + characterOffset;
+    for (size_t iEntry = 1; iEntry < pView->selectionCount; ++iEntry) {
+        pView->_pSelectionIndex[iEntry].iCharMaxEnd = drte_max(pView->_pSelectionIndex[iEntry].iCharMaxEnd, pView->_pSelectionIndex[iEntry-1].iCharMaxEnd);
     }
 
-    pLineCache->count = newLineCount;
-    return DRTE_TRUE;
+    pView->_isSelectionIndexValid = DRTE_TRUE;
 }
 
-drte_bool32 drte_line_cache_append_line(drte_line_cache* pLineCache, size_t iLineCharBeg)
+// Called after a cursor has been added to the end of the list. When the new cursor is at or after every other cursor it can
+// be appended to the index without needing a rebuild.
+void drte_view__on_cursor_appended(drte_view* pView, drte_bool32 wasIndexValid)
 {
-    size_t lineCount = drte_line_cache_get_line_count(pLineCache);
-    if (!drte_line_cache_insert_lines(pLineCache, lineCount, 1, 0)) {
-        return DRTE_FALSE;
+    assert(pView != NULL);
+    assert(pView->cursorCount > 0);
+
+    size_t iCursor = pView->cursorCount-1;
+    size_t iChar = pView->pCursors[iCursor].iCharAbs;
+    if (wasIndexValid && (iCursor == 0 || pView->_pCursorIndex[iCursor-1].iChar <= iChar)) {
+        pView->_pCursorIndex[iCursor].iChar       = iChar;
+        pView->_pCursorIndex[iCursor].iCharMaxEnd = iChar;
+        pView->_pCursorIndex[iCursor].index       = iCursor;
+        pView->_isCursorIndexValid = DRTE_TRUE;
+    } else {
+        pView->_isCursorIndexValid = DRTE_FALSE;
     }
-
-    drte_line_cache_set_line_first_character(pLineCache, lineCount, iLineCharBeg);
-    return DRTE_TRUE;
 }
 
-drte_bool32 drte_line_cache_remove_lines(drte_line_cache* pLineCache, size_t firstLineIndex, size_t lineCount, size_t characterOffset)
+// Called after the last selection has been added or changed. As with cursors, the index is updated in place when the
+// selection's position in the index is not affected.
+void drte_view__on_last_selection_changed(drte_view* pView, drte_bool32 isNewSelection)
 {
-    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
-        return DRTE_FALSE;
+    assert(pView != NULL);
+    assert(pView->selectionCount > 0);
+
+    if (!pView->_isSelectionIndexValid) {
+        return;
     }
 
-    if (pLineCache->count <= lineCount) {
-        pLineCache->count = 1;
-    } else {
-        for (size_t i = firstLineIndex; i < (pLineCache->count - lineCount); ++i) {
-            size_t iDst = i;
-            size_t iSrc = i + lineCount;
-            pLineCache->pLines[iDst] = pLineCache->pLines[iSrc] - characterOffset;
-        }
+    size_t iSelection = pView->selectionCount-1;
+    if (!isNewSelection && pView->_pSelectionIndex[iSelection].index != iSelection) {
+        pView->_isSelectionIndexValid = DRTE_FALSE;
+        return;
+    }
 
-        pLineCache->count -= lineCount;
+    drte_region selection = drte_region_normalize(pView->pSelections[iSelection]);
+    if (iSelection > 0 && pView->_pSelectionIndex[iSelection-1].iChar > selection.iCharBeg) {
+        pView->_isSelectionIndexValid = DRTE_FALSE;
+        return;
     }
 
-    return DRTE_TRUE;
+    pView->_pSelectionIndex[iSelection].iChar       = selection.iCharBeg;
+    pView->_pSelectionIndex[iSelection].iCharMaxEnd = (iSelection > 0) ? drte_max(selection.iCharEnd, pView->_pSelectionIndex[iSelection-1].iCharMaxEnd) : selection.iCharEnd;
+    pView->_pSelectionIndex[iSelection].index       = iSelection;
 }
 
-drte_bool32 drte_line_cache_offset_lines(drte_line_cache* pLineCache, size_t firstLineIndex, size_t characterOffset)
+// Finds a selection containing the given character. If multiple selections contain the character it is undefined which one
+// is returned.
+drte_bool32 drte_view__find_selection_containing_character(drte_view* pView, size_t iChar, size_t* piSelectionOut)
 {
-    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
-        return DRTE_FALSE;
-    }
+    assert(pView != NULL);
 
-    for (size_t iLine = firstLineIndex; iLine < pLineCache->count; ++iLine) {
-        pLineCache->pLines[iLine] += characterOffset;
+    drte_view__update_selection_index(pView);
+
+    // The last entry starting at or before the character. If the furthest end point up to and including that entry is after
+    // the character then at least one of those entries contains it. This will almost always be the entry itself.
+    size_t iEntry = drte_index__find_first_entry_at_or_after(pView->_pSelectionIndex, pView->selectionCount, iChar+1);
+    while (iEntry > 0 && pView->_pSelectionIndex[iEntry-1].iCharMaxEnd > iChar) {
+        iEntry -= 1;
+
+        drte_region selection = drte_region_normalize(pView->pSelections[pView->_pSelectionIndex[iEntry].index]);
+        if (iChar < selection.iCharEnd) {
+            if (piSelectionOut) *piSelectionOut = pView->_pSelectionIndex[iEntry].index;
+            return DRTE_TRUE;
+        }
     }
 
-    return DRTE_TRUE;
+    return DRTE_FALSE;
 }
 
-drte_bool32 drte_line_cache_offset_lines_negative(drte_line_cache* pLineCache, size_t firstLineIndex, size_t characterOffset)
+// Retrieves the range of the rectangle selection on the given line. The range of the most recently requested line is cached.
+static drte_bool32 drte_view__get_rect_selection_on_line(drte_view* pView, size_t iLine, drte_region* pRegionOut)
 {
-    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
+    assert(pView != NULL);
+    assert(pRegionOut != NULL);
+
+    if (!pView->hasRectSelection || pView->_isCalculatingRectSelection || iLine < pView->rectSelectionLineBeg || iLine > pView->rectSelectionLineEnd) {
         return DRTE_FALSE;
     }
 
-    for (size_t iLine = firstLineIndex; iLine < pLineCache->count; ++iLine) {
-        pLineCache->pLines[iLine] -= characterOffset;
-    }
+    size_t iLineCharBeg;
+    size_t iLineCharEnd;
+    drte_view_get_line_character_range(pView, pView->pWrappedLines, iLine, &iLineCharBeg, &iLineCharEnd);
 
-    return DRTE_TRUE;
-}
+    if (pView->_isRectSelectionCacheValid && pView->_rectSelectionCachedLine == iLine && pView->_rectSelectionCachedLineCharBeg == iLineCharBeg && pView->_rectSelectionCachedLineCharEnd == iLineCharEnd) {
+        *pRegionOut = pView->_rectSelectionCachedRegion;
+        return DRTE_TRUE;
+    }
 
+    // The characters are found the same way as when clicking on the line, using the middle of the line for the y position.
+    float linePosY = (iLine + 0.5f) * drte_engine_get_line_height(pView->pEngine);
 
-size_t drte_line_cache_find_line_by_character__internal(drte_line_cache* pLineCache, size_t iChar, size_t iLineBeg, size_t iLineEnd)
-{
+    size_t iCharBeg;
+    size_t iCharEnd;
+    pView->_isCalculatingRectSelection = DRTE_TRUE;
+    {
+        drte_view_get_character_under_point_relative_to_text(pView, pView->pWrappedLines, pView->rectSelectionPosXBeg, linePosY, &iCharBeg, NULL);
+        drte_view_get_character_under_point_relative_to_text(pView, pView->pWrappedLines, pView->rectSelectionPosXEnd, linePosY, &iCharEnd, NULL);
+    }
+    pView->_isCalculatingRectSelection = DRTE_FALSE;
+
+    pView->_rectSelectionCachedLine = iLine;
+    pView->_rectSelectionCachedLineCharBeg = iLineCharBeg;
+    pView->_rectSelectionCachedLineCharEnd = iLineCharEnd;
+    pView->_rectSelectionCachedRegion = drte_region_normalize(drte_make_region(iCharBeg, iCharEnd));
+    pView->_isRectSelectionCacheValid = DRTE_TRUE;
+
+    *pRegionOut = pView->_rectSelectionCachedRegion;
+    return DRTE_TRUE;
+}
+
+// Retrieves the range of the rectangle selection on the line containing the given character if it's not empty and does not
+// end before the character.
+static drte_bool32 drte_view__get_rect_selection_from_character(drte_view* pView, size_t iChar, drte_region* pRegionOut)
+{
+    assert(pView != NULL);
+    assert(pRegionOut != NULL);
+
+    if (!pView->hasRectSelection || pView->_isCalculatingRectSelection) {
+        return DRTE_FALSE;
+    }
+
+    // The character will almost always be on the cached line, which saves searching the line cache.
+    size_t iLine;
+    if (pView->_isRectSelectionCacheValid && iChar >= pView->_rectSelectionCachedLineCharBeg && iChar < pView->_rectSelectionCachedLineCharEnd) {
+        iLine = pView->_rectSelectionCachedLine;
+    } else {
+        iLine = drte_view_get_character_line(pView, pView->pWrappedLines, iChar);
+    }
+
+    drte_region region;
+    if (!drte_view__get_rect_selection_on_line(pView, iLine, &region) || region.iCharBeg == region.iCharEnd || region.iCharEnd <= iChar) {
+        return DRTE_FALSE;
+    }
+
+    *pRegionOut = region;
+    return DRTE_TRUE;
+}
+
+// Retrieves the next selection region starting from the given character, including the region the character is sitting in, if any.
+static drte_bool32 drte_view__get_next_selection_from_character(drte_view* pView, size_t iChar, drte_region* pSelectionOut)
+{
+    assert(pView != NULL);
+    assert(pSelectionOut != NULL);
+
+    drte_bool32 hasSelection = DRTE_FALSE;
+    size_t iSelection;
+    if (drte_view__find_selection_containing_character(pView, iChar, &iSelection)) {
+        *pSelectionOut = drte_region_normalize(pView->pSelections[iSelection]);
+        return DRTE_TRUE;
+    }
+
+    // Nothing is on top of the character so we just use the closest selection after it.
+    size_t iEntry = drte_index__find_first_entry_at_or_after(pView->_pSelectionIndex, pView->selectionCount, iChar+1);
+    if (iEntry < pView->selectionCount) {
+        *pSelectionOut = drte_region_normalize(pView->pSelections[pView->_pSelectionIndex[iEntry].index]);
+        hasSelection = DRTE_TRUE;
+    }
+
+    // The rectangle selection is only ever checked on the character's own line. That's enough for segments since they never
+    // cross lines.
+    drte_region rectSelection;
+    if (drte_view__get_rect_selection_from_character(pView, iChar, &rectSelection)) {
+        if (!hasSelection || rectSelection.iCharBeg <= iChar || rectSelection.iCharBeg < pSelectionOut->iCharBeg) {
+            *pSelectionOut = rectSelection;
+            hasSelection = DRTE_TRUE;
+        }
+    }
+
+    return hasSelection;
+}
+
+
+
+//// Line Cache ////
+
+drte_bool32 drte_line_cache_init(drte_line_cache* pLineCache)
+{
+    if (pLineCache == NULL) {
+        return DRTE_FALSE;
+    }
+
+    // There's always at least one line.
+    pLineCache->bufferSize = DRTE_PAGE_LINE_COUNT;
+    pLineCache->pLines = (size_t*)calloc(pLineCache->bufferSize, sizeof(*pLineCache->pLines));   // <-- calloc() is important here. It initializes the first line to 0.
+    pLineCache->count = 1;
+
+    return DRTE_TRUE;
+}
+
+void drte_line_cache_uninit(drte_line_cache* pLineCache)
+{
+    if (pLineCache == NULL) {
+        return;
+    }
+
+    free(pLineCache->pLines);
+
+    // It's important to clear everything to zero in case this is called multiple times after each other which is abolutely possible.
+    pLineCache->pLines = NULL;
+    pLineCache->bufferSize = 0;
+    pLineCache->count = 0;
+}
+
+size_t drte_line_cache_get_line_count(drte_line_cache* pLineCache)
+{
+    if (pLineCache == NULL) {
+        return 0;
+    }
+
+    return pLineCache->count;
+}
+
+
+size_t drte_line_cache_get_line_first_character(drte_line_cache* pLineCache, size_t iLine)
+{
+    if (pLineCache == NULL || iLine >= pLineCache->count) {
+        return 0;
+    }
+
+    return pLineCache->pLines[iLine];
+}
+
+void drte_line_cache_set_line_first_character(drte_line_cache* pLineCache, size_t iLine, size_t iCharBeg)
+{
+    if (pLineCache == NULL || iLine >= pLineCache->count) {
+        return;
+    }
+
+    pLineCache->pLines[iLine] = iCharBeg;
+}
+
+drte_bool32 drte_line_cache_insert_lines(drte_line_cache* pLineCache, size_t insertLineIndex, size_t lineCount, size_t characterOffset)
+{
+    if (pLineCache == NULL || insertLineIndex > pLineCache->count) {
+        return DRTE_FALSE;
+    }
+
+    size_t newLineCount = pLineCache->count + lineCount;
+
+    if (newLineCount >= pLineCache->bufferSize) {
+        size_t newLineBufferSize = (pLineCache->bufferSize == 0) ? DRTE_PAGE_LINE_COUNT : drte_round_up(newLineCount, DRTE_PAGE_LINE_COUNT);
+        size_t* pNewLines = (size_t*)realloc(pLineCache->pLines, newLineBufferSize * sizeof(*pNewLines));
+        if (pNewLines == NULL) {
+            return DRTE_FALSE;   // Ran out of memory?
+        }
+
+        pLineCache->bufferSize = newLineBufferSize;
+        pLineCache->pLines = pNewLines;
+    }
+
+    // All existing lines coming after the line the text was inserted at need to be moved down newLineCount slots. They also need to have their
+    // first character index updated.
+    for (size_t i = pLineCache->count; i > insertLineIndex; --i) {
+        size_t iSrc = i-1;
+        size_t iDst = iSrc + lineCount;
+        pLineCache->pLines[iDst] = pLineCache->pLines[iSrc] + characterOffset;
+    }
+
+    pLineCache->count = newLineCount;
+    return DRTE_TRUE;
+}
+
+drte_bool32 drte_line_cache_append_line(drte_line_cache* pLineCache, size_t iLineCharBeg)
+{
+    size_t lineCount = drte_line_cache_get_line_count(pLineCache);
+    if (!drte_line_cache_insert_lines(pLineCache, lineCount, 1, 0)) {
+        return DRTE_FALSE;
+    }
+
+    drte_line_cache_set_line_first_character(pLineCache, lineCount, iLineCharBeg);
+    return DRTE_TRUE;
+}
+
+drte_bool32 drte_line_cache_remove_lines(drte_line_cache* pLineCache, size_t firstLineIndex, size_t lineCount, size_t characterOffset)
+{
+    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
+        return DRTE_FALSE;
+    }
+
+    if (pLineCache->count <= lineCount) {
+        pLineCache->count = 1;
+    } else {
+        for (size_t i = firstLineIndex; i < (pLineCache->count - lineCount); ++i) {
+            size_t iDst = i;
+            size_t iSrc = i + lineCount;
+            pLineCache->pLines[iDst] = pLineCache->pLines[iSrc] - characterOffset;
+        }
+
+        pLineCache->count -= lineCount;
+    }
+
+    return DRTE_TRUE;
+}
+
+drte_bool32 drte_line_cache_offset_lines(drte_line_cache* pLineCache, size_t firstLineIndex, size_t characterOffset)
+{
+    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
+        return DRTE_FALSE;
+    }
+
+    for (size_t iLine = firstLineIndex; iLine < pLineCache->count; ++iLine) {
+        pLineCache->pLines[iLine] += characterOffset;
+    }
+
+    return DRTE_TRUE;
+}
+
+drte_bool32 drte_line_cache_offset_lines_negative(drte_line_cache* pLineCache, size_t firstLineIndex, size_t characterOffset)
+{
+    if (pLineCache == NULL || firstLineIndex >= pLineCache->count) {
+        return DRTE_FALSE;
+    }
+
+    for (size_t iLine = firstLineIndex; iLine < pLineCache->count; ++iLine) {
+        pLineCache->pLines[iLine] -= characterOffset;
+    }
+
+    return DRTE_TRUE;
+}
+
+
+size_t drte_line_cache_find_line_by_character__internal(drte_line_cache* pLineCache, size_t iChar, size_t iLineBeg, size_t iLineEnd)
+{
     assert(pLineCache != NULL);
 
     if ((iLineBeg+1 == iLineEnd) || (iChar >= pLineCache->pLines[iLineBeg] && iChar < pLineCache->pLines[iLineBeg+1])) {
@@ -1659,7 +2280,9 @@ drte_bool32 drte_engine__next_segment(drte_view* pView, drte_segment* pSegment)
     drte_engine* pEngine = pView->pEngine;
     assert(pEngine != NULL);
 
-    // TODO: Handle UTF-8 properly.
+    // Segments are found by scanning bytes, but every boundary a segment can be clamped to (line endings, tabs, selections and
+    // highlights) is on a code point boundary so a segment never splits a multi-byte sequence.
+    //
     // TODO: There is LOTS of optimization opportunity in this function.
 
     // The next segment is clamped to a specific character with the following priorities, from highest priority to lowest
@@ -1995,6 +2618,60 @@ void drte_engine__push_text_change_to_prepared_undo_state(drte_engine* pEngine,
     *((size_t*)drte_stack_buffer_get_data_ptr(&pEngine->preparedUndoState, pEngine->preparedUndoTextChangesOffset)) += 1;
 }
 
+// Batches are stored as a single change so that undoing and redoing them is a single pass over the text rather than one pass
+// per edit. The layout is:
+//   type, editCount, payloadSize, [iCharBeg, iCharEnd, newTextLength][editCount], old texts, new texts
+// where every text is null terminated, and positions are relative to the text before the batch was applied.
+void drte_engine__push_batch_to_prepared_undo_state(drte_engine* pEngine, size_t editCount, const drte_edit* pEdits, const size_t* pNewTextLengths)
+{
+    if (pEngine == NULL || editCount == 0) {
+        return;
+    }
+
+    size_t payloadSize = editCount * sizeof(size_t)*3;
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        payloadSize += (pEdits[iEdit].iCharEnd - pEdits[iEdit].iCharBeg) + 1;
+        payloadSize += pNewTextLengths[iEdit] + 1;
+    }
+
+    drte_undo_change_type type = drte_undo_change_type_batch;
+    size_t headerSize = sizeof(type) + sizeof(size_t) + sizeof(size_t);
+
+    uint8_t* pData = (uint8_t*)drte_stack_buffer_alloc(&pEngine->preparedUndoState, headerSize + payloadSize);
+    if (pData == NULL) {
+        return;
+    }
+
+    memcpy(pData, &type, sizeof(type));
+    memcpy(pData + sizeof(type), &editCount, sizeof(editCount));
+    memcpy(pData + sizeof(type) + sizeof(editCount), &payloadSize, sizeof(payloadSize));
+
+    uint8_t* pRanges = pData + headerSize;
+    char* pText = (char*)(pRanges + editCount * sizeof(size_t)*3);
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        size_t range[3];
+        range[0] = pEdits[iEdit].iCharBeg;
+        range[1] = pEdits[iEdit].iCharEnd;
+        range[2] = pNewTextLengths[iEdit];
+        memcpy(pRanges + iEdit * sizeof(range), range, sizeof(range));
+
+        size_t oldTextLength = pEdits[iEdit].iCharEnd - pEdits[iEdit].iCharBeg;
+        memcpy(pText, pEngine->text + pEdits[iEdit].iCharBeg, oldTextLength);
+        pText[oldTextLength] = '\0';
+        pText += oldTextLength + 1;
+    }
+
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        if (pNewTextLengths[iEdit] > 0) {
+            memcpy(pText, pEdits[iEdit].text, pNewTextLengths[iEdit]);
+        }
+        pText[pNewTextLengths[iEdit]] = '\0';
+        pText += pNewTextLengths[iEdit] + 1;
+    }
+
+    *((size_t*)drte_stack_buffer_get_data_ptr(&pEngine->preparedUndoState, pEngine->preparedUndoTextChangesOffset)) += 1;
+}
+
 
 drte_bool32 drte_engine_init(drte_engine* pEngine, void* pUserData)
 {
@@ -2021,6 +2698,8 @@ drte_bool32 drte_engine_init(drte_engine* pEngine, void* pUserData)
     pEngine->cursorBlinkRate       = 500;
     pEngine->timeToNextCursorBlink = pEngine->cursorBlinkRate;
     pEngine->isCursorBlinkOn       = DRTE_TRUE;
+    pEngine->isTextASCII           = DRTE_TRUE;
+    pEngine->isTextValidUTF8       = DRTE_TRUE;
     pEngine->pUserData             = pUserData;
 
     drte_stack_buffer_init(&pEngine->preparedUndoState);
@@ -2052,6 +2731,14 @@ void drte_engine_uninit(drte_engine* pEngine)
 
     drte_line_cache_uninit(&pEngine->_unwrappedLines);
 
+    if (pEngine->_pColumnIndex != NULL) {
+        for (size_t iSlot = 0; iSlot < DRTE_COLUMN_INDEX_SLOT_COUNT; ++iSlot) {
+            free(pEngine->_pColumnIndex[iSlot].pCheckpoints);
+        }
+
+        free(pEngine->_pColumnIndex);
+    }
+
     //free(pEngine->pView->pSelections);
     //free(pEngine->pView->pCursors);
 
@@ -2069,6 +2756,38 @@ size_t drte_engine_get_view_count(drte_engine* pEngine)
     return count;
 }
 
+size_t drte_engine_get_memory_usage(drte_engine* pEngine)
+{
+    if (pEngine == NULL) {
+        return 0;
+    }
+
+    size_t size = sizeof(*pEngine);
+    size += pEngine->textLength + 1;
+    size += pEngine->_unwrappedLines.bufferSize * sizeof(*pEngine->_unwrappedLines.pLines);
+    size += pEngine->undoBuffer.bufferSize;
+    size += pEngine->preparedUndoState.bufferSize;
+
+    if (pEngine->_pColumnIndex != NULL) {
+        for (size_t iSlot = 0; iSlot < DRTE_COLUMN_INDEX_SLOT_COUNT; ++iSlot) {
+            size += sizeof(*pEngine->_pColumnIndex) + pEngine->_pColumnIndex[iSlot].checkpointCapacity * sizeof(size_t);
+        }
+    }
+
+    for (drte_view* pView = drte_engine_first_view(pEngine); pView != NULL; pView = drte_view_next_view(pView)) {
+        size += sizeof(*pView);
+        size += pView->_cursorBufferSize    * (sizeof(*pView->pCursors)    + sizeof(*pView->_pCursorIndex));
+        size += pView->_selectionBufferSize * (sizeof(*pView->pSelections) + sizeof(*pView->_pSelectionIndex));
+
+        // The wrapped line cache is shared with the engine when word wrap is disabled.
+        if (pView->pWrappedLines == &pView->_wrappedLines) {
+            size += pView->_wrappedLines.bufferSize * sizeof(*pView->_wrappedLines.pLines);
+        }
+    }
+
+    return size;
+}
+
 
 drte_bool32 drte_engine_register_style_token(drte_engine* pEngine, drte_style_token styleToken, drte_font_metrics fontMetrics)
 {
@@ -2259,13 +2978,288 @@ float drte_engine_get_line_height(drte_engine* pEngine)
 
 
 uint32_t drte_engine_get_utf32(drte_engine* pEngine, size_t characterIndex)
+{
+    if (pEngine == NULL || characterIndex >= pEngine->textLength) {
+        return 0;
+    }
+
+    uint32_t utf32;
+    drte_utf8_decode(pEngine->text + characterIndex, pEngine->textLength - characterIndex, &utf32);
+
+    return utf32;
+}
+
+size_t drte_engine_get_next_character(drte_engine* pEngine, size_t characterIndex)
 {
     if (pEngine == NULL) {
         return 0;
     }
 
-    // TODO: Handle UTF-8 properly.
-    return pEngine->text[characterIndex];
+    if (characterIndex >= pEngine->textLength) {
+        return pEngine->textLength;
+    }
+
+    uint32_t unused;
+    return characterIndex + drte_utf8_decode(pEngine->text + characterIndex, pEngine->textLength - characterIndex, &unused);
+}
+
+size_t drte_engine_get_prev_character(drte_engine* pEngine, size_t characterIndex)
+{
+    if (pEngine == NULL || characterIndex == 0) {
+        return 0;
+    }
+
+    if (characterIndex > pEngine->textLength) {
+        characterIndex = pEngine->textLength;
+    }
+
+    // Step back over up to three continuation bytes to find the lead byte, and then make sure the sequence it starts actually
+    // ends at the input character. If it doesn't, the byte immediately before the input character is a character on it's own
+    // which is consistent with drte_engine_get_next_character().
+    size_t iLeadChar = characterIndex - 1;
+    while (iLeadChar > 0 && (characterIndex - iLeadChar) < 4 && (pEngine->text[iLeadChar] & 0xC0) == 0x80) {
+        iLeadChar -= 1;
+    }
+
+    uint32_t unused;
+    if (iLeadChar + drte_utf8_decode(pEngine->text + iLeadChar, pEngine->textLength - iLeadChar, &unused) == characterIndex) {
+        return iLeadChar;
+    }
+
+    return characterIndex - 1;
+}
+
+size_t drte_engine_get_code_point_count(drte_engine* pEngine)
+{
+    if (pEngine == NULL) {
+        return 0;
+    }
+
+    return pEngine->codePointCount;
+}
+
+drte_bool32 drte_engine_is_text_valid_utf8(drte_engine* pEngine)
+{
+    if (pEngine == NULL) {
+        return DRTE_FALSE;
+    }
+
+    return pEngine->isTextValidUTF8;
+}
+
+
+void drte_engine__invalidate_column_index(drte_engine* pEngine, size_t iLine)
+{
+    assert(pEngine != NULL);
+
+    if (pEngine->_pColumnIndex == NULL) {
+        return;
+    }
+
+    // Passing (size_t)-1 invalidates every line. This needs to be done whenever lines are added or removed since that changes
+    // the index of every line after the edit.
+    if (iLine == (size_t)-1) {
+        for (size_t iSlot = 0; iSlot < DRTE_COLUMN_INDEX_SLOT_COUNT; ++iSlot) {
+            pEngine->_pColumnIndex[iSlot].iLine = (size_t)-1;
+        }
+    } else {
+        drte_column_index_slot* pSlot = &pEngine->_pColumnIndex[iLine % DRTE_COLUMN_INDEX_SLOT_COUNT];
+        if (pSlot->iLine == iLine) {
+            pSlot->iLine = (size_t)-1;
+        }
+    }
+}
+
+void drte_engine__get_unwrapped_line_range(drte_engine* pEngine, size_t iLine, size_t* pCharBegOut, size_t* pCharEndOut)
+{
+    assert(pEngine != NULL);
+
+    size_t iLineCharBeg = drte_line_cache_get_line_first_character(pEngine->pUnwrappedLines, iLine);
+    size_t iLineCharEnd = pEngine->textLength;
+    if (iLine+1 < drte_line_cache_get_line_count(pEngine->pUnwrappedLines)) {
+        iLineCharEnd = drte_line_cache_get_line_first_character(pEngine->pUnwrappedLines, iLine+1);
+    }
+
+    // The new line characters are not part of the line.
+    if (iLineCharEnd > iLineCharBeg && pEngine->text[iLineCharEnd-1] == '\n') {
+        iLineCharEnd -= 1;
+        if (iLineCharEnd > iLineCharBeg && pEngine->text[iLineCharEnd-1] == '\r') {
+            iLineCharEnd -= 1;
+        }
+    }
+
+    *pCharBegOut = iLineCharBeg;
+    *pCharEndOut = iLineCharEnd;
+}
+
+// Walks forward over up to the given number of characters, stopping at iCharEnd.
+size_t drte_engine__walk_characters(drte_engine* pEngine, size_t iChar, size_t iCharEnd, size_t count)
+{
+    assert(pEngine != NULL);
+
+    while (count > 0 && iChar < iCharEnd) {
+        iChar = drte_engine_get_next_character(pEngine, iChar);
+        count -= 1;
+    }
+
+    return iChar;
+}
+
+drte_column_index_slot* drte_engine__get_column_index(drte_engine* pEngine, size_t iLine, size_t iLineCharBeg, size_t iLineCharEnd)
+{
+    assert(pEngine != NULL);
+
+    if (pEngine->_pColumnIndex == NULL) {
+        pEngine->_pColumnIndex = (drte_column_index_slot*)calloc(DRTE_COLUMN_INDEX_SLOT_COUNT, sizeof(*pEngine->_pColumnIndex));
+        if (pEngine->_pColumnIndex == NULL) {
+            return NULL;
+        }
+
+        for (size_t iSlot = 0; iSlot < DRTE_COLUMN_INDEX_SLOT_COUNT; ++iSlot) {
+            pEngine->_pColumnIndex[iSlot].iLine = (size_t)-1;
+        }
+    }
+
+    drte_column_index_slot* pSlot = &pEngine->_pColumnIndex[iLine % DRTE_COLUMN_INDEX_SLOT_COUNT];
+    if (pSlot->iLine == iLine) {
+        return pSlot;
+    }
+
+    // The line needs to be indexed. This is a single pass over the line.
+    pSlot->iLine = (size_t)-1;
+    pSlot->checkpointCount = 0;
+
+    size_t column = 0;
+    size_t iChar = iLineCharBeg;
+    while (iChar < iLineCharEnd) {
+        if ((column % DRTE_COLUMN_CHECKPOINT_INTERVAL) == 0) {
+            if (pSlot->checkpointCount == pSlot->checkpointCapacity) {
+                size_t newCapacity = (pSlot->checkpointCapacity == 0) ? 16 : pSlot->checkpointCapacity*2;
+                size_t* pNewCheckpoints = (size_t*)realloc(pSlot->pCheckpoints, newCapacity * sizeof(*pNewCheckpoints));
+                if (pNewCheckpoints == NULL) {
+                    return NULL;
+                }
+
+                pSlot->pCheckpoints = pNewCheckpoints;
+                pSlot->checkpointCapacity = newCapacity;
+            }
+
+            pSlot->pCheckpoints[pSlot->checkpointCount++] = iChar - iLineCharBeg;
+        }
+
+        if ((unsigned char)pEngine->text[iChar] < 0x80) {
+            iChar += 1;
+        } else {
+            iChar = drte_engine_get_next_character(pEngine, iChar);
+        }
+
+        column += 1;
+    }
+
+    pSlot->lineLength  = iLineCharEnd - iLineCharBeg;
+    pSlot->columnCount = column;
+    pSlot->iLine       = iLine;
+
+    return pSlot;
+}
+
+size_t drte_engine_get_character_column(drte_engine* pEngine, size_t characterIndex)
+{
+    if (pEngine == NULL) {
+        return 0;
+    }
+
+    if (characterIndex > pEngine->textLength) {
+        characterIndex = pEngine->textLength;
+    }
+
+    size_t iLine = drte_line_cache_find_line_by_character(pEngine->pUnwrappedLines, characterIndex);
+
+    size_t iLineCharBeg;
+    size_t iLineCharEnd;
+    drte_engine__get_unwrapped_line_range(pEngine, iLine, &iLineCharBeg, &iLineCharEnd);
+
+    if (characterIndex > iLineCharEnd) {
+        characterIndex = iLineCharEnd;  // It's on the new line characters.
+    }
+
+    size_t offset = characterIndex - iLineCharBeg;
+    if (pEngine->isTextASCII) {
+        return offset;
+    }
+
+    drte_column_index_slot* pSlot = drte_engine__get_column_index(pEngine, iLine, iLineCharBeg, iLineCharEnd);
+    if (pSlot == NULL) {
+        // Out of memory. Fall back to walking the whole line.
+        size_t column = 0;
+        for (size_t iChar = iLineCharBeg; iChar < characterIndex; iChar = drte_engine_get_next_character(pEngine, iChar)) {
+            column += 1;
+        }
+
+        return column;
+    }
+
+    if (pSlot->columnCount == pSlot->lineLength) {
+        return offset;  // The line is all ASCII.
+    }
+
+    // Find the last checkpoint at or before the character and walk forward from there. The walk is never longer than the
+    // checkpoint interval.
+    size_t iCheckpointBeg = 0;
+    size_t iCheckpointEnd = pSlot->checkpointCount;
+    while (iCheckpointEnd - iCheckpointBeg > 1) {
+        size_t iCheckpointMid = iCheckpointBeg + (iCheckpointEnd - iCheckpointBeg)/2;
+        if (pSlot->pCheckpoints[iCheckpointMid] <= offset) {
+            iCheckpointBeg = iCheckpointMid;
+        } else {
+            iCheckpointEnd = iCheckpointMid;
+        }
+    }
+
+    size_t column = iCheckpointBeg * DRTE_COLUMN_CHECKPOINT_INTERVAL;
+    if (pSlot->checkpointCount > 0) {
+        for (size_t iChar = iLineCharBeg + pSlot->pCheckpoints[iCheckpointBeg]; iChar < characterIndex; iChar = drte_engine_get_next_character(pEngine, iChar)) {
+            column += 1;
+        }
+    }
+
+    return column;
+}
+
+size_t drte_engine_get_character_at_column(drte_engine* pEngine, size_t iLine, size_t column)
+{
+    if (pEngine == NULL) {
+        return 0;
+    }
+
+    size_t lineCount = drte_line_cache_get_line_count(pEngine->pUnwrappedLines);
+    if (iLine >= lineCount) {
+        return pEngine->textLength;
+    }
+
+    size_t iLineCharBeg;
+    size_t iLineCharEnd;
+    drte_engine__get_unwrapped_line_range(pEngine, iLine, &iLineCharBeg, &iLineCharEnd);
+
+    if (pEngine->isTextASCII) {
+        return iLineCharBeg + drte_min(column, iLineCharEnd - iLineCharBeg);
+    }
+
+    drte_column_index_slot* pSlot = drte_engine__get_column_index(pEngine, iLine, iLineCharBeg, iLineCharEnd);
+    if (pSlot == NULL) {
+        return drte_engine__walk_characters(pEngine, iLineCharBeg, iLineCharEnd, column);   // Out of memory.
+    }
+
+    if (column >= pSlot->columnCount) {
+        return iLineCharEnd;
+    }
+
+    if (pSlot->columnCount == pSlot->lineLength) {
+        return iLineCharBeg + column;   // The line is all ASCII.
+    }
+
+    size_t iCheckpoint = column / DRTE_COLUMN_CHECKPOINT_INTERVAL;
+    return drte_engine__walk_characters(pEngine, iLineCharBeg + pSlot->pCheckpoints[iCheckpoint], iLineCharEnd, column % DRTE_COLUMN_CHECKPOINT_INTERVAL);
 }
 
 
@@ -2392,14 +3386,24 @@ void drte_engine_reset_cursor_blinks(drte_engine* pEngine)
     pEngine->isCursorBlinkOn = DRTE_TRUE;
 }
 
+unsigned int drte_engine_get_time_to_next_cursor_blink(drte_engine* pEngine)
+{
+    if (pEngine == NULL) return 0;
+    return pEngine->timeToNextCursorBlink;
+}
+
+drte_bool32 drte_engine_is_cursor_blink_on(drte_engine* pEngine)
+{
+    if (pEngine == NULL) return DRTE_FALSE;
+    return pEngine->isCursorBlinkOn;
+}
+
 
 
 drte_bool32 drte_engine_insert_character(drte_engine* pEngine, size_t insertIndex, uint32_t utf32)
 {
-    // TODO: Do a proper UTF-32 -> UTF-8 conversion.
     char utf8[16];
-    utf8[0] = (char)utf32;
-    utf8[1] = '\0';
+    utf8[drte_utf8_encode(utf32, utf8)] = '\0';
 
     return drte_engine_insert_text(pEngine, utf8, insertIndex);
 }
@@ -2428,7 +3432,6 @@ drte_bool32 drte_engine_insert_text(drte_engine* pEngine, const char* text, size
     size_t iLine = drte_line_cache_find_line_by_character(pEngine->pUnwrappedLines, insertIndex);
 
 
-    // TODO: Add proper support for UTF-8.
     char* pOldText = pEngine->text;
     char* pNewText = (char*)malloc(pEngine->textLength + newTextLength + 1);   // +1 for the new character and +1 for the null terminator.
 
@@ -2466,6 +3469,20 @@ drte_bool32 drte_engine_insert_text(drte_engine* pEngine, const char* text, size
     free(pOldText);
 
 
+    // UTF-8 state. When a file is loaded this is run over the entire file.
+    size_t insertedCodePointCount;
+    drte_bool32 isInsertedTextASCII;
+    if (!drte_utf8_validate(text, newTextLength, &insertedCodePointCount, &isInsertedTextASCII)) {
+        pEngine->isTextValidUTF8 = DRTE_FALSE;
+    }
+    if (!isInsertedTextASCII) {
+        pEngine->isTextASCII = DRTE_FALSE;
+    }
+
+    pEngine->codePointCount += insertedCodePointCount;
+    drte_engine__invalidate_column_index(pEngine, (linesAddedCount > 0) ? (size_t)-1 : iLine);
+
+
     // Adjust lines.
     if (linesAddedCount > 0) {
         if (!drte_line_cache_insert_lines(pEngine->pUnwrappedLines, iLine+1, linesAddedCount, newTextLength)) {
@@ -2525,6 +3542,8 @@ drte_bool32 drte_engine_insert_text(drte_engine* pEngine, const char* text, size
                 }
             }
         }
+
+        pView->_isSelectionIndexValid = DRTE_FALSE;
     }
 
 
@@ -2630,62 +3649,278 @@ drte_bool32 drte_engine_delete_text(drte_engine* pEngine, size_t iFirstCh, size_
                     }
                 }
 
-                if (pView->pSelections[iSelection].iCharBeg < pView->pSelections[iSelection].iCharEnd) {
-                    pView->pSelections[iSelection].iCharBeg = selection.iCharBeg;
-                    pView->pSelections[iSelection].iCharEnd = selection.iCharEnd;
-                } else {
-                    pView->pSelections[iSelection].iCharBeg = selection.iCharEnd;
-                    pView->pSelections[iSelection].iCharEnd = selection.iCharBeg;
+                if (pView->pSelections[iSelection].iCharBeg < pView->pSelections[iSelection].iCharEnd) {
+                    pView->pSelections[iSelection].iCharBeg = selection.iCharBeg;
+                    pView->pSelections[iSelection].iCharEnd = selection.iCharEnd;
+                } else {
+                    pView->pSelections[iSelection].iCharBeg = selection.iCharEnd;
+                    pView->pSelections[iSelection].iCharEnd = selection.iCharBeg;
+                }
+            }
+
+            pView->_isSelectionIndexValid = DRTE_FALSE;
+        }
+
+
+
+        // Add the change to the prepared state.
+        if (pEngine->hasPreparedUndoState) {
+            drte_engine__push_text_change_to_prepared_undo_state(pEngine, drte_undo_change_type_delete, iFirstCh, iLastChPlus1, pEngine->text + iFirstCh);
+        }
+
+
+        // UTF-8 state. Deleting everything is common (it's how drte_engine_set_text() clears the old text) so that is special
+        // cased to avoid the scan.
+        if (bytesToRemove == pEngine->textLength) {
+            pEngine->codePointCount  = 0;
+            pEngine->isTextASCII     = DRTE_TRUE;
+            pEngine->isTextValidUTF8 = DRTE_TRUE;
+        } else {
+            size_t removedCodePointCount;
+            drte_utf8_validate(pEngine->text + iFirstCh, bytesToRemove, &removedCodePointCount, NULL);
+            pEngine->codePointCount -= drte_min(removedCodePointCount, pEngine->codePointCount);
+        }
+
+        drte_engine__invalidate_column_index(pEngine, (linesRemovedCount > 0) ? (size_t)-1 : iLine);
+
+
+        memmove(pEngine->text + iFirstCh, pEngine->text + iLastChPlus1, pEngine->textLength - iLastChPlus1);
+        pEngine->textLength -= bytesToRemove;
+        pEngine->text[pEngine->textLength] = '\0';
+
+        if (linesRemovedCount > 0) {
+            if (!drte_line_cache_remove_lines(pEngine->pUnwrappedLines, iLine+1, linesRemovedCount, bytesToRemove)) {
+                return DRTE_FALSE;
+            }
+        } else {
+            // No lines were removed, but we still need to update the character positions of the line cache.
+            drte_line_cache_offset_lines_negative(pEngine->pUnwrappedLines, iLine+1, bytesToRemove);
+        }
+
+
+        // Refresh the lines if line wrap is enabled.
+        // TODO: Optimize this.
+        for (drte_view* pView = drte_engine_first_view(pEngine); pView != NULL; pView = drte_view_next_view(pView)) {
+            if (drte_view_is_word_wrap_enabled(pView)) {
+                drte_view__refresh_word_wrapping(pView);    // <-- This will repaint.
+            } else {
+                // After line each cursor is sitting on may have changed.
+                for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+                    drte_view_move_cursor_to_character(pView, iCursor, pView->pCursors[iCursor].iCharAbs);
+                }
+
+                drte_view_dirty(pView, drte_view_get_local_rect(pView));
+            }
+        }
+        
+
+        if (pEngine->onTextChanged) {
+            pEngine->onTextChanged(pEngine);
+        }
+
+        return DRTE_TRUE;
+    }
+
+    return DRTE_FALSE;
+}
+
+
+size_t drte_engine__find_last_edit_at_or_before(size_t iChar, size_t editCount, const drte_edit* pEdits)
+{
+    // Binary search. Returns editCount if there are no edits at or before the character.
+    size_t iEditBeg = 0;
+    size_t iEditEnd = editCount;
+    while (iEditBeg < iEditEnd) {
+        size_t iEditMid = iEditBeg + (iEditEnd - iEditBeg)/2;
+        if (pEdits[iEditMid].iCharBeg <= iChar) {
+            iEditBeg = iEditMid + 1;
+        } else {
+            iEditEnd = iEditMid;
+        }
+    }
+
+    return (iEditBeg == 0) ? editCount : iEditBeg-1;
+}
+
+size_t drte_engine__map_character_through_edits(size_t iChar, size_t editCount, const drte_edit* pEdits, const size_t* pNewEditEnds)
+{
+    // pNewEditEnds is the position of the end of each edit after the edits have been applied. A character sitting inside a
+    // replaced range is moved to the end of the new text which is consistent with how drte_engine_insert_text() and
+    // drte_engine_delete_text() update cursors.
+    size_t iEdit = drte_engine__find_last_edit_at_or_before(iChar, editCount, pEdits);
+    if (iEdit == editCount) {
+        return iChar;
+    }
+
+    if (iChar <= pEdits[iEdit].iCharEnd) {
+        return pNewEditEnds[iEdit];
+    }
+
+    return pNewEditEnds[iEdit] + (iChar - pEdits[iEdit].iCharEnd);
+}
+
+drte_bool32 drte_engine_apply_edits(drte_engine* pEngine, size_t editCount, const drte_edit* pEdits)
+{
+    if (pEngine == NULL || editCount == 0 || pEdits == NULL) {
+        return DRTE_FALSE;
+    }
+
+    // Validation and size calculation. pNewEditEnds temporarily holds the length of each edit's text so we don't need to
+    // calculate it twice.
+    size_t* pNewEditEnds = (size_t*)malloc(editCount * sizeof(*pNewEditEnds));
+    if (pNewEditEnds == NULL) {
+        return DRTE_FALSE;
+    }
+
+    size_t newTextLength = pEngine->textLength;
+    size_t newLinesAddedCount = 0;
+    drte_bool32 isChangingText = DRTE_FALSE;
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        size_t iCharBeg = pEdits[iEdit].iCharBeg;
+        size_t iCharEnd = pEdits[iEdit].iCharEnd;
+        if (iCharBeg > iCharEnd || iCharEnd > pEngine->textLength || (iEdit > 0 && iCharBeg < pEdits[iEdit-1].iCharEnd)) {
+            free(pNewEditEnds);
+            return DRTE_FALSE;  // Unsorted or overlapping.
+        }
+
+        size_t textLength = 0;
+        if (pEdits[iEdit].text != NULL) {
+            for (const char* src = pEdits[iEdit].text; *src != '\0'; ++src) {
+                if (*src == '\n') {
+                    newLinesAddedCount += 1;
+                }
+            }
+
+            textLength = strlen(pEdits[iEdit].text);
+        }
+
+        pNewEditEnds[iEdit] = textLength;
+        newTextLength = newTextLength - (iCharEnd - iCharBeg) + textLength;
+
+        if (iCharEnd > iCharBeg || textLength > 0) {
+            isChangingText = DRTE_TRUE;
+        }
+    }
+
+    if (!isChangingText) {
+        free(pNewEditEnds);
+        return DRTE_FALSE;
+    }
+
+
+    drte_line_cache* pLineCache = pEngine->pUnwrappedLines;
+
+    size_t newLineBufferSize = drte_round_up(pLineCache->count + newLinesAddedCount + 1, DRTE_PAGE_LINE_COUNT);
+    size_t* pNewLines = (size_t*)malloc(newLineBufferSize * sizeof(*pNewLines));
+    char* pNewText = (char*)malloc(newTextLength + 1);
+    if (pNewLines == NULL || pNewText == NULL) {
+        free(pNewLines);
+        free(pNewText);
+        free(pNewEditEnds);
+        return DRTE_FALSE;
+    }
+
+
+    // The whole batch is added to the prepared state as a single change so that undo and redo can replay it in one pass.
+    if (pEngine->hasPreparedUndoState) {
+        drte_engine__push_batch_to_prepared_undo_state(pEngine, editCount, pEdits, pNewEditEnds);
+    }
+
+
+    // Build the new text and line cache in a single pass. Line starts in the unchanged segments are carried over from the old
+    // line cache, those within replaced ranges are dropped and those within the new text are added.
+    size_t newLineCount = 1;
+    pNewLines[0] = 0;
+
+    size_t iOldLine = 1;
+    size_t iSrc = 0;
+    size_t iDst = 0;
+    for (size_t iEdit = 0; iEdit <= editCount; ++iEdit) {
+        // The last iteration copies the tail of the text.
+        size_t iCharBeg = (iEdit < editCount) ? pEdits[iEdit].iCharBeg : pEngine->textLength;
+        size_t iCharEnd = (iEdit < editCount) ? pEdits[iEdit].iCharEnd : pEngine->textLength;
+
+        while (iOldLine < pLineCache->count && pLineCache->pLines[iOldLine] <= iCharBeg) {
+            pNewLines[newLineCount++] = iDst + (pLineCache->pLines[iOldLine] - iSrc);
+            iOldLine += 1;
+        }
+
+        memcpy(pNewText + iDst, pEngine->text + iSrc, iCharBeg - iSrc);
+        iDst += iCharBeg - iSrc;
+
+        while (iOldLine < pLineCache->count && pLineCache->pLines[iOldLine] <= iCharEnd) {
+            iOldLine += 1;
+        }
+
+        if (iEdit < editCount) {
+            size_t textLength = pNewEditEnds[iEdit];
+            for (size_t iChar = 0; iChar < textLength; ++iChar) {
+                if (pEdits[iEdit].text[iChar] == '\n') {
+                    pNewLines[newLineCount++] = iDst + iChar + 1;
                 }
             }
+
+            if (textLength > 0) {
+                memcpy(pNewText + iDst, pEdits[iEdit].text, textLength);
+                iDst += textLength;
+            }
+
+            pNewEditEnds[iEdit] = iDst;
         }
 
+        iSrc = iCharEnd;
+    }
 
+    assert(iDst == newTextLength);
+    pNewText[newTextLength] = '\0';
 
-        // Add the change to the prepared state.
-        if (pEngine->hasPreparedUndoState) {
-            drte_engine__push_text_change_to_prepared_undo_state(pEngine, drte_undo_change_type_delete, iFirstCh, iLastChPlus1, pEngine->text + iFirstCh);
-        }
+    free(pEngine->text);
+    pEngine->text = pNewText;
+    pEngine->textLength = newTextLength;
 
+    // The edits can be anywhere in the text so the UTF-8 state is recalculated from scratch. This is a lot cheaper than the
+    // rebuild of the text above.
+    pEngine->isTextValidUTF8 = drte_utf8_validate(pEngine->text, pEngine->textLength, &pEngine->codePointCount, &pEngine->isTextASCII);
+    drte_engine__invalidate_column_index(pEngine, (size_t)-1);
 
-        memmove(pEngine->text + iFirstCh, pEngine->text + iLastChPlus1, pEngine->textLength - iLastChPlus1);
-        pEngine->textLength -= bytesToRemove;
-        pEngine->text[pEngine->textLength] = '\0';
+    free(pLineCache->pLines);
+    pLineCache->pLines = pNewLines;
+    pLineCache->bufferSize = newLineBufferSize;
+    pLineCache->count = newLineCount;
 
-        if (linesRemovedCount > 0) {
-            if (!drte_line_cache_remove_lines(pEngine->pUnwrappedLines, iLine+1, linesRemovedCount, bytesToRemove)) {
-                return DRTE_FALSE;
-            }
-        } else {
-            // No lines were removed, but we still need to update the character positions of the line cache.
-            drte_line_cache_offset_lines_negative(pEngine->pUnwrappedLines, iLine+1, bytesToRemove);
-        }
 
+    // Selections are updated before refreshing word wrapping, but cursors need to be updated after because their line index
+    // depends on the wrapped lines.
+    for (drte_view* pView = drte_engine_first_view(pEngine); pView != NULL; pView = drte_view_next_view(pView)) {
+        drte_view_begin_dirty(pView);
 
-        // Refresh the lines if line wrap is enabled.
-        // TODO: Optimize this.
-        for (drte_view* pView = drte_engine_first_view(pEngine); pView != NULL; pView = drte_view_next_view(pView)) {
-            if (drte_view_is_word_wrap_enabled(pView)) {
-                drte_view__refresh_word_wrapping(pView);    // <-- This will repaint.
-            } else {
-                // After line each cursor is sitting on may have changed.
-                for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
-                    drte_view_move_cursor_to_character(pView, iCursor, pView->pCursors[iCursor].iCharAbs);
-                }
+        for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
+            pView->pSelections[iSelection].iCharBeg = drte_engine__map_character_through_edits(pView->pSelections[iSelection].iCharBeg, editCount, pEdits, pNewEditEnds);
+            pView->pSelections[iSelection].iCharEnd = drte_engine__map_character_through_edits(pView->pSelections[iSelection].iCharEnd, editCount, pEdits, pNewEditEnds);
+        }
 
-                drte_view_dirty(pView, drte_view_get_local_rect(pView));
-            }
+        pView->_isSelectionIndexValid = DRTE_FALSE;
+
+        if (drte_view_is_word_wrap_enabled(pView)) {
+            drte_view__refresh_word_wrapping(pView);
         }
-        
 
-        if (pEngine->onTextChanged) {
-            pEngine->onTextChanged(pEngine);
+        for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+            drte_view_move_cursor_to_character(pView, iCursor, drte_engine__map_character_through_edits(pView->pCursors[iCursor].iCharAbs, editCount, pEdits, pNewEditEnds));
         }
 
-        return DRTE_TRUE;
+        drte_view_dirty(pView, drte_view_get_local_rect(pView));
+        drte_view_end_dirty(pView);
     }
 
-    return DRTE_FALSE;
+    free(pNewEditEnds);
+
+
+    if (pEngine->onTextChanged) {
+        pEngine->onTextChanged(pEngine);
+    }
+
+    return DRTE_TRUE;
 }
 
 
@@ -3115,6 +4350,7 @@ drte_bool32 drte_engine_commit_undo_point(drte_engine* pEngine)
         return DRTE_FALSE;
     }
 
+    drte_uint64 perfBegTime = DRTE_PERF_BEGIN();
 
 
     // The undo buffer needs to be trimmed.
@@ -3191,6 +4427,7 @@ drte_bool32 drte_engine_commit_undo_point(drte_engine* pEngine)
         pEngine->onUndoPointChanged(pEngine, pEngine->iUndoState);
     }
 
+    DRTE_PERF_END(UNDO_COMMIT, perfBegTime);
     return DRTE_TRUE;
 }
 
@@ -3323,7 +4560,9 @@ void drte_engine_step(drte_engine* pEngine, unsigned int milliseconds)
         return;
     }
 
-    if (pEngine->timeToNextCursorBlink < milliseconds)
+    // Stepping by exactly the remaining time needs to switch the blink state so that a timer scheduled with the value
+    // returned by drte_engine_get_time_to_next_cursor_blink() lands on the transition.
+    if (pEngine->timeToNextCursorBlink <= milliseconds)
     {
         pEngine->isCursorBlinkOn = !pEngine->isCursorBlinkOn;
         pEngine->timeToNextCursorBlink = pEngine->cursorBlinkRate;
@@ -3359,10 +4598,10 @@ void drte_view__set_cursors(drte_view* pView, size_t cursorCount, const drte_cur
 {
     assert(pView != NULL);
 
+    pView->_isCursorIndexValid = DRTE_FALSE;
+
     if (cursorCount > 0) {
-        drte_cursor* pNewCursors = (drte_cursor*)realloc(pView->pCursors, cursorCount * sizeof(*pNewCursors));
-        if (pNewCursors != NULL) {
-            pView->pCursors = pNewCursors;
+        if (drte_view__reserve_cursors(pView, cursorCount)) {
             for (size_t iCursor = 0; iCursor < cursorCount; ++iCursor) {
                 pView->pCursors[iCursor] = pCursors[iCursor];
                 drte_view__update_cursor_sticky_position(pView, &pView->pCursors[iCursor]);
@@ -3379,10 +4618,10 @@ void drte_view__set_selections(drte_view* pView, size_t selectionCount, const dr
 {
     assert(pView != NULL);
 
+    pView->_isSelectionIndexValid = DRTE_FALSE;
+
     if (selectionCount > 0) {
-        drte_region* pNewSelections = (drte_region*)realloc(pView->pSelections, selectionCount * sizeof(*pNewSelections));
-        if (pNewSelections != NULL) {
-            pView->pSelections = pNewSelections;
+        if (drte_view__reserve_selections(pView, selectionCount)) {
             for (size_t iSelection = 0; iSelection < selectionCount; ++iSelection) {
                 pView->pSelections[iSelection] = pSelections[iSelection];
             }
@@ -3394,10 +4633,75 @@ void drte_view__set_selections(drte_view* pView, size_t selectionCount, const dr
     }
 }
 
+size_t drte_engine__get_text_change_size(const uint8_t* pData)
+{
+    drte_undo_change_type type = *(drte_undo_change_type*)(pData + 0);
+    size_t iCharBeg = *(size_t*)(pData + sizeof(drte_undo_change_type));
+    size_t iCharEnd = *(size_t*)(pData + sizeof(drte_undo_change_type) + sizeof(size_t));
+
+    size_t sizeInBytes = sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t);
+    if (type == drte_undo_change_type_batch) {
+        sizeInBytes += iCharEnd;    // <-- The payload size for batches.
+    } else {
+        sizeInBytes += (iCharEnd - iCharBeg) + 1;
+    }
+
+    return drte_round_up(sizeInBytes, DRTE_STACK_BUFFER_ALIGNMENT);
+}
+
+// Replays a batch change with a single call to drte_engine_apply_edits(). When undoing, each edit's new text is replaced with
+// its old text, with the positions moved to where they ended up after the batch was applied.
+void drte_engine__apply_batch_change(drte_engine* pEngine, const uint8_t* pData, drte_bool32 isUndoing)
+{
+    size_t headerSize = sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t);
+    size_t editCount = *(size_t*)(pData + sizeof(drte_undo_change_type));
+
+    drte_edit* pEdits = (drte_edit*)malloc(editCount * sizeof(*pEdits));
+    if (pEdits == NULL) {
+        return;
+    }
+
+    const uint8_t* pRanges = pData + headerSize;
+    const char* pOldText = (const char*)(pRanges + editCount * sizeof(size_t)*3);
+
+    // The new texts come after all of the old ones.
+    const char* pNewText = pOldText;
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        size_t range[3];
+        memcpy(range, pRanges + iEdit * sizeof(range), sizeof(range));
+        pNewText += (range[1] - range[0]) + 1;
+    }
+
+    size_t offset = 0;  // How far the text has shifted after the previous edits.
+    for (size_t iEdit = 0; iEdit < editCount; ++iEdit) {
+        size_t range[3];
+        memcpy(range, pRanges + iEdit * sizeof(range), sizeof(range));
+
+        if (isUndoing) {
+            pEdits[iEdit].iCharBeg = range[0] + offset;
+            pEdits[iEdit].iCharEnd = range[0] + offset + range[2];
+            pEdits[iEdit].text     = pOldText;
+        } else {
+            pEdits[iEdit].iCharBeg = range[0];
+            pEdits[iEdit].iCharEnd = range[1];
+            pEdits[iEdit].text     = pNewText;
+        }
+
+        offset    = offset + range[2] - (range[1] - range[0]);
+        pOldText += (range[1] - range[0]) + 1;
+        pNewText += range[2] + 1;
+    }
+
+    drte_engine_apply_edits(pEngine, editCount, pEdits);
+    free(pEdits);
+}
+
 void drte_engine__apply_text_changes_reversed(drte_engine* pEngine, size_t changeCount, const uint8_t* pData)
 {
     // Each item in pData is formatted as:
     //   type, iCharBeg, iCharEnd, text (null terminated).
+    //
+    // or for batches, as described in drte_engine__push_batch_to_prepared_undo_state().
 
     assert(pEngine != NULL);
     assert(pData != NULL);
@@ -3410,13 +4714,14 @@ void drte_engine__apply_text_changes_reversed(drte_engine* pEngine, size_t chang
     size_t iCharBeg = *(size_t*)(pData + sizeof(drte_undo_change_type));
     size_t iCharEnd = *(size_t*)(pData + sizeof(drte_undo_change_type) + sizeof(size_t));
     const char* text = (const char*)(pData + sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t));
-    size_t sizeInBytes = sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t) + (iCharEnd - iCharBeg) + 1;
 
     // We need to do the next changes before doing this one. This is how we do it in reverse.
-    drte_engine__apply_text_changes_reversed(pEngine, changeCount - 1, pData + drte_round_up(sizeInBytes, DRTE_STACK_BUFFER_ALIGNMENT));
+    drte_engine__apply_text_changes_reversed(pEngine, changeCount - 1, pData + drte_engine__get_text_change_size(pData));
 
     // Now we apply the change, remembering to transform inserts into deletes and vice versa.
-    if (type == drte_undo_change_type_insert) {
+    if (type == drte_undo_change_type_batch) {
+        drte_engine__apply_batch_change(pEngine, pData, DRTE_TRUE);
+    } else if (type == drte_undo_change_type_insert) {
         drte_engine_delete_text(pEngine, iCharBeg, iCharEnd);
     } else {
         drte_engine_insert_text(pEngine, text, iCharBeg);
@@ -3427,6 +4732,8 @@ void drte_engine__apply_text_changes(drte_engine* pEngine, size_t changeCount, c
 {
     // Each item in pData is formatted as:
     //   type, iCharBeg, iCharEnd, text (null terminated).
+    //
+    // or for batches, as described in drte_engine__push_batch_to_prepared_undo_state().
 
     assert(pEngine != NULL);
     assert(pData != NULL);
@@ -3436,16 +4743,16 @@ void drte_engine__apply_text_changes(drte_engine* pEngine, size_t changeCount, c
         size_t iCharBeg = *(size_t*)(pData + sizeof(drte_undo_change_type));
         size_t iCharEnd = *(size_t*)(pData + sizeof(drte_undo_change_type) + sizeof(size_t));
         const char* text = (const char*)(pData + sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t));
-        size_t sizeInBytes = sizeof(drte_undo_change_type) + sizeof(size_t) + sizeof(size_t) + (iCharEnd - iCharBeg) + 1;
 
-        // Now we apply the change, remembering to transform inserts into deletes and vice versa.
-        if (type == drte_undo_change_type_insert) {
+        if (type == drte_undo_change_type_batch) {
+            drte_engine__apply_batch_change(pEngine, pData, DRTE_FALSE);
+        } else if (type == drte_undo_change_type_insert) {
             drte_engine_insert_text(pEngine, text, iCharBeg);
         } else {
             drte_engine_delete_text(pEngine, iCharBeg, iCharEnd);
         }
 
-        pData += drte_round_up(sizeInBytes, DRTE_STACK_BUFFER_ALIGNMENT);
+        pData += drte_engine__get_text_change_size(pData);
     }
 }
 
@@ -3616,6 +4923,8 @@ static void drte_view__refresh_word_wrapping(drte_view* pView)
     // When word wrap is enabled we need to recalculate the lines and then repaint. There is no need to do
     // this when word wrap is disabled, but it will need a repaint.
     if (drte_view_is_word_wrap_enabled(pView)) {
+        drte_uint64 perfBegTime = DRTE_PERF_BEGIN();
+
         // Make sure the cache is cleared to begin with.
         drte_line_cache_clear(pView->pWrappedLines);
 
@@ -3678,6 +4987,8 @@ static void drte_view__refresh_word_wrapping(drte_view* pView)
                 drte_line_cache_append_line(pView->pWrappedLines, iLineCharBeg);  // <-- Empty line.
             }
         }
+
+        DRTE_PERF_END(WORD_WRAP, perfBegTime);
     }
 
     // Cursors need to have their sticky positions refreshed.
@@ -3748,6 +5059,10 @@ void drte_view_delete(drte_view* pView)
     }
 
     drte_line_cache_uninit(&pView->_wrappedLines);
+    free(pView->pCursors);
+    free(pView->pSelections);
+    free(pView->_pCursorIndex);
+    free(pView->_pSelectionIndex);
     free(pView);
 }
 
@@ -3853,6 +5168,10 @@ void drte_view_dirty(drte_view* pView, drte_rect rect)
         return;
     }
 
+    // Anything that changes the layout of the text dirties the view, so this is where the cached line of the rectangle selection
+    // is invalidated.
+    pView->_isRectSelectionCacheValid = DRTE_FALSE;
+
     drte_view_begin_dirty(pView);
     pView->_accumulatedDirtyRect = drte_rect_union(pView->_accumulatedDirtyRect, rect);
     drte_view_end_dirty(pView);
@@ -3881,6 +5200,8 @@ void drte_view_paint(drte_view* pView, drte_rect rect, void* pPaintData)
         return;
     }
 
+    drte_uint64 perfBegTime = DRTE_PERF_BEGIN();
+
     float lineHeight = drte_engine_get_line_height(pView->pEngine);
 
 
@@ -3986,10 +5307,40 @@ void drte_view_paint(drte_view* pView, drte_rect rect, void* pPaintData)
     }
 
 
-    // Cursors.
+    // Cursors. Only those within the visible lines are painted which we find with the cursor index.
     if (drte_view_is_showing_cursors(pView) && pView->pEngine->isCursorBlinkOn && pView->pEngine->styles[pView->pEngine->cursorStyleSlot].styleToken != 0) {
-        for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
-            pView->pEngine->onPaintRect(pView->pEngine, pView, pView->pEngine->styles[pView->pEngine->cursorStyleSlot].styleToken, drte_view_get_cursor_rect(pView, iCursor), pPaintData);
+        size_t iVisibleCharBeg;
+        size_t iVisibleCharEnd;
+        drte_view_get_line_character_range(pView, pView->pWrappedLines, iLineTop, &iVisibleCharBeg, NULL);
+        drte_view_get_line_character_range(pView, pView->pWrappedLines, iLineBottom, NULL, &iVisibleCharEnd);
+        if (iLineBottom+1 >= drte_view_get_line_count(pView)) {
+            iVisibleCharEnd = (size_t)-1;   // <-- Always include cursors at the end of the text.
+        }
+
+        drte_view__update_cursor_index(pView);
+        for (size_t iEntry = drte_index__find_first_entry_at_or_after(pView->_pCursorIndex, pView->cursorCount, iVisibleCharBeg); iEntry < pView->cursorCount; ++iEntry) {
+            if (pView->_pCursorIndex[iEntry].iChar > iVisibleCharEnd) {
+                break;
+            }
+
+            pView->pEngine->onPaintRect(pView->pEngine, pView, pView->pEngine->styles[pView->pEngine->cursorStyleSlot].styleToken, drte_view_get_cursor_rect(pView, pView->_pCursorIndex[iEntry].index), pPaintData);
+        }
+
+        // The rectangle selection has a cursor at the end of each line. Only the visible lines need to be considered.
+        if (pView->hasRectSelection && pView->rectSelectionLineBeg <= iLineBottom && pView->rectSelectionLineEnd >= iLineTop) {
+            size_t iRectLineBeg = drte_max(pView->rectSelectionLineBeg, iLineTop);
+            size_t iRectLineEnd = drte_min(pView->rectSelectionLineEnd, iLineBottom);
+            for (size_t iLine = iRectLineBeg; iLine <= iRectLineEnd; ++iLine) {
+                drte_region region;
+                if (drte_view__get_rect_selection_on_line(pView, iLine, &region)) {
+                    float cursorPosX;
+                    drte_view_get_character_position(pView, pView->pWrappedLines, region.iCharEnd, &cursorPosX, NULL);
+
+                    float cursorPosY = drte_view_get_line_pos_y(pView, iLine);
+                    drte_rect cursorRect = drte_make_rect(cursorPosX + pView->innerOffsetX, cursorPosY + pView->innerOffsetY, cursorPosX + pView->innerOffsetX + pView->cursorWidth, cursorPosY + pView->innerOffsetY + lineHeight);
+                    pView->pEngine->onPaintRect(pView->pEngine, pView, pView->pEngine->styles[pView->pEngine->cursorStyleSlot].styleToken, cursorRect, pPaintData);
+                }
+            }
         }
     }
 
@@ -4004,6 +5355,8 @@ void drte_view_paint(drte_view* pView, drte_rect rect, void* pPaintData)
         tailRect.bottom = pView->sizeY;
         pView->pEngine->onPaintRect(pView->pEngine, pView, pView->pEngine->styles[pView->pEngine->defaultStyleSlot].styleToken, tailRect, pPaintData);
     }
+
+    DRTE_PERF_END(VIEW_PAINT, perfBegTime);
 }
 
 void drte_view_paint_line_numbers(drte_view* pView, float lineNumbersWidth, float lineNumbersHeight, drte_engine_on_paint_text_proc onPaintText, drte_engine_on_paint_rect_proc onPaintRect, void* pPaintData)
@@ -4622,12 +5975,12 @@ size_t drte_view_insert_cursor(drte_view* pView, size_t iChar)
         return (size_t)-1;
     }
 
-    drte_cursor* pNewCursors = (drte_cursor*)realloc(pView->pCursors, (pView->cursorCount+1) * sizeof(*pNewCursors));
-    if (pNewCursors == NULL) {
+    if (!drte_view__reserve_cursors(pView, pView->cursorCount+1)) {
         return (size_t)-1;
     }
 
-    pView->pCursors = pNewCursors;
+    drte_bool32 wasIndexValid = pView->_isCursorIndexValid;
+
     pView->pCursors[pView->cursorCount].iCharAbs = 0;
     pView->pCursors[pView->cursorCount].iLine = 0;
     pView->pCursors[pView->cursorCount].absoluteSickyPosX = 0;
@@ -4635,6 +5988,7 @@ size_t drte_view_insert_cursor(drte_view* pView, size_t iChar)
 
     drte_view_begin_dirty(pView);
         drte_view_move_cursor_to_character(pView, pView->cursorCount-1, iChar);
+        drte_view__on_cursor_appended(pView, wasIndexValid);
         drte_view__repaint(pView);
     drte_view_end_dirty(pView);
 
@@ -4658,6 +6012,12 @@ void drte_view_remove_cursor(drte_view* pView, size_t cursorIndex)
         return;
     }
 
+    // Removing the last cursor is the common case and does not require the index to be rebuilt so long as it's also the last
+    // cursor in the index.
+    if (cursorIndex != pView->cursorCount-1 || !pView->_isCursorIndexValid || pView->_pCursorIndex[cursorIndex].index != cursorIndex) {
+        pView->_isCursorIndexValid = DRTE_FALSE;
+    }
+
     for (size_t i = cursorIndex; i < pView->cursorCount-1; ++i) {
         pView->pCursors[i] = pView->pCursors[i+1];
     }
@@ -4666,22 +6026,60 @@ void drte_view_remove_cursor(drte_view* pView, size_t cursorIndex)
     drte_view__repaint(pView);
 }
 
+drte_bool32 drte_view_find_cursor_at_character(drte_view* pView, size_t iChar, size_t* pCursorIndexOut)
+{
+    if (pView == NULL) {
+        return DRTE_FALSE;
+    }
+
+    drte_view__update_cursor_index(pView);
+
+    size_t iEntry = drte_index__find_first_entry_at_or_after(pView->_pCursorIndex, pView->cursorCount, iChar);
+    if (iEntry < pView->cursorCount && pView->_pCursorIndex[iEntry].iChar == iChar) {
+        if (pCursorIndexOut) *pCursorIndexOut = pView->_pCursorIndex[iEntry].index;
+        return DRTE_TRUE;
+    }
+
+    return DRTE_FALSE;
+}
+
 void drte_view_remove_overlapping_cursors(drte_view* pView)
 {
     if (pView == NULL || pView->cursorCount == 0) {
         return;
     }
 
-    drte_view_begin_dirty(pView);
-    for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
-        for (size_t jCursor = iCursor+1; jCursor < pView->cursorCount; ++jCursor) {
-            if (pView->pCursors[iCursor].iCharAbs == pView->pCursors[jCursor].iCharAbs) {
-                drte_view_remove_cursor(pView, jCursor);
-                break;
+    // Overlapping cursors are next to each other in the index, with the earliest one first. The earliest one is kept.
+    drte_view__update_cursor_index(pView);
+
+    uint8_t* pIsRemoved = (uint8_t*)calloc(pView->cursorCount, sizeof(*pIsRemoved));
+    if (pIsRemoved == NULL) {
+        return;
+    }
+
+    drte_bool32 isAnythingRemoved = DRTE_FALSE;
+    for (size_t iEntry = 1; iEntry < pView->cursorCount; ++iEntry) {
+        if (pView->_pCursorIndex[iEntry].iChar == pView->_pCursorIndex[iEntry-1].iChar) {
+            pIsRemoved[pView->_pCursorIndex[iEntry].index] = 1;
+            isAnythingRemoved = DRTE_TRUE;
+        }
+    }
+
+    if (isAnythingRemoved) {
+        size_t newCursorCount = 0;
+        for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+            if (!pIsRemoved[iCursor]) {
+                pView->pCursors[newCursorCount++] = pView->pCursors[iCursor];
             }
         }
+
+        pView->cursorCount = newCursorCount;
+        pView->_isCursorIndexValid = DRTE_FALSE;
+
+        drte_view__repaint(pView);
     }
-    drte_view_end_dirty(pView);
+
+    free(pIsRemoved);
 }
 
 size_t drte_view_get_last_cursor(drte_view* pView)
@@ -4732,6 +6130,7 @@ drte_bool32 drte_view_move_cursor_to_point(drte_view* pView, size_t cursorIndex,
 
     size_t iPrevChar = pView->pCursors[cursorIndex].iCharAbs;
 
+    pView->_isCursorIndexValid = DRTE_FALSE;
     pView->pCursors[cursorIndex].iCharAbs = 0;
     pView->pCursors[cursorIndex].iLine = 0;
     pView->pCursors[cursorIndex].absoluteSickyPosX = 0;
@@ -4760,6 +6159,8 @@ drte_bool32 drte_view_move_cursor_to_point_relative_to_text(drte_view* pView, si
         return DRTE_FALSE;
     }
 
+    pView->_isCursorIndexValid = DRTE_FALSE;
+
     size_t iLine = drte_view_get_line_at_pos_y(pView, pView->pWrappedLines, posYRelativeToText);
     pView->pCursors[cursorIndex].iLine = iLine;
 
@@ -4834,6 +6235,8 @@ drte_bool32 drte_view_move_cursor_left(drte_view* pView, size_t cursorIndex)
         return DRTE_FALSE;   // Already at the start of the string. Nowhere to go.
     }
 
+    pView->_isCursorIndexValid = DRTE_FALSE;
+
     size_t iPrevChar = pView->pCursors[cursorIndex].iCharAbs;
     size_t iPrevLine = pView->pCursors[cursorIndex].iLine;
 
@@ -4843,13 +6246,13 @@ drte_bool32 drte_view_move_cursor_left(drte_view* pView, size_t cursorIndex)
         if (iLineCharBeg == iPrevChar) {
             drte_view_move_cursor_to_end_of_line_by_index(pView, cursorIndex, iPrevLine-1);
             if (pView->pCursors[cursorIndex].iCharAbs == iPrevChar) {
-                pView->pCursors[cursorIndex].iCharAbs -= 1;
+                pView->pCursors[cursorIndex].iCharAbs = drte_engine_get_prev_character(pView->pEngine, iPrevChar);
             }
         } else {
-            pView->pCursors[cursorIndex].iCharAbs -= 1;
+            pView->pCursors[cursorIndex].iCharAbs = drte_engine_get_prev_character(pView->pEngine, iPrevChar);
         }
     } else {
-        pView->pCursors[cursorIndex].iCharAbs -= 1;
+        pView->pCursors[cursorIndex].iCharAbs = drte_engine_get_prev_character(pView->pEngine, iPrevChar);
     }
 
     if (iPrevChar != pView->pCursors[cursorIndex].iCharAbs || iPrevLine != pView->pCursors[cursorIndex].iLine) {
@@ -4875,6 +6278,8 @@ drte_bool32 drte_view_move_cursor_right(drte_view* pView, size_t cursorIndex)
         return DRTE_FALSE;   // Already at the end. Nowhere to go.
     }
 
+    pView->_isCursorIndexValid = DRTE_FALSE;
+
     size_t iPrevChar = pView->pCursors[cursorIndex].iCharAbs;
     size_t iPrevLine = pView->pCursors[cursorIndex].iLine;
 
@@ -4884,10 +6289,10 @@ drte_bool32 drte_view_move_cursor_right(drte_view* pView, size_t cursorIndex)
         if (iLineCharEnd == iPrevChar) {
             drte_view_move_cursor_to_start_of_line_by_index(pView, cursorIndex, iPrevLine+1);
         } else {
-            pView->pCursors[cursorIndex].iCharAbs += 1;
+            pView->pCursors[cursorIndex].iCharAbs = drte_engine_get_next_character(pView->pEngine, iPrevChar);
         }
     } else {
-        pView->pCursors[cursorIndex].iCharAbs += 1;
+        pView->pCursors[cursorIndex].iCharAbs = drte_engine_get_next_character(pView->pEngine, iPrevChar);
     }
 
     if (iPrevChar != pView->pCursors[cursorIndex].iCharAbs || iPrevLine != pView->pCursors[cursorIndex].iLine) {
@@ -5115,6 +6520,10 @@ void drte_view_move_cursor_to_character_and_line(drte_view* pView, size_t cursor
     size_t iPrevChar = pView->pCursors[cursorIndex].iCharAbs;
     size_t iPrevLine = pView->pCursors[cursorIndex].iLine;
 
+    if (iPrevChar != iChar) {
+        pView->_isCursorIndexValid = DRTE_FALSE;
+    }
+
     pView->pCursors[cursorIndex].iCharAbs = iChar;
     pView->pCursors[cursorIndex].iLine = iLine;
 
@@ -5314,6 +6723,8 @@ void drte_view_deselect_all(drte_view* pView)
     }
 
     pView->selectionCount = 0;
+    pView->_isSelectionIndexValid = DRTE_TRUE;  // <-- An empty index is always valid.
+    pView->hasRectSelection = DRTE_FALSE;
 
     drte_view_dirty(pView, drte_view_get_local_rect(pView));
 }
@@ -5452,15 +6863,15 @@ void drte_view_begin_selection(drte_view* pView, size_t iCharBeg)
         return;
     }
 
-    drte_region* pNewSelections = (drte_region*)realloc(pView->pSelections, (pView->selectionCount + 1) * sizeof(*pNewSelections));
-    if (pNewSelections == NULL) {
+    if (!drte_view__reserve_selections(pView, pView->selectionCount + 1)) {
         return;
     }
 
-    pView->pSelections = pNewSelections;
     pView->pSelections[pView->selectionCount].iCharBeg = iCharBeg;
     pView->pSelections[pView->selectionCount].iCharEnd = iCharBeg;
     pView->selectionCount += 1;
+
+    drte_view__on_last_selection_changed(pView, DRTE_TRUE);
 }
 
 void drte_view_cancel_selection(drte_view* pView, size_t iSelection)
@@ -5474,6 +6885,7 @@ void drte_view_cancel_selection(drte_view* pView, size_t iSelection)
     }
 
     pView->selectionCount -= 1;
+    pView->_isSelectionIndexValid = DRTE_FALSE;
 }
 
 void drte_view_cancel_last_selection(drte_view* pView)
@@ -5482,6 +6894,10 @@ void drte_view_cancel_last_selection(drte_view* pView)
         return;
     }
 
+    if (pView->_isSelectionIndexValid && pView->_pSelectionIndex[pView->selectionCount-1].index != pView->selectionCount-1) {
+        pView->_isSelectionIndexValid = DRTE_FALSE;
+    }
+
     pView->selectionCount -= 1;
 }
 
@@ -5493,6 +6909,7 @@ void drte_view_set_selection_anchor(drte_view* pView, size_t iCharBeg)
 
     if (pView->pSelections[pView->selectionCount-1].iCharBeg != iCharBeg) {
         pView->pSelections[pView->selectionCount-1].iCharBeg = iCharBeg;
+        drte_view__on_last_selection_changed(pView, DRTE_FALSE);
         drte_view__repaint(pView);
     }
 }
@@ -5505,6 +6922,7 @@ void drte_view_set_selection_end_point(drte_view* pView, size_t iCharEnd)
 
     if (pView->pSelections[pView->selectionCount-1].iCharEnd != iCharEnd) {
         pView->pSelections[pView->selectionCount-1].iCharEnd = iCharEnd;
+        drte_view__on_last_selection_changed(pView, DRTE_FALSE);
         drte_view__repaint(pView);
     }
 }
@@ -5531,15 +6949,60 @@ drte_bool32 drte_view_get_selection_under_point(drte_view* pView, float posX, fl
         return DRTE_FALSE;
     }
 
-    for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
-        drte_region selection = drte_region_normalize(pView->pSelections[iSelection]);
-        if (iChar >= selection.iCharBeg && iChar < selection.iCharEnd) {
-            if (piSelectionOut) *piSelectionOut = iSelection;
-            return DRTE_TRUE;
-        }
+    return drte_view__find_selection_containing_character(pView, iChar, piSelectionOut);
+}
+
+void drte_view_set_rect_selection(drte_view* pView, size_t iLineBeg, size_t iLineEnd, float posXBeg, float posXEnd)
+{
+    if (pView == NULL) {
+        return;
     }
 
-    return DRTE_FALSE;
+    pView->hasRectSelection = DRTE_TRUE;
+    pView->rectSelectionLineBeg = drte_min(iLineBeg, iLineEnd);
+    pView->rectSelectionLineEnd = drte_max(iLineBeg, iLineEnd);
+    pView->rectSelectionPosXBeg = drte_min(posXBeg, posXEnd);
+    pView->rectSelectionPosXEnd = drte_max(posXBeg, posXEnd);
+
+    drte_view_dirty(pView, drte_view_get_local_rect(pView));
+}
+
+void drte_view_clear_rect_selection(drte_view* pView)
+{
+    if (pView == NULL || !pView->hasRectSelection) {
+        return;
+    }
+
+    pView->hasRectSelection = DRTE_FALSE;
+    drte_view_dirty(pView, drte_view_get_local_rect(pView));
+}
+
+drte_bool32 drte_view_has_rect_selection(drte_view* pView)
+{
+    if (pView == NULL) {
+        return DRTE_FALSE;
+    }
+
+    return pView->hasRectSelection;
+}
+
+drte_bool32 drte_view_get_rect_selection_on_line(drte_view* pView, size_t iLine, size_t* piCharBegOut, size_t* piCharEndOut)
+{
+    if (piCharBegOut) *piCharBegOut = 0;
+    if (piCharEndOut) *piCharEndOut = 0;
+
+    if (pView == NULL) {
+        return DRTE_FALSE;
+    }
+
+    drte_region region;
+    if (!drte_view__get_rect_selection_on_line(pView, iLine, &region)) {
+        return DRTE_FALSE;
+    }
+
+    if (piCharBegOut) *piCharBegOut = region.iCharBeg;
+    if (piCharEndOut) *piCharEndOut = region.iCharEnd;
+    return DRTE_TRUE;
 }
 
 
@@ -5573,22 +7036,10 @@ drte_bool32 drte_view_insert_character_at_cursors(drte_view* pView, unsigned int
         return DRTE_FALSE;
     }
 
-    // TODO: This can be improved because it is posting multiple onTextChanged messages.
-
-    drte_bool32 wasTextChanged = DRTE_FALSE;
-    drte_view_begin_dirty(pView);
-    {
-        for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
-            if (!drte_view_insert_character_at_cursor(pView, iCursor, character)) {
-                continue;
-            } else {
-                wasTextChanged = DRTE_TRUE;
-            }
-        }
-    }
-    drte_view_end_dirty(pView);
+    char utf8[16];
+    utf8[drte_utf8_encode(character, utf8)] = '\0';
 
-    return wasTextChanged;
+    return drte_view_insert_text_at_cursors(pView, utf8);
 }
 
 drte_bool32 drte_view_insert_text_at_cursor(drte_view* pView, size_t cursorIndex, const char* text)
@@ -5613,6 +7064,59 @@ drte_bool32 drte_view_insert_text_at_cursor(drte_view* pView, size_t cursorIndex
     return DRTE_TRUE;
 }
 
+int drte_view__compare_edits(const void* a, const void* b)
+{
+    const drte_edit* pEditA = (const drte_edit*)a;
+    const drte_edit* pEditB = (const drte_edit*)b;
+
+    if (pEditA->iCharBeg < pEditB->iCharBeg) {
+        return -1;
+    }
+    if (pEditA->iCharBeg > pEditB->iCharBeg) {
+        return 1;
+    }
+
+    return 0;
+}
+
+drte_bool32 drte_view_insert_text_at_cursors(drte_view* pView, const char* text)
+{
+    if (pView == NULL || text == NULL || pView->cursorCount == 0) {
+        return DRTE_FALSE;
+    }
+
+    // Cursors are not stored in any particular order, but edits need to be sorted.
+    drte_edit* pEdits = (drte_edit*)malloc(pView->cursorCount * sizeof(*pEdits));
+    if (pEdits == NULL) {
+        return DRTE_FALSE;
+    }
+
+    for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+        pEdits[iCursor].iCharBeg = pView->pCursors[iCursor].iCharAbs;
+        pEdits[iCursor].iCharEnd = pView->pCursors[iCursor].iCharAbs;
+        pEdits[iCursor].text     = text;
+    }
+
+    qsort(pEdits, pView->cursorCount, sizeof(*pEdits), drte_view__compare_edits);
+
+    drte_bool32 wasTextChanged;
+    drte_view_begin_dirty(pView);
+    {
+        wasTextChanged = drte_engine_apply_edits(pView->pEngine, pView->cursorCount, pEdits);
+        if (wasTextChanged) {
+            // The cursor's sticky position needs to be updated whenever the text is edited.
+            for (size_t iCursor = 0; iCursor < pView->cursorCount; ++iCursor) {
+                drte_view__update_cursor_sticky_position(pView, &pView->pCursors[iCursor]);
+                drte_engine__on_cursor_move(pView->pEngine, pView, iCursor);
+            }
+        }
+    }
+    drte_view_end_dirty(pView);
+
+    free(pEdits);
+    return wasTextChanged;
+}
+
 drte_bool32 drte_view_delete_character_to_left_of_cursor(drte_view* pView, size_t cursorIndex)
 {
     if (pView == NULL) {
@@ -5671,7 +7175,7 @@ drte_bool32 drte_view_delete_character_to_right_of_cursor(drte_view* pView, size
     size_t iCharBeg = pView->pCursors[cursorIndex].iCharAbs;
     if (iCharBeg < pView->pEngine->textLength)
     {
-        size_t iCharEnd = iCharBeg+1;
+        size_t iCharEnd = drte_engine_get_next_character(pView->pEngine, iCharBeg);
         if (pView->pEngine->text[iCharBeg] == '\r' && pView->pEngine->text[iCharEnd] == '\n') {
             iCharEnd += 1;  // It's a \r\n line ending.
         }
@@ -5733,15 +7237,42 @@ drte_bool32 drte_view_delete_selected_text(drte_view* pView)
         return DRTE_FALSE;
     }
 
+    // All selections are deleted as a single batch. The selection index gives us the selections in order, but they may still
+    // overlap in which case they need to be merged since drte_engine_apply_edits() does not allow overlapping edits.
+    drte_edit* pEdits = (drte_edit*)malloc(pView->selectionCount * sizeof(*pEdits));
+    if (pEdits == NULL) {
+        return DRTE_FALSE;
+    }
+
+    drte_view__update_selection_index(pView);
+
+    size_t editCount = 0;
+    for (size_t iEntry = 0; iEntry < pView->selectionCount; ++iEntry) {
+        drte_region selection = drte_region_normalize(pView->pSelections[pView->_pSelectionIndex[iEntry].index]);
+        if (selection.iCharBeg == selection.iCharEnd) {
+            continue;   // Nothing is selected.
+        }
+
+        if (editCount > 0 && selection.iCharBeg <= pEdits[editCount-1].iCharEnd) {
+            pEdits[editCount-1].iCharEnd = drte_max(pEdits[editCount-1].iCharEnd, selection.iCharEnd);
+        } else {
+            pEdits[editCount].iCharBeg = selection.iCharBeg;
+            pEdits[editCount].iCharEnd = selection.iCharEnd;
+            pEdits[editCount].text     = NULL;
+            editCount += 1;
+        }
+    }
+
     drte_bool32 wasTextChanged = DRTE_FALSE;
-    drte_view_begin_dirty(pView);
-    {
-        for (size_t iSelection = 0; iSelection < pView->selectionCount; ++iSelection) {
-            wasTextChanged = drte_view_delete_selection_text(pView, iSelection) || wasTextChanged;
+    if (editCount > 0) {
+        drte_view_begin_dirty(pView);
+        {
+            wasTextChanged = drte_engine_apply_edits(pView->pEngine, editCount, pEdits);
         }
+        drte_view_end_dirty(pView);
     }
-    drte_view_end_dirty(pView);
 
+    free(pEdits);
     return wasTextChanged;
 }
 